@@ -1,11 +1,13 @@
 /*
- * Muon-jet filter:
+ * Muon-jet filter (defaults):
+ * - muons from a1 (36) or dark photon (3000022) decays, see motherPdgIds
  * - 2 muons in barrel
  * - 2 muons in endcap
  * - endcap muon pT > 10GeV
  */
 
 // system include files
+#include <cstdlib>
 #include <memory>
 #include <vector>
 
@@ -16,6 +18,7 @@
 #include "FWCore/Framework/interface/MakerMacros.h"
 #include "FWCore/ParameterSet/interface/ParameterSet.h"
 #include "DataFormats/HepMCCandidate/interface/GenParticle.h"
+#include "GEMCode/GEMValidation/interface/GenParticleAncestry.h"
 
 using namespace edm;
 
@@ -27,10 +30,30 @@ class MuJetFilter : public edm::EDFilter {
    private:
       virtual bool filter(edm::Event&, const edm::EventSetup&);
       virtual void endJob() ;
+
+      edm::InputTag input_;
+      // muons are kept if a non-muon mother of their muon chain has one of these pdgIds
+      std::vector<int> motherPdgIds_;
+      double barrelMaxEta_;
+      double endcapMinEta_;
+      double endcapMaxEta_;
+      double endcapMinPt_;
+      int minNBarrel_;
+      int minNEndcap_;
 };
 
 MuJetFilter::MuJetFilter(const edm::ParameterSet& iConfig)
 {
+  // defaults: a1 (36) or dark photon (3000022) muons, 2 in the barrel and 2 in the endcap with pT > 10 GeV
+  const std::vector<int> defaultPdgIds {36, 3000022};
+  input_ = iConfig.getUntrackedParameter<edm::InputTag>("genParticles", edm::InputTag("genParticles"));
+  motherPdgIds_ = iConfig.getUntrackedParameter<std::vector<int> >("motherPdgIds", defaultPdgIds);
+  barrelMaxEta_ = iConfig.getUntrackedParameter<double>("barrelMaxEta", 1.1);
+  endcapMinEta_ = iConfig.getUntrackedParameter<double>("endcapMinEta", 1.1);
+  endcapMaxEta_ = iConfig.getUntrackedParameter<double>("endcapMaxEta", 2.4);
+  endcapMinPt_ = iConfig.getUntrackedParameter<double>("endcapMinPt", 10.);
+  minNBarrel_ = iConfig.getUntrackedParameter<int>("minNBarrel", 2);
+  minNEndcap_ = iConfig.getUntrackedParameter<int>("minNEndcap", 2);
 }
 
 
@@ -43,58 +66,28 @@ bool MuJetFilter::filter(edm::Event& iEvent, const edm::EventSetup& iSetup)
   using namespace edm;
   
   Handle<reco::GenParticleCollection> genParticles;
-  iEvent.getByLabel("genParticles", genParticles);
-  
-  std::vector<const reco::GenParticle*> genMuons;
-  std::vector<const reco::Candidate*>   genMuonMothers;
-  // Loop over all gen particles
-  int counterGenParticle = 0;
-  for(auto iGenParticle = genParticles->begin();  iGenParticle != genParticles->end();  ++iGenParticle) {
-    counterGenParticle++;
-    //    std::cout << counterGenParticle << " " << iGenParticle->status() << " " << iGenParticle->pdgId() << " " << iGenParticle->vx() << " " << iGenParticle->vy() << " " << iGenParticle->vz() << std::endl;
-    // Check if gen particle is muon (pdgId = +/-13) and stable (status = 1)
-    if (fabs(iGenParticle->pdgId()) == 13 && iGenParticle->status() == 1) {
-      // Mother of the muon can be muon. Find the last muon in this chain: genMuonCand
-      // Example: a1 -> mu+ (status = 3) mu- (status = 3)
-      //          mu- (status = 3) -> mu- (status = 2) -> mu- (status = 1)
-      const reco::Candidate *genMuonCand = &(*iGenParticle);
-      bool isMuonMother = true;
-      while(isMuonMother) {
-        isMuonMother = false;
-        for ( size_t iMother = 0; iMother < genMuonCand->numberOfMothers(); iMother++ ) {
-          if ( fabs( genMuonCand->mother(iMother)->pdgId() ) == 13 ) {
-            isMuonMother = true;
-            genMuonCand = genMuonCand->mother(iMother);
-          }
-        }
-      }
-      // Loop over all real (non-muon) mothers of the muon (here we use genMuonCand)
-      for ( size_t iMother = 0; iMother < genMuonCand->numberOfMothers(); iMother++ ) {
-        // Check if mother is CP-odd Higgs (PdgId = 36) or gamma_Dark (PdgId = 3000022)
-        //        if ( genMuonCand->mother(iMother)->pdgId() == 36 || genMuonCand->mother(iMother)->pdgId() == 3000022 || genMuonCand->mother(iMother)->pdgId() == 443 ) {
-        if ( genMuonCand->mother(iMother)->pdgId() == 36 || genMuonCand->mother(iMother)->pdgId() == 3000022 ) {
-          // Store the muon (stable, first in chain) into vector
-          genMuons.push_back(&(*iGenParticle));
-          // Store mother of the muon into vector. We need this to group muons into dimuons later
-          genMuonMothers.push_back(genMuonCand->mother(iMother));
-        }
-      }
-    }
-  }
-  
-  // 2 muons in barrel, 2 muons in endcap
+  iEvent.getByLabel(input_, genParticles);
+  // built once for this event; the muon chains and their mothers come from the index
+  const GenParticleAncestry ancestry(*genParticles);
+
+  // single pass over the stable muons
   int nMuBarrel = 0;
   int nMuEndcap = 0;
   int nMuEndcapPTok = 0;
-  for (auto muon: genMuons) {
-    const float eta(fabs(muon->eta()));
-    if (eta < 1.1) nMuBarrel++;
-    if (eta > 1.1 and eta < 2.4){ 
+  for (unsigned int i = 0; i < ancestry.size(); ++i) {
+    const reco::GenParticle& muon(ancestry.particle(i));
+    if (std::abs(muon.pdgId()) != 13 or muon.status() != 1) continue;
+    if (ancestry.ancestorWithPdgId(i, motherPdgIds_) < 0) continue;
+
+    const float eta(fabs(muon.eta()));
+    if (eta < barrelMaxEta_) nMuBarrel++;
+    if (eta > endcapMinEta_ and eta < endcapMaxEta_){ 
       nMuEndcap++;
-      if (muon->pt() > 10) nMuEndcapPTok++;
+      if (muon.pt() > endcapMinPt_) nMuEndcapPTok++;
     }
+    if (nMuBarrel>=minNBarrel_ and nMuEndcap>=minNEndcap_ and nMuEndcapPTok>=minNEndcap_) return true;
   }
-  return nMuBarrel>=2 and nMuEndcap>=2 and nMuEndcapPTok>=2;
+  return false;
 }
 
 void MuJetFilter::endJob() 
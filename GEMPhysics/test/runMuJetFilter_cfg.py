@@ -19,7 +19,10 @@ process.USER = cms.OutputModule("PoolOutputModule",
     fileName = cms.untracked.string('out_genfilter.root')
 )
 
-process.muJetFilter = cms.EDFilter('MuJetFilter')
+process.muJetFilter = cms.EDFilter('MuJetFilter',
+    motherPdgIds = cms.untracked.vint32(36, 3000022),
+    endcapMinPt = cms.untracked.double(10.),
+)
 
 process.p = cms.Path(process.muJetFilter)
 
@@ -87,6 +87,7 @@ public:
   const DTGeometry* getDTGeometry() const {return dtGeometry_;}
 
   double phiHeavyCorr(double pt, double eta, double phi, double charge) const;
+  /// GEM-CSC bending angle cut with the default ME11GEMdPhi/ME21GEMdPhi tables, see GEMCSCdPhiLUT
   bool passDPhicut(CSCDetId id, int chargesign, float dphi, float pt) const;
 
  protected:
@@ -91,6 +91,14 @@ public:
 
   bool checkStubInChamber(CSCDetId id, CSCCorrelatedLCTDigi lct) const;
 
+  /// valid (MP)LCTs of a chamber in [minBX, maxBX], plus the ghost combinations
+  /// of two stubs in the same BX when addGhosts is set; source[i] is the position
+  /// in cscLcts of the stub digis[i] was made from
+  static void collectLCTsInChamber(unsigned int id, const CSCCorrelatedLCTDigiCollection& lcts,
+                                   int minBX, int maxBX, bool addGhosts,
+                                   DigiContainer& digis, CSCCorrelatedLCTDigiContainer& cscLcts,
+                                   std::vector<int>& source);
+
 private:
 
   void matchCLCTsToSimTrack(const CSCCLCTDigiCollection&);
@@ -98,6 +106,9 @@ private:
   void matchLCTsToSimTrack(const CSCCorrelatedLCTDigiCollection&);
   void matchMPLCTsToSimTrack(const CSCCorrelatedLCTDigiCollection&);
 
+  // half-strip expected for the simtrack in a chamber, used by the ALCT-GEM and ALCT-RPC pairings
+  float trackHalfStripInChamber(unsigned int id) const;
+
   const CSCDigiMatcher* digi_matcher_;
   const GEMDigiMatcher* gem_digi_matcher_;
   const RPCDigiMatcher* rpc_digi_matcher_;
@@ -9,12 +9,14 @@
 */
 
 #include "GEMCode/GEMValidation/interface/BaseMatcher.h"
+#include "GEMCode/GEMValidation/interface/GenParticleAncestry.h"
 #include "DataFormats/Math/interface/deltaR.h"
 #include "DataFormats/Math/interface/deltaPhi.h"
 #include "DataFormats/Math/interface/normalizedPhi.h"
 #include "DataFormats/Math/interface/LorentzVector.h"
 #include "DataFormats/GeometryVector/interface/GlobalPoint.h"
 
+#include <memory>
 #include <vector>
 #include <map>
 #include <set>
@@ -23,11 +25,17 @@ class DisplacedGENMuonMatcher : public BaseMatcher
 {
 public:
   
+  /// ancestry: gen particle index of the event, see eventAncestry; built by the matcher if null
   DisplacedGENMuonMatcher(const SimTrack& t, const SimVertex& v,
-      const edm::ParameterSet& ps, const edm::Event& ev, const edm::EventSetup& es);
+      const edm::ParameterSet& ps, const edm::Event& ev, const edm::EventSetup& es,
+      const GenParticleAncestry* ancestry = nullptr);
   
   ~DisplacedGENMuonMatcher();
 
+  /// gen particle index of the event, to be built once per event by the module and
+  /// passed to the matchers of all its SimTracks; null if displacedGenMu is not run
+  static std::unique_ptr<GenParticleAncestry> eventAncestry(const edm::ParameterSet& ps, const edm::Event& ev);
+
   const reco::GenParticle* getMatchedGENMuon() const {return matchedGENMuon_;} 
   std::vector<const reco::GenParticle*> getMatchedGENMuons() const {return matchedGENMuons_;}
   const reco::GenParticle* getMatchedDarkBoson() const {return matchedDarkBoson_;}
@@ -46,7 +54,10 @@ private:
   int verbose_;
   bool run_;
  
-  void matchDisplacedGENMuonMatcherToSimTrack(const reco::GenParticleCollection& genParticles);
+  // muons are kept if a non-muon mother of their muon chain has one of these pdgIds (default a1 and dark photon)
+  std::vector<int> motherPdgIds_;
+ 
+  void matchDisplacedGENMuonMatcherToSimTrack(const GenParticleAncestry& ancestry);
 
   /* bool PtOrder (const reco::GenParticle* p1, const reco::GenParticle* p2); */
   double dxy(double px, double py, double vx, double vy, double pt);
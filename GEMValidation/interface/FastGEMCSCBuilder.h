@@ -107,6 +107,9 @@ public:
 
   void build(const SimHitMatcher& match_sh);
 
+  /// straight line x(z), y(z) through the SimHit positions of a chamber
+  void fitStub(SimStub& stub, const std::vector<GlobalPoint>& points);
+
   std::vector<unsigned int> getChamberIds();
   std::vector<SimStub>& getStubs(unsigned int det_id) {return stubs_map_[det_id];}
 
@@ -126,6 +129,9 @@ private:
 
   const CSCGeometry* csc_geo_;
 
+  // SimHit positions of the chamber being built
+  std::vector<GlobalPoint> points_;
+
   std::map<unsigned int, std::vector<SimStub> > stubs_map_;
 };
 
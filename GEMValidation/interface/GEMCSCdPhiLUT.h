@@ -0,0 +1,132 @@
+#ifndef GEMCode_GEMValidation_GEMCSCdPhiLUT_h
+#define GEMCode_GEMValidation_GEMCSCdPhiLUT_h
+
+/**\class GEMCSCdPhiLUT
+
+ Description: GEM-CSC bending angle cuts as a flat lookup table
+
+ The cuts are stored as [station][eta partition][pT bin][parity] and the pT
+ and eta bins are found by counting thresholds instead of scanning the table
+ on every call. Every station has its own eta partitions (GE1/1 and GE2/1 are
+ not segmented alike); all stations share the pT thresholds. The default table is built from ME11GEMdPhi/ME21GEMdPhi in
+ Helpers.h (a single eta partition); eta-binned dictionaries such as
+ GEMCSCdPhiDict.py can be passed as a ParameterSet (see dPhiLUTFromDict in
+ simTrackMatching_cfi.py), so several dictionaries can be evaluated in the
+ same job without a rebuild.
+
+*/
+
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
+#include "DataFormats/MuonDetId/interface/CSCDetId.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+class GEMCSCdPhiLUT
+{
+public:
+
+  enum Station {ME11 = 0, ME21, NStations};
+  enum Parity {Odd = 0, Even, NParities};
+
+  /// default cuts from ME11GEMdPhi/ME21GEMdPhi
+  GEMCSCdPhiLUT();
+
+  /// cuts from a dictionary, see dPhiLUTFromDict
+  explicit GEMCSCdPhiLUT(const edm::ParameterSet& ps);
+
+  /// shared instance of the default cuts
+  static const GEMCSCdPhiLUT& defaultLUT();
+
+  /// index of the LUT station for a CSC chamber, -1 when there is no GEM in front of it
+  static int station(const CSCDetId& id)
+  {
+    if (id.station()==1 and (id.ring()==1 or id.ring()==4)) return ME11;
+    if (id.station()==2 and id.ring()==1) return ME21;
+    return -1;
+  }
+
+  static int parity(const CSCDetId& id) { return id.chamber()%2==1 ? Odd : Even; }
+
+  /// number of pT thresholds passed, minus one; -1 below the lowest threshold
+  int ptBin(float pt) const
+  {
+    int n = -1;
+    for (unsigned int b = 0; b < nPt_; ++b) n += (double(pt) >= ptThresholds_[b]);
+    return n;
+  }
+
+  /// eta partition containing |eta| (the first one for overlapping partitions),
+  /// the closest edge partition outside of the table range
+  int etaBin(int st, int par, float eta) const;
+
+  /// cut for a given station/parity/pT bin/eta bin
+  double cut(int st, int par, int ptbin, int etabin) const
+  {
+    return cuts_[index(st, etabin, ptbin, par)];
+  }
+
+  /**
+   * The chamber-level part of the cut, computed once and then applied to any
+   * number of LCT-pad pairs in the chamber with pass().
+   */
+  struct ChamberCut
+  {
+    double cut;       // cut for the track pT
+    double smallCut;  // |dphi| below which the bending direction is not checked
+    double relaxCut;  // |dphi| below which the track always passes (ME21 at high pT)
+    int chargesign;
+    bool active;     // false for chambers without GEM: everything passes
+  };
+
+  ChamberCut chamberCut(const CSCDetId& id, int chargesign, float pt, float eta = 0.,
+                        bool relaxME21 = true) const;
+
+  /// same semantics as BaseMatcher::passDPhicut
+  static bool pass(const ChamberCut& c, float dphi)
+  {
+    if (!c.active) return true;
+    const float adphi(std::abs(dphi));
+    const bool direction((c.chargesign == 1 and dphi < 0) || (c.chargesign == 0 and dphi > 0) || adphi < c.smallCut);
+    return (adphi < 99 and direction and adphi < c.cut) || adphi < c.relaxCut;
+  }
+
+  bool pass(const CSCDetId& id, int chargesign, float dphi, float pt, float eta = 0.,
+            bool relaxME21 = true) const
+  {
+    return pass(chamberCut(id, chargesign, pt, eta, relaxME21), dphi);
+  }
+
+  unsigned int nPtBins() const { return nPt_; }
+  unsigned int nEtaBins(int st) const { return nEta_[st]; }
+  double ptThreshold(int b) const { return ptThresholds_[b]; }
+
+private:
+
+  unsigned int index(int st, int etabin, int ptbin, int par) const
+  {
+    return ((etaStart_[st] + etabin)*nPt_ + ptbin)*NParities + par;
+  }
+
+  // first eta partition of a parity of a station in etaMin_/etaMax_
+  unsigned int etaIndex(int st, int par) const
+  {
+    return etaStart_[st]*NParities + par*nEta_[st];
+  }
+
+  unsigned int nPt_;
+  // eta partitions of each station, and the number of partitions of the stations before it
+  unsigned int nEta_[NStations];
+  unsigned int etaStart_[NStations];
+  std::vector<double> ptThresholds_;
+  // [station][parity][eta partition]
+  std::vector<float> etaMin_;
+  std::vector<float> etaMax_;
+  // [station][eta partition][pT bin][parity]
+  std::vector<double> cuts_;
+  // pT bin above which ME21 tracks pass with the cut of that bin regardless of the bending direction
+  int relaxME21PtBin_;
+};
+
+#endif
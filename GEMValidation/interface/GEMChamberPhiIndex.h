@@ -0,0 +1,80 @@
+#ifndef GEMCode_GEMValidation_GEMChamberPhiIndex_h
+#define GEMCode_GEMValidation_GEMChamberPhiIndex_h
+
+/**\class GEMChamberPhiIndex
+
+ Description: the two overlapping chambers at a given phi, for GE1/1, GE2/1 or ME0
+
+ The chamber centers are taken from the geometry, sorted in phi per region,
+ and the phi range between two neighbouring centers is covered by the pair
+ of (even, odd) chambers that overlap there. The lookup is a division into
+ uniform bins narrower than the smallest chamber spacing, plus a single
+ comparison with the one center that can fall inside the bin, so it holds
+ for any number and placement of chambers.
+
+*/
+
+#include "Geometry/GEMGeometry/interface/GEMGeometry.h"
+#include "Geometry/GEMGeometry/interface/ME0Geometry.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+class GEMChamberPhiIndex
+{
+public:
+
+  typedef std::pair<unsigned int, unsigned int> ChamberPair;
+
+  GEMChamberPhiIndex() {}
+
+  /// layer 1 chambers of a GEM station, identified by their eta partition refRoll
+  GEMChamberPhiIndex(const GEMGeometry& geometry, int station, int refRoll = 2);
+
+  /// layer 1 ME0 chambers, identified by their first eta partition
+  explicit GEMChamberPhiIndex(const ME0Geometry& geometry);
+
+  /// number of chambers in a region (-1 or 1)
+  unsigned int nChambers(int region) const { return regions_[region > 0].ids.size(); }
+
+  /// chambers whose centers are the closest below and above phi (in degrees, any range),
+  /// (0,0) if the region has less than two chambers
+  ChamberPair closestChambers(int region, float phi) const
+  {
+    const Region& r(regions_[region > 0]);
+    if (r.pairs.empty()) return ChamberPair(0, 0);
+    // phi relative to the first center, in [0, 360)
+    float u = std::fmod(phi - r.phi0, 360.f);
+    u += 360.f * (u < 0.f);
+    const unsigned int bin = std::min(static_cast<unsigned int>(u * r.invBinWidth), r.nBins - 1);
+    unsigned int k = r.firstCenter[bin];
+    k += (u >= r.edges[k+1]);
+    return r.pairs[k];
+  }
+
+private:
+
+  struct Region
+  {
+    float phi0 = 0.;
+    float invBinWidth = 0.;
+    unsigned int nBins = 0;
+    // chamber ids sorted by center phi
+    std::vector<unsigned int> ids;
+    // centers relative to phi0; edges[n] = 360, edges[n+1] is never crossed
+    std::vector<float> edges;
+    // last center at or below the start of each bin
+    std::vector<unsigned int> firstCenter;
+    // pairs[k] = (ids[k], ids[k+1]), wrapping around; pairs[n] = pairs[0] for u rounded up to 360
+    std::vector<ChamberPair> pairs;
+  };
+
+  // sorts the chambers collected in a region and fills its tables
+  static void build(Region& r, std::vector<std::pair<float, unsigned int> >& centers);
+
+  Region regions_[2];
+};
+
+#endif
@@ -0,0 +1,120 @@
+#ifndef GEMCode_GEMValidation_GEMPadBits_h
+#define GEMCode_GEMValidation_GEMPadBits_h
+
+/**\class GEMPadBits
+
+ Description: pads of a GEM eta partition as a fixed size bitset
+
+ Pad numbers start at 1, as the ones of GEMCSCPadDigi and of SimHitMatcher,
+ and pad p is bit p-1. A partition has 192 pads in GE1/1 (GE11PadBits), and
+ up to 384 in GE2/1 (GE21PadBits); pads beyond the size are ignored.
+
+ The 2-layer coincidence of two partitions is a word-wise AND of their pads,
+ where the pads of the second layer may be widened by a few pads first, so
+ that the whole comparison of two partitions is a handful of word operations.
+
+*/
+
+#include <set>
+#include <stdint.h>
+
+template <unsigned int NPads>
+class GEMPadBits
+{
+public:
+
+  enum {NWords = (NPads + 63)/64};
+
+  GEMPadBits() { clear(); }
+
+  void clear() { for (unsigned int w = 0; w < NWords; ++w) words_[w] = 0; }
+
+  static unsigned int size() { return NPads; }
+
+  void set(int pad)
+  {
+    if (pad < 1 or pad > int(NPads)) return;
+    words_[(pad - 1) >> 6] |= uint64_t(1) << ((pad - 1) & 63);
+  }
+
+  bool test(int pad) const
+  {
+    if (pad < 1 or pad > int(NPads)) return false;
+    return (words_[(pad - 1) >> 6] >> ((pad - 1) & 63)) & 1;
+  }
+
+  bool any() const
+  {
+    uint64_t r = 0;
+    for (unsigned int w = 0; w < NWords; ++w) r |= words_[w];
+    return r != 0;
+  }
+
+  unsigned int count() const
+  {
+    unsigned int n = 0;
+    for (unsigned int w = 0; w < NWords; ++w) n += __builtin_popcountll(words_[w]);
+    return n;
+  }
+
+  /// pad numbers, in increasing order
+  std::set<int> pads() const
+  {
+    std::set<int> result;
+    for (unsigned int w = 0; w < NWords; ++w)
+      for (uint64_t b = words_[w]; b; b &= b - 1)
+        result.insert(int(64*w) + __builtin_ctzll(b) + 1);
+    return result;
+  }
+
+  GEMPadBits& operator&=(const GEMPadBits& rhs)
+  {
+    for (unsigned int w = 0; w < NWords; ++w) words_[w] &= rhs.words_[w];
+    return *this;
+  }
+
+  GEMPadBits& operator|=(const GEMPadBits& rhs)
+  {
+    for (unsigned int w = 0; w < NWords; ++w) words_[w] |= rhs.words_[w];
+    return *this;
+  }
+
+  /// the pads, and the pads within n pads of them
+  GEMPadBits widened(unsigned int n) const
+  {
+    GEMPadBits result(*this);
+    for (unsigned int s = 1; s <= n and s < 64; ++s) {
+      for (unsigned int w = 0; w < NWords; ++w) {
+        // pad p-s and pad p+s of every pad p
+        const uint64_t up = words_[w] << s | (w > 0 ? words_[w-1] >> (64 - s) : 0);
+        const uint64_t down = words_[w] >> s | (w + 1 < NWords ? words_[w+1] << (64 - s) : 0);
+        result.words_[w] |= up | down;
+      }
+    }
+    result.trim();
+    return result;
+  }
+
+  /// pads of layer1 with a pad of layer2 within deltaPad pads
+  static GEMPadBits coincidence(const GEMPadBits& layer1, const GEMPadBits& layer2, unsigned int deltaPad = 0)
+  {
+    GEMPadBits result(deltaPad ? layer2.widened(deltaPad) : layer2);
+    result &= layer1;
+    return result;
+  }
+
+private:
+
+  // clears the bits above the last pad
+  void trim()
+  {
+    if (NPads % 64) words_[NWords - 1] &= (uint64_t(1) << (NPads % 64)) - 1;
+  }
+
+  uint64_t words_[NWords];
+};
+
+typedef GEMPadBits<192> GE11PadBits;
+typedef GEMPadBits<384> GE21PadBits;
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef GEMCode_GEMValidation_GenParticleAncestry_h
+#define GEMCode_GEMValidation_GenParticleAncestry_h
+
+/**\class GenParticleAncestry
+
+ Description: per-event ancestry index of a GenParticleCollection
+
+ For every particle the index holds
+  - the top of its same-flavour chain (mu(status 3) -> mu(2) -> mu(1) all
+    point to the first muon); as in the mother walks it replaces, a particle
+    with several same-flavour mothers follows the last one,
+  - the first ancestor of a different flavour (the first mother of the chain
+    top with a different |pdgId|),
+  - the root of the decay chain (following the first non-self ancestors),
+  - the transverse distance of its production vertex, lxy.
+
+ All of it is computed in one pass with memoization, so looking up the
+ ancestry of a muon is O(1) instead of walking its mother chain. The index
+ refers to the collection of the event: a module builds it once per event
+ and hands it to its users (see DisplacedGENMuonMatcher::eventAncestry),
+ and must not keep it after the event.
+
+*/
+
+#include "DataFormats/HepMCCandidate/interface/GenParticle.h"
+
+#include <vector>
+
+class GenParticleAncestry
+{
+public:
+
+  explicit GenParticleAncestry(const reco::GenParticleCollection& particles);
+
+  const reco::GenParticleCollection& particles() const { return particles_; }
+  unsigned int size() const { return particles_.size(); }
+  const reco::GenParticle& particle(int i) const { return particles_[i]; }
+
+  /// position of a candidate in the collection, -1 if it is not part of it
+  int index(const reco::Candidate* c) const;
+
+  int chainTop(int i) const { return chainTop_[i]; }
+  int firstNonSelfAncestor(int i) const { return ancestor_[i]; }
+  int root(int i) const { return root_[i]; }
+  float lxy(int i) const { return lxy_[i]; }
+
+  /// first mother of the chain top of i whose pdgId is in pdgIds, -1 if none
+  /// (a muon with two such mothers is counted once)
+  int ancestorWithPdgId(int i, const std::vector<int>& pdgIds) const;
+
+private:
+
+  int resolveChainTop(int i);
+  int resolveRoot(int i);
+
+  const reco::GenParticleCollection& particles_;
+  std::vector<int> chainTop_;
+  std::vector<int> ancestor_;
+  std::vector<int> root_;
+  std::vector<float> lxy_;
+};
+
+#endif
@@ -2,6 +2,7 @@
 #define GEMCode_GEMValidation_L1GlobalMuonTriggerMatcher_h
 
 #include "GEMCode/GEMValidation/interface/SimHitMatcher.h"
+#include "GEMCode/GEMValidation/interface/SimTrackL1Association.h"
 
 #include "DataFormats/L1GlobalMuonTrigger/interface/L1MuGMTCand.h"
 #include "DataFormats/L1GlobalMuonTrigger/interface/L1MuGMTExtendedCand.h"
@@ -28,6 +29,18 @@ class L1GlobalMuonTriggerMatcher : public BaseMatcher
   bool gmtCandInContainer(const L1MuGMTCand&, const L1MuGMTCandCollection&) const;
   bool isGmtCandMatched(const L1MuGMTCand&) const;
 
+  /// station 2/3 reference point of the SimTrack, used for the L1Extra matching
+  const SimTrackL1Association::Reference& reference() const {return reference_;}
+
+  /// whether the GMT candidates / L1Extra muons are left to an event-level SimTrackL1Association
+  bool globalAssociationGmtCand() const {return globalAssociationGmtCand_;}
+  bool globalAssociationL1ExtraMuon() const {return globalAssociationL1ExtraMuon_;}
+
+  /// take the candidates assigned to this SimTrack (index in the associations);
+  /// a null association leaves the corresponding matches unchanged
+  void setAssociation(const SimTrackL1Association* gmtCands, const SimTrackL1Association* l1ExtraMuons,
+                      unsigned int index);
+
  private:
   
   void clear();
@@ -82,7 +95,14 @@ class L1GlobalMuonTriggerMatcher : public BaseMatcher
   float deltaRGmtCand_;
   float deltaRL1ExtraMuon_;
 
+  bool globalAssociationGmtCand_;
+  bool globalAssociationL1ExtraMuon_;
+
   const SimHitMatcher* simhit_matcher_;
+  SimTrackL1Association::Reference reference_;
+
+  edm::Handle<L1MuGMTCandCollection> hGmtCand_;
+  edm::Handle<l1extra::L1MuonParticleCollection> hL1ExtraMuonParticle_;
 
   L1MuRegionalCandCollection    matchedL1GmtCSCCands_;
   L1MuRegionalCandCollection    matchedL1GmtRPCfCands_;
@@ -2,6 +2,7 @@
 #define GEMCode_GEMValidation_L1TrackFinderTrackMatcher_h
 
 #include "GEMCode/GEMValidation/interface/SimHitMatcher.h"
+#include "GEMCode/GEMValidation/interface/LCTSimTrackAssociation.h"
 
 #include "DataFormats/L1DTTrackFinder/interface/L1MuDTChambPhContainer.h"
 #include "DataFormats/L1CSCTrackFinder/interface/L1CSCTrackCollection.h"
@@ -13,13 +14,24 @@ class L1TrackFinderTrackMatcher : public BaseMatcher
   L1TrackFinderTrackMatcher(SimHitMatcher& sh);
   /// destructor
   ~L1TrackFinderTrackMatcher();
+
+  /// CSCTF tracks whose stubs belong to this SimTrack, by decreasing number of matched stubs;
+  /// valid until the association is used for the next event
+  const std::vector<const TFTrack*>& tfTracks() const {return matchedTfTracks_;}
+  /// the TF track with most stubs of this SimTrack, 0 if none
+  const TFTrack* bestTfTrack() const {return matchedTfTracks_.empty() ? 0 : matchedTfTracks_.front();}
+  /// number of stubs of a matched TF track that belong to this SimTrack
+  unsigned int nMatchedStubs(const TFTrack* track) const;
+
+  /// take the CSCTF tracks of SimTrack index in the event-level stub association
+  void setAssociation(const LCTSimTrackAssociation& association, unsigned int index);
   
  private:
   
   void clear();
   void init();
   
-  void matchCSCTfTrackToSimTrack(const L1CSCTrackCollection&);
+  void matchCSCTfTrackToSimTrack(const LCTSimTrackAssociation&, unsigned int index);
   void matchDTTfTrackToSimTrack(const L1CSCTrackCollection&);
   void matchRPCTfTrackToSimTrack(const L1CSCTrackCollection&);
 
@@ -43,7 +55,8 @@ class L1TrackFinderTrackMatcher : public BaseMatcher
   int maxBXDtTfTrack_;
   int maxBXRpcTfTrack_;
 
-  L1CSCTrackCollection matchedTfTracks_;
+  const LCTSimTrackAssociation* association_;
+  std::vector<const TFTrack*> matchedTfTracks_;
 };
 
 #endif
@@ -0,0 +1,81 @@
+#ifndef GEMCode_GEMValidation_LCTSimTrackAssociation_h
+#define GEMCode_GEMValidation_LCTSimTrackAssociation_h
+
+/**\class LCTSimTrackAssociation
+
+ Description: CSCTF tracks matched to SimTracks by the ownership of their stubs
+
+ The MPC LCTs matched to every SimTrack of the event by its CSCStubMatcher are
+ put in one hash map, keyed by (chamber, half-strip, wiregroup, BX). Every
+ L1CSCTrack is then matched by a vote of its stubs: each stub votes for the
+ SimTracks that own it, and the SimTrack with most votes (at least
+ minMatchedStubs) gets the track. The cost is one lookup per stub, instead of
+ a comparison of every SimTrack with every TF track.
+
+ The TFTracks are kept in a pool owned by this object and reused from event
+ to event, so the pointers returned by tfTracks() are only valid until the
+ next call to matchTracks().
+
+   association.clear();
+   for (unsigned int i = 0; i < matches.size(); ++i) association.addSimTrack(matches[i]->cscStubs(), i);
+   association.matchTracks(*hTracks, muScalesHd, muPtScaleHd);
+   ... association.tfTracks(i) ...
+
+*/
+
+#include "GEMCode/GEMValidation/interface/CSCStubMatcher.h"
+#include "GEMCode/GEMValidation/interface/TFTrack.h"
+
+#include <unordered_map>
+#include <vector>
+#include <stdint.h>
+
+class LCTSimTrackAssociation
+{
+public:
+
+  explicit LCTSimTrackAssociation(unsigned int minMatchedStubs = 2, int minBX = -1, int maxBX = 1);
+
+  /// forget the SimTracks and TF tracks of the previous event
+  void clear();
+
+  /// MPC LCTs matched to a SimTrack; index is the SimTrack number used in the results
+  void addSimTrack(const CSCStubMatcher& stubs, unsigned int index);
+
+  /// match all the TF tracks of the event
+  void matchTracks(const L1CSCTrackCollection& tracks,
+                   edm::ESHandle<L1MuTriggerScales>& muScales,
+                   edm::ESHandle<L1MuTriggerPtScale>& muPtScale);
+
+  /// TF tracks matched to a SimTrack, by decreasing number of matched stubs
+  const std::vector<const TFTrack*>& tfTracks(unsigned int index) const;
+
+  /// number of stubs of a matched TF track owned by its SimTrack
+  unsigned int nMatchedStubs(const TFTrack* track) const;
+
+private:
+
+  static uint64_t key(unsigned int chamber, int hs, int wg, int bx)
+  {
+    return (uint64_t(chamber) << 32) | (uint64_t(hs & 0xfff) << 20) | (uint64_t(wg & 0xfff) << 8) | uint64_t(bx & 0xff);
+  }
+
+  unsigned int minMatchedStubs_;
+  int minBX_;
+  int maxBX_;
+
+  // owners of the MPC LCTs
+  std::unordered_multimap<uint64_t, unsigned int> owners_;
+  unsigned int nSimTracks_;
+
+  // TF tracks of the event; only the first nTracks_ are in use
+  std::vector<TFTrack> pool_;
+  std::vector<unsigned int> owner_;
+  std::vector<unsigned int> nMatchedStubs_;
+  unsigned int nTracks_;
+
+  std::vector<std::vector<const TFTrack*> > matched_;
+  std::vector<const TFTrack*> noTracks_;
+};
+
+#endif
@@ -0,0 +1,239 @@
+#ifndef GEMCode_GEMValidation_MyTrackEff_h
+#define GEMCode_GEMValidation_MyTrackEff_h
+
+/**\class MyTrackEff
+
+ Description: row of the GEMCSCAnalyzer trk_eff_* trees, one per SimTrack and CSC station
+
+ Kept apart from the analyzer so that standalone tools (replayTrackEff) can
+ rebuild the trees. It must stay a plain struct of numbers: the records of
+ TrackEffRecord are raw copies of it.
+
+*/
+
+#include "Rtypes.h"
+
+#include <string>
+#include <vector>
+
+class TTree;
+
+struct MyTrackEff
+{
+  enum {MaxDPhiWorkingPoints = 8};
+
+  void init(); // initialize to default values
+  // attach all the members to branches of a tree, with a passdphi_<name> branch per dPhi working point
+  void branches(TTree *t, const std::vector<std::string>& dPhiWorkingPoints = std::vector<std::string>());
+
+  Int_t lumi;
+  Int_t run;
+  Int_t event;
+
+  Float_t pt, eta, phi;
+  Char_t charge;
+  Char_t endcap;
+  Char_t chamber_ME1_csc_sh;//bit1:odd, bit2:even
+  Char_t chamber_ME2_csc_sh;
+  Char_t chamber_odd; // bit1: has GEM pad   bit2: has CSC LCT
+  Char_t chamber_even; // bit1: has GEM pad   bit2: has CSC LCT
+  Float_t bending_sh;
+  Float_t phi_cscsh_even, phi_cscsh_odd, eta_cscsh_even, eta_cscsh_odd;
+  Float_t dphi_sh_even,dphi_sh_odd;
+  Float_t pt_sh,ptphi_sh,pteta_sh;
+
+  Char_t has_csc_sh; // #layers with SimHits > minHitsChamber    bit1: in odd, bit2: even
+  Char_t has_csc_strips; // #layers with comparator digis > minHitsChamber    bit1: in odd, bit2: even
+  Char_t has_csc_wires; // #layers with wire digis > minHitsChamber    bit1: in odd, bit2: even
+
+  Char_t has_clct; // bit1: in odd, bit2: even
+  Char_t has_alct; // bit1: in odd, bit2: even
+  Char_t has_lct; // bit1: in odd, bit2: even
+
+  Int_t bend_lct_odd;
+  Int_t bend_lct_even;
+  Int_t bx_lct_odd;
+  Int_t bx_lct_even;
+
+
+  Float_t hs_lct_odd;
+  Float_t wg_lct_odd;
+  Float_t hs_lct_even;
+  Float_t wg_lct_even;
+
+  Float_t phi_lct_odd;
+  Float_t phi_lct_even;
+  Float_t eta_lct_odd;
+  Float_t eta_lct_even;
+  Float_t dphi_lct_odd; // dphi stored as data member in LCT
+  Float_t dphi_lct_even;
+  Bool_t passdphi_odd;
+  Bool_t passdphi_even;
+  // per dPhi working point  bit1: odd LCT passes  bit2: even LCT passes  bit3, bit4: GE11, GE21 TF track passes at the sim pT
+  UChar_t passdphi_wp[MaxDPhiWorkingPoints];
+
+  Int_t wiregroup_odd;
+  Int_t wiregroup_even;
+  Int_t halfstrip_odd;
+  Int_t halfstrip_even;
+
+  Int_t quality_clct_odd;
+  Int_t quality_clct_even;
+  Int_t quality_alct_odd;
+  Int_t quality_alct_even;
+
+  Int_t nlayers_csc_sh_odd;
+  Int_t nlayers_wg_dg_odd;
+  Int_t nlayers_st_dg_odd;
+  Int_t nlayers_csc_sh_even;
+  Int_t nlayers_wg_dg_even;
+  Int_t nlayers_st_dg_even;
+  Int_t pad_odd;
+  Int_t pad_even;
+  Int_t Copad_odd;
+  Int_t Copad_even;
+  Int_t hsfromgem_odd;
+  Int_t hsfromgem_even;
+
+  Char_t has_gem_sh; // bit1: in odd, bit2: even
+  Char_t has_gem_sh2; // has SimHits in 2 layers  bit1: in odd, bit2: even
+  Char_t has_gem_dg; // bit1: in odd, bit2: even
+  Char_t has_gem_dg2; // has pads in 2 layers  bit1: in odd, bit2: even
+  Char_t has_gem_pad; // bit1: in odd, bit2: even
+  Char_t has_gem_pad2; // has pads in 2 layers  bit1: in odd, bit2: even
+  Char_t has_gem_copad; // bit1: in odd, bit2: even
+
+  Float_t strip_gemsh_odd; // average hits' strip
+  Float_t strip_gemsh_even;
+  Float_t eta_gemsh_odd;
+  Float_t eta_gemsh_even;
+  Float_t phi_gemsh_odd;
+  Float_t phi_gemsh_even;
+  Int_t strip_gemdg_odd; // median digis' strip
+  Int_t strip_gemdg_even;
+
+  Char_t has_rpc_sh; // bit1: in odd, bit2: even
+  Char_t has_rpc_dg; // bit1: in odd, bit2: even
+  Int_t strip_rpcdg_odd; // median digis' strip
+  Int_t strip_rpcdg_even;
+
+  Int_t bx_pad_odd;
+  Int_t bx_pad_even;
+  Float_t phi_pad_odd;
+  Float_t phi_pad_even;
+  Float_t eta_pad_odd;
+  Float_t eta_pad_even;
+
+  Float_t dphi_pad_odd;
+  Float_t dphi_pad_even;
+  Float_t deta_pad_odd;
+  Float_t deta_pad_even;
+
+  Int_t quality_odd;
+  Int_t quality_even;
+
+  Int_t hsfromrpc_odd; // extraplotate hs from rpc
+  Int_t hsfromrpc_even;
+
+  Int_t bx_rpcstrip_odd;
+  Int_t bx_rpcstrip_even;
+  Float_t phi_rpcstrip_odd;
+  Float_t phi_rpcstrip_even;
+  Float_t eta_rpcstrip_odd;
+  Float_t eta_rpcstrip_even;
+
+  Float_t dphi_rpcstrip_odd;
+  Float_t dphi_rpcstrip_even;
+  Float_t deta_rpcstrip_odd;
+  Float_t deta_rpcstrip_even;
+
+  // Track properties
+  Int_t has_tfTrack;
+  Int_t has_tfCand;
+
+  // CSCTF track matched by stub ownership
+  Int_t has_tfTrack_stubs;
+  Float_t tfTrack_stubs_pt, tfTrack_stubs_eta, tfTrack_stubs_phi;
+  Int_t tfTrack_stubs_nStubs, tfTrack_stubs_nMatchedStubs;
+  Int_t has_gmtRegCand;
+  Int_t has_gmtCand;
+ 
+  //csctf
+  Float_t trackpt, tracketa, trackphi;
+  UInt_t quality_packed, pt_packed, eta_packed, phi_packed;
+  UInt_t chargesign;
+  UInt_t rank;
+  UInt_t nstubs;
+  UInt_t deltaphi12, deltaphi23; 
+  Bool_t hasME1,hasME2;
+  Char_t chamberME1,chamberME2;//bit1: odd, bit2: even
+  Int_t ME1_ring, ME2_ring;
+  Int_t ME1_hs, ME2_hs, ME1_wg,ME2_wg;
+  Float_t dphiGE11,dphiGE21;
+  Bool_t passGE11,passGE21;
+  Bool_t passGE11_pt5, passGE11_pt7, passGE11_pt10, passGE11_pt15, passGE11_pt20, passGE11_pt30, passGE11_pt40;
+  Bool_t passGE21_pt5, passGE21_pt7, passGE21_pt10, passGE21_pt15, passGE21_pt20, passGE21_pt30, passGE21_pt40;
+  Bool_t passGE11_simpt, passGE21_simpt;
+  Float_t deltaR;
+  Float_t lctdphi12;
+  Float_t eta_propagated_ME1;
+  Float_t eta_propagated_ME2;
+  Float_t eta_propagated_ME3;
+  Float_t eta_propagated_ME4;
+  Float_t phi_propagated_ME1;
+  Float_t phi_propagated_ME2;
+  Float_t phi_propagated_ME3;
+  Float_t phi_propagated_ME4;
+  Float_t eta_ME1_TF;
+  Float_t eta_ME2_TF;
+  Float_t eta_ME3_TF;
+  Float_t eta_ME4_TF;
+  Float_t phi_ME1_TF;
+  Float_t phi_ME2_TF;
+  Float_t phi_ME3_TF;
+  Float_t phi_ME4_TF;
+
+  Float_t eta_interStat12;
+  Float_t phi_interStat12;
+  Float_t eta_interStat23;
+  Float_t phi_interStat23;
+  Float_t eta_interStat13;
+  Float_t phi_interStat13;
+
+  Bool_t allstubs_matched_TF;
+
+  Int_t has_l1Extra;
+  Float_t l1Extra_pt;
+  Float_t l1Extra_eta;
+  Float_t l1Extra_phi;
+  Float_t l1Extra_dR;
+  Int_t has_recoTrackExtra;
+  Float_t recoTrackExtra_pt_inner;
+  Float_t recoTrackExtra_eta_inner;
+  Float_t recoTrackExtra_phi_inner;  
+  Float_t recoTrackExtra_pt_outer;
+  Float_t recoTrackExtra_eta_outer;
+  Float_t recoTrackExtra_phi_outer;
+  Int_t has_recoTrack;
+  Float_t recoTrack_pt_outer;
+  Float_t recoTrack_eta_outer;
+  Float_t recoTrack_phi_outer;
+  Int_t has_recoChargedCandidate;
+  Float_t recoChargedCandidate_pt;
+  Float_t recoChargedCandidate_eta;
+  Float_t recoChargedCandidate_phi;
+
+  Int_t recoChargedCandidate_nValidCSCHits;
+  Int_t recoChargedCandidate_nValidRPCHits;
+  Int_t recoChargedCandidate_nValidDTHits;
+
+
+  // pt assginment
+  Float_t pt_position_sh;
+  Float_t pt_position;
+  Float_t pt_position2;
+  Bool_t hasSt1St2St3;
+  Bool_t hasSt1St2St3_sh;
+};
+
+#endif
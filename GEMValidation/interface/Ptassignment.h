@@ -1,8 +1,10 @@
-
+#ifndef GEMCode_GEMValidation_Ptassignment_h
+#define GEMCode_GEMValidation_Ptassignment_h
 
 #include "DataFormats/GeometryVector/interface/GlobalPoint.h"
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
 
-
+#include <vector>
 
 
 //eta partitions: 1.6-1.8, 1.8-2.0, 2.0-2.2, 2.2-2.4
@@ -31,7 +33,7 @@ const double PositionEpLUT[Parity][EtaPartitions][3] = {
 		},
 	};
 
-float Ptassign_Position(float deltay12, float deltay23, float eta, int par){
+inline float Ptassign_Position(float deltay12, float deltay23, float eta, int par){
     int neta=-1;
     if (fabs(eta)>=1.6 and fabs(eta)<1.8)
 	neta=0;
@@ -52,7 +54,7 @@ float Ptassign_Position(float deltay12, float deltay23, float eta, int par){
 }
 
 
-float Ptassign_Position_gp(GlobalPoint gp1, GlobalPoint gp2, GlobalPoint gp3, float eta, int par){
+inline float Ptassign_Position_gp(GlobalPoint gp1, GlobalPoint gp2, GlobalPoint gp3, float eta, int par){
 
    float anglea = gp2.phi();
    float newyst1 = -gp1.x()*sin(anglea) + gp1.y()*cos(anglea);
@@ -66,3 +68,62 @@ float Ptassign_Position_gp(GlobalPoint gp1, GlobalPoint gp2, GlobalPoint gp3, fl
 }
 
 
+/// structure-of-arrays input for n 3-station candidates; parity as in Ptassign_Position
+struct PositionPtInput
+{
+  const float* x1; const float* y1;
+  const float* x2; const float* y2;
+  const float* x3; const float* y3;
+  const float* eta;
+  const int* parity;
+  unsigned int n;
+};
+
+/**
+ * Position-based pT LUT in a flat layout for the batch assignment: one row of
+ * (prop_factor, slope, intercept) per parity and eta partition. The default is
+ * PositionEpLUT; another table can be given at runtime as a ParameterSet with
+ *   etaEdges = vdouble(nEta+1 increasing |eta| edges)
+ *   parity0 ... parity3 = vdouble(nEta rows of prop_factor, slope, intercept)
+ */
+class PositionPtLUT
+{
+public:
+  PositionPtLUT();
+  explicit PositionPtLUT(const edm::ParameterSet& ps);
+
+  static const PositionPtLUT& defaultLUT();
+
+  unsigned int nEta() const { return nEta_; }
+  unsigned int nParity() const { return nParity_; }
+
+  /// eta partition by counting edges, -1 outside of the table
+  int etaBin(float eta) const;
+
+  /// rows indexed by parity*nEta() + eta partition
+  const float* prop() const { return &prop_[0]; }
+  const float* slope() const { return &slope_[0]; }
+  const float* intercept() const { return &intercept_[0]; }
+  const float* etaEdges() const { return &etaEdges_[0]; }
+
+private:
+  unsigned int nEta_;
+  unsigned int nParity_;
+  std::vector<float> etaEdges_;
+  // [parity][eta]
+  std::vector<float> prop_;
+  std::vector<float> slope_;
+  std::vector<float> intercept_;
+};
+
+/**
+ * Ptassign_Position_gp for n candidates at once. The rotation to the frame of
+ * the station-2 point uses x2/r2 and y2/r2 instead of sin/cos of its phi, and
+ * the eta partition is found without branches, so the loop vectorizes.
+ * Agrees with the scalar version up to float rounding, which only shows at
+ * very high pT where |deltay23| - prop*|deltay12| cancels.
+ */
+void Ptassign_Position_batch(const PositionPtInput& in, float* pt,
+                             const PositionPtLUT& lut = PositionPtLUT::defaultLUT());
+
+#endif
@@ -9,6 +9,7 @@
 */
 
 #include "GEMCode/GEMValidation/interface/BaseMatcher.h"
+#include "GEMCode/GEMValidation/interface/GEMPadBits.h"
 
 #include "SimDataFormats/TrackingHit/interface/PSimHitContainer.h"
 #include "DataFormats/GeometryVector/interface/GlobalPoint.h"
@@ -158,6 +159,8 @@ public:
   std::set<int> hitWiregroupsInDetId(unsigned int, int margin_n_wg = 0) const; // CSC
   std::set<int> hitPadsInDetId(unsigned int) const; // GEM
   std::set<int> hitCoPadsInDetId(unsigned int) const; // GEM coincidence pads with hits
+  const GE11PadBits& hitPadBitsInDetId(unsigned int) const; // GEM
+  const GE11PadBits& hitCoPadBitsInDetId(unsigned int) const; // GEM coincidence pads with hits
   std::set<unsigned int> hitWiresInDTLayerId(unsigned int, int margin_n_wires = 0) const;  // DT
   std::set<unsigned int> hitWiresInDTSuperLayerId(unsigned int, int margin_n_wires = 0) const;  // DT
   std::set<unsigned int> hitWiresInDTChamberId(unsigned int, int margin_n_wires = 0) const;  // DT
@@ -229,10 +232,13 @@ private:
   std::map<unsigned int, edm::PSimHitContainer > dt_superlayer_to_hits_;
   std::map<unsigned int, edm::PSimHitContainer > dt_chamber_to_hits_;
 
-  // detids with hits in pads
-  std::map<unsigned int, std::set<int> > gem_detids_to_pads_;
+  // detids with hits in pads (GE1/1 only, the GE2/1 hits are not matched)
+  std::map<unsigned int, GE11PadBits> gem_detids_to_pads_;
   // detids with hits in 2-layer pad coincidences
-  std::map<unsigned int, std::set<int> > gem_detids_to_copads_;
+  std::map<unsigned int, GE11PadBits> gem_detids_to_copads_;
+  GE11PadBits no_pads_;
+  // pads of layer 2 within matchDeltaPad pads of a pad of layer 1 make a coincidence
+  int matchDeltaPadGEM_;
 
   bool verboseGEM_;
   bool verboseCSC_;
@@ -0,0 +1,96 @@
+#ifndef GEMCode_GEMValidation_SimTrackL1Association_h
+#define GEMCode_GEMValidation_SimTrackL1Association_h
+
+/**\class SimTrackL1Association
+
+ Description: event-level one-to-one association of SimTracks and L1 muon candidates
+
+ Every SimTrack is represented by a reference point, the mean position of its
+ simhits in the first chamber of the second (or else third) DT or CSC
+ station, computed once per track. The cost of a SimTrack-candidate pair is
+
+   dR(reference, candidate) + deltaBXCost*|bx| + chargeMismatchCost*(charges differ)
+
+ and pairs outside of deltaR or of [minBX, maxBX] are not allowed. The
+ assignment is solved for all the SimTracks of the event at once (Hungarian
+ algorithm): as many SimTracks as possible get a candidate, with the smallest
+ total cost, and no candidate is given to two SimTracks.
+
+   SimTrackL1Association assoc(cfg.getParameter<edm::ParameterSet>("l1ExtraMuonParticle"));
+   for (auto& m: matches) assoc.addSimTrack(m->l1GMTCands().reference());
+   for (auto& mu: muons) assoc.addCandidate(mu.eta(), mu.phi(), mu.bx(), mu.charge());
+   assoc.solve();
+   ... assoc.partner(i) ...
+
+*/
+
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
+
+#include <vector>
+
+class SimHitMatcher;
+
+class SimTrackL1Association
+{
+public:
+
+  /// SimTrack side of the association
+  struct Reference
+  {
+    Reference(): eta(0.), phi(0.), charge(0), valid(false) {}
+    float eta;
+    float phi;
+    int charge;
+    // false when the track has no hits in the second or third station
+    bool valid;
+  };
+
+  /// reads deltaR, minBX, maxBX and (optionally) deltaBXCost, chargeMismatchCost
+  explicit SimTrackL1Association(const edm::ParameterSet& ps);
+
+  /// station 2 (or else 3) DT or CSC reference point of the track of a SimHitMatcher
+  static Reference reference(const SimHitMatcher& sh);
+
+  /// returns the index of the track
+  unsigned int addSimTrack(const Reference& ref);
+  /// returns the index of the candidate
+  unsigned int addCandidate(float eta, float phi, int bx, int charge);
+
+  /// assigns the candidates to the tracks added so far
+  void solve();
+
+  unsigned int nSimTracks() const { return tracks_.size(); }
+  unsigned int nCandidates() const { return cands_.size(); }
+
+  /// index of the candidate assigned to a track, -1 if none
+  int partner(unsigned int track) const { return partner_[track]; }
+  /// dR between a track and its candidate, 99 if none
+  float partnerDeltaR(unsigned int track) const { return partnerDeltaR_[track]; }
+
+private:
+
+  struct Candidate
+  {
+    float eta;
+    float phi;
+    int bx;
+    int charge;
+  };
+
+  // cost of a pair, >= forbidden() when the pair is not allowed
+  double cost(const Reference& t, const Candidate& c) const;
+  static double forbidden() { return 1e6; }
+
+  double deltaR_;
+  int minBX_;
+  int maxBX_;
+  double deltaBXCost_;
+  double chargeMismatchCost_;
+
+  std::vector<Reference> tracks_;
+  std::vector<Candidate> cands_;
+  std::vector<int> partner_;
+  std::vector<float> partnerDeltaR_;
+};
+
+#endif
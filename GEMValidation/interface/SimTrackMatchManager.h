@@ -36,8 +36,10 @@ class SimTrackMatchManager
 {
 public:
   
+  /// genAncestry: gen particle index of the event (DisplacedGENMuonMatcher::eventAncestry), may be null
   SimTrackMatchManager(const SimTrack& t, const SimVertex& v,
-      const edm::ParameterSet& ps, const edm::Event& ev, const edm::EventSetup& es);
+      const edm::ParameterSet& ps, const edm::Event& ev, const edm::EventSetup& es,
+      const GenParticleAncestry* genAncestry = nullptr);
   
   ~SimTrackMatchManager();
 
@@ -60,6 +62,19 @@ public:
   const L1TrackFinderCandidateMatcher& l1TfCands() const {return l1_tf_cands_;}
   const L1GlobalMuonTriggerMatcher& l1GMTCands() const {return l1_gmt_cands_;}
   const HLTTrackMatcher& hltTracks() const {return hlt_tracks_;}
+
+  /// L1 candidates assigned to this SimTrack by the event-level associations (null if not used)
+  void setL1Association(const SimTrackL1Association* gmtCands, const SimTrackL1Association* l1ExtraMuons,
+                        unsigned int index)
+  {
+    l1_gmt_cands_.setAssociation(gmtCands, l1ExtraMuons, index);
+  }
+
+  /// CSCTF tracks assigned to this SimTrack by the event-level stub association
+  void setTfTrackAssociation(const LCTSimTrackAssociation& association, unsigned int index)
+  {
+    l1_tf_tracks_.setAssociation(association, index);
+  }
   
 private:
 
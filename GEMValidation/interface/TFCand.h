@@ -23,7 +23,7 @@ class TFCand
 
   TFTrack* tftrack() const {return tftrack_;}
 
-  std::vector < CSCDetId > ids() const {return ids_;}
+  TFStubSpan<CSCDetId> ids() const {return TFStubSpan<CSCDetId>(ids_, nIds_);}
 
   double pt() const {return pt_;}
   double eta() const {return eta_;}
@@ -34,7 +34,8 @@ class TFCand
 
   const L1MuRegionalCand* l1Cand_;
   TFTrack* tftrack_;
-  std::vector<CSCDetId> ids_;
+  CSCDetId ids_[TFTrack::MaxStubs];
+  unsigned char nIds_;
   double pt_;
   double eta_;
   double phi_;
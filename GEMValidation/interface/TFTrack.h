@@ -11,6 +11,7 @@
 // user include files
 #include "GEMCode/GEMValidation/interface/GenericDigi.h"
 #include "GEMCode/GEMValidation/interface/BaseMatcher.h"
+#include "GEMCode/GEMValidation/interface/GEMCSCdPhiLUT.h"
 
 #include "DataFormats/MuonDetId/interface/CSCDetId.h"
 
@@ -36,9 +37,45 @@
 
 #include "DataFormats/GeometryVector/interface/GlobalPoint.h"
 
+#include <stdexcept>
+
+/// read-only range of the stubs of a TFTrack or TFCand, valid as long as the track
+template <class T>
+class TFStubSpan
+{
+ public:
+  TFStubSpan(): begin_(0), end_(0) {}
+  TFStubSpan(const T* begin, unsigned int n): begin_(begin), end_(begin + n) {}
+
+  const T* begin() const { return begin_; }
+  const T* end() const { return end_; }
+  unsigned int size() const { return end_ - begin_; }
+  bool empty() const { return begin_ == end_; }
+  const T& operator[](unsigned int i) const { return begin_[i]; }
+  const T& at(unsigned int i) const
+  {
+    if (i >= size()) throw std::out_of_range("TFStubSpan::at");
+    return begin_[i];
+  }
+
+ private:
+  const T* begin_;
+  const T* end_;
+};
+
+
+/**
+ * CSCTF track with its stubs. A CSCTF track has at most one stub per station,
+ * so the stubs (up to 4 CSC stations + MB1) are kept in fixed size arrays in
+ * the object: copying or reusing a track does not allocate, and the accessors
+ * return spans over the arrays. The stations with a stub are kept as a bitmask
+ * (bit 0: MB1, bits 1-4: ME1-ME4).
+ */
 class TFTrack
 {
  public:
+  enum {MaxStubs = 5};
+
   /// constructor
   TFTrack(const csc::L1Track* t, const CSCCorrelatedLCTDigiCollection*);
   /// copy constructor
@@ -46,6 +83,9 @@ class TFTrack
   /// destructor
   ~TFTrack();  
 
+  /// reuse this object for another L1 track
+  void reset(const csc::L1Track* t, const CSCCorrelatedLCTDigiCollection*);
+
   void init(edm::ESHandle< L1MuTriggerScales > &muScales,
 	    edm::ESHandle< L1MuTriggerPtScale > &muPtScale);
   
@@ -54,13 +94,13 @@ class TFTrack
   /// L1 track
   const csc::L1Track* getL1Track() const {return l1track_;}
   /// collection of trigger digis
-  std::vector<const CSCCorrelatedLCTDigi*> getTriggerDigis() const {return triggerDigis_;} 
+  TFStubSpan<const CSCCorrelatedLCTDigi*> getTriggerDigis() const {return TFStubSpan<const CSCCorrelatedLCTDigi*>(triggerDigis_, nTriggerDigis_);}
   /// collection of MPC LCTs
-  std::vector<CSCDetId> getTriggerDigisIds() const {return triggerIds_;}
-  std::vector<std::pair<float, float>> getTriggerEtaPhis() {return triggerEtaPhis_;}
-  std::vector<csctf::TrackStub> getTriggerStubs() const {return triggerStubs_;}
-  std::vector<matching::Digi*> getTriggerMPLCTs() const {return mplcts_;}
-  std::vector<CSCDetId> getChamberIds() const {return ids_;}
+  TFStubSpan<CSCDetId> getTriggerDigisIds() const {return TFStubSpan<CSCDetId>(triggerIds_, nTriggerIds_);}
+  TFStubSpan<std::pair<float, float> > getTriggerEtaPhis() const {return TFStubSpan<std::pair<float, float> >(triggerEtaPhis_, nTriggerEtaPhis_);}
+  TFStubSpan<csctf::TrackStub> getTriggerStubs() const {return TFStubSpan<csctf::TrackStub>(triggerStubs_, nTriggerStubs_);}
+  TFStubSpan<matching::Digi*> getTriggerMPLCTs() const {return TFStubSpan<matching::Digi*>(mplcts_, nMPLCTs_);}
+  TFStubSpan<CSCDetId> getChamberIds() const {return TFStubSpan<CSCDetId>(ids_, nIds_);}
  
   unsigned int digiInME(int st, int ring) const;
 
@@ -74,22 +114,30 @@ class TFTrack
   /// bunch crossing 
   int bx() const {return l1track_->bx();}
   /// how many stubs?
-  unsigned int nStubs(bool mb1, bool me1, bool me2, bool me3, bool me4) const;
+  unsigned int nStubs(bool mb1, bool me1, bool me2, bool me3, bool me4) const
+  {
+    return nBits(stationMask_ & (mb1 | me1 << 1 | me2 << 2 | me3 << 3 | me4 << 4));
+  }
   unsigned int nStubs() const {return nstubs;}
   /// how many stubs in CSC? 
-  unsigned int nStubsCSCOk(bool me1, bool me2, bool me3, bool me4) const;
+  unsigned int nStubsCSCOk(bool me1, bool me2, bool me3, bool me4) const
+  {
+    return nBits(cscOkMask_ & (me1 << 1 | me2 << 2 | me3 << 3 | me4 << 4));
+  }
+  /// stations with a stub, bit 0: MB1, bits 1-4: ME1-ME4
+  unsigned int stationMask() const {return stationMask_;}
   /// has stub in muon barrel/endcap
-  bool hasStubStation(int wheel) const; 
+  bool hasStubStation(int st) const {return st >= 0 and st <= 4 and (stationMask_ >> st & 1);}
   /// has stub in muon barrel?
-  bool hasStubBarrel() const;  
+  bool hasStubBarrel() const {return stationMask_ & 1;}
   /// has stub in muon endcap?
-  bool hasStubEndcap(int station) const;
+  bool hasStubEndcap(int st) const {return st >= 1 and st <= 4 and (stationMask_ >> st & 1);}
   /// matches CSC stubs?
-  bool hasStubCSCOk(int st) const;
+  bool hasStubCSCOk(int st) const {return st >= 1 and st <= 4 and (cscOkMask_ >> st & 1);}
   /// has stubs that pass match?
   bool passStubsMatch(double eta, int minLowHStubs, int minMidHStubs, int minHighHStubs) const;
   /// print some information
-  void print();
+  void print() const;
 
 
 
@@ -106,18 +154,34 @@ class TFTrack
   double eta() const {return eta_;}
   double phi() const {return phi_;}
   double dr() const {return dr_;}
-  std::vector<bool> deltaOk();
+  /// stubs matched to the SimTrack, bit i for stub i (not filled yet)
+  unsigned int deltaOk() const {return deltaOk_;}
   bool debug() const {return debug_;}
-  bool passDPhicutTFTrack(int st, float pt) const;
+  bool passDPhicutTFTrack(int st, float pt, const GEMCSCdPhiLUT& lut = GEMCSCdPhiLUT::defaultLUT()) const;
    
  private:
+  static unsigned int nBits(unsigned int mask)
+  {
+    unsigned int n = 0;
+    for (; mask; mask &= mask - 1) ++n;
+    return n;
+  }
+
   const csc::L1Track* l1track_;
-  std::vector<const CSCCorrelatedLCTDigi*> triggerDigis_;
-  std::vector<CSCDetId> triggerIds_;
-  std::vector<std::pair<float, float>> triggerEtaPhis_;
-  std::vector<csctf::TrackStub> triggerStubs_;
-  std::vector<matching::Digi*> mplcts_;
-  std::vector<CSCDetId> ids_; // chamber ids
+  const CSCCorrelatedLCTDigi* triggerDigis_[MaxStubs];
+  CSCDetId triggerIds_[MaxStubs];
+  std::pair<float, float> triggerEtaPhis_[MaxStubs];
+  csctf::TrackStub triggerStubs_[MaxStubs];
+  matching::Digi* mplcts_[MaxStubs];
+  CSCDetId ids_[MaxStubs]; // chamber ids
+  unsigned char nTriggerDigis_;
+  unsigned char nTriggerIds_;
+  unsigned char nTriggerEtaPhis_;
+  unsigned char nTriggerStubs_;
+  unsigned char nMPLCTs_;
+  unsigned char nIds_;
+  unsigned char stationMask_;
+  unsigned char cscOkMask_;
   unsigned phi_packed_;
   unsigned eta_packed_;
   unsigned pt_packed_;
@@ -128,7 +192,7 @@ class TFTrack
   double pt_;
   double dr_;
   unsigned int nstubs;
-  std::vector<bool> deltaOk_;
+  unsigned int deltaOk_;
   bool debug_;
 };
 
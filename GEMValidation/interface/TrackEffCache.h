@@ -0,0 +1,78 @@
+#ifndef GEMCode_GEMValidation_TrackEffCache_h
+#define GEMCode_GEMValidation_TrackEffCache_h
+
+/**\class TrackEffCache
+
+ Description: trk_eff rows of GEMCSCAnalyzer cached per luminosity block
+
+ The rows of a station in a luminosity block depend only on the input file,
+ the process history of the block, the run and lumi numbers, the analyzer
+ configuration, the EventSetup configuration, the conditions of the block
+ and the analyzer code. The cache keys every (block, station) by a hash of
+ these and keeps the rows in the cache directory as record files (see
+ TrackEffRecord.h):
+
+   dir/trkeff_<station>_<key>.bin
+
+ A job with the same inputs and a partly changed configuration fills the
+ trees of the blocks and stations whose key did not change from the cache,
+ and only analyzes the other ones. Files are written under a temporary name
+ and renamed when the block is complete, so that an interrupted job leaves
+ no partial entries.
+
+ GEMCSCAnalyzer passes the ES sources, ES producers and ES prefers of the
+ process (the GlobalTag with its toGet overrides, the geometry and field
+ configuration) with the analyzer configuration, and the IOVs of the
+ geometry, magnetic field and L1 muon scales records of every block as its
+ conditions. Conditions that change without a change of these are not seen:
+ a sqlite file or a geometry XML file rewritten in place under the same name,
+ or a record the rows depend on through another one. Clear the cache
+ directory after such a change.
+*/
+
+#include "GEMCode/GEMValidation/interface/TrackEffRecord.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+class TrackEffCache
+{
+public:
+
+  /// config: the configuration the rows depend on, as a string; stations: names of the station numbers
+  TrackEffCache(const std::string& dir, const std::string& config, const std::vector<std::string>& stations);
+  ~TrackEffCache();
+
+  /// computes the keys of a new block; a block still being recorded is dropped;
+  /// conditions: the IOVs of the records the rows depend on, as a string
+  void beginBlock(const std::string& inputFile, const std::string& processHistory,
+                  unsigned int run, unsigned int lumi, const std::string& conditions);
+
+  /// rows of a station in the current block, null when they are not in the cache
+  std::unique_ptr<TrackEffRecordFile> cached(unsigned int station) const;
+
+  /// records the rows of a station in the current block
+  void record(unsigned int station);
+  bool recording(unsigned int station) const { return station < writers_.size() and writers_[station]; }
+  void write(unsigned int station, unsigned int track, const MyTrackEff& eff);
+
+  /// moves the rows recorded in the current block into the cache
+  void endBlock();
+
+  /// drops the rows recorded in the current block
+  void abortBlock();
+
+  std::string path(unsigned int station) const;
+
+private:
+
+  std::string dir_;
+  uint64_t configKey_;
+  std::vector<std::string> stations_;
+  std::vector<uint64_t> keys_;
+  std::vector<std::unique_ptr<TrackEffRecordWriter> > writers_;
+};
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef GEMCode_GEMValidation_TrackEffRecord_h
+#define GEMCode_GEMValidation_TrackEffRecord_h
+
+/**\class TrackEffRecordWriter, TrackEffRecordFile
+
+ Description: binary record of the trk_eff_* rows, to rebuild the trees without cmsRun
+
+ The capture mode of GEMCSCAnalyzer (trackEffRecordFile) writes, for every
+ good SimTrack and every station in use, the filled MyTrackEff row: the
+ matched simhits, GEM/CSC/RPC digis, pads, stubs, TF/GMT/L1Extra candidates
+ and propagated points, as summarized by the analyzer. The file is a header
+ followed by fixed size records, so that it can be memory-mapped and split in
+ independent ranges:
+
+   TrackEffRecordHeader  magic, version, record size, station and dPhi working point names
+   TrackEffRecord[n]     station, SimTrack number in the event, MyTrackEff
+
+ Records are raw copies of MyTrackEff, so a file can only be read by code
+ built with the same MyTrackEff (the record size is checked when opening).
+ See test/replayTrackEff.cpp.
+
+*/
+
+#include "GEMCode/GEMValidation/interface/MyTrackEff.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+struct TrackEffRecordHeader
+{
+  enum {MaxStations = 16, MaxNameLength = 16};
+  char magic[8];
+  uint32_t version;
+  uint32_t recordSize;
+  uint32_t nStations;
+  uint32_t nDPhiWorkingPoints;
+  char stations[MaxStations][MaxNameLength];
+  char dPhiWorkingPoints[MyTrackEff::MaxDPhiWorkingPoints][MaxNameLength];
+};
+
+struct TrackEffRecord
+{
+  uint32_t station;
+  uint32_t track;
+  MyTrackEff eff;
+};
+
+
+class TrackEffRecordWriter
+{
+public:
+
+  /// station names are indexed by the station numbers of the records,
+  /// working point names by the bits of MyTrackEff::passdphi_wp
+  TrackEffRecordWriter(const std::string& fileName, const std::vector<std::string>& stations,
+                       const std::vector<std::string>& dPhiWorkingPoints = std::vector<std::string>());
+  ~TrackEffRecordWriter();
+
+  void write(unsigned int station, unsigned int track, const MyTrackEff& eff);
+
+  /// closes the file, false when it could not be completed
+  bool close();
+
+  unsigned long long nRecords() const { return nRecords_; }
+
+private:
+
+  TrackEffRecordWriter(const TrackEffRecordWriter&);
+  TrackEffRecordWriter& operator=(const TrackEffRecordWriter&);
+
+  std::FILE* file_;
+  std::string fileName_;
+  unsigned long long nRecords_;
+};
+
+
+class TrackEffRecordFile
+{
+public:
+
+  /// maps the whole file read-only; throws cms::Exception on a bad file
+  explicit TrackEffRecordFile(const std::string& fileName);
+  ~TrackEffRecordFile();
+
+  unsigned long long size() const { return nRecords_; }
+  const TrackEffRecord& operator[](unsigned long long i) const { return records_[i]; }
+
+  unsigned int nStations() const { return header_->nStations; }
+  std::string stationName(unsigned int station) const;
+
+  std::vector<std::string> dPhiWorkingPoints() const;
+
+private:
+
+  TrackEffRecordFile(const TrackEffRecordFile&);
+  TrackEffRecordFile& operator=(const TrackEffRecordFile&);
+
+  void* data_;
+  size_t length_;
+  const TrackEffRecordHeader* header_;
+  const TrackEffRecord* records_;
+  unsigned long long nRecords_;
+};
+
+#endif
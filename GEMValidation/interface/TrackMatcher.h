@@ -71,6 +71,11 @@ class TrackMatcher : public CSCStubMatcher
   GMTCand* bestGMTCand(bool sortPtFirst=1) const;
   L1Extra* bestL1Extra(bool sortPtFirst=1) const;
 
+  /// dR between a TF track and the SimTrack bent to the 2nd station
+  double deltaR(const TFTrack& track) const;
+  /// eta and phi of the intersection of a LCT key wiregroup and half-strip
+  std::pair<float, float> intersectionEtaPhi(CSCDetId id, int wg, int hs) const;
+
   //bool passDPhicut_TFTrack(int st) const;
   
  private:
@@ -93,7 +98,6 @@ class TrackMatcher : public CSCStubMatcher
   void matchL1MuonParticleToSimTrack(const l1extra::L1MuonParticleCollection& tracks);
 
   csctf::TrackStub buildTrackStub(const CSCCorrelatedLCTDigi& d, CSCDetId id);
-  std::pair<float, float> intersectionEtaPhi(CSCDetId id, int wg, int hs);
   std::vector< EtaPhi > simTrackPropagateGPs_even_;
   std::vector< EtaPhi > simTrackPropagateGPs_odd_;
   std::map<int, GlobalPoint> interStatPropagation_odd_;
@@ -131,6 +135,9 @@ class TrackMatcher : public CSCStubMatcher
   double deltaRL1Extra_;
   
   bool runTFTrack_;
+  // legacy dR matching of all the TF tracks; the CSCTF tracks are matched by
+  // stub ownership in L1TrackFinderTrackMatcher
+  bool matchTFTrackByDeltaR_;
 
   std::vector<TFTrack*> tfTracks_;
   std::vector<TFCand*> tfCands_;
@@ -164,12 +164,14 @@ void FastGEMCSCProducer::produce(edm::Event& ev, const edm::EventSetup& es)
     }
   }
 
+  // gen particle ancestry of this event, shared by the matchers of all SimTracks
+  const auto genAncestry(DisplacedGENMuonMatcher::eventAncestry(cfg_, ev));
   for (auto& t: *sim_tracks.product())
   {
     if (!isSimTrackGood(t)) continue;
 
     // match hits, digis and LCTs to this SimTrack
-    SimTrackMatchManager match(t, sim_vert[t.vertIndex()], cfg_, ev, es);
+    SimTrackMatchManager match(t, sim_vert[t.vertIndex()], cfg_, ev, es, genAncestry.get());
 
     processStubs4SimTrack(mutable_stubs, match);
   }
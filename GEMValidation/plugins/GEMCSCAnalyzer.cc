@@ -13,7 +13,15 @@
 #include "FWCore/Framework/interface/MakerMacros.h"
 #include "FWCore/Framework/interface/Event.h"
 #include "FWCore/Framework/interface/ESHandle.h"
+#include "FWCore/Framework/interface/LuminosityBlock.h"
+#include "FWCore/Framework/interface/FileBlock.h"
+#include "FWCore/Framework/interface/NoProxyException.h"
+#include "FWCore/Framework/interface/EventSetupRecordKey.h"
+#include "FWCore/Framework/interface/ValidityInterval.h"
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
 #include "FWCore/ParameterSet/interface/ParameterSet.h"
+#include "FWCore/ParameterSet/interface/Registry.h"
+#include "FWCore/Utilities/interface/Exception.h"
 #include "FWCore/ServiceRegistry/interface/Service.h"
 #include "CommonTools/UtilAlgos/interface/TFileService.h"
 
@@ -23,9 +31,16 @@
 #include "SimDataFormats/TrackingHit/interface/PSimHitContainer.h"
 #include "SimDataFormats/Track/interface/SimTrackContainer.h"
 
+#include "Geometry/Records/interface/MuonGeometryRecord.h"
+#include "MagneticField/Records/interface/IdealMagneticFieldRecord.h"
+
 #include "GEMCode/GEMValidation/interface/SimTrackMatchManager.h"
 #include "GEMCode/GEMValidation/interface/Helpers.h"
 #include "GEMCode/GEMValidation/interface/Ptassignment.h"
+#include "GEMCode/GEMValidation/interface/GEMCSCdPhiLUT.h"
+#include "GEMCode/GEMValidation/interface/MyTrackEff.h"
+#include "GEMCode/GEMValidation/interface/TrackEffRecord.h"
+#include "GEMCode/GEMValidation/interface/TrackEffCache.h"
 
 #include "TTree.h"
 
@@ -42,6 +57,9 @@ using namespace matching;
 // "signed" LCT bend pattern
 const int LCT_BEND_PATTERN[11] = { -99,  -5,  4, -4,  3, -3,  2, -2,  1, -1,  0};
 
+// version of the trk_eff rows: bump when analyzeTrackEff changes, to invalidate the result caches
+const char TRACK_EFF_VERSION[] = "trk_eff 2";
+
 
 struct MyTrackChamberDelta
 {
@@ -80,678 +98,6 @@ struct MyTrackChamberDelta
 };
 
 
-struct MyTrackEff
-{
-  void init(); // initialize to default values
-  TTree* book(TTree *t, const std::string & name = "trk_eff");
-
-  Int_t lumi;
-  Int_t run;
-  Int_t event;
-
-  Float_t pt, eta, phi;
-  Char_t charge;
-  Char_t endcap;
-  Char_t chamber_ME1_csc_sh;//bit1:odd, bit2:even
-  Char_t chamber_ME2_csc_sh;
-  Char_t chamber_odd; // bit1: has GEM pad   bit2: has CSC LCT
-  Char_t chamber_even; // bit1: has GEM pad   bit2: has CSC LCT
-  Float_t bending_sh;
-  Float_t phi_cscsh_even, phi_cscsh_odd, eta_cscsh_even, eta_cscsh_odd;
-  Float_t dphi_sh_even,dphi_sh_odd;
-  Float_t pt_sh,ptphi_sh,pteta_sh;
-
-  Char_t has_csc_sh; // #layers with SimHits > minHitsChamber    bit1: in odd, bit2: even
-  Char_t has_csc_strips; // #layers with comparator digis > minHitsChamber    bit1: in odd, bit2: even
-  Char_t has_csc_wires; // #layers with wire digis > minHitsChamber    bit1: in odd, bit2: even
-
-  Char_t has_clct; // bit1: in odd, bit2: even
-  Char_t has_alct; // bit1: in odd, bit2: even
-  Char_t has_lct; // bit1: in odd, bit2: even
-
-  Int_t bend_lct_odd;
-  Int_t bend_lct_even;
-  Int_t bx_lct_odd;
-  Int_t bx_lct_even;
-
-
-  Float_t hs_lct_odd;
-  Float_t wg_lct_odd;
-  Float_t hs_lct_even;
-  Float_t wg_lct_even;
-
-  Float_t phi_lct_odd;
-  Float_t phi_lct_even;
-  Float_t eta_lct_odd;
-  Float_t eta_lct_even;
-  Float_t dphi_lct_odd; // dphi stored as data member in LCT
-  Float_t dphi_lct_even;
-  Bool_t passdphi_odd;
-  Bool_t passdphi_even;
-
-  Int_t wiregroup_odd;
-  Int_t wiregroup_even;
-  Int_t halfstrip_odd;
-  Int_t halfstrip_even;
-
-  Int_t quality_clct_odd;
-  Int_t quality_clct_even;
-  Int_t quality_alct_odd;
-  Int_t quality_alct_even;
-
-  Int_t nlayers_csc_sh_odd;
-  Int_t nlayers_wg_dg_odd;
-  Int_t nlayers_st_dg_odd;
-  Int_t nlayers_csc_sh_even;
-  Int_t nlayers_wg_dg_even;
-  Int_t nlayers_st_dg_even;
-  Int_t pad_odd;
-  Int_t pad_even;
-  Int_t Copad_odd;
-  Int_t Copad_even;
-  Int_t hsfromgem_odd;
-  Int_t hsfromgem_even;
-
-  Char_t has_gem_sh; // bit1: in odd, bit2: even
-  Char_t has_gem_sh2; // has SimHits in 2 layers  bit1: in odd, bit2: even
-  Char_t has_gem_dg; // bit1: in odd, bit2: even
-  Char_t has_gem_dg2; // has pads in 2 layers  bit1: in odd, bit2: even
-  Char_t has_gem_pad; // bit1: in odd, bit2: even
-  Char_t has_gem_pad2; // has pads in 2 layers  bit1: in odd, bit2: even
-  Char_t has_gem_copad; // bit1: in odd, bit2: even
-
-  Float_t strip_gemsh_odd; // average hits' strip
-  Float_t strip_gemsh_even;
-  Float_t eta_gemsh_odd;
-  Float_t eta_gemsh_even;
-  Float_t phi_gemsh_odd;
-  Float_t phi_gemsh_even;
-  Int_t strip_gemdg_odd; // median digis' strip
-  Int_t strip_gemdg_even;
-
-  Char_t has_rpc_sh; // bit1: in odd, bit2: even
-  Char_t has_rpc_dg; // bit1: in odd, bit2: even
-  Int_t strip_rpcdg_odd; // median digis' strip
-  Int_t strip_rpcdg_even;
-
-  Int_t bx_pad_odd;
-  Int_t bx_pad_even;
-  Float_t phi_pad_odd;
-  Float_t phi_pad_even;
-  Float_t eta_pad_odd;
-  Float_t eta_pad_even;
-
-  Float_t dphi_pad_odd;
-  Float_t dphi_pad_even;
-  Float_t deta_pad_odd;
-  Float_t deta_pad_even;
-
-  Int_t quality_odd;
-  Int_t quality_even;
-
-  Int_t hsfromrpc_odd; // extraplotate hs from rpc
-  Int_t hsfromrpc_even;
-
-  Int_t bx_rpcstrip_odd;
-  Int_t bx_rpcstrip_even;
-  Float_t phi_rpcstrip_odd;
-  Float_t phi_rpcstrip_even;
-  Float_t eta_rpcstrip_odd;
-  Float_t eta_rpcstrip_even;
-
-  Float_t dphi_rpcstrip_odd;
-  Float_t dphi_rpcstrip_even;
-  Float_t deta_rpcstrip_odd;
-  Float_t deta_rpcstrip_even;
-
-  // Track properties
-  Int_t has_tfTrack;
-  Int_t has_tfCand;
-  Int_t has_gmtRegCand;
-  Int_t has_gmtCand;
- 
-  //csctf
-  Float_t trackpt, tracketa, trackphi;
-  UInt_t quality_packed, pt_packed, eta_packed, phi_packed;
-  UInt_t chargesign;
-  UInt_t rank;
-  UInt_t nstubs;
-  UInt_t deltaphi12, deltaphi23; 
-  Bool_t hasME1,hasME2;
-  Char_t chamberME1,chamberME2;//bit1: odd, bit2: even
-  Int_t ME1_ring, ME2_ring;
-  Int_t ME1_hs, ME2_hs, ME1_wg,ME2_wg;
-  Float_t dphiGE11,dphiGE21;
-  Bool_t passGE11,passGE21;
-  Bool_t passGE11_pt5, passGE11_pt7, passGE11_pt10, passGE11_pt15, passGE11_pt20, passGE11_pt30, passGE11_pt40;
-  Bool_t passGE21_pt5, passGE21_pt7, passGE21_pt10, passGE21_pt15, passGE21_pt20, passGE21_pt30, passGE21_pt40;
-  Bool_t passGE11_simpt, passGE21_simpt;
-  Float_t deltaR;
-  Float_t lctdphi12;
-  Float_t eta_propagated_ME1;
-  Float_t eta_propagated_ME2;
-  Float_t eta_propagated_ME3;
-  Float_t eta_propagated_ME4;
-  Float_t phi_propagated_ME1;
-  Float_t phi_propagated_ME2;
-  Float_t phi_propagated_ME3;
-  Float_t phi_propagated_ME4;
-  Float_t eta_ME1_TF;
-  Float_t eta_ME2_TF;
-  Float_t eta_ME3_TF;
-  Float_t eta_ME4_TF;
-  Float_t phi_ME1_TF;
-  Float_t phi_ME2_TF;
-  Float_t phi_ME3_TF;
-  Float_t phi_ME4_TF;
-
-  Float_t eta_interStat12;
-  Float_t phi_interStat12;
-  Float_t eta_interStat23;
-  Float_t phi_interStat23;
-  Float_t eta_interStat13;
-  Float_t phi_interStat13;
-
-  Bool_t allstubs_matched_TF;
-
-  Int_t has_l1Extra;
-  Float_t l1Extra_pt;
-  Float_t l1Extra_eta;
-  Float_t l1Extra_phi;
-  Float_t l1Extra_dR;
-  Int_t has_recoTrackExtra;
-  Float_t recoTrackExtra_pt_inner;
-  Float_t recoTrackExtra_eta_inner;
-  Float_t recoTrackExtra_phi_inner;  
-  Float_t recoTrackExtra_pt_outer;
-  Float_t recoTrackExtra_eta_outer;
-  Float_t recoTrackExtra_phi_outer;
-  Int_t has_recoTrack;
-  Float_t recoTrack_pt_outer;
-  Float_t recoTrack_eta_outer;
-  Float_t recoTrack_phi_outer;
-  Int_t has_recoChargedCandidate;
-  Float_t recoChargedCandidate_pt;
-  Float_t recoChargedCandidate_eta;
-  Float_t recoChargedCandidate_phi;
-
-  Int_t recoChargedCandidate_nValidCSCHits;
-  Int_t recoChargedCandidate_nValidRPCHits;
-  Int_t recoChargedCandidate_nValidDTHits;
-
-
-  // pt assginment
-  Float_t pt_position_sh;
-  Float_t pt_position;
-  Float_t pt_position2;
-  Bool_t hasSt1St2St3;
-  Bool_t hasSt1St2St3_sh;
-};
-
-void MyTrackEff::init()
-{
-  lumi = -99;
-  run = -99;
-  event = -99;
-
-  pt = 0.;
-  phi = 0.;
-  eta = -9.;
-  charge = -9;
-  endcap = -9;
-  chamber_ME1_csc_sh=0;
-  chamber_ME2_csc_sh=0;
-  chamber_odd = 0;
-  chamber_even = 0;
-  quality_odd = 0;
-  quality_even = 0;
-  bending_sh = -10;
-  phi_cscsh_even = -9.0;
-  phi_cscsh_odd = -9.0;
-  eta_cscsh_even = -9.0;
-  eta_cscsh_odd = -9.0;
-  pt_sh = -9.0;
-  pteta_sh = 0;
-  ptphi_sh = -9.0;
-
-  has_csc_sh = 0;
-  has_csc_strips = 0;
-  has_csc_wires = 0;
-  has_alct = 0;
-  has_clct = 0;
-  has_lct = 0;
-  bend_lct_odd = -9;
-  bend_lct_even = -9;
-  bx_lct_odd = -9;
-  bx_lct_even = -9;
-  hs_lct_odd = 0;
-  hs_lct_even = 0;
-  wg_lct_odd = 0;
-  wg_lct_even = 0;
-  phi_lct_odd = -9.;
-  phi_lct_even = -9.;
-  eta_lct_odd = -9.;
-  eta_lct_even = -9.;
-  dphi_lct_odd = -9.;
-  dphi_lct_even = -9.;
-  passdphi_odd = false;
-  passdphi_even = false;
-
-  wiregroup_odd = -1;
-  wiregroup_even =-1; 
-  halfstrip_odd =-1;
-  halfstrip_even = -1;
-  quality_clct_odd = -1;
-  quality_clct_even = -1;
-  quality_alct_odd = -1;
-  quality_alct_even = -1;
-  nlayers_csc_sh_odd = -1;
-  nlayers_wg_dg_odd = -1;
-  nlayers_st_dg_odd = -1;
-  nlayers_csc_sh_even = -1;
-  nlayers_wg_dg_even = -1;
-  nlayers_st_dg_even = -1;
-  pad_odd = -1;
-  pad_even = -1;
-  Copad_odd = -1;
-  Copad_even = -1;
-
-  hsfromgem_odd = -1;
-  hsfromgem_even = -1;
-
-  has_gem_sh = 0;
-  has_gem_sh2 = 0;
-  has_gem_dg = 0;
-  has_gem_dg2 = 0;
-  has_gem_pad = 0;
-  has_gem_pad2 = 0;
-  has_gem_copad = 0;
-  strip_gemsh_odd = -9.;
-  strip_gemsh_even = -9.;
-  eta_gemsh_odd = -9.;
-  eta_gemsh_even = -9.;
-  phi_gemsh_odd = -9.;
-  phi_gemsh_even = -9.;
-  dphi_sh_odd = -9;
-  dphi_sh_even = -9;
-  strip_gemdg_odd = -9;
-  strip_gemdg_even = -9;
- 
-  has_rpc_sh = 0;
-  has_rpc_dg = 0; // bit1: in odd, bit2: even
-  strip_rpcdg_odd = -1;
-  strip_rpcdg_even = -1;
-
-  hsfromrpc_odd = 0;
-  hsfromrpc_even = 0;
-
-  bx_pad_odd = -9;
-  bx_pad_even = -9;
-  phi_pad_odd = -9.;
-  phi_pad_even = -9.;
-  eta_pad_odd = -9.;
-  eta_pad_even = -9.;
-  dphi_pad_odd = -9.;
-  dphi_pad_even = -9.;
-  deta_pad_odd = -9.;
-  deta_pad_even = -9.;
-
-  bx_rpcstrip_odd = -9;
-  bx_rpcstrip_even = -9;
-  phi_rpcstrip_odd = -9.;
-  phi_rpcstrip_even = -9.;
-  eta_rpcstrip_odd = -9.;
-  eta_rpcstrip_even = -9.;
-  dphi_rpcstrip_odd = -9.;
-  dphi_rpcstrip_even = -9.;
-  deta_rpcstrip_odd = -9.;
-  deta_rpcstrip_even = -9.;
-
-  // Track properties
-  has_tfTrack = -99;
-  has_tfCand = -99;
-  has_gmtRegCand = -99;
-  has_gmtCand = -99;
-
-  //csctf
-  trackpt = 0 ;
-  tracketa = 0;
-  trackphi = -9;
-  quality_packed = 0;
-  pt_packed = 0;
-  eta_packed = 0;
-  phi_packed = 0;
-  ME1_hs = -1;
-  ME1_wg = -1;
-  ME2_hs = -1;
-  ME2_wg = -1;
-  chargesign =99;
-  rank = 0;
-  deltaphi12 = 0;
-  deltaphi23 = 0;; 
-  hasME1 = false;
-  hasME2 = false;
-  ME1_ring = -1;
-  ME2_ring = -1;
-  chamberME1 = 0;
-  chamberME2 = 0;
-  dphiGE11 = -99.0;
-  dphiGE21 = -99.0;
-  passGE11 = false;
-  passGE11_pt5 = false;
-  passGE11_pt7 = false;
-  passGE11_pt10 = false;
-  passGE11_pt15 = false;
-  passGE11_pt20 = false;
-  passGE11_pt30 = false;
-  passGE11_pt40 = false;
-  passGE21 = false;
-  passGE21_pt5 = false;
-  passGE21_pt7 = false;
-  passGE21_pt10 = false;
-  passGE21_pt15 = false;
-  passGE21_pt20 = false;
-  passGE21_pt30 = false;
-  passGE21_pt40 = false;
-  passGE11_simpt = false;
-  passGE21_simpt = false;//to debug dphi cut eff
-  nstubs = 0;
-  deltaR = 10;
-  lctdphi12 = -99;
-
-  eta_propagated_ME1 = -9;
-  eta_propagated_ME2 = -9;
-  eta_propagated_ME3 = -9;
-  eta_propagated_ME4 = -9;
-  phi_propagated_ME1 = -9;
-  phi_propagated_ME2 = -9;
-  phi_propagated_ME3 = -9;
-  phi_propagated_ME4 = -9;
-  eta_ME1_TF = -9;
-  eta_ME2_TF = -9;
-  eta_ME3_TF = -9;
-  eta_ME4_TF = -9;
-  phi_ME1_TF = -9;
-  phi_ME2_TF = -9;
-  phi_ME3_TF = -9;
-  phi_ME4_TF = -9;
- 
-  eta_interStat12 = -9;
-  phi_interStat12 = -9;
-  eta_interStat23 = -9;
-  phi_interStat23 = -9;
-  eta_interStat13 = -9;
-  phi_interStat13 = -9;
-  
-  allstubs_matched_TF = false; 
-
-  has_l1Extra = 0;
-  l1Extra_pt = -99;
-  l1Extra_eta = -99;
-  l1Extra_phi = -99;
-  l1Extra_dR = -99;
-  has_recoTrackExtra = 0;
-  recoTrackExtra_pt_inner = - 99.;
-  recoTrackExtra_eta_inner = - 99.;
-  recoTrackExtra_phi_inner = - 99.;  
-  recoTrackExtra_pt_outer = - 99.;
-  recoTrackExtra_eta_outer = - 99.;
-  recoTrackExtra_phi_outer = - 99.;
-  has_recoTrack = 0;
-  recoTrack_pt_outer = - 99.;
-  recoTrack_eta_outer = - 99.;
-  recoTrack_phi_outer = - 99.;
-  has_recoChargedCandidate = 0;
-  recoChargedCandidate_pt = - 99.;
-  recoChargedCandidate_eta = - 99.;
-  recoChargedCandidate_phi = - 99.;
-
-  recoChargedCandidate_nValidDTHits = 0;
-  recoChargedCandidate_nValidCSCHits = 0;
-  recoChargedCandidate_nValidRPCHits = 0;
-
-  pt_position_sh=-1;
-  pt_position=-1;
-  pt_position2=-1;
-  hasSt1St2St3=false;
-  hasSt1St2St3_sh=false;
-}
-
-
-TTree* MyTrackEff::book(TTree *t, const std::string & name)
-{
-  edm::Service< TFileService > fs;
-  t = fs->make<TTree>(name.c_str(), name.c_str());
-
-  t->Branch("lumi", &lumi);
-  t->Branch("run", &run);
-  t->Branch("event", &event);
-
-  t->Branch("pt", &pt);
-  t->Branch("eta", &eta);
-  t->Branch("phi", &phi);
-  t->Branch("charge", &charge);
-  t->Branch("endcap", &endcap);
-  t->Branch("chamber_ME1_csc_sh", &chamber_ME1_csc_sh);
-  t->Branch("chamber_ME2_csc_sh", &chamber_ME2_csc_sh);
-  t->Branch("chamber_odd", &chamber_odd);
-  t->Branch("chamber_even", &chamber_even);
-  t->Branch("quality_odd", &quality_odd);
-  t->Branch("quality_even", &quality_even);
-  t->Branch("bending_sh", &bending_sh);
-  t->Branch("phi_cscsh_even", &phi_cscsh_even);
-  t->Branch("phi_cscsh_odd", &phi_cscsh_odd);
-  t->Branch("eta_cscsh_even", &eta_cscsh_even);
-  t->Branch("eta_cscsh_odd", &eta_cscsh_odd);
-  t->Branch("pt_sh", &pt_sh);
-  t->Branch("pteta_sh", &pteta_sh);
-  t->Branch("ptphi_sh", &ptphi_sh);
-  t->Branch("has_csc_sh", &has_csc_sh);
-  t->Branch("has_csc_strips", &has_csc_strips);
-  t->Branch("has_csc_wires", &has_csc_wires);
-  t->Branch("has_clct", &has_clct);
-  t->Branch("has_alct", &has_alct);
-  t->Branch("has_lct", &has_lct);
-  t->Branch("bend_lct_odd", &bend_lct_odd);
-  t->Branch("bend_lct_even", &bend_lct_even);
-  t->Branch("bx_lct_odd", &bx_lct_odd);
-  t->Branch("bx_lct_even", &bx_lct_even);
-  t->Branch("hs_lct_odd", &hs_lct_odd);
-  t->Branch("hs_lct_even", &hs_lct_even);
-  t->Branch("wg_lct_even", &wg_lct_even);
-  t->Branch("wg_lct_odd", &wg_lct_odd);
-  t->Branch("phi_lct_odd", &phi_lct_odd);
-  t->Branch("phi_lct_even", &phi_lct_even);
-  t->Branch("eta_lct_odd", &eta_lct_odd);
-  t->Branch("eta_lct_even", &eta_lct_even);
-  t->Branch("dphi_lct_odd", &dphi_lct_odd);
-  t->Branch("dphi_lct_even", &dphi_lct_even);
-  t->Branch("passdphi_odd", &passdphi_odd);
-  t->Branch("passdphi_even", &passdphi_even);
-  
-  t->Branch("wiregroup_odd", &wiregroup_odd);
-  t->Branch("wiregroup_even", &wiregroup_even);
-  t->Branch("halfstrip_odd", &halfstrip_odd);
-  t->Branch("halfstrip_even", &halfstrip_even);
-  t->Branch("quality_clct_odd", &quality_clct_odd);
-  t->Branch("quality_clct_even", &quality_clct_even);
-  t->Branch("quality_alct_odd", &quality_alct_odd);
-  t->Branch("quality_alct_even", &quality_alct_even);
-  t->Branch("nlayers_csc_sh_odd", &nlayers_csc_sh_odd);
-  t->Branch("nlayers_csc_sh_even", &nlayers_csc_sh_even);
-  t->Branch("nlayers_wg_dg_odd", &nlayers_wg_dg_odd);
-  t->Branch("nlayers_wg_dg_even", &nlayers_wg_dg_even);
-  t->Branch("nlayers_st_dg_odd", &nlayers_st_dg_odd);
-  t->Branch("nlayers_st_dg_even", &nlayers_st_dg_even);
-
-  t->Branch("pad_odd", &pad_odd);
-  t->Branch("pad_even", &pad_even);
-  t->Branch("Copad_odd", &Copad_odd);
-  t->Branch("copad_even", &Copad_even);
-
-  t->Branch("hsfromgem_odd", &hsfromgem_odd);
-  t->Branch("hsfromgem_even", &hsfromgem_even);
-
-  t->Branch("has_gem_sh", &has_gem_sh);
-  t->Branch("has_gem_sh2", &has_gem_sh2);
-  t->Branch("has_gem_dg", &has_gem_dg);
-  t->Branch("has_gem_dg2", &has_gem_dg2);
-  t->Branch("has_gem_pad", &has_gem_pad);
-  t->Branch("has_gem_pad2", &has_gem_pad2);
-  t->Branch("has_gem_copad", &has_gem_copad);
-  t->Branch("strip_gemsh_odd", &strip_gemsh_odd);
-  t->Branch("strip_gemsh_even", &strip_gemsh_even);
-  t->Branch("eta_gemsh_odd", &eta_gemsh_odd);
-  t->Branch("eta_gemsh_even", &eta_gemsh_even);
-  t->Branch("phi_gemsh_odd", &phi_gemsh_odd);
-  t->Branch("phi_gemsh_even", &phi_gemsh_even);
-  t->Branch("dphi_sh_odd", &dphi_sh_odd);
-  t->Branch("dphi_sh_even", &dphi_sh_even);
-  t->Branch("strip_gemdg_odd", &strip_gemdg_odd);
-  t->Branch("strip_gemdg_even", &strip_gemdg_even);
-
-  t->Branch("has_rpc_sh", &has_rpc_sh);
-  t->Branch("has_rpc_dg", &has_rpc_dg);
-  t->Branch("strip_rpcdg_odd", &strip_rpcdg_odd);
-  t->Branch("strip_rpcdg_even", &strip_rpcdg_even);
-  t->Branch("hsfromrpc_odd", &hsfromrpc_odd);
-  t->Branch("hsfromrpc_even", &hsfromrpc_even);
-
-  t->Branch("bx_pad_odd", &bx_pad_odd);
-  t->Branch("bx_pad_even", &bx_pad_even);
-  t->Branch("phi_pad_odd", &phi_pad_odd);
-  t->Branch("phi_pad_even", &phi_pad_even);
-  t->Branch("eta_pad_odd", &eta_pad_odd);
-  t->Branch("eta_pad_even", &eta_pad_even);
-  t->Branch("dphi_pad_odd", &dphi_pad_odd);
-  t->Branch("dphi_pad_even", &dphi_pad_even);
-  t->Branch("deta_pad_odd", &deta_pad_odd);
-  t->Branch("deta_pad_even", &deta_pad_even);
-
-  t->Branch("bx_rpcstrip_odd", &bx_rpcstrip_odd);
-  t->Branch("bx_rpcstrip_even", &bx_rpcstrip_even);
-  t->Branch("phi_rpcstrip_odd", &phi_rpcstrip_odd);
-  t->Branch("phi_rpcstrip_even", &phi_rpcstrip_even);
-  t->Branch("eta_rpcstrip_odd", &eta_rpcstrip_odd);
-  t->Branch("eta_rpcstrip_even", &eta_rpcstrip_even);
-  t->Branch("dphi_rpcstrip_odd", &dphi_rpcstrip_odd);
-  t->Branch("dphi_rpcstrip_even", &dphi_rpcstrip_even);
-  t->Branch("deta_rpcstrip_odd", &deta_rpcstrip_odd);
-  t->Branch("deta_rpcstrip_even", &deta_rpcstrip_even);
-
-  //t->Branch("", &);
-  t->Branch("has_tfTrack", &has_tfTrack);
-  t->Branch("has_tfCand", &has_tfCand);
-  t->Branch("has_gmtRegCand", &has_gmtRegCand);
-  t->Branch("has_gmtCand", &has_gmtCand);
-  
-  //csctftrack
-  t->Branch("trackpt", &trackpt);
-  t->Branch("tracketa", &tracketa);
-  t->Branch("trackphi", &trackphi);
-  t->Branch("quality_packed",&quality_packed);
-  t->Branch("rank",&rank);
-  t->Branch("pt_packed",&pt_packed);
-  t->Branch("eta_packed",&eta_packed);
-  t->Branch("phi_packed",&phi_packed);
-  t->Branch("chargesign",&chargesign);
-  t->Branch("deltaphi12",&deltaphi12);
-  t->Branch("deltaphi23",&deltaphi23);
-  t->Branch("hasME1",&hasME1);
-  t->Branch("hasME2",&hasME2);
-  t->Branch("ME1_ring",&ME1_ring);
-  t->Branch("ME2_ring",&ME2_ring);
-  t->Branch("chamberME1",&chamberME1);
-  t->Branch("chamberME2",&chamberME2);
-  t->Branch("ME1_hs",&ME1_hs);
-  t->Branch("ME1_wg",&ME1_wg);
-  t->Branch("ME2_hs",&ME2_hs);
-  t->Branch("ME2_wg",&ME2_wg);
-  t->Branch("dphiGE11",&dphiGE11);
-  t->Branch("dphiGE21",&dphiGE21);
-  t->Branch("passGE11",&passGE11);
-  t->Branch("passGE11_pt5",&passGE11_pt5);
-  t->Branch("passGE11_pt7",&passGE11_pt7);
-  t->Branch("passGE11_pt10",&passGE11_pt10);
-  t->Branch("passGE11_pt15",&passGE11_pt15);
-  t->Branch("passGE11_pt20",&passGE11_pt20);
-  t->Branch("passGE11_pt30",&passGE11_pt30);
-  t->Branch("passGE11_pt40",&passGE11_pt40);
-  t->Branch("passGE21",&passGE21);
-  t->Branch("passGE21_pt5",&passGE21_pt5);
-  t->Branch("passGE21_pt7",&passGE21_pt7);
-  t->Branch("passGE21_pt10",&passGE21_pt10);
-  t->Branch("passGE21_pt15",&passGE21_pt15);
-  t->Branch("passGE21_pt20",&passGE21_pt20);
-  t->Branch("passGE21_pt30",&passGE21_pt30);
-  t->Branch("passGE21_pt40",&passGE21_pt40);
-  t->Branch("passGE11_simpt",&passGE11_simpt);
-  t->Branch("passGE21_simpt",&passGE21_simpt);
-  t->Branch("nstubs",&nstubs);
-  t->Branch("deltaR",&deltaR);
-  t->Branch("lctdphi12",&lctdphi12);
-   
-  t->Branch("eta_propagated_ME1",&eta_propagated_ME1);
-  t->Branch("eta_propagated_ME2",&eta_propagated_ME2);
-  t->Branch("eta_propagated_ME3",&eta_propagated_ME3);
-  t->Branch("eta_propagated_ME4",&eta_propagated_ME4);
-  t->Branch("phi_propagated_ME1",&phi_propagated_ME1);
-  t->Branch("phi_propagated_ME2",&phi_propagated_ME2);
-  t->Branch("phi_propagated_ME3",&phi_propagated_ME3);
-  t->Branch("phi_propagated_ME4",&phi_propagated_ME4);
-  t->Branch("eta_ME1_TF",&eta_ME1_TF);
-  t->Branch("eta_ME2_TF",&eta_ME2_TF);
-  t->Branch("eta_ME3_TF",&eta_ME3_TF);
-  t->Branch("eta_ME4_TF",&eta_ME4_TF);
-  t->Branch("phi_ME1_TF",&phi_ME1_TF);
-  t->Branch("phi_ME2_TF",&phi_ME2_TF);
-  t->Branch("phi_ME3_TF",&phi_ME3_TF);
-  t->Branch("phi_ME4_TF",&phi_ME4_TF);
-
-  t->Branch("eta_interStat12",&eta_interStat12);
-  t->Branch("phi_interStat12",&phi_interStat12);
-  t->Branch("eta_interStat23",&eta_interStat23);
-  t->Branch("phi_interStat23",&phi_interStat23);
-  t->Branch("eta_interStat13",&eta_interStat13);
-  t->Branch("phi_interStat13",&phi_interStat13);
-  
-  t->Branch("allstubs_matched_TF",&allstubs_matched_TF);
-
-  t->Branch("has_l1Extra", &has_l1Extra);
-  t->Branch("l1Extra_pt", &l1Extra_pt);
-  t->Branch("l1Extra_eta", &l1Extra_eta);
-  t->Branch("l1Extra_phi", &l1Extra_phi);
-  t->Branch("l1Extra_dR", &l1Extra_dR);
-  t->Branch("has_recoTrackExtra", &has_recoTrackExtra);
-  t->Branch("recoTrackExtra_pt_inner", &recoTrackExtra_pt_inner);
-  t->Branch("recoTrackExtra_eta_inner", &recoTrackExtra_eta_inner);
-  t->Branch("recoTrackExtra_phi_inner", &recoTrackExtra_phi_inner);
-  t->Branch("recoTrackExtra_pt_outer", &recoTrackExtra_pt_outer);
-  t->Branch("recoTrackExtra_eta_outer", &recoTrackExtra_eta_outer);
-  t->Branch("recoTrackExtra_phi_outer", &recoTrackExtra_phi_outer);
-  t->Branch("has_recoTrack", &has_recoTrack);
-  t->Branch("recoTrack_pt_outer", &recoTrack_pt_outer);
-  t->Branch("recoTrack_eta_outer", &recoTrack_eta_outer);
-  t->Branch("recoTrack_phi_outer", &recoTrack_phi_outer);
-  t->Branch("has_recoChargedCandidate", &has_recoChargedCandidate);
-  t->Branch("recoChargedCandidate_pt", &recoChargedCandidate_pt);
-  t->Branch("recoChargedCandidate_eta", &recoChargedCandidate_eta);
-  t->Branch("recoChargedCandidate_phi", &recoChargedCandidate_phi); 
-
-  t->Branch("recoChargedCandidate_nValidDTHits", &recoChargedCandidate_nValidDTHits); 
-  t->Branch("recoChargedCandidate_nValidCSCHits", &recoChargedCandidate_nValidCSCHits); 
-  t->Branch("recoChargedCandidate_nValidRPCHits", &recoChargedCandidate_nValidRPCHits); 
-
-  
-  t->Branch("pt_position_sh", &pt_position_sh); 
-  t->Branch("pt_position", &pt_position); 
-  t->Branch("pt_position2", &pt_position2); 
-  t->Branch("hasSt1St2St3", &hasSt1St2St3); 
-  t->Branch("hasSt1St2St3_sh", &hasSt1St2St3_sh); 
-
-  return t;
-}
-
 // --------------------------- GEMCSCAnalyzer ---------------------------
 
 class GEMCSCAnalyzer : public edm::EDAnalyzer
@@ -766,6 +112,12 @@ public:
 
   virtual void analyze(const edm::Event&, const edm::EventSetup&);
 
+  virtual void beginLuminosityBlock(const edm::LuminosityBlock&, const edm::EventSetup&);
+
+  virtual void endLuminosityBlock(const edm::LuminosityBlock&, const edm::EventSetup&);
+
+  virtual void respondToOpenInputFile(const edm::FileBlock&);
+
   static void fillDescriptions(edm::ConfigurationDescriptions& descriptions);
   
 private:
@@ -777,7 +129,22 @@ private:
   void printout(SimTrackMatchManager& match, int trk_no, const char msg[300]);
 
   bool isSimTrackGood(const SimTrack &t);
+  // true unless maxEvents, skipEvents or eventsToProcess can cut luminosity blocks
+  bool readsWholeBlocks() const;
   int detIdToMEStation(int st, int ri);
+  // sets a bit of passdphi_wp for every dPhi working point passed
+  void passDPhiWorkingPoints(MyTrackEff& etrk, const CSCDetId& id, int chargesign, float dphi, float pt, UChar_t bit);
+  // assign the GMT candidates and L1Extra muons to all the good SimTracks of the event at once
+  void associateL1(const edm::Event& ev, std::vector<std::unique_ptr<SimTrackMatchManager> >& matches);
+  // assign the CSCTF tracks to the SimTracks that own their stubs
+  void associateTfTracks(const edm::Event& ev, const edm::EventSetup& es,
+                         std::vector<std::unique_ptr<SimTrackMatchManager> >& matches);
+  // trigger scales, fetched again only when their IOV changes; false if they are unavailable
+  bool fetchScales(const edm::EventSetup& es);
+  // ES sources, producers and prefers of the process, for the result cache key
+  std::string eventSetupConfiguration() const;
+  // IOVs of the records the trk_eff rows depend on, for the result cache key
+  std::string conditionsIOVs(const edm::EventSetup& es) const;
   
   edm::ParameterSet cfg_;
   edm::InputTag simInputLabel_;
@@ -791,6 +158,19 @@ private:
   bool ntupleTrackEff_;
   bool matchprint_;
   double bendingcutPt_;
+  // GEM-CSC bending angle cuts; default ME11GEMdPhi/ME21GEMdPhi unless a "dPhiLUT" dictionary is given
+  GEMCSCdPhiLUT dPhiLUT_;
+  // additional cuts evaluated in the same pass ("dPhiWorkingPoints"), stored as passdphi_<name> bitmasks
+  std::vector<GEMCSCdPhiLUT> dPhiWorkingPoints_;
+  std::vector<std::string> dPhiWorkingPointNames_;
+  // CSCTF track matching by stub ownership; its TFTrack pool is reused from event to event
+  LCTSimTrackAssociation tfTrackAssociation_;
+  std::vector<edm::InputTag> cscTfTrackInputLabel_;
+  bool runCscTfTrack_;
+  edm::ESHandle<L1MuTriggerScales> muScalesHd_;
+  edm::ESHandle<L1MuTriggerPtScale> muPtScaleHd_;
+  unsigned long long muScalesCacheID_;
+  unsigned long long muPtScaleCacheID_;
   std::vector<string> cscStations_;
   std::vector<std::pair<int,int> > cscStationsCo_;
   std::set<int> stations_to_use_;
@@ -801,6 +181,16 @@ private:
   MyTrackEff  etrk_[12];
   MyTrackChamberDelta dtrk_;
 
+  // capture mode: the trk_eff rows are also written to a record file for replayTrackEff
+  std::unique_ptr<TrackEffRecordWriter> trackEffRecord_;
+
+  // trk_eff rows cached per luminosity block (resultCacheDir)
+  std::unique_ptr<TrackEffCache> trackEffCache_;
+  std::string inputFile_;
+  // stations of the current block filled from the cache, and whether all of them are
+  bool fromCache_[12];
+  bool blockFromCache_;
+
   int minNHitsChamberCSCSimHit_;
   int minNHitsChamberCSCWireDigi_;
   int minNHitsChamberCSCStripDigi_;
@@ -815,6 +205,17 @@ GEMCSCAnalyzer::GEMCSCAnalyzer(const edm::ParameterSet& ps)
 : cfg_(ps.getParameterSet("simTrackMatching"))
 , verbose_(ps.getUntrackedParameter<int>("verbose", 0))
 {
+  if (cfg_.exists("dPhiLUT")) dPhiLUT_ = GEMCSCdPhiLUT(cfg_.getParameterSet("dPhiLUT"));
+  if (cfg_.exists("dPhiWorkingPoints")) {
+    for (auto& wp: cfg_.getParameter<std::vector<edm::ParameterSet> >("dPhiWorkingPoints")) {
+      dPhiWorkingPoints_.push_back(GEMCSCdPhiLUT(wp));
+      dPhiWorkingPointNames_.push_back(wp.getParameter<std::string>("name"));
+    }
+    if (dPhiWorkingPoints_.size() > MyTrackEff::MaxDPhiWorkingPoints)
+      throw cms::Exception("Configuration") << "GEMCSCAnalyzer: at most " << int(MyTrackEff::MaxDPhiWorkingPoints)
+                                            << " dPhiWorkingPoints, got " << dPhiWorkingPoints_.size();
+  }
+
   cscStations_ = cfg_.getParameter<std::vector<string> >("cscStations");
   ntupleTrackChamberDelta_ = cfg_.getParameter<bool>("ntupleTrackChamberDelta");
   ntupleTrackEff_ = cfg_.getParameter<bool>("ntupleTrackEff");
@@ -830,6 +231,14 @@ GEMCSCAnalyzer::GEMCSCAnalyzer(const edm::ParameterSet& ps)
   simTrackMaxEta_ = simTrack.getParameter<double>("maxEta");
   simTrackOnlyMuon_ = simTrack.getParameter<bool>("onlyMuon");
     
+  auto cscTfTrack = cfg_.getParameter<edm::ParameterSet>("cscTfTrack");
+  cscTfTrackInputLabel_ = cscTfTrack.getParameter<std::vector<edm::InputTag> >("validInputTags");
+  runCscTfTrack_ = cscTfTrack.getParameter<bool>("run");
+  muScalesCacheID_ = 0ULL;
+  muPtScaleCacheID_ = 0ULL;
+  tfTrackAssociation_ = LCTSimTrackAssociation(cscTfTrack.getParameter<int>("minMatchedStubs"),
+                                               cscTfTrack.getParameter<int>("minBX"), cscTfTrack.getParameter<int>("maxBX"));
+
   auto cscSimHit = cfg_.getParameter<edm::ParameterSet>("cscSimHit");
   minNHitsChamberCSCSimHit_ = cscSimHit.getParameter<int>("minNHitsChamber");
 
@@ -862,9 +271,32 @@ GEMCSCAnalyzer::GEMCSCAnalyzer(const edm::ParameterSet& ps)
       stringstream ss;
       ss << "trk_eff_"<< cscStations_[s];
       std::cout <<"station to use "<< cscStations_[s]  << std::endl;
-      tree_eff_[s] = etrk_[s].book(tree_eff_[s], ss.str());
+      edm::Service< TFileService > fs;
+      tree_eff_[s] = fs->make<TTree>(ss.str().c_str(), ss.str().c_str());
+      etrk_[s].branches(tree_eff_[s], dPhiWorkingPointNames_);
+    }
+
+    const std::string recordFile(ps.getUntrackedParameter<std::string>("trackEffRecordFile", ""));
+    if (!recordFile.empty()) trackEffRecord_.reset(new TrackEffRecordWriter(recordFile, cscStations_, dPhiWorkingPointNames_));
+
+    const std::string cacheDir(ps.getUntrackedParameter<std::string>("resultCacheDir", ""));
+    if (!cacheDir.empty()) {
+      if (ntupleTrackChamberDelta_)
+        std::cout << "GEMCSCAnalyzer: no result cache together with ntupleTrackChamberDelta" << std::endl;
+      else if (!readsWholeBlocks())
+        std::cout << "GEMCSCAnalyzer: no result cache when maxEvents, skipEvents or eventsToProcess is set" << std::endl;
+      else {
+        // the stations to use only select the trees to fill
+        edm::ParameterSet config(cfg_);
+        config.eraseSimpleParameter("cscStationsToUse");
+        config.eraseSimpleParameter("matchprint");
+        trackEffCache_.reset(new TrackEffCache(cacheDir, std::string(TRACK_EFF_VERSION) + "\n" + config.dump() + "\n" +
+                                               eventSetupConfiguration(), cscStations_));
+      }
     }
   }
+  std::fill(fromCache_, fromCache_ + 12, false);
+  blockFromCache_ = false;
 
   cscStationsCo_.push_back(std::make_pair(-99,-99));
   cscStationsCo_.push_back(std::make_pair(1,-99));
@@ -888,11 +320,122 @@ int GEMCSCAnalyzer::detIdToMEStation(int st, int ri)
 }
 
 
+void GEMCSCAnalyzer::passDPhiWorkingPoints(MyTrackEff& etrk, const CSCDetId& id, int chargesign, float dphi, float pt, UChar_t bit)
+{
+  for (unsigned int w = 0; w < dPhiWorkingPoints_.size(); ++w) {
+    if (dPhiWorkingPoints_[w].pass(id, chargesign, dphi, pt, etrk.eta)) etrk.passdphi_wp[w] |= bit;
+  }
+}
+
+
 void GEMCSCAnalyzer::beginRun(const edm::Run &iRun, const edm::EventSetup &iSetup)
 {
 }
 
 
+void GEMCSCAnalyzer::respondToOpenInputFile(const edm::FileBlock& fb)
+{
+  inputFile_ = fb.fileName();
+}
+
+
+void GEMCSCAnalyzer::beginLuminosityBlock(const edm::LuminosityBlock& lumi, const edm::EventSetup& es)
+{
+  blockFromCache_ = false;
+  if (!trackEffCache_) return;
+
+  std::ostringstream history;
+  history << lumi.processHistoryID();
+  trackEffCache_->beginBlock(inputFile_, history.str(), lumi.run(), lumi.luminosityBlock(), conditionsIOVs(es));
+
+  // the cached rows are filled now, the events are analyzed only for the other stations
+  blockFromCache_ = true;
+  unsigned long long nCached = 0;
+  for (auto s: stations_to_use_) {
+    auto rows(trackEffCache_->cached(s));
+    fromCache_[s] = bool(rows);
+    if (!rows) {
+      trackEffCache_->record(s);
+      blockFromCache_ = false;
+      continue;
+    }
+    for (unsigned long long i = 0; i < rows->size(); ++i) {
+      const TrackEffRecord& r((*rows)[i]);
+      if (r.station != unsigned(s)) continue;
+      etrk_[s] = r.eff;
+      tree_eff_[s]->Fill();
+      if (trackEffRecord_) trackEffRecord_->write(s, r.track, etrk_[s]);
+    }
+    nCached += rows->size();
+  }
+  if (verbose_)
+    std::cout << "GEMCSCAnalyzer: run " << lumi.run() << " lumi " << lumi.luminosityBlock() << ": " << nCached
+              << " rows from the result cache" << (blockFromCache_ ? ", events skipped" : "") << std::endl;
+}
+
+
+void GEMCSCAnalyzer::endLuminosityBlock(const edm::LuminosityBlock& lumi, const edm::EventSetup& es)
+{
+  if (trackEffCache_) trackEffCache_->endBlock();
+}
+
+
+bool GEMCSCAnalyzer::readsWholeBlocks() const
+{
+  const edm::ParameterSet& process(edm::getProcessParameterSet());
+  if (process.existsAs<edm::ParameterSet>("maxEvents", false) and
+      process.getUntrackedParameterSet("maxEvents").getUntrackedParameter<int>("input", -1) >= 0) return false;
+  if (process.existsAs<edm::ParameterSet>("@main_input")) {
+    const edm::ParameterSet& source(process.getParameterSet("@main_input"));
+    if (source.getUntrackedParameter<unsigned int>("skipEvents", 0) > 0) return false;
+    if (source.exists("eventsToProcess")) return false;
+  }
+  return true;
+}
+
+
+std::string GEMCSCAnalyzer::eventSetupConfiguration() const
+{
+  // the GlobalTag is an ES source: its PSet has the tag name and the toGet overrides
+  const edm::ParameterSet& process(edm::getProcessParameterSet());
+  std::ostringstream s;
+  for (auto list: {"@all_essources", "@all_esmodules", "@all_esprefers"}) {
+    if (!process.existsAs<std::vector<std::string> >(list)) continue;
+    for (auto& label: process.getParameter<std::vector<std::string> >(list)) {
+      s << label << "\n";
+      if (process.existsAs<edm::ParameterSet>(label)) s << process.getParameterSet(label).dump() << "\n";
+    }
+  }
+  return s.str();
+}
+
+
+namespace {
+template <class R>
+void addIOV(std::ostream& s, const edm::EventSetup& es, const char* name)
+{
+  s << name << " ";
+  if (es.find(edm::eventsetup::EventSetupRecordKey::makeKey<R>())) {
+    const edm::ValidityInterval& iov(es.get<R>().validityInterval());
+    s << iov.first().eventID() << " - " << iov.last().eventID();
+  }
+  else s << "none";
+  s << "\n";
+}
+}
+
+
+std::string GEMCSCAnalyzer::conditionsIOVs(const edm::EventSetup& es) const
+{
+  std::ostringstream s;
+  addIOV<MuonGeometryRecord>(s, es, "MuonGeometryRecord");
+  addIOV<IdealMagneticFieldRecord>(s, es, "IdealMagneticFieldRecord");
+  addIOV<L1MuTriggerScalesRcd>(s, es, "L1MuTriggerScalesRcd");
+  addIOV<L1MuTriggerPtScaleRcd>(s, es, "L1MuTriggerPtScaleRcd");
+  return s.str();
+}
+
+
 bool GEMCSCAnalyzer::isSimTrackGood(const SimTrack &t)
 {
   // SimTrack selection
@@ -909,8 +452,94 @@ bool GEMCSCAnalyzer::isSimTrackGood(const SimTrack &t)
 }
 
 
+void GEMCSCAnalyzer::associateL1(const edm::Event& ev, std::vector<std::unique_ptr<SimTrackMatchManager> >& matches)
+{
+  if (matches.empty()) return;
+  auto& gmt(matches.front()->l1GMTCands());
+  if (!gmt.globalAssociationGmtCand() and !gmt.globalAssociationL1ExtraMuon()) return;
+
+  std::unique_ptr<SimTrackL1Association> gmtCands;
+  if (gmt.globalAssociationGmtCand()) {
+    auto ps(cfg_.getParameter<edm::ParameterSet>("gmtCand"));
+    edm::Handle<L1MuGMTCandCollection> hGmtCand;
+    if (gemvalidation::getByLabel(ps.getParameter<std::vector<edm::InputTag> >("validInputTags"), hGmtCand, ev)) {
+      gmtCands.reset(new SimTrackL1Association(ps));
+      for (auto& m: matches) gmtCands->addSimTrack(m->l1GMTCands().reference());
+      for (auto& c: *hGmtCand) gmtCands->addCandidate(c.etaValue(), c.phiValue(), c.bx(), c.charge());
+      gmtCands->solve();
+    }
+  }
+
+  std::unique_ptr<SimTrackL1Association> l1ExtraMuons;
+  if (gmt.globalAssociationL1ExtraMuon()) {
+    auto ps(cfg_.getParameter<edm::ParameterSet>("l1ExtraMuonParticle"));
+    edm::Handle<l1extra::L1MuonParticleCollection> hL1ExtraMuonParticle;
+    if (gemvalidation::getByLabel(ps.getParameter<std::vector<edm::InputTag> >("validInputTags"), hL1ExtraMuonParticle, ev)) {
+      l1ExtraMuons.reset(new SimTrackL1Association(ps));
+      for (auto& m: matches) l1ExtraMuons->addSimTrack(m->l1GMTCands().reference());
+      for (auto& mu: *hL1ExtraMuonParticle) l1ExtraMuons->addCandidate(mu.eta(), mu.phi(), mu.bx(), mu.charge());
+      l1ExtraMuons->solve();
+    }
+  }
+
+  for (unsigned int i = 0; i < matches.size(); ++i)
+    matches[i]->setL1Association(gmtCands.get(), l1ExtraMuons.get(), i);
+}
+
+
+void GEMCSCAnalyzer::associateTfTracks(const edm::Event& ev, const edm::EventSetup& es,
+                                       std::vector<std::unique_ptr<SimTrackMatchManager> >& matches)
+{
+  if (!runCscTfTrack_ or matches.empty()) return;
+  edm::Handle<L1CSCTrackCollection> hCscTfTrack;
+  if (!gemvalidation::getByLabel(cscTfTrackInputLabel_, hCscTfTrack, ev)) return;
+  // without the scales the TFTracks cannot be built, leave the SimTracks unassociated
+  if (!fetchScales(es)) return;
+
+  tfTrackAssociation_.clear();
+  for (unsigned int i = 0; i < matches.size(); ++i) tfTrackAssociation_.addSimTrack(matches[i]->cscStubs(), i);
+  tfTrackAssociation_.matchTracks(*hCscTfTrack, muScalesHd_, muPtScaleHd_);
+  for (unsigned int i = 0; i < matches.size(); ++i) matches[i]->setTfTrackAssociation(tfTrackAssociation_, i);
+}
+
+
+bool GEMCSCAnalyzer::fetchScales(const edm::EventSetup& es)
+{
+  // jobs that load no L1 trigger scales configuration have not even the records
+  if (!es.find(edm::eventsetup::EventSetupRecordKey::makeKey<L1MuTriggerScalesRcd>()) or
+      !es.find(edm::eventsetup::EventSetupRecordKey::makeKey<L1MuTriggerPtScaleRcd>())) {
+    LogDebug("GEMCSCAnalyzer") << "+++ Info: the L1 muon trigger scale records are unavailable. +++\n";
+    return false;
+  }
+
+  if (es.get<L1MuTriggerScalesRcd>().cacheIdentifier() != muScalesCacheID_) {
+    try {
+      es.get<L1MuTriggerScalesRcd>().get(muScalesHd_);
+    } catch (edm::eventsetup::NoProxyException<L1MuTriggerScalesRcd>& e) {
+      muScalesHd_ = edm::ESHandle<L1MuTriggerScales>();
+      LogDebug("GEMCSCAnalyzer") << "+++ Info: L1MuTriggerScalesRcd is unavailable. +++\n";
+    }
+    muScalesCacheID_ = es.get<L1MuTriggerScalesRcd>().cacheIdentifier();
+  }
+
+  if (es.get<L1MuTriggerPtScaleRcd>().cacheIdentifier() != muPtScaleCacheID_) {
+    try {
+      es.get<L1MuTriggerPtScaleRcd>().get(muPtScaleHd_);
+    } catch (edm::eventsetup::NoProxyException<L1MuTriggerPtScaleRcd>& e) {
+      muPtScaleHd_ = edm::ESHandle<L1MuTriggerPtScale>();
+      LogDebug("GEMCSCAnalyzer") << "+++ Info: L1MuTriggerPtScaleRcd is unavailable. +++\n";
+    }
+    muPtScaleCacheID_ = es.get<L1MuTriggerPtScaleRcd>().cacheIdentifier();
+  }
+
+  return muScalesHd_.isValid() and muPtScaleHd_.isValid();
+}
+
+
 void GEMCSCAnalyzer::analyze(const edm::Event& ev, const edm::EventSetup& es)
 {
+  if (blockFromCache_) return;
+
   edm::Handle<edm::SimTrackContainer> sim_tracks;
   ev.getByLabel(simInputLabel_, sim_tracks);
   const edm::SimTrackContainer & sim_track = *sim_tracks.product();
@@ -923,19 +552,27 @@ void GEMCSCAnalyzer::analyze(const edm::Event& ev, const edm::EventSetup& es)
     std::cout << "Total number of SimTrack in this event: " << sim_track.size() << std::endl;      
   }
     
-  int trk_no=0;
+  // match hits and digis to all the good SimTracks first, so that the L1 candidates
+  // can be associated to them event-wide
+  std::vector<std::unique_ptr<SimTrackMatchManager> > matches;
+  const auto genAncestry(DisplacedGENMuonMatcher::eventAncestry(cfg_, ev));
   for (auto& t: sim_track)
   {
     if (!isSimTrackGood(t)) continue;
     if (verboseSimTrack_){
-      std::cout << "Processing SimTrack " << trk_no + 1 << std::endl;      
+      std::cout << "Processing SimTrack " << matches.size() + 1 << std::endl;      
       std::cout << "pt(GeV/c) = " << t.momentum().pt() << ", eta = " << t.momentum().eta()  
                 << ", phi = " << t.momentum().phi() << ", Q = " << t.charge() << std::endl;
     }
-    
-//    std::cout<< " initialize SimTrackMatcherManager "<< std::endl;  
-    // match hits and digis to this SimTrack
-    SimTrackMatchManager match(t, sim_vert[t.vertIndex()], cfg_, ev, es);
+    matches.emplace_back(new SimTrackMatchManager(t, sim_vert[t.vertIndex()], cfg_, ev, es, genAncestry.get()));
+  }
+  associateL1(ev, matches);
+  associateTfTracks(ev, es, matches);
+
+  int trk_no=0;
+  for (auto& m: matches)
+  {
+    SimTrackMatchManager& match(*m);
 
     if (ntupleTrackChamberDelta_) analyzeTrackChamberDeltas(match, trk_no);
     if (ntupleTrackEff_) analyzeTrackEff(match, trk_no);
@@ -1246,7 +883,8 @@ void GEMCSCAnalyzer::analyzeTrackEff(SimTrackMatchManager& match, int trk_no)
       etrk_[st].wg_lct_odd = digi_wg(lct);
       etrk_[st].chamber_odd |= 2;
       etrk_[st].quality_odd = digi_quality(lct);
-      etrk_[st].passdphi_odd = match_lct.passDPhicut(id, chargesign, digi_dphi(lct), pt);
+      etrk_[st].passdphi_odd = dPhiLUT_.pass(id, chargesign, digi_dphi(lct), pt, etrk_[st].eta);
+      passDPhiWorkingPoints(etrk_[st], id, chargesign, digi_dphi(lct), pt, 1);
     }
     else
     {
@@ -1261,7 +899,8 @@ void GEMCSCAnalyzer::analyzeTrackEff(SimTrackMatchManager& match, int trk_no)
       etrk_[st].wg_lct_even = digi_wg(lct);
       etrk_[st].chamber_even |= 2;
       etrk_[st].quality_even = digi_quality(lct);
-      etrk_[st].passdphi_even = match_lct.passDPhicut(id, chargesign, digi_dphi(lct), pt);
+      etrk_[st].passdphi_even = dPhiLUT_.pass(id, chargesign, digi_dphi(lct), pt, etrk_[st].eta);
+      passDPhiWorkingPoints(etrk_[st], id, chargesign, digi_dphi(lct), pt, 2);
     }
 
     // case ME11
@@ -1279,7 +918,8 @@ void GEMCSCAnalyzer::analyzeTrackEff(SimTrackMatchManager& match, int trk_no)
         etrk_[1].wg_lct_odd = digi_wg(lct);
         etrk_[1].chamber_odd |= 2;
         etrk_[1].quality_odd = digi_quality(lct);
-        etrk_[1].passdphi_odd = match_lct.passDPhicut(id, chargesign, digi_dphi(lct), pt);
+        etrk_[1].passdphi_odd = dPhiLUT_.pass(id, chargesign, digi_dphi(lct), pt, etrk_[1].eta);
+        passDPhiWorkingPoints(etrk_[1], id, chargesign, digi_dphi(lct), pt, 1);
       }
       else
       {
@@ -1294,7 +934,8 @@ void GEMCSCAnalyzer::analyzeTrackEff(SimTrackMatchManager& match, int trk_no)
         etrk_[1].wg_lct_even = digi_wg(lct);
         etrk_[1].chamber_even |= 2;
         etrk_[1].quality_even = digi_quality(lct);
-        etrk_[1].passdphi_even = match_lct.passDPhicut(id, chargesign, digi_dphi(lct), pt);
+        etrk_[1].passdphi_even = dPhiLUT_.pass(id, chargesign, digi_dphi(lct), pt, etrk_[1].eta);
+        passDPhiWorkingPoints(etrk_[1], id, chargesign, digi_dphi(lct), pt, 2);
       }
 
     }
@@ -1722,9 +1363,20 @@ void GEMCSCAnalyzer::analyzeTrackEff(SimTrackMatchManager& match, int trk_no)
 	              {etrk_[s].eta_interStat13 = propagate_interstat_odd[13].eta();
 	               etrk_[s].phi_interStat13 = propagate_interstat_odd[13].phi();}
   }
-  if (match_track.tfTracks().size()) {
+  const TFTrack* stubTrack(match.l1TfTracks().bestTfTrack());
+  if (stubTrack) {
+    etrk_[0].has_tfTrack_stubs = 1;
+    etrk_[0].tfTrack_stubs_pt = stubTrack->pt();
+    etrk_[0].tfTrack_stubs_eta = stubTrack->eta();
+    etrk_[0].tfTrack_stubs_phi = stubTrack->phi();
+    etrk_[0].tfTrack_stubs_nStubs = stubTrack->nStubs();
+    etrk_[0].tfTrack_stubs_nMatchedStubs = match.l1TfTracks().nMatchedStubs(stubTrack);
+  }
+
+  // the TF track fields are taken from the track matched by stub ownership
+  if (stubTrack) {
     etrk_[0].has_tfTrack = 1;
-    TFTrack* besttrack = match_track.bestTFTrack();
+    const TFTrack* besttrack(stubTrack);
     etrk_[0].trackpt = besttrack->pt();
     etrk_[0].tracketa = besttrack->eta();
     etrk_[0].trackphi = besttrack->phi();
@@ -1739,7 +1391,7 @@ void GEMCSCAnalyzer::analyzeTrackEff(SimTrackMatchManager& match, int trk_no)
    etrk_[0].hasME1 = besttrack->hasStubEndcap(1);
    etrk_[0].hasME2 = besttrack->hasStubEndcap(2);
    etrk_[0].nstubs = besttrack->nStubs();
-   etrk_[0].deltaR = besttrack->dr();
+   etrk_[0].deltaR = match_track.deltaR(*besttrack);
    etrk_[0].chargesign = besttrack->chargesign();
    unsigned int lct1 = 999;
    auto me1b(besttrack->digiInME(1,1));
@@ -1755,18 +1407,19 @@ void GEMCSCAnalyzer::analyzeTrackEff(SimTrackMatchManager& match, int trk_no)
        if (id_me1.chamber()%2 == 1)  etrk_[0].chamberME1 |= 1;
        if (id_me1.chamber()%2 == 0)  etrk_[0].chamberME1 |= 2;
        etrk_[0].ME1_ring = id_me1.ring();
-       etrk_[0].passGE11 = besttrack->passDPhicutTFTrack(1,bendingcutPt_);
-       etrk_[0].passGE11_pt5 = besttrack->passDPhicutTFTrack(1, 5);
-       etrk_[0].passGE11_pt7 = besttrack->passDPhicutTFTrack(1, 7);
-       etrk_[0].passGE11_pt10 = besttrack->passDPhicutTFTrack(1, 10);
-       etrk_[0].passGE11_pt15 = besttrack->passDPhicutTFTrack(1, 15);
-       etrk_[0].passGE11_pt20 = besttrack->passDPhicutTFTrack(1, 20);
-       etrk_[0].passGE11_pt30 = besttrack->passDPhicutTFTrack(1, 30);
-       etrk_[0].passGE11_pt40 = besttrack->passDPhicutTFTrack(1, 40);
+       etrk_[0].passGE11 = besttrack->passDPhicutTFTrack(1, bendingcutPt_, dPhiLUT_);
+       etrk_[0].passGE11_pt5 = besttrack->passDPhicutTFTrack(1, 5, dPhiLUT_);
+       etrk_[0].passGE11_pt7 = besttrack->passDPhicutTFTrack(1, 7, dPhiLUT_);
+       etrk_[0].passGE11_pt10 = besttrack->passDPhicutTFTrack(1, 10, dPhiLUT_);
+       etrk_[0].passGE11_pt15 = besttrack->passDPhicutTFTrack(1, 15, dPhiLUT_);
+       etrk_[0].passGE11_pt20 = besttrack->passDPhicutTFTrack(1, 20, dPhiLUT_);
+       etrk_[0].passGE11_pt30 = besttrack->passDPhicutTFTrack(1, 30, dPhiLUT_);
+       etrk_[0].passGE11_pt40 = besttrack->passDPhicutTFTrack(1, 40, dPhiLUT_);
        etrk_[0].dphiGE11 = ((besttrack->getTriggerDigis()).at(lct1))->getGEMDPhi();
        etrk_[0].ME1_hs = ((besttrack->getTriggerDigis()).at(lct1))->getStrip();
        etrk_[0].ME1_wg = ((besttrack->getTriggerDigis()).at(lct1))->getKeyWG();
-       etrk_[0].passGE11_simpt = match_lct.passDPhicut(id_me1, etrk_[0].chargesign, etrk_[0].dphiGE11, pt);
+       etrk_[0].passGE11_simpt = dPhiLUT_.pass(id_me1, etrk_[0].chargesign, etrk_[0].dphiGE11, pt, etrk_[0].eta);
+       passDPhiWorkingPoints(etrk_[0], id_me1, etrk_[0].chargesign, etrk_[0].dphiGE11, pt, 4);
        //std::cout <<" pass dphicut ?? " <<(etrk_[0].passGE11 ? "  Yes ":" No") << std::endl;
        //if (fabs(etrk_[0].dphiGE11)>1 and fabs(etrk_[0].dphiGE11)<99) std::cout <<" dphiGE11 " << etrk_[0].dphiGE11  << std::endl;
        //if (!etrk_[0].passGE11_simpt and etrk_[0].passGE11 and id_me1.ring()==1) std::cout <<"simpt dphicut failed,st "<< id_me1.station()<<(id_me1.chamber()%2==1 ? " odd": " even") <<" dphiGE11 " << etrk_[0].dphiGE11 << " simpt "<<pt <<" trackpt "<<etrk_[0].trackpt << std::endl; 
@@ -1784,18 +1437,19 @@ void GEMCSCAnalyzer::analyzeTrackEff(SimTrackMatchManager& match, int trk_no)
        if (id_me2.chamber()%2 == 1)  etrk_[0].chamberME2 |= 1;
        if (id_me2.chamber()%2 == 0)  etrk_[0].chamberME2 |= 2;
        etrk_[0].ME2_ring = id_me2.ring();
-       etrk_[0].passGE21 = besttrack->passDPhicutTFTrack(2, bendingcutPt_);
-       etrk_[0].passGE21_pt5 = besttrack->passDPhicutTFTrack(2, 5);
-       etrk_[0].passGE21_pt7 = besttrack->passDPhicutTFTrack(2, 7);
-       etrk_[0].passGE21_pt10 = besttrack->passDPhicutTFTrack(2, 10);
-       etrk_[0].passGE21_pt15 = besttrack->passDPhicutTFTrack(2, 15);
-       etrk_[0].passGE21_pt20 = besttrack->passDPhicutTFTrack(2, 20);
-       etrk_[0].passGE21_pt30 = besttrack->passDPhicutTFTrack(2, 30);
-       etrk_[0].passGE21_pt40 = besttrack->passDPhicutTFTrack(2, 40);
+       etrk_[0].passGE21 = besttrack->passDPhicutTFTrack(2, bendingcutPt_, dPhiLUT_);
+       etrk_[0].passGE21_pt5 = besttrack->passDPhicutTFTrack(2, 5, dPhiLUT_);
+       etrk_[0].passGE21_pt7 = besttrack->passDPhicutTFTrack(2, 7, dPhiLUT_);
+       etrk_[0].passGE21_pt10 = besttrack->passDPhicutTFTrack(2, 10, dPhiLUT_);
+       etrk_[0].passGE21_pt15 = besttrack->passDPhicutTFTrack(2, 15, dPhiLUT_);
+       etrk_[0].passGE21_pt20 = besttrack->passDPhicutTFTrack(2, 20, dPhiLUT_);
+       etrk_[0].passGE21_pt30 = besttrack->passDPhicutTFTrack(2, 30, dPhiLUT_);
+       etrk_[0].passGE21_pt40 = besttrack->passDPhicutTFTrack(2, 40, dPhiLUT_);
        etrk_[0].dphiGE21 = ((besttrack->getTriggerDigis()).at(lct2))->getGEMDPhi();
        etrk_[0].ME2_hs = ((besttrack->getTriggerDigis()).at(lct2))->getStrip();
        etrk_[0].ME2_wg = ((besttrack->getTriggerDigis()).at(lct2))->getKeyWG();
-       etrk_[0].passGE21_simpt = match_lct.passDPhicut(id_me2, etrk_[0].chargesign, etrk_[0].dphiGE21, pt);
+       etrk_[0].passGE21_simpt = dPhiLUT_.pass(id_me2, etrk_[0].chargesign, etrk_[0].dphiGE21, pt, etrk_[0].eta);
+       passDPhiWorkingPoints(etrk_[0], id_me2, etrk_[0].chargesign, etrk_[0].dphiGE21, pt, 8);
        //std::cout <<" pass dphicut ?? " <<(etrk_[0].passGE21 ? "  Yes ":" No") << std::endl;
        //if (fabs(etrk_[0].dphiGE21)>1 and fabs(etrk_[0].dphiGE21)<99) std::cout <<" dphiGE21 " << etrk_[0].dphiGE21  << std::endl;
        //if (!etrk_[0].passGE21_simpt and etrk_[0].passGE21 and id_me2.ring()==1) std::cout <<"simpt dphicut failed,st "<<id_me2.station()<<(id_me2.chamber()%2==1 ? " odd": " even")  << " dphiGE21 " << etrk_[0].dphiGE21 << " simpt "<<pt <<" trackpt "<<etrk_[0].trackpt << std::endl; 
@@ -1805,7 +1459,10 @@ void GEMCSCAnalyzer::analyzeTrackEff(SimTrackMatchManager& match, int trk_no)
     auto triggerDigiIds(besttrack->getTriggerDigisIds()); 
     auto triggerDigis(besttrack->getTriggerDigis()); 
 
-    auto triggerDigiEtaPhi(besttrack->getTriggerEtaPhis());
+    std::vector<std::pair<float, float> > triggerDigiEtaPhi;
+    triggerDigiEtaPhi.reserve(triggerDigis.size());
+    for (unsigned int i=0; i<triggerDigis.size() and i<triggerDigiIds.size(); i++)
+      triggerDigiEtaPhi.push_back(match_track.intersectionEtaPhi(triggerDigiIds[i], triggerDigis[i]->getKeyWG(), triggerDigis[i]->getStrip()));
     if (triggerDigiIds.size() == triggerDigiEtaPhi.size() && triggerDigis.size() == triggerDigiIds.size())
      {
         bool stub_Good_ME[4] = {1,1,1,1};
@@ -2003,7 +1660,11 @@ void GEMCSCAnalyzer::analyzeTrackEff(SimTrackMatchManager& match, int trk_no)
 
   for (auto s: stations_to_use_)
   {
+    // already filled from the result cache
+    if (fromCache_[s]) continue;
     tree_eff_[s]->Fill();
+    if (trackEffRecord_) trackEffRecord_->write(s, trk_no, etrk_[s]);
+    if (trackEffCache_) trackEffCache_->write(s, trk_no, etrk_[s]);
   }
 }
 
@@ -2524,8 +2185,8 @@ void GEMCSCAnalyzer::bookSimTracksDeltaTree()
 
 
   std::cout << "######  matching Tracks to Simtrack " << std::endl;
-  if (match_track.tfTracks().size()) {
-     TFTrack* besttrack = match_track.bestTFTrack();
+  if (match.l1TfTracks().bestTfTrack()) {
+     const TFTrack* besttrack(match.l1TfTracks().bestTfTrack());
      std::cout << "       Best TFTrack                  " << std::endl;
      besttrack->print();
 	 /*for (unsigned int i=0; i<triggerDigiIds.size(); i++)
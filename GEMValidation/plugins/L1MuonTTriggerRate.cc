@@ -1,8 +1,11 @@
 // system include files
 #include <memory>
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <iostream>
 #include <sstream>
+#include <vector>
 #include <boost/foreach.hpp>
 #define foreach BOOST_FOREACH
 
@@ -45,6 +48,7 @@
 
 #include "GEMCode/GEMValidation/interface/Helpers.h"
 #include "GEMCode/GEMValidation/interface/TFTrack.h" 
+#include "GEMCode/GEMValidation/interface/GEMCSCdPhiLUT.h"
 
 #include "TH1F.h"
 #include "TH2F.h"
@@ -93,6 +97,8 @@ private:
 
 private:
   void init();
+  void fetchScales(const edm::EventSetup&);
+  void computeDPhiFlags(unsigned int ntracks);
 
 private:
   TTree* evtree;
@@ -112,11 +118,29 @@ private:
   bool hasME1,hasME2;
   float GE11dPhi,GE21dPhi;
   bool passGE11,passGE21;
-  bool passGE11_pt5, passGE11_pt7, passGE11_pt10, passGE11_pt15, passGE11_pt20, passGE11_pt30, passGE11_pt40;
-  bool passGE21_pt5, passGE21_pt7, passGE21_pt10, passGE21_pt15, passGE21_pt20, passGE21_pt30, passGE21_pt40;
+  // passGE11_ptX/passGE21_ptX for every threshold X of dPhiPtThresholds_, [threshold][GE11,GE21]
+  std::vector<std::array<bool, 2> > passGE_;
   int firstl1mu;
   unsigned int nl1tracks;
 
+  // trigger scales, fetched again only when their IOV changes
+  edm::ESHandle<L1MuTriggerScales> muScalesHd_;
+  edm::ESHandle<L1MuTriggerPtScale> muptScaleHd_;
+  unsigned long long muScalesCacheID_;
+  unsigned long long muPtScaleCacheID_;
+
+  // TFTracks of the current event; the objects are kept between events so that
+  // their stub vectors are reused instead of allocating new tracks every event
+  std::vector<TFTrack> tracks_;
+
+  // GEM-CSC bending angle cuts; default ME11GEMdPhi/ME21GEMdPhi unless a "dPhiLUT" dictionary is given
+  GEMCSCdPhiLUT dPhiLUT_;
+  std::vector<double> dPhiPtThresholds_;
+
+  // per event, for all tracks: dphi of the GE11/GE21 LCT (-99 without LCT)
+  // and the pass flags [track][threshold]
+  std::vector<float> gemDPhi_[2];
+  std::vector<char> passDPhi_[2];
 
 };
 
@@ -129,6 +153,13 @@ L1MuonTTriggerRate::L1MuonTTriggerRate(const edm::ParameterSet& iConfig)
   min_aEta = iConfig.getParameter<double>("minEta");
   max_aEta = iConfig.getParameter<double>("maxEta");
 
+  muScalesCacheID_ = 0ULL;
+  muPtScaleCacheID_ = 0ULL;
+
+  if (iConfig.exists("dPhiLUT")) dPhiLUT_ = GEMCSCdPhiLUT(iConfig.getParameterSet("dPhiLUT"));
+  const std::vector<double> defaultThresholds = {5, 7, 10, 15, 20, 30, 40};
+  dPhiPtThresholds_ = iConfig.getUntrackedParameter<std::vector<double> >("dPhiPtThresholds", defaultThresholds);
+  passGE_.resize(dPhiPtThresholds_.size());
 }
 
 L1MuonTTriggerRate::~L1MuonTTriggerRate()
@@ -144,95 +175,51 @@ void L1MuonTTriggerRate::analyze(const edm::Event& iEvent, const edm::EventSetup
   edm::Handle<CSCCorrelatedLCTDigiCollection> lcts;
   iEvent.getByLabel("simCscTriggerPrimitiveDigis","MPCSORTED", lcts);
 
-  edm::ESHandle<L1MuTriggerScales> muScalesHd_;
-  edm::ESHandle<L1MuTriggerPtScale> muptScaleHd_;
-  //const L1MuTriggerScales* muScales_;
-  //const L1MuTriggerPtScale* muptScale_;
-  try {
-    iSetup.get<L1MuTriggerScalesRcd>().get(muScalesHd_);
-  } catch (edm::eventsetup::NoProxyException<L1MuTriggerScalesRcd>& e) {
-    LogDebug("TrackMatcher") << "+++ Info: L1MuTriggerScalesRcd is unavailable. +++\n";
-  }
-
-  try {
-    iSetup.get<L1MuTriggerPtScaleRcd>().get(muptScaleHd_);
-  } catch (edm::eventsetup::NoProxyException<L1MuTriggerPtScaleRcd>& e) {
-    LogDebug("TrackMatcher") << "+++ Info: L1MuTriggerptScaleRcd is unavailable. +++\n";
-  }
-
-  //CSCTFptLUT* ptLUT_ = new CSCTFptLUT(ptLUTset_, muScalesHd_.product(), muptScaleHd_.product());
-
+  fetchScales(iSetup);
 
   ++ntotalEvents;
   firstl1mu = 1;
 
+  // build (or reuse) the TFTracks of all L1 tracks
   nl1tracks = l1csctracks->size();
-  // lcts used in tracks
-  L1CSCTrackCollection::const_iterator tmp_trk = l1csctracks->begin();
-  for(; tmp_trk != l1csctracks->end(); tmp_trk++){
-    //    float GEMdPhi = -99;
+  unsigned int ntracks = 0;
+  for (auto& trk: *l1csctracks) {
+    if (ntracks < tracks_.size()) tracks_[ntracks].reset(&trk.first, &trk.second);
+    else tracks_.emplace_back(&trk.first, &trk.second);
+    tracks_[ntracks].init(muScalesHd_, muptScaleHd_);
+    ++ntracks;
+  }
+
+  computeDPhiFlags(ntracks);
+
+  const unsigned int nthr(dPhiPtThresholds_.size());
+  for (unsigned int i = 0; i < ntracks; ++i) {
+    const TFTrack& track(tracks_[i]);
     init();
-    if (tmp_trk != l1csctracks->begin()) firstl1mu = -1;//only first track firstl1mu =1
-
-    TFTrack *track = new TFTrack(&tmp_trk->first,&tmp_trk->second);
-    track->init(muScalesHd_, muptScaleHd_);
-
-    pt = track->pt();
-    eta = track->eta();
-    phi = track->phi();
-    pt_packed = track->ptPacked();
-    eta_packed = track->etaPacked();
-    phi_packed = track->phiPacked();
-    quality_packed = track->qPacked();
-    chargesign = track->chargesign();
-    deltaphi12 = track->dPhi12();
-    deltaphi23 = track->dPhi23();
-    hasME1 = track->hasStubEndcap(1);
-    hasME2 = track->hasStubEndcap(2);
-    nstubs = track->nStubs();
-    
-
-    //std::cout <<" charge sign " << sign << std::endl;
-    unsigned int lct1 = 999;
-    auto me1b(track->digiInME(1,1));
-    auto me1a(track->digiInME(1,4));
-    if (me1a != 999) lct1 = me1a;
-    if (me1b != 999) lct1 = me1b;
-
-    if (lct1 < (track->getTriggerDigis()).size()) 
-    {
-       //passGE11 = track->passDPhicutTFTrack(1);
-       passGE11_pt5 = track->passDPhicutTFTrack(1, 5);
-       passGE11_pt7 = track->passDPhicutTFTrack(1, 7);
-       passGE11_pt10 = track->passDPhicutTFTrack(1, 10);
-       passGE11_pt15 = track->passDPhicutTFTrack(1, 15);
-       passGE11_pt20 = track->passDPhicutTFTrack(1, 20);
-       passGE11_pt30 = track->passDPhicutTFTrack(1, 30);
-       passGE11_pt40 = track->passDPhicutTFTrack(1, 40);
-       GE11dPhi = ((track->getTriggerDigis()).at(lct1))->getGEMDPhi();
+    firstl1mu = (i == 0 ? 1 : -1);//only first track firstl1mu =1
+
+    pt = track.pt();
+    eta = track.eta();
+    phi = track.phi();
+    pt_packed = track.ptPacked();
+    eta_packed = track.etaPacked();
+    phi_packed = track.phiPacked();
+    quality_packed = track.qPacked();
+    chargesign = track.chargesign();
+    deltaphi12 = track.dPhi12();
+    deltaphi23 = track.dPhi23();
+    hasME1 = track.hasStubEndcap(1);
+    hasME2 = track.hasStubEndcap(2);
+    nstubs = track.nStubs();
+
+    GE11dPhi = gemDPhi_[0][i];
+    GE21dPhi = gemDPhi_[1][i];
+    for (unsigned int t = 0; t < nthr; ++t) {
+      passGE_[t][0] = passDPhi_[0][i*nthr + t];
+      passGE_[t][1] = passDPhi_[1][i*nthr + t];
     }
-//   if (pt<10 and passGE11 ) std::cout <<" passGE11  pt "<< pt <<" deltaphi " << GE11dPhi << std::endl;
-    unsigned int lct2 = 999;
-    lct2 = track->digiInME(2,1);
-    if (lct2 < (track->getTriggerDigis()).size()) 
-    {
-       //passGE21 = track->passDPhicutTFTrack(2);
-       passGE21_pt5 = track->passDPhicutTFTrack(2, 5);
-       passGE21_pt7 = track->passDPhicutTFTrack(2, 7);
-       passGE21_pt10 = track->passDPhicutTFTrack(2, 10);
-       passGE21_pt15 = track->passDPhicutTFTrack(2, 15);
-       passGE21_pt20 = track->passDPhicutTFTrack(2, 20);
-       passGE21_pt30 = track->passDPhicutTFTrack(2, 30);
-       passGE21_pt40 = track->passDPhicutTFTrack(2, 40);
-       GE21dPhi = ((track->getTriggerDigis()).at(lct2))->getGEMDPhi();
-    }
-
-   //if (nstubs>2 and pt>=30 and passGE11 and abs(eta)<2.14 and abs(eta)>1.64) std::cout <<" nevent "<< ntotalEvents <<" l1track passGE11, pt "<<pt <<" nstub "<<nstubs << std::endl;
 
-    //if (nstub) 
-    //std::cout <<" nevent "<< ntotalEvents  <<" l1track nstub "<< nstubs << " pt " << pt <<" eta "<< eta <<(passGE11?" passGE11 ":" failedGE11"  )<<" dphi at st1 " << GE11dPhi <<std::endl;
     evtree->Fill();
-    delete track;
   }
 // can not find any tracks, still fill evtree to record this event so finally script could count total events correctly
   if (nl1tracks ==0 ) {
@@ -268,20 +255,15 @@ void L1MuonTTriggerRate::beginJob()
    evtree->Branch("dphiGE21",&GE21dPhi);
    evtree->Branch("passGE11",&passGE11);
    evtree->Branch("passGE21",&passGE21);
-   evtree->Branch("passGE11_pt5",&passGE11_pt5);
-   evtree->Branch("passGE21_pt5",&passGE21_pt5);
-   evtree->Branch("passGE11_pt7",&passGE11_pt7);
-   evtree->Branch("passGE21_pt7",&passGE21_pt7);
-   evtree->Branch("passGE11_pt10",&passGE11_pt10);
-   evtree->Branch("passGE21_pt10",&passGE21_pt10);
-   evtree->Branch("passGE11_pt15",&passGE11_pt15);
-   evtree->Branch("passGE21_pt15",&passGE21_pt15);
-   evtree->Branch("passGE11_pt20",&passGE11_pt20);
-   evtree->Branch("passGE21_pt20",&passGE21_pt20);
-   evtree->Branch("passGE11_pt30",&passGE11_pt30);
-   evtree->Branch("passGE21_pt30",&passGE21_pt30);
-   evtree->Branch("passGE11_pt40",&passGE11_pt40);
-   evtree->Branch("passGE21_pt40",&passGE21_pt40);
+   // passGE11_pt5, passGE21_pt5, ... ; a threshold of 7.5 gives passGE11_pt7p5
+   for (unsigned int t = 0; t < dPhiPtThresholds_.size(); ++t) {
+     std::ostringstream pt;
+     pt << dPhiPtThresholds_[t];
+     std::string suffix(pt.str());
+     std::replace(suffix.begin(), suffix.end(), '.', 'p');
+     evtree->Branch(("passGE11_pt" + suffix).c_str(), &passGE_[t][0]);
+     evtree->Branch(("passGE21_pt" + suffix).c_str(), &passGE_[t][1]);
+   }
    evtree->Branch("nstubs",&nstubs);
    
 
@@ -307,22 +289,60 @@ void L1MuonTTriggerRate::init(){
   passGE21 = false;
   GE11dPhi = -99;
   GE21dPhi =-99;
-  passGE11_pt5=false;
-  passGE11_pt7=false;
-  passGE11_pt10=false;
-  passGE11_pt15=false;
-  passGE11_pt20=false;
-  passGE11_pt30=false;
-  passGE11_pt40=false;
-  passGE21_pt5=false;
-  passGE21_pt7=false;
-  passGE21_pt10=false;
-  passGE21_pt15=false;
-  passGE21_pt20=false;
-  passGE21_pt30=false;
-  passGE21_pt40=false;
+  for (auto& p: passGE_) p[0] = p[1] = false;
+
 
+}
 
+
+//--------------- trigger scales for the current IOV ------------------------------
+void L1MuonTTriggerRate::fetchScales(const edm::EventSetup& iSetup)
+{
+  if (iSetup.get<L1MuTriggerScalesRcd>().cacheIdentifier() != muScalesCacheID_) {
+    try {
+      iSetup.get<L1MuTriggerScalesRcd>().get(muScalesHd_);
+    } catch (edm::eventsetup::NoProxyException<L1MuTriggerScalesRcd>& e) {
+      LogDebug("TrackMatcher") << "+++ Info: L1MuTriggerScalesRcd is unavailable. +++\n";
+    }
+    muScalesCacheID_ = iSetup.get<L1MuTriggerScalesRcd>().cacheIdentifier();
+  }
+
+  if (iSetup.get<L1MuTriggerPtScaleRcd>().cacheIdentifier() != muPtScaleCacheID_) {
+    try {
+      iSetup.get<L1MuTriggerPtScaleRcd>().get(muptScaleHd_);
+    } catch (edm::eventsetup::NoProxyException<L1MuTriggerPtScaleRcd>& e) {
+      LogDebug("TrackMatcher") << "+++ Info: L1MuTriggerptScaleRcd is unavailable. +++\n";
+    }
+    muPtScaleCacheID_ = iSetup.get<L1MuTriggerPtScaleRcd>().cacheIdentifier();
+  }
+}
+
+//--------------- GE11/GE21 dphi flags of all tracks for all thresholds ------------------------------
+void L1MuonTTriggerRate::computeDPhiFlags(unsigned int ntracks)
+{
+  const unsigned int nthr(dPhiPtThresholds_.size());
+  for (int s = 0; s < 2; ++s) {
+    gemDPhi_[s].assign(ntracks, -99);
+    passDPhi_[s].assign(ntracks*nthr, 0);
+  }
+
+  for (unsigned int i = 0; i < ntracks; ++i) {
+    const TFTrack& track(tracks_[i]);
+    // same stubs as TFTrack::passDPhicutTFTrack: ME1/b first, then ME1/a
+    unsigned int lct[2] = {track.digiInME(1,1), track.digiInME(2,1)};
+    if (lct[0] == 999) lct[0] = track.digiInME(1,4);
+
+    for (int s = 0; s < 2; ++s) {
+      if (lct[s] >= track.getTriggerDigis().size()) continue;
+      const CSCDetId& id(track.getTriggerDigisIds()[lct[s]]);
+      const float dphi(track.getTriggerDigis()[lct[s]]->getGEMDPhi());
+      gemDPhi_[s][i] = dphi;
+      // no ME2/1 high-pT relaxation at track level
+      char* pass(&passDPhi_[s][i*nthr]);
+      for (unsigned int t = 0; t < nthr; ++t)
+        pass[t] = GEMCSCdPhiLUT::pass(dPhiLUT_.chamberCut(id, track.chargesign(), dPhiPtThresholds_[t], track.eta(), false), dphi);
+    }
+  }
 }
 
 
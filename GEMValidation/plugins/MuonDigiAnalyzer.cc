@@ -54,6 +54,7 @@
 #include "CommonTools/UtilAlgos/interface/TFileService.h"
 
 #include "GEMCode/GEMValidation/interface/SimTrackMatchManager.h"
+#include "GEMCode/GEMValidation/interface/GEMChamberPhiIndex.h"
 
 
 
@@ -167,8 +168,6 @@ private:
   void analyzeGEMCSCCoPad();  
   bool isSimTrackGood(const SimTrack &);
   void analyzeTracks(edm::ParameterSet, const edm::Event&, const edm::EventSetup&);
-  void buildLUT();
-  std::pair<int,int> getClosestChambers(int region, float phi);
 
   TTree* rpc_tree_;
   TTree* gem_tree_;
@@ -211,8 +210,8 @@ private:
   float radiusCenter_;
   float chamberHeight_;
 
-  std::pair<std::vector<float>,std::vector<int> > positiveLUT_;
-  std::pair<std::vector<float>,std::vector<int> > negativeLUT_;
+  // GE1/1 chambers overlapping at a given phi
+  GEMChamberPhiIndex gemChamberPhiIndex_;
 
   bool hasGEMGeometry_;
   bool hasRPCGeometry_;
@@ -306,7 +305,7 @@ void MuonDigiAnalyzer::beginRun(edm::Run const&, edm::EventSetup const& iSetup)
     //cout<<"r0 top "<<top_chamber->toGlobal(p0).perp()<<" bot "<< bottom_chamber->toGlobal(p0).perp()<<endl;
     //cout<<"rch "<<radiusCenter_<<" hch "<<chamberHeight_<<endl;
     
-    buildLUT();
+    gemChamberPhiIndex_ = GEMChamberPhiIndex(*gem_geometry_, 1);
   }
 }
 
@@ -676,13 +675,15 @@ void MuonDigiAnalyzer::analyzeTracks(edm::ParameterSet cfg_, const edm::Event& i
 {
   const edm::SimVertexContainer & sim_vert = *sim_vertices.product();
   const edm::SimTrackContainer & sim_trks = *sim_tracks.product();
+  // gen particle ancestry of this event, shared by the matchers of all SimTracks
+  const auto genAncestry(DisplacedGENMuonMatcher::eventAncestry(cfg_, iEvent));
 
   for (auto& t: sim_trks)
   {
     if (!isSimTrackGood(t)) continue;
     
     // match hits and digis to this SimTrack
-    SimTrackMatchManager match(t, sim_vert[t.vertIndex()], cfg_, iEvent, iSetup);
+    SimTrackMatchManager match(t, sim_vert[t.vertIndex()], cfg_, iEvent, iSetup, genAncestry.get());
     
     const SimHitMatcher&  match_sh = match.simhits();
     const GEMDigiMatcher& match_gd = match.gemDigis();
@@ -744,7 +745,7 @@ void MuonDigiAnalyzer::analyzeTracks(edm::ParameterSet cfg_, const edm::Event& i
     const int track_region = (gp_track.z() > 0 ? 1 : -1);
     
     // closest chambers in phi
-    const auto mypair = getClosestChambers(track_region, track_angle);
+    const auto mypair = gemChamberPhiIndex_.closestChambers(track_region, track_angle);
     
     // chambers
     GEMDetId detId_first(mypair.first);
@@ -894,38 +895,5 @@ void MuonDigiAnalyzer::fillDescriptions(edm::ConfigurationDescriptions& descript
   descriptions.addDefault(desc);
 }
 
-void MuonDigiAnalyzer::buildLUT()
-{
-  std::vector<int> pos_ids;
-  pos_ids.push_back(GEMDetId(1,1,1,1,36,2).rawId());
-
-  std::vector<int> neg_ids;
-  neg_ids.push_back(GEMDetId(-1,1,1,1,36,2).rawId());
-
-  // VK: I would really suggest getting phis from GEMGeometry
-  
-  std::vector<float> phis;
-  phis.push_back(0.);
-  for(int i=1; i<37; ++i)
-  {
-    pos_ids.push_back(GEMDetId(1,1,1,1,i,2).rawId());
-    neg_ids.push_back(GEMDetId(-1,1,1,1,i,2).rawId());
-    phis.push_back(i*10.);
-  }
-  positiveLUT_ = std::make_pair(phis,pos_ids);
-  negativeLUT_ = std::make_pair(phis,neg_ids);
-}
-
-std::pair<int,int>
-MuonDigiAnalyzer::getClosestChambers(int region, float phi)
-{
-  auto& phis(positiveLUT_.first);
-  auto upper = std::upper_bound(phis.begin(), phis.end(), phi);
-  //std::cout << "lower = " << upper - phis.begin()  << std::endl;
-  //std::cout << "upper = " << upper - phis.begin() + 1 << std::endl;
-  auto& LUT = (region == 1 ? positiveLUT_.second : negativeLUT_.second);
-  return std::make_pair(LUT.at(upper - phis.begin()), (LUT.at((upper - phis.begin() + 1)%36)));
-}
-
 //define this as a plug-in
 DEFINE_FWK_MODULE(MuonDigiAnalyzer);
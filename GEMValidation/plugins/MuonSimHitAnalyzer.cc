@@ -31,6 +31,7 @@
 #include "CommonTools/UtilAlgos/interface/TFileService.h"
 
 #include "GEMCode/GEMValidation/interface/SimTrackMatchManager.h"
+#include "GEMCode/GEMValidation/interface/GEMChamberPhiIndex.h"
 
 #include "TTree.h"
 
@@ -119,8 +120,6 @@ private:
   void analyzeME0( const edm::Event& iEvent );
   bool isSimTrackGood(const SimTrack &t);
   void analyzeTracks(const edm::Event& iEvent, const edm::EventSetup& iSetup);
-  void buildLUT();
-  std::pair<int,int> getClosestChambers(int region, float phi);
 
   TTree* csc_sh_tree_;
   TTree* rpc_sh_tree_;
@@ -168,8 +167,8 @@ private:
   float radiusCenter_;
   float chamberHeight_;
 
-  std::pair<std::vector<float>,std::vector<int> > positiveLUT_;
-  std::pair<std::vector<float>,std::vector<int> > negativeLUT_;
+  // GE1/1 chambers overlapping at a given phi
+  GEMChamberPhiIndex gemChamberPhiIndex_;
 
   bool hasGEMGeometry_;
   bool hasRPCGeometry_;
@@ -277,7 +276,7 @@ void MuonSimHitAnalyzer::beginRun(const edm::Run &iRun, const edm::EventSetup &i
 //     cout<<"r0 top "<<top_chamber->toGlobal(p0).perp()<<" bot "<< bottom_chamber->toGlobal(p0).perp()<<endl;
 //     cout<<"rch "<<radiusCenter_<<" hch "<<chamberHeight_<<endl;
     
-    buildLUT();
+    gemChamberPhiIndex_ = GEMChamberPhiIndex(*gem_geometry_, 1);
   }
 }
 
@@ -651,13 +650,15 @@ bool MuonSimHitAnalyzer::isSimTrackGood(const SimTrack &t)
 void MuonSimHitAnalyzer::analyzeTracks(const edm::Event& iEvent, const edm::EventSetup& iSetup)
 {
   const edm::SimVertexContainer & sim_vert(*simVertices.product());
+  // gen particle ancestry of this event, shared by the matchers of all SimTracks
+  const auto genAncestry(DisplacedGENMuonMatcher::eventAncestry(cfg_, iEvent));
   
   for (auto& t: *simTracks.product())
   {
     if (!isSimTrackGood(t)) continue;
     
     // match hits and digis to this SimTrack
-    const SimTrackMatchManager match(t, sim_vert[t.vertIndex()], cfg_, iEvent, iSetup);
+    const SimTrackMatchManager match(t, sim_vert[t.vertIndex()], cfg_, iEvent, iSetup, genAncestry.get());
     const SimHitMatcher& match_sh = match.simhits();
 
     track.pt = t.momentum().pt();
@@ -704,7 +705,7 @@ void MuonSimHitAnalyzer::analyzeTracks(const edm::Event& iEvent, const edm::Even
     const int track_region = (gp_track.z() > 0 ? 1 : -1);
     
     // closest chambers in phi
-    const auto mypair = getClosestChambers(track_region, track_angle);
+    const auto mypair = gemChamberPhiIndex_.closestChambers(track_region, track_angle);
     
     // chambers
     GEMDetId detId_first(mypair.first);
@@ -784,37 +785,6 @@ void MuonSimHitAnalyzer::fillDescriptions(edm::ConfigurationDescriptions& descri
   descriptions.addDefault(desc);
 }
 
-void MuonSimHitAnalyzer::buildLUT()
-{
-  std::vector<int> pos_ids;
-  pos_ids.push_back(GEMDetId(1,1,1,1,36,2).rawId());
-
-  std::vector<int> neg_ids;
-  neg_ids.push_back(GEMDetId(-1,1,1,1,36,2).rawId());
-
-  std::vector<float> phis;
-  phis.push_back(0.);
-  for(int i=1; i<37; ++i)
-  {
-    pos_ids.push_back(GEMDetId(1,1,1,1,i,2).rawId());
-    neg_ids.push_back(GEMDetId(-1,1,1,1,i,2).rawId());
-    phis.push_back(i*10.);
-  }
-  positiveLUT_ = std::make_pair(phis,pos_ids);
-  negativeLUT_ = std::make_pair(phis,neg_ids);
-}
-
-std::pair<int,int>
-MuonSimHitAnalyzer::getClosestChambers(int region, float phi)
-{
-  auto& phis(positiveLUT_.first);
-  auto upper = std::upper_bound(phis.begin(), phis.end(), phi);
-//   std::cout << "lower = " << upper - phis.begin()  << std::endl;
-//   std::cout << "upper = " << upper - phis.begin() + 1 << std::endl;
-  auto& LUT = (region == 1 ? positiveLUT_.second : negativeLUT_.second);
-  return std::make_pair(LUT.at(upper - phis.begin()), (LUT.at((upper - phis.begin() + 1)%36)));
-}
-
 //define this as a plug-in
 DEFINE_FWK_MODULE(MuonSimHitAnalyzer);
 
@@ -0,0 +1,177 @@
+/**\class MuonSlimSkimProducer
+
+ Description:
+
+ Companion producer of the muon-only slim skim (see GEMCode/GEMValidation/python/muonSlimSkim_cff.py).
+ It copies the SimTracks of the muons in the event together with their families (all
+ the tracks descending from a muon, as followed by SimHitMatcher::getIdsOfSimTrackShower)
+ and their ancestors, the SimVertices of these tracks, and the muon PSimHit collections.
+
+ The skim job runs it with the label g4SimHits, reading the g4SimHits products of the
+ simulation process (simProcessName), so that the analyzers and simTrackMatching_cfi read
+ the slim file with their usual InputTags. The vertex indices of the copied SimTracks
+ point into the pruned SimVertex collection; track ids and vertex parent ids are kept.
+*/
+
+#include "FWCore/Framework/interface/Frameworkfwd.h"
+#include "FWCore/Framework/interface/EDProducer.h"
+#include "FWCore/Framework/interface/MakerMacros.h"
+#include "FWCore/Framework/interface/Event.h"
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
+#include "FWCore/Utilities/interface/InputTag.h"
+
+#include "SimDataFormats/Track/interface/SimTrackContainer.h"
+#include "SimDataFormats/Vertex/interface/SimVertexContainer.h"
+#include "SimDataFormats/TrackingHit/interface/PSimHitContainer.h"
+
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+
+class MuonSlimSkimProducer : public edm::EDProducer
+{
+public:
+
+  explicit MuonSlimSkimProducer(const edm::ParameterSet&);
+
+  ~MuonSlimSkimProducer() {}
+
+private:
+
+  virtual void produce(edm::Event&, const edm::EventSetup&);
+
+  // the muons whose families are kept
+  bool isSelectedMuon(const SimTrack& t) const;
+
+  string simProcessName_;
+  vector<string> simHitInstances_;
+  bool pruneSimHits_;
+  double minPt_;
+  double maxEta_;
+  int verbose_;
+};
+
+
+MuonSlimSkimProducer::MuonSlimSkimProducer(const edm::ParameterSet& ps)
+: simProcessName_(ps.getParameter<string>("simProcessName"))
+, simHitInstances_(ps.getParameter<vector<string> >("simHitInstances"))
+, pruneSimHits_(ps.getParameter<bool>("pruneSimHits"))
+, minPt_(ps.getParameter<double>("minPt"))
+, maxEta_(ps.getParameter<double>("maxEta"))
+, verbose_(ps.getUntrackedParameter<int>("verbose", 0))
+{
+  produces<edm::SimTrackContainer>();
+  produces<edm::SimVertexContainer>();
+  for (auto& instance: simHitInstances_) produces<edm::PSimHitContainer>(instance);
+}
+
+
+bool MuonSlimSkimProducer::isSelectedMuon(const SimTrack& t) const
+{
+  return std::abs(t.type()) == 13 and t.momentum().pt() >= minPt_ and std::abs(t.momentum().eta()) <= maxEta_;
+}
+
+
+void MuonSlimSkimProducer::produce(edm::Event& ev, const edm::EventSetup& es)
+{
+  edm::Handle<edm::SimTrackContainer> sim_tracks;
+  edm::Handle<edm::SimVertexContainer> sim_vertices;
+  ev.getByLabel(edm::InputTag("g4SimHits", "", simProcessName_), sim_tracks);
+  ev.getByLabel(edm::InputTag("g4SimHits", "", simProcessName_), sim_vertices);
+  const edm::SimTrackContainer& tracks(*sim_tracks.product());
+  const edm::SimVertexContainer& vertices(*sim_vertices.product());
+
+  map<unsigned int, unsigned int> trkid_to_index;
+  for (unsigned int i = 0; i < tracks.size(); ++i) trkid_to_index[tracks[i].trackId()] = i;
+
+  // index of the parent track of a track, -1 without one
+  auto parent = [&](const SimTrack& t) -> int
+  {
+    if (t.noVertex() or vertices[t.vertIndex()].noParent()) return -1;
+    auto association = trkid_to_index.find(vertices[t.vertIndex()].parentIndex());
+    return association == trkid_to_index.end() ? -1 : int(association->second);
+  };
+
+  // family: 0 not known yet, 1 descends from a selected muon (or is one), 2 does not
+  vector<char> family(tracks.size(), 0);
+  vector<unsigned int> chain;
+  for (unsigned int i = 0; i < tracks.size(); ++i) {
+    chain.clear();
+    int j = i;
+    char result = 2;
+    while (j >= 0 and family[j] == 0) {
+      if (isSelectedMuon(tracks[j])) { result = 1; break; }
+      chain.push_back(j);
+      j = parent(tracks[j]);
+      // guard against parent loops in corrupted records
+      if (chain.size() > tracks.size()) break;
+    }
+    if (j >= 0 and family[j] != 0) result = family[j];
+    if (j >= 0 and family[j] == 0 and result == 1) family[j] = 1;
+    for (auto k: chain) family[k] = result;
+  }
+
+  // ancestors of the selected muons
+  vector<bool> keep(tracks.size(), false);
+  for (unsigned int i = 0; i < tracks.size(); ++i) {
+    if (family[i] != 1) continue;
+    keep[i] = true;
+    if (!isSelectedMuon(tracks[i])) continue;
+    for (int j = parent(tracks[i]); j >= 0 and !keep[j]; j = parent(tracks[j])) keep[j] = true;
+  }
+
+  std::auto_ptr<edm::SimTrackContainer> slim_tracks(new edm::SimTrackContainer());
+  std::auto_ptr<edm::SimVertexContainer> slim_vertices(new edm::SimVertexContainer());
+  map<int, int> vertex_index;
+  for (unsigned int i = 0; i < tracks.size(); ++i) {
+    if (!keep[i]) continue;
+    const SimTrack& t(tracks[i]);
+    int iv = -1;
+    if (!t.noVertex()) {
+      auto inserted = vertex_index.insert(make_pair(t.vertIndex(), int(slim_vertices->size())));
+      if (inserted.second) slim_vertices->push_back(vertices[t.vertIndex()]);
+      iv = inserted.first->second;
+    }
+    SimTrack slim(t.type(), t.momentum(), iv, t.genpartIndex());
+    slim.setTrackId(t.trackId());
+    slim.setEventId(t.eventId());
+    slim_tracks->push_back(slim);
+  }
+
+  unsigned int nHits = 0, nSlimHits = 0;
+  for (auto& instance: simHitInstances_) {
+    std::auto_ptr<edm::PSimHitContainer> slim_hits(new edm::PSimHitContainer());
+    edm::Handle<edm::PSimHitContainer> hits;
+    if (ev.getByLabel(edm::InputTag("g4SimHits", instance, simProcessName_), hits)) {
+      nHits += hits->size();
+      for (auto& h: *hits) {
+        if (pruneSimHits_) {
+          auto association = trkid_to_index.find(h.trackId());
+          if (association == trkid_to_index.end() or !keep[association->second]) continue;
+        }
+        slim_hits->push_back(h);
+      }
+    }
+    nSlimHits += slim_hits->size();
+    ev.put(slim_hits, instance);
+  }
+
+  if (verbose_) {
+    cout << "MuonSlimSkimProducer: " << slim_tracks->size() << "/" << tracks.size() << " SimTracks, "
+         << slim_vertices->size() << "/" << vertices.size() << " SimVertices, "
+         << nSlimHits << "/" << nHits << " muon SimHits" << endl;
+  }
+
+  ev.put(slim_tracks);
+  ev.put(slim_vertices);
+}
+
+
+//define this as a plug-in
+DEFINE_FWK_MODULE(MuonSlimSkimProducer);
@@ -0,0 +1,13 @@
+import FWCore.ParameterSet.Config as cms
+
+MuonSlimSkimProducer = cms.EDProducer("MuonSlimSkimProducer",
+    verbose = cms.untracked.int32(0),
+    ## process of the g4SimHits products to slim
+    simProcessName = cms.string("SIM"),
+    simHitInstances = cms.vstring("MuonCSCHits", "MuonGEMHits", "MuonRPCHits", "MuonDTHits", "MuonME0Hits"),
+    ## keep only the SimHits of the kept SimTracks
+    pruneSimHits = cms.bool(True),
+    ## muons whose families and ancestors are kept
+    minPt = cms.double(0.),
+    maxEta = cms.double(99.),
+)
@@ -0,0 +1,43 @@
+import FWCore.ParameterSet.Config as cms
+
+## Muon-only slim skim of FEVTDEBUG files, for repeated passes of GEMCSCAnalyzer,
+## MuonDigiAnalyzer, GEMRecHitAnalyzer and GEMCSCTriggerRate. The slim event has
+## the muon collections consumed by simTrackMatching_cfi and by the trigger rate
+## code, with the SimTracks, SimVertices and muon SimHits of g4SimHits replaced by
+## those of MuonSlimSkimProducer. The producer runs with the label g4SimHits, so
+## that the slim files are read with the usual InputTags.
+
+from GEMCode.GEMValidation.MuonSlimSkimProducer_cfi import MuonSlimSkimProducer
+from GEMCode.GEMValidation.simTrackMatching_cfi import SimTrackMatching
+
+## trigger rate and pileup products not covered by simTrackMatching
+muonSlimExtraLabels = ['simCscTriggerPrimitiveDigis', 'simDtTriggerPrimitiveDigis', 'simCsctfTrackDigis',
+                       'simCsctfDigis', 'simGmtDigis', 'l1extraParticles', 'addPileupInfo', 'genParticles']
+
+def muonSlimOutputCommands(skimProcessName, matching = SimTrackMatching):
+    """keep statements for the inputs of a simTrackMatching PSet, the slim g4SimHits and the extra labels"""
+    keep = set()
+    for name in matching.parameterNames_():
+        pset = getattr(matching, name)
+        if not isinstance(pset, cms.PSet) or not hasattr(pset, 'validInputTags'):
+            continue
+        for tag in pset.validInputTags:
+            if tag.getModuleLabel() == 'g4SimHits':
+                continue
+            keep.add('keep *_%s_%s_*' % (tag.getModuleLabel(), tag.getProductInstanceLabel() or '*'))
+    for label in muonSlimExtraLabels:
+        keep.add('keep *_%s_*_*' % label)
+    return cms.untracked.vstring(['drop *'] + sorted(keep) + ['drop *_g4SimHits_*_*', 'keep *_g4SimHits_*_%s' % skimProcessName])
+
+def addMuonSlimSkim(process, fileName, simProcessName = "SIM", matching = SimTrackMatching):
+    """slim g4SimHits, a path running it and an output module writing the slim events"""
+    process.g4SimHits = MuonSlimSkimProducer.clone(simProcessName = cms.string(simProcessName))
+    process.muonSlimSkim = cms.Path(process.g4SimHits)
+    process.muonSlimOutput = cms.OutputModule("PoolOutputModule",
+        fileName = cms.untracked.string(fileName),
+        outputCommands = muonSlimOutputCommands(process.name_(), matching),
+        SelectEvents = cms.untracked.PSet(SelectEvents = cms.vstring('muonSlimSkim')),
+        dropMetaData = cms.untracked.string('DROPPED'),
+    )
+    process.muonSlimOutputPath = cms.EndPath(process.muonSlimOutput)
+    return process
@@ -53,6 +53,7 @@ SimTrackMatching = cms.PSet(
         run = cms.bool(True),
         simMuOnly = cms.bool(True),
         discardEleHits = cms.bool(True),
+        matchDeltaPad = cms.int32(0),
     ),
     gemStripDigi = cms.PSet(
         verbose = cms.int32(0),
@@ -295,6 +296,11 @@ SimTrackMatching = cms.PSet(
         minBX = cms.int32(-1),
         maxBX = cms.int32(1),
         deltaR = cms.double(0.5),
+        ## stubs of a TF track that must belong to a SimTrack (LCTSimTrackAssociation)
+        minMatchedStubs = cms.int32(2),
+        ## legacy dR matching of every TF track to every SimTrack in TrackMatcher;
+        ## the analyzers use the stub matching above
+        matchByDeltaR = cms.bool(False),
     ),
     dtTfTrack = cms.PSet(
         verbose = cms.int32(0),
@@ -349,6 +355,7 @@ SimTrackMatching = cms.PSet(
 	validInputTags = cms.VInputTag(cms.InputTag("Notreal","test")),
 	verbose = cms.int32(0),
 	run = cms.bool(False),
+	motherPdgIds = cms.vint32(36, 3000022),
     ),
     sectorProcessor = csctfTrackDigis.SectorProcessor,
 #       SRLUT = cms.PSet(
@@ -413,6 +420,10 @@ SimTrackMatching = cms.PSet(
         minBX = cms.int32(-1),
         maxBX = cms.int32(1),
         deltaR = cms.double(0.05),
+        ## one-to-one association with all the SimTracks of the event (SimTrackL1Association)
+        globalAssociation = cms.bool(False),
+        deltaBXCost = cms.double(0.05),
+        chargeMismatchCost = cms.double(0.1),
     ),
     l1ExtraMuonParticle = cms.PSet(
         verbose = cms.int32(0),
@@ -421,6 +432,9 @@ SimTrackMatching = cms.PSet(
         minBX = cms.int32(-1),
         maxBX = cms.int32(1),
         deltaR = cms.double(0.2),
+        globalAssociation = cms.bool(True),
+        deltaBXCost = cms.double(0.05),
+        chargeMismatchCost = cms.double(0.1),
     ),
     ## HLT Tracks
     recoTrackExtra = cms.PSet(
@@ -452,3 +466,62 @@ SimTrackMatching = cms.PSet(
         maxBX = cms.int32(1),
     ),
 )
+
+
+def dPhiLUTFromDict(dphi_lct_pad, eff, etaPartitionsME11, etaPartitionsME21,
+                    stationME11 = "ME1b", stationME21 = "ME21", relaxME21AbovePt = 15.):
+    """GEM-CSC bending angle LUT (GEMCSCdPhiLUT) from an eta-binned dictionary
+
+    dphi_lct_pad has the layout of GEMCSCdPhiDict.py: [station]["Eta<n>"]["Pt<x>"]["Eff<y>"]["odd"/"even"],
+    etaPartitions* have the layout of eta_partitions in cuts.py: {n : {'odd' : {'min', 'max'}, 'even' : {...}}}.
+    Every station keeps its own eta partitions; the dictionary needs an "Eta<n>" entry for each of them
+    and the same pT bins for both stations. Below the lowest pT of the dictionary no cut is applied.
+    Usage (GEMCSCdPhiDict has the 10 GE1/1 and 12 GE2/1 partitions of GE11-9-10 and GE21L):
+      from GEMCode.SimMuL1.GEMCSCdPhiDict import dphi_lct_pad
+      SimTrackMatching.dPhiLUT = dPhiLUTFromDict(dphi_lct_pad, "Eff98", eta_partitions['GE11-9-10'], eta_partitions['GE21L'])
+    """
+    ptKey = lambda p: float(p[2:])
+    pts = sorted(dphi_lct_pad[stationME11]["Eta1"].keys(), key = ptKey)
+    def stationPSet(station, partitions):
+        table = dphi_lct_pad[station]
+        missing = ["Eta%d"%n for n in sorted(partitions.keys()) if "Eta%d"%n not in table]
+        if missing:
+            raise ValueError("dPhiLUTFromDict: the dictionary has %d eta bins for %s, the partition table %d (no %s)"
+                             %(len(table), station, len(partitions), ", ".join(missing)))
+        pset = cms.PSet()
+        for parity in ['odd', 'even']:
+            etaMin, etaMax, cuts = [], [], []
+            for n in sorted(partitions.keys()):
+                if sorted(table["Eta%d"%n].keys(), key = ptKey) != pts:
+                    raise ValueError("dPhiLUTFromDict: %s Eta%d does not have the pT bins %s"%(station, n, pts))
+                etaMin.append(partitions[n][parity]['min'])
+                etaMax.append(partitions[n][parity]['max'])
+                cuts.append(1.0)
+                for pt in pts:
+                    cuts.append(table["Eta%d"%n][pt][eff][parity])
+            setattr(pset, "etaMin_" + parity, cms.vdouble(etaMin))
+            setattr(pset, "etaMax_" + parity, cms.vdouble(etaMax))
+            setattr(pset, "cut_" + parity, cms.vdouble(cuts))
+        return pset
+    return cms.PSet(
+        ptThresholds = cms.vdouble([-2.] + [ptKey(p) for p in pts]),
+        relaxME21AbovePt = cms.double(relaxME21AbovePt),
+        ME11 = stationPSet(stationME11, etaPartitionsME11),
+        ME21 = stationPSet(stationME21, etaPartitionsME21),
+    )
+
+
+def dPhiWorkingPoint(name, lut):
+    """a dPhiLUTFromDict LUT as a working point of SimTrackMatching.dPhiWorkingPoints (GEMCSCAnalyzer)
+
+    Every working point is evaluated in the same pass and stored in the trk_eff trees as a
+    passdphi_<name> bitmask (bit1: odd LCT, bit2: even LCT, bit3/bit4: GE11/GE21 TF track). Usage
+    (see doDPhiWorkingPoints in test/runGEMCSCAnalyzer_cfg.py):
+      from GEMCode.SimMuL1.GEMCSCdPhiDict import dphi_lct_pad
+      SimTrackMatching.dPhiWorkingPoints = cms.VPSet(
+          [dPhiWorkingPoint(eff, dPhiLUTFromDict(dphi_lct_pad, eff, eta_partitions['GE11-9-10'], eta_partitions['GE21L']))
+           for eff in ["Eff95", "Eff98", "Eff99"]])
+    """
+    wp = lut.clone()
+    wp.name = cms.string(name)
+    return wp
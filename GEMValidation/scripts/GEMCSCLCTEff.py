@@ -25,15 +25,15 @@ c1.SetGridy()
 c1.SetTickx()
 c1.SetTicky()
 
-def getEff(file,dir,den,num):
-    f = ROOT.TFile(file)
-    t = f.Get(dir)
-    h1 = ROOT.TH1F("h1","h1",40,1.5,2.5)
-    t.Draw("(-eta) >> h1",den)
-    h2 = ROOT.TH1F("h2","h2",40,1.5,2.5)
-    t.Draw("(-eta) >> h2",num)
-    e = ROOT.TEfficiency(h2,h1)
-    return e
+from Helpers import getMultiHistFiller, book_eff, get_eff
+
+def getEffs(file,dir,cuts,nThreads=4):
+    """Efficiencies for a list of (name,den,num) cuts from a single pass over the file"""
+    filler = getMultiHistFiller(dir, file)
+    for name,den,num in cuts:
+        book_eff(filler, name, "(40,1.5,2.5)", "(-eta)", ROOT.TCut(den), ROOT.TCut(num))
+    filler.fill(nThreads)
+    return [get_eff(filler, name) for name,den,num in cuts]
 
 b1 = ROOT.TH1F("b1","b1",40,1.5,2.5)
 b1.GetYaxis().SetRangeUser(0.50,1.02)
@@ -49,9 +49,8 @@ num = "has_csc_sh>0 && has_lct>0 && pt>10"
 den_pt15 = "has_csc_sh>0 && pt <15"
 num_pt15 = "has_csc_sh>0 && has_lct>0 && pt<15"
 #e2 = getEff("PU140_100k_2019withoutGEM_GEMCSCAna.root",treename,den,num)
-e3 = getEff("PU140_200k_Pt2-50_2023_GE21dphi_v3_GEMCSC.root",treename,den,num)
-e2 = getEff("PU140_200k_Pt2-50_GEMCSC_LCTTiming.root",treename,den,num)
-e4 = getEff("PU140_200k_Pt2-50_GEMCSC_LCTTiming.root",treename,den_pt15,num_pt15)
+e3, = getEffs("PU140_200k_Pt2-50_2023_GE21dphi_v3_GEMCSC.root",treename,[("pt10",den,num)])
+e2, e4 = getEffs("PU140_200k_Pt2-50_GEMCSC_LCTTiming.root",treename,[("pt10",den,num),("pt15",den_pt15,num_pt15)])
 #e4 = getEff("PU140_200k_GE21dphi_v3_GEMCSC_hsfromgem_ana.root",treename,den,num)
 #e = getEff("PU140_100k_2023_fixeven_GEMCSCAna.root",treename,den,num)
 
@@ -1,6 +1,8 @@
 from ROOT import *
 import os
 
+from Helpers import getMultiHistFiller
+
 
 gROOT.SetBatch(1)
 #gStyle from TStyle
@@ -29,39 +31,52 @@ gStyle.SetPadBottomMargin(0.13)
 
 
 
-def GEMCSCResolution(filedir,treename1,xaxis,x_bins,st_title, xtitle, text, cuts,picname):
-    
-    c1 = TCanvas()
-    c1.SetGridx()
-    c1.SetGridy()
-    c1.SetTickx()
-    c1.SetTicky()
-    gStyle.SetOptFit(0111)
-    gStyle.SetOptStat(0)
-
-        
-    chain = TChain(treename1)
+def getResolutionFiller(filedir,treename1):
+    """MultiHistFiller over the file, or all the files of the directory"""
+    files = []
     if os.path.isdir(filedir):
     	  ls = os.listdir(filedir)
     	  for x in ls:
 		x = filedir[:]+x
-		chain.Add(x)
+		files.append(x)
     elif os.path.isfile(filedir):
-	  chain.Add(filedir)
+	  files.append(filedir)
     else:
 	  print " it is not file or dir ", filedir
+    return getMultiHistFiller(treename1, files)
+
+def bookResolution(filler,name,xaxis,x_bins,cuts):
+    """book the histogram of xaxis; filled by filler.fill()"""
+    xBins = int(x_bins[1:-1].split(',')[0])
+    xminBin = float(x_bins[1:-1].split(',')[1])
+    xmaxBin = float(x_bins[1:-1].split(',')[2])
+    filler.add1D(name, xaxis, cuts, xBins, xminBin, xmaxBin)
 
+def bookResolution2D(filler,name,xaxis,yaxis,x_bins,y_bins,cuts):
+    """book the histogram of yaxis:xaxis; filled by filler.fill()"""
     xBins = int(x_bins[1:-1].split(',')[0])
     xminBin = float(x_bins[1:-1].split(',')[1])
     xmaxBin = float(x_bins[1:-1].split(',')[2])
-    b1 = TH1F("b1","b1",xBins,xminBin,xmaxBin)
+    yBins = int(y_bins[1:-1].split(',')[0])
+    yminBin = float(y_bins[1:-1].split(',')[1])
+    ymaxBin = float(y_bins[1:-1].split(',')[2])
+    filler.add2D(name, xaxis, yaxis, cuts, xBins, xminBin, xmaxBin, yBins, yminBin, ymaxBin)
+
+def GEMCSCResolution(filler,name,st_title, xtitle, text,picname):
+    
+    c1 = TCanvas()
+    c1.SetGridx()
+    c1.SetGridy()
+    c1.SetTickx()
+    c1.SetTicky()
+    gStyle.SetOptFit(0111)
+    gStyle.SetOptStat(0)
+
+    b1 = filler.get(name)
     b1.SetTitle("%s"%st_title)
     b1.GetYaxis().SetTitle("Events")
     b1.GetXaxis().SetTitle("%s"%xtitle)
     #b1.SetStats(0)
-
-    b1.Sumw2() 
-    chain.Draw(xaxis+">>b1",cuts)
    # b1.Draw("colz")
 #    b2 = ROOT.TF2("b2","x^2+y^2",xminBin,xmaxBin,yminBin,ymaxBin)
 
@@ -79,7 +94,7 @@ def GEMCSCResolution(filedir,treename1,xaxis,x_bins,st_title, xtitle, text, cuts
     c1.SaveAs("%s"%picname+".pdf")
     c1.SaveAs("%s"%picname+".png")
 
-def GEMCSCResolution2D(filedir,treename1,xaxis, yaxis, x_bins, y_bins, st_title, xtitle, ytitle,text, cuts,picname):
+def GEMCSCResolution2D(filler,name,st_title, xtitle, ytitle,text,picname):
     
     c1 = TCanvas()
     c1.SetGridx()
@@ -89,33 +104,11 @@ def GEMCSCResolution2D(filedir,treename1,xaxis, yaxis, x_bins, y_bins, st_title,
     gStyle.SetOptFit(0111)
     gStyle.SetOptStat(0)
 
-        
-    chain = TChain(treename1)
-    if os.path.isdir(filedir):
-    	  ls = os.listdir(filedir)
-    	  for x in ls:
-		x = filedir[:]+x
-		chain.Add(x)
-    elif os.path.isfile(filedir):
-	  chain.Add(filedir)
-    else:
-	  print " it is not file or dir ", filedir
-
-    xBins = int(x_bins[1:-1].split(',')[0])
-    xminBin = float(x_bins[1:-1].split(',')[1])
-    xmaxBin = float(x_bins[1:-1].split(',')[2])
-    yBins = int(y_bins[1:-1].split(',')[0])
-    yminBin = float(y_bins[1:-1].split(',')[1])
-    ymaxBin = float(y_bins[1:-1].split(',')[2])
-    b1 = TH2F("b1","b1",xBins,xminBin,xmaxBin, yBins, yminBin, ymaxBin)
+    b1 = filler.get(name)
     b1.SetTitle("%s"%st_title)
     b1.GetYaxis().SetTitle("%s"%ytitle)
     b1.GetXaxis().SetTitle("%s"%xtitle)
     #b1.SetStats(0)
-
-    b1.Sumw2() 
-    print "xaxis ",xaxis," yaxis ",yaxis
-    chain.Draw(yaxis+":"+xaxis+">>b1",cuts)
    # b1.Draw("colz")
 #    b2 = ROOT.TF2("b2","x^2+y^2",xminBin,xmaxBin,yminBin,ymaxBin)
 
@@ -182,20 +175,23 @@ slope = {
 print "slope ME11 odd",slope["ME11even"]
 deltaphi0=-0.02
 ddphi = 0.004
+## one pass over the tree of each chamber type for all its plots
 for me in GEMCSCs:
+	treename1 = "GEMCSCAnalyzer/trk_eff_CSC_%s"%(me)
+	filler = getResolutionFiller(filedir,treename1)
+	plots = []
 	for a in evenodds:
 			dd=0
 		#for pt in pts:
 		#while dd<10:
 			#filedir = "/eos/uscms/store/user/tahuang/SLHC23_patch1_2023Muon_1M_Ana_PU0_Pt%d_20160301/"%pt
 			#filedir = "/eos/uscms/store/user/tahuang/SLHC23_patch1_2023Muon_1M_Ana_PU0_Pt2_50_20160301/"
-			treename1 = "GEMCSCAnalyzer/trk_eff_CSC_%s"%(me)
 			deltaphi1 = deltaphi0+dd*ddphi
 			deltaphi2 = deltaphi0+(dd+1)*ddphi
 			
 			#xaxis2 = "(dphi_lct_%s)-(phi_cscsh_%s-phi_gemsh_%s)"%(a,a,a)
 			#xaxis2 = "(phi_lct_%s-phi_pad_%s)-(phi_cscsh_%s-phi_gemsh_%s)"%(a,a,a,a)
-  			case= "%s%s"%(me,a)
+			case= "%s%s"%(me,a)
 			xaxis2 = "(dphi_pad_%s)-(dphi_sh_%s)*(1+%f)"%(a,a,slope[case])
 			#yaxis = "(dphi_pad_%s)"%(a)
 			yaxis = "(dphi_sh_%s)"%(a)
@@ -221,8 +217,13 @@ for me in GEMCSCs:
 			x_bins = "(100,-0.02,0.02)"
 			#text = "%.3f<#Delta#Phi_{GEM-CSC}^{SIM} <%.3f"%(deltaphi1, deltaphi2)
 			text="prompt muon,2<p_{T}<50"
-			#GEMCSCResolution(filedir,treename1,xaxis2,y_bins,st_title, xtitle2, text, cuts,picname)
-			#GEMCSCResolution(filedir,treename1,yaxis,y_bins,st_title, ytitle, text, cuts,picname2)
-    			#dd = dd+1
-			GEMCSCResolution2D(filedir,treename1,yaxis, xaxis2, y_bins, x_bins, st_title, ytitle, xtitle2,text, cuts,picname)
-			#GEMCSCResolution2D(filedir,treename1,"pt", xaxis2,"(20,0,50)", y_bins, st_title, "simulated p_{T}", xtitle2,text,cuts,picname2)
+			#bookResolution(filler,picname,xaxis2,y_bins,cuts)
+			#bookResolution(filler,picname2,yaxis,y_bins,cuts)
+			#dd = dd+1
+			print "xaxis ",yaxis," yaxis ",xaxis2
+			bookResolution2D(filler,picname,yaxis, xaxis2, y_bins, x_bins, cuts)
+			plots.append((picname, st_title, ytitle, xtitle2, text, picname))
+			#bookResolution2D(filler,picname2,"pt", xaxis2,"(20,0,50)", y_bins, cuts)
+	filler.fill(4)
+	for p in plots:
+		GEMCSCResolution2D(filler, *p)
@@ -10,398 +10,89 @@ from Helpers import *
 import sys
 sys.argv.append( '-b' )
 
-import ROOT 
+import ROOT
 ROOT.gROOT.SetBatch(1)
 
-
-#_______________________________________________________________________________
-def simTrackToCscSimHitMatching(plotter,st=1):
-
-    gStyle.SetTitleStyle(0);
-    gStyle.SetTitleAlign(13); ##coord in top left
-    gStyle.SetTitleX(0.);
-    gStyle.SetTitleY(1.);
-    gStyle.SetTitleW(1);
-    gStyle.SetTitleH(0.058);
-    gStyle.SetTitleBorderSize(0);
-    
-    gStyle.SetPadLeftMargin(0.126);
-    gStyle.SetPadRightMargin(0.04);
-    gStyle.SetPadTopMargin(0.06);
-    gStyle.SetPadBottomMargin(0.13);
-    gStyle.SetOptStat(0);
-    gStyle.SetMarkerStyle(1);
-    
-    ok_eta = TCut("TMath::Abs(eta)>%f && TMath::Abs(eta)<%f"%(plotter.etaMin,plotter.etaMax))
-
-    ## variables for the plot
-    topTitle = " " * 11 + "CSC SimHit matching" + " " * 35 + "CMS Simulation Preliminary"
-    xTitle = "Generated muon #eta"
-    yTitle = "Efficiency"
-    title = "%s;%s;%s"%(topTitle,xTitle,yTitle)
-    toPlot = "TMath::Abs(eta)"
-    h_bins = "(100,%f,%f)"%(plotter.etaMin,plotter.etaMax)
-    nBins = int(h_bins[1:-1].split(',')[0])
-    minBin = float(h_bins[1:-1].split(',')[1])
-    maxBin = float(h_bins[1:-1].split(',')[2])
-
-    c = TCanvas("c","c",700,450)
-    c.Clear()
-    base = TH1F("base",title,nBins,minBin,maxBin)
-    base.SetMinimum(plotter.yMin)
-    base.SetMaximum(plotter.yMax)
-    base.Draw("")
-    base.GetXaxis().SetLabelSize(0.05)
-    base.GetYaxis().SetLabelSize(0.05)
-    base.GetXaxis().SetTitleSize(0.05)
-    base.GetYaxis().SetTitleSize(0.05)
-
-    index = plotter.stationsToUse.index(st)
-
-    h1 = draw_geff(plotter.treeEffSt[index], title, h_bins, toPlot, nocut, ok_sh1, "same")
-
-    leg = TLegend(0.45,0.2,.75,0.35, "", "brNDC")
-    leg.SetBorderSize(0)
-    leg.SetFillStyle(0)
-    leg.SetTextSize(0.06)
-    leg.AddEntry(h1, "SimHits","l")
-    leg.Draw("same")
-    
-    csc = drawCscLabel(plotter.stations.reverse_mapping[st], 0.87,0.87,0.05)
-    pul = drawPuLabel(plotter.pu,0.17,0.17,0.05)
-#    tex = drawEtaLabel(plotter.etaMin,plotter.etaMax,0.2,0.8,0.05)
-
-    c.Print("%scsc_simhit_matching_efficiency_%s%s"%(plotter.targetDir, plotter.stations.reverse_mapping[st], plotter.ext))
+## Every function below describes one matching efficiency plot of a station:
+## the name of the output file, the title, the legend and the curves, as
+## (denominator cut, extra numerator cut, color, legend entry).
+## makeEffPlots books the curves of all the plots of a station, reads the
+## trk_eff tree of the station once (MultiHistFiller) and draws them.
 
 
 #_______________________________________________________________________________
-def simTrackToCscStripsWiresMatching(plotter,st=1):
-
-    gStyle.SetTitleStyle(0);
-    gStyle.SetTitleAlign(13); ##coord in top left
-    gStyle.SetTitleX(0.);
-    gStyle.SetTitleY(1.);
-    gStyle.SetTitleW(1);
-    gStyle.SetTitleH(0.058);
-    gStyle.SetTitleBorderSize(0);
-    
-    gStyle.SetPadLeftMargin(0.126);
-    gStyle.SetPadRightMargin(0.04);
-    gStyle.SetPadTopMargin(0.06);
-    gStyle.SetPadBottomMargin(0.13);
-    gStyle.SetOptStat(0);
-    gStyle.SetMarkerStyle(1);
-    
-    ok_eta = TCut("TMath::Abs(eta)>%f && TMath::Abs(eta)<%f"%(plotter.etaMin,plotter.etaMax))
-
-    ## variables for the plot
-    topTitle = " " * 11 + "CSC Digi matching" + " " * 35 + "CMS Simulation Preliminary"
-    xTitle = "Generated muon #eta"
-    yTitle = "Efficiency"
-    title = "%s;%s;%s"%(topTitle,xTitle,yTitle)
-    toPlot = "TMath::Abs(eta)"
-    h_bins = "(100,%f,%f)"%(plotter.etaMin,plotter.etaMax)
-    nBins = int(h_bins[1:-1].split(',')[0])
-    minBin = float(h_bins[1:-1].split(',')[1])
-    maxBin = float(h_bins[1:-1].split(',')[2])
-
-    c = TCanvas("c","c",700,450)
-    c.Clear()
-    base  = TH1F("base",title,nBins,minBin,maxBin)
-    base.SetMinimum(plotter.yMin)
-    base.SetMaximum(plotter.yMax)
-    base.Draw("")
-    base.GetXaxis().SetLabelSize(0.05)
-    base.GetYaxis().SetLabelSize(0.05)
-    base.GetXaxis().SetTitleSize(0.05)
-    base.GetYaxis().SetTitleSize(0.05)
-
-    index = plotter.stationsToUse.index(st)
-
-    h1 = draw_geff(plotter.treeEffSt[index], title, h_bins, toPlot, ok_sh1, ok_w1, "same", kRed)
-    h2 = draw_geff(plotter.treeEffSt[index], title, h_bins, toPlot, ok_sh1, ok_st1, "same")
-   
-    leg = TLegend(0.45,0.2,.75,0.35, "", "brNDC")
-    leg.SetBorderSize(0)
-    leg.SetFillStyle(0)
-    leg.SetTextSize(0.06)
-    leg.AddEntry(h1, "Wires","l")
-    leg.AddEntry(h2, "Strips","l")
-    leg.Draw("same")
-    
-    csc = drawCscLabel(plotter.stations.reverse_mapping[st], 0.87,0.87,0.05)
-    pul = drawPuLabel(plotter.pu,0.17,0.17,0.05)
-    #tex = drawEtaLabel(plotter.etaMin,plotter.etaMax,0.2,0.8,0.05)
-
-    c.Print("%scsc_digi_matching_efficiency_%s%s"%(plotter.targetDir,plotter.stations.reverse_mapping[st],plotter.ext))
+def simTrackToCscSimHitMatching(plotter):
+    return dict(name = "csc_simhit_matching_efficiency",
+                title = "CSC SimHit matching",
+                legend = (0.45,0.2,.75,0.35), legendTextSize = 0.06,
+                curves = [(nocut, ok_sh1, kBlue, "SimHits")])
 
 
 #_______________________________________________________________________________
-def simTrackToCscStripsWiresMatching_2(plotter,st=1):
-
-    gStyle.SetTitleStyle(0)
-    gStyle.SetTitleAlign(13) ##coord in top left
-    gStyle.SetTitleX(0.)
-    gStyle.SetTitleY(1.)
-    gStyle.SetTitleW(1)
-    gStyle.SetTitleH(0.058)
-    gStyle.SetTitleBorderSize(0)
-    
-    gStyle.SetPadLeftMargin(0.126)
-    gStyle.SetPadRightMargin(0.04)
-    gStyle.SetPadTopMargin(0.06)
-    gStyle.SetPadBottomMargin(0.13)
-    gStyle.SetOptStat(0)
-    gStyle.SetMarkerStyle(1)
-    
-    ok_eta = TCut("TMath::Abs(eta)>%f && TMath::Abs(eta)<%f"%(plotter.etaMin,plotter.etaMax))
-
-    ## variables for the plot
-    topTitle = " " * 11 + "CSC Digi matching" + " " * 35 + "CMS Simulation Preliminary"
-    xTitle = "Generated muon #eta"
-    yTitle = "Efficiency"
-    title = "%s;%s;%s"%(topTitle,xTitle,yTitle)
-    toPlot = "TMath::Abs(eta)"
-    h_bins = "(100,%f,%f)"%(plotter.etaMin,plotter.etaMax)
-    nBins = int(h_bins[1:-1].split(',')[0])
-    minBin = float(h_bins[1:-1].split(',')[1])
-    maxBin = float(h_bins[1:-1].split(',')[2])
-
-    c = TCanvas("c","c",700,450)
-    c.Clear()
-    base  = TH1F("base",title,nBins,minBin,maxBin)
-    base.SetMinimum(plotter.yMin)
-    base.SetMaximum(plotter.yMax)
-    base.Draw("")
-    base.GetXaxis().SetLabelSize(0.05)
-    base.GetYaxis().SetLabelSize(0.05)
-    base.GetXaxis().SetTitleSize(0.05)
-    base.GetYaxis().SetTitleSize(0.05)
-
-    index = plotter.stationsToUse.index(st)
-
-    h1 = draw_geff(plotter.treeEffSt[index], title, h_bins, toPlot, ok_sh1, OR(ok_w1,ok_st1), "same", kRed)
-    h2 = draw_geff(plotter.treeEffSt[index], title, h_bins, toPlot, ok_sh1, AND(ok_w1,ok_st1), "same")
-   
-    leg = TLegend(0.45,0.2,.75,0.35, "", "brNDC");
-    leg.SetBorderSize(0)
-    leg.SetFillStyle(0)
-    leg.SetTextSize(0.06)
-    leg.AddEntry(h1, "Wires OR strips","l")
-    leg.AddEntry(h2, "Wires AND strips","l")
-    leg.Draw("same");
-    
-    csc = drawCscLabel(plotter.stations.reverse_mapping[st], 0.87,0.87,0.05)
-    pul = drawPuLabel(plotter.pu,0.17,0.17,0.05)
-    #tex = drawEtaLabel(plotter.etaMin,plotter.etaMax,0.2,0.8,0.05)
-
-    c.Print("%scsc_combined_digi_matching_efficiency_%s%s"%(plotter.targetDir,plotter.stations.reverse_mapping[st],plotter.ext))
+def simTrackToCscStripsWiresMatching(plotter):
+    return dict(name = "csc_digi_matching_efficiency",
+                title = "CSC Digi matching",
+                legend = (0.45,0.2,.75,0.35), legendTextSize = 0.06,
+                curves = [(ok_sh1, ok_w1, kRed, "Wires"),
+                          (ok_sh1, ok_st1, kBlue, "Strips")])
 
 
 #_______________________________________________________________________________
-def simTrackToCscAlctClctMatching(plotter,st=1):
-
-    gStyle.SetTitleStyle(0);
-    gStyle.SetTitleAlign(13); ##coord in top left
-    gStyle.SetTitleX(0.);
-    gStyle.SetTitleY(1.);
-    gStyle.SetTitleW(1);
-    gStyle.SetTitleH(0.058);
-    gStyle.SetTitleBorderSize(0);
-    
-    gStyle.SetPadLeftMargin(0.126);
-    gStyle.SetPadRightMargin(0.04);
-    gStyle.SetPadTopMargin(0.06);
-    gStyle.SetPadBottomMargin(0.13);
-    gStyle.SetOptStat(0);
-    gStyle.SetMarkerStyle(1);
-    
-    ok_eta = TCut("TMath::Abs(eta)>%f && TMath::Abs(eta)<%f"%(plotter.etaMin,plotter.etaMax))
-
-    ## variables for the plot
-    topTitle = " " * 11 + "CSC Stub matching" + " " * 35 + "CMS Simulation Preliminary"
-    xTitle = "Generated muon #eta"
-    yTitle = "Efficiency"
-    title = "%s;%s;%s"%(topTitle,xTitle,yTitle)
-    toPlot = "TMath::Abs(eta)"
-    h_bins = "(100,%f,%f)"%(plotter.etaMin,plotter.etaMax)
-    nBins = int(h_bins[1:-1].split(',')[0])
-    minBin = float(h_bins[1:-1].split(',')[1])
-    maxBin = float(h_bins[1:-1].split(',')[2])
-
-    c = TCanvas("c","c",700,450)
-    c.Clear()
-    base  = TH1F("base",title,nBins,minBin,maxBin)
-    base.SetMinimum(plotter.yMin)
-    base.SetMaximum(plotter.yMax)
-    base.Draw("")
-    base.GetXaxis().SetLabelSize(0.05)
-    base.GetYaxis().SetLabelSize(0.05)
-    base.GetXaxis().SetTitleSize(0.05)
-    base.GetYaxis().SetTitleSize(0.05)
-
-    index = plotter.stationsToUse.index(st)
-
-    h1 = draw_geff(plotter.treeEffSt[index], title, h_bins, toPlot, ok_sh1, ok_alct1, "same", kRed)
-    h11 = draw_geff(plotter.treeEffSt[index], title, h_bins, toPlot, AND(ok_sh1,ok_w1), ok_alct1, "same", kOrange+1)
-    h2 = draw_geff(plotter.treeEffSt[index], title, h_bins, toPlot, ok_sh1, ok_clct1, "same",kBlue)
-    h21 = draw_geff(plotter.treeEffSt[index], title, h_bins, toPlot, AND(ok_sh1,ok_st1), ok_clct1, "same",kGreen+1)
-   
-    leg = TLegend(0.45,0.2,.75,0.5, "", "brNDC");
-    leg.SetBorderSize(0)
-    leg.SetFillStyle(0)
-    leg.SetTextSize(0.06)
-    leg.AddEntry(h1, "ALCT","l")
-    leg.AddEntry(h11, "ALCT provided wires","l")
-    leg.AddEntry(h2, "CLCT","l")
-    leg.AddEntry(h21, "CLCT provided strips","l")
-    leg.Draw("same");
-    
-    csc = drawCscLabel(plotter.stations.reverse_mapping[st], 0.87,0.87,0.05)
-    pul = drawPuLabel(plotter.pu,0.17,0.17,0.05)
-    #tex = drawEtaLabel(plotter.etaMin,plotter.etaMax,0.2,0.8,0.05)
-
-    c.Print("%scsc_stub_matching_efficiency_%s%s"%(plotter.targetDir,plotter.stations.reverse_mapping[st],plotter.ext))
+def simTrackToCscStripsWiresMatching_2(plotter):
+    return dict(name = "csc_combined_digi_matching_efficiency",
+                title = "CSC Digi matching",
+                legend = (0.45,0.2,.75,0.35), legendTextSize = 0.06,
+                curves = [(ok_sh1, OR(ok_w1,ok_st1), kRed, "Wires OR strips"),
+                          (ok_sh1, AND(ok_w1,ok_st1), kBlue, "Wires AND strips")])
 
 
 #_______________________________________________________________________________
-def simTrackToCscAlctClctMatching_2(plotter,st=1):
-
-    gStyle.SetTitleStyle(0);
-    gStyle.SetTitleAlign(13); ##coord in top left
-    gStyle.SetTitleX(0.);
-    gStyle.SetTitleY(1.);
-    gStyle.SetTitleW(1);
-    gStyle.SetTitleH(0.058);
-    gStyle.SetTitleBorderSize(0);
-    
-    gStyle.SetPadLeftMargin(0.126);
-    gStyle.SetPadRightMargin(0.04);
-    gStyle.SetPadTopMargin(0.06);
-    gStyle.SetPadBottomMargin(0.13);
-    gStyle.SetOptStat(0);
-    gStyle.SetMarkerStyle(1);
-    
-    ok_eta = TCut("TMath::Abs(eta)>%f && TMath::Abs(eta)<%f"%(plotter.etaMin,plotter.etaMax))
-
-    ## variables for the plot
-    topTitle = " " * 11 + "CSC Stub matching" + " " * 35 + "CMS Simulation Preliminary"
-    xTitle = "Generated muon #eta"
-    yTitle = "Efficiency"
-    title = "%s;%s;%s"%(topTitle,xTitle,yTitle)
-    toPlot = "TMath::Abs(eta)"
-    h_bins = "(100,%f,%f)"%(plotter.etaMin,plotter.etaMax)
-    nBins = int(h_bins[1:-1].split(',')[0])
-    minBin = float(h_bins[1:-1].split(',')[1])
-    maxBin = float(h_bins[1:-1].split(',')[2])
-
-    c = TCanvas("c","c",700,450)
-    c.Clear()
-    base  = TH1F("base",title,nBins,minBin,maxBin)
-    base.SetMinimum(plotter.yMin)
-    base.SetMaximum(plotter.yMax)
-    base.Draw("")
-    base.GetXaxis().SetLabelSize(0.05)
-    base.GetYaxis().SetLabelSize(0.05)
-    base.GetXaxis().SetTitleSize(0.05)
-    base.GetYaxis().SetTitleSize(0.05)
-
-    index = plotter.stationsToUse.index(st)
-
-    h1 = draw_geff(plotter.treeEffSt[index], title, h_bins, toPlot, ok_sh1, OR(ok_alct1,ok_clct1), "same", kRed)
-    h11 = draw_geff(plotter.treeEffSt[index], title, h_bins, toPlot, AND(ok_sh1,ok_st1,ok_w1), OR(ok_alct1,ok_clct1), "same", kOrange)
-    h2 = draw_geff(plotter.treeEffSt[index], title, h_bins, toPlot, ok_sh1, AND(ok_alct1,ok_clct1), "same",kBlue)
-    h21 = draw_geff(plotter.treeEffSt[index], title, h_bins, toPlot, AND(ok_sh1,ok_st1,ok_w1), AND(ok_alct1,ok_clct1), "same",kGreen+1)
-   
-    leg = TLegend(0.45,0.2,.75,0.5, "", "brNDC");
-    leg.SetBorderSize(0)
-    leg.SetFillStyle(0)
-    leg.SetTextSize(0.06)
-    leg.AddEntry(h1, "ALCT OR CLCT","l")
-    leg.AddEntry(h11, "ALCT OR CLCT provided wires and strips","l")
-    leg.AddEntry(h2, "ALCT AND CLCT","l")
-    leg.AddEntry(h21, "ALCT AND CLCT provided wires and strips","l")
-    leg.Draw("same");
-    
-    csc = drawCscLabel(plotter.stations.reverse_mapping[st], 0.87,0.87,0.05)
-    pul = drawPuLabel(plotter.pu,0.17,0.17,0.05)
-    #tex = drawEtaLabel(plotter.etaMin,plotter.etaMax,0.2,0.8,0.05)
-
-    c.Print("%scsc_combined_stub_matching_efficiency_%s%s"%(plotter.targetDir,plotter.stations.reverse_mapping[st],plotter.ext))
+def simTrackToCscAlctClctMatching(plotter):
+    return dict(name = "csc_stub_matching_efficiency",
+                title = "CSC Stub matching",
+                legend = (0.45,0.2,.75,0.5), legendTextSize = 0.06,
+                curves = [(ok_sh1, ok_alct1, kRed, "ALCT"),
+                          (AND(ok_sh1,ok_w1), ok_alct1, kOrange+1, "ALCT provided wires"),
+                          (ok_sh1, ok_clct1, kBlue, "CLCT"),
+                          (AND(ok_sh1,ok_st1), ok_clct1, kGreen+1, "CLCT provided strips")])
 
 
 #_______________________________________________________________________________
-def simTrackToCscLctMatching(plotter,st=1):
+def simTrackToCscAlctClctMatching_2(plotter):
+    return dict(name = "csc_combined_stub_matching_efficiency",
+                title = "CSC Stub matching",
+                legend = (0.45,0.2,.75,0.5), legendTextSize = 0.06,
+                curves = [(ok_sh1, OR(ok_alct1,ok_clct1), kRed, "ALCT OR CLCT"),
+                          (AND(ok_sh1,ok_st1,ok_w1), OR(ok_alct1,ok_clct1), kOrange, "ALCT OR CLCT provided wires and strips"),
+                          (ok_sh1, AND(ok_alct1,ok_clct1), kBlue, "ALCT AND CLCT"),
+                          (AND(ok_sh1,ok_st1,ok_w1), AND(ok_alct1,ok_clct1), kGreen+1, "ALCT AND CLCT provided wires and strips")])
 
-    gStyle.SetTitleStyle(0);
-    gStyle.SetTitleAlign(13); ##coord in top left
-    gStyle.SetTitleX(0.);
-    gStyle.SetTitleY(1.);
-    gStyle.SetTitleW(1);
-    gStyle.SetTitleH(0.058);
-    gStyle.SetTitleBorderSize(0);
-    
-    gStyle.SetPadLeftMargin(0.126);
-    gStyle.SetPadRightMargin(0.04);
-    gStyle.SetPadTopMargin(0.06);
-    gStyle.SetPadBottomMargin(0.13);
-    gStyle.SetOptStat(0);
-    gStyle.SetMarkerStyle(1);
-    
-    ok_eta = TCut("TMath::Abs(eta)>%f && TMath::Abs(eta)<%f"%(plotter.etaMin,plotter.etaMax))
 
-    ## variables for the plot
-    topTitle = " " * 11 + "CSC Stub matching" + " " * 35 + "CMS Simulation Preliminary"
-    xTitle = "Generated muon #eta"
-    yTitle = "Efficiency"
-    title = "%s;%s;%s"%(topTitle,xTitle,yTitle)
-    toPlot = "TMath::Abs(eta)"
-    h_bins = "(100,%f,%f)"%(plotter.etaMin,plotter.etaMax)
-    nBins = int(h_bins[1:-1].split(',')[0])
-    minBin = float(h_bins[1:-1].split(',')[1])
-    maxBin = float(h_bins[1:-1].split(',')[2])
-
-    c = TCanvas("c","c",700,450)
-    c.Clear()
-    base  = TH1F("base",title,nBins,minBin,maxBin)
-    base.SetMinimum(plotter.yMin)
-    base.SetMaximum(plotter.yMax)
-    base.Draw("")
-    base.GetXaxis().SetLabelSize(0.05)
-    base.GetYaxis().SetLabelSize(0.05)
-    base.GetXaxis().SetTitleSize(0.05)
-    base.GetYaxis().SetTitleSize(0.05)
-    
-    index = plotter.stationsToUse.index(st)
-
-    if plotter.matchAlctGem:        
-        h1 = draw_geff(plotter.treeEffSt[index], title, h_bins, toPlot, AND(ok_sh1, ok_alct1,OR(ok_clct1,ok_pad1)), ok_lct1, "same", kRed)
-        h2 = draw_geff(plotter.treeEffSt[index], title, h_bins, toPlot, ok_sh1, ok_lct1, "same", kBlue)
-    else:
-        h1 = draw_geff(plotter.treeEffSt[index], title, h_bins, toPlot, AND(ok_sh1, ok_alct1,ok_clct1), ok_lct1, "same", kRed)
-        h2 = draw_geff(plotter.treeEffSt[index], title, h_bins, toPlot, ok_sh1, ok_lct1, "same", kBlue)
-
-    leg = TLegend(0.10,0.2,.75,0.35, "", "brNDC");
-    leg.SetBorderSize(0)
-    leg.SetFillStyle(0)
-    leg.SetTextSize(0.04)
+#_______________________________________________________________________________
+def simTrackToCscLctMatching(plotter):
     if plotter.matchAlctGem:
-        leg.AddEntry(h1, "LCT matched to ALCT and (CLCT or GEM)","l")
-        leg.AddEntry(h2, "LCT","l")
+        matched = (AND(ok_sh1, ok_alct1,OR(ok_clct1,ok_pad1)), ok_lct1, kRed, "LCT matched to ALCT and (CLCT or GEM)")
     else:
-        leg.AddEntry(h1, "LCT matched to ALCT and CLCT","l")
-        leg.AddEntry(h2, "LCT","l")
-    leg.Draw("same");
-    
-    csc = drawCscLabel(plotter.stations.reverse_mapping[st], 0.87,0.87,0.05)
-    pul = drawPuLabel(plotter.pu,0.17,0.17,0.05)
-    #tex = drawEtaLabel(plotter.etaMin,plotter.etaMax,0.2,0.8,0.05)
+        matched = (AND(ok_sh1, ok_alct1,ok_clct1), ok_lct1, kRed, "LCT matched to ALCT and CLCT")
+    return dict(name = "csc_lct_matching_efficiency",
+                title = "CSC Stub matching",
+                legend = (0.10,0.2,.75,0.35), legendTextSize = 0.04,
+                curves = [matched,
+                          (ok_sh1, ok_lct1, kBlue, "LCT")])
 
-    c.Print("%scsc_lct_matching_efficiency_%s%s"%(plotter.targetDir,plotter.stations.reverse_mapping[st],plotter.ext))
+
+#_______________________________________________________________________________
+def simTrackToCscMpLctMatching(plotter):
+    return dict(name = "csc_mplct_matching_efficiency",
+                title = "CSC Stub matching",
+                legend = (0.10,0.2,.75,0.35), legendTextSize = 0.04,
+                curves = [(AND(ok_sh1, ok_alct1, ok_clct1), ok_mplct1, kRed, "MPLCT matched to ALCT and CLCT"),
+                          (ok_sh1, ok_mplct1, kBlue, "MPLCT")])
 
 
 #_______________________________________________________________________________
-def simTrackToCscMpLctMatching(plotter,st=1):
+def makeEffPlots(plotter, st, plots, nThreads = 4):
+    """Draw the plots of a station from a single pass over its trk_eff tree"""
 
     gStyle.SetTitleStyle(0);
     gStyle.SetTitleAlign(13); ##coord in top left
@@ -410,53 +101,57 @@ def simTrackToCscMpLctMatching(plotter,st=1):
     gStyle.SetTitleW(1);
     gStyle.SetTitleH(0.058);
     gStyle.SetTitleBorderSize(0);
-    
+
     gStyle.SetPadLeftMargin(0.126);
     gStyle.SetPadRightMargin(0.04);
     gStyle.SetPadTopMargin(0.06);
     gStyle.SetPadBottomMargin(0.13);
     gStyle.SetOptStat(0);
     gStyle.SetMarkerStyle(1);
-    
-    ok_eta = TCut("TMath::Abs(eta)>%f && TMath::Abs(eta)<%f"%(plotter.etaMin,plotter.etaMax))
 
-    ## variables for the plot
-    topTitle = " " * 11 + "CSC Stub matching" + " " * 35 + "CMS Simulation Preliminary"
+    stName = plotter.stations.reverse_mapping[st]
     xTitle = "Generated muon #eta"
     yTitle = "Efficiency"
-    title = "%s;%s;%s"%(topTitle,xTitle,yTitle)
     toPlot = "TMath::Abs(eta)"
     h_bins = "(100,%f,%f)"%(plotter.etaMin,plotter.etaMax)
     nBins = int(h_bins[1:-1].split(',')[0])
     minBin = float(h_bins[1:-1].split(',')[1])
     maxBin = float(h_bins[1:-1].split(',')[2])
 
-    c = TCanvas("c","c",700,450)
-    c.Clear()
-    base  = TH1F("base",title,nBins,minBin,maxBin)
-    base.SetMinimum(plotter.yMin)
-    base.SetMaximum(plotter.yMax)
-    base.Draw("")
-    base.GetXaxis().SetLabelSize(0.05)
-    base.GetYaxis().SetLabelSize(0.05)
-    base.GetXaxis().SetTitleSize(0.05)
-    base.GetYaxis().SetTitleSize(0.05)
-    
-    index = plotter.stationsToUse.index(st)
-
-    h1 = draw_geff(plotter.treeEffSt[index], title, h_bins, toPlot, AND(ok_sh1, ok_alct1, ok_clct1), ok_mplct1, "same", kRed)
-    h2 = draw_geff(plotter.treeEffSt[index], title, h_bins, toPlot, ok_sh1, ok_mplct1, "same", kBlue)
-
-    leg = TLegend(0.10,0.2,.75,0.35, "", "brNDC");
-    leg.SetBorderSize(0)
-    leg.SetFillStyle(0)
-    leg.SetTextSize(0.04)
-    leg.AddEntry(h1, "MPLCT matched to ALCT and CLCT","l")
-    leg.AddEntry(h2, "MPLCT","l")
-    leg.Draw("same");
-    
-    csc = drawCscLabel(plotter.stations.reverse_mapping[st], 0.87,0.87,0.05)
-    pul = drawPuLabel(plotter.pu,0.17,0.17,0.05)
-    #tex = drawEtaLabel(plotter.etaMin,plotter.etaMax,0.2,0.8,0.05)
-
-    c.Print("%scsc_mplct_matching_efficiency_%s%s"%(plotter.targetDir,plotter.stations.reverse_mapping[st],plotter.ext))
+    filler = getMultiHistFiller("%s/%s%s"%(plotter.analyzer, plotter.effSt, stName),
+                                plotter.inputDir + plotter.inputFile)
+    for p in plots:
+        for i, (den, num, color, label) in enumerate(p["curves"]):
+            book_eff(filler, "%s_%d"%(p["name"], i), h_bins, toPlot, den, num)
+    filler.fill(nThreads)
+
+    for p in plots:
+        topTitle = " " * 11 + p["title"] + " " * 35 + "CMS Simulation Preliminary"
+        title = "%s;%s;%s"%(topTitle,xTitle,yTitle)
+
+        c = TCanvas("c","c",700,450)
+        c.Clear()
+        base = TH1F("base",title,nBins,minBin,maxBin)
+        base.SetMinimum(plotter.yMin)
+        base.SetMaximum(plotter.yMax)
+        base.Draw("")
+        base.GetXaxis().SetLabelSize(0.05)
+        base.GetYaxis().SetLabelSize(0.05)
+        base.GetXaxis().SetTitleSize(0.05)
+        base.GetYaxis().SetTitleSize(0.05)
+
+        leg = TLegend(p["legend"][0], p["legend"][1], p["legend"][2], p["legend"][3], "", "brNDC")
+        leg.SetBorderSize(0)
+        leg.SetFillStyle(0)
+        leg.SetTextSize(p["legendTextSize"])
+        for i, (den, num, color, label) in enumerate(p["curves"]):
+            h = get_eff(filler, "%s_%d"%(p["name"], i), title, color)
+            h.Draw("same")
+            leg.AddEntry(h, label, "l")
+        leg.Draw("same")
+
+        csc = drawCscLabel(stName, 0.87,0.87,0.05)
+        pul = drawPuLabel(plotter.pu,0.17,0.17,0.05)
+        #tex = drawEtaLabel(plotter.etaMin,plotter.etaMax,0.2,0.8,0.05)
+
+        c.Print("%s%s_%s%s"%(plotter.targetDir, p["name"], stName, plotter.ext))
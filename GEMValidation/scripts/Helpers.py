@@ -2,7 +2,7 @@ from ROOT import *
 from cuts import *
 
 ## run quiet mode
-import sys
+import sys, os
 sys.argv.append( '-b' )
 
 import ROOT 
@@ -121,3 +121,44 @@ def draw_geff(t, title, h_bins, to_draw, den_cut, extra_num_cut,
 
     SetOwnership(eff, False)
     return eff
+
+
+#_______________________________________________________________________________
+def getMultiHistFiller(tree_name, file_names):
+    """Single-pass histogram filler over one or more files (see MultiHistFiller.C)"""
+    if not hasattr(ROOT, "MultiHistFiller"):
+        macro = os.path.join(os.path.dirname(os.path.abspath(__file__)), "MultiHistFiller.C")
+        gROOT.ProcessLine(".L %s+"%(macro))
+    filler = ROOT.MultiHistFiller(tree_name)
+    if isinstance(file_names, str):
+        file_names = [file_names]
+    for f in file_names:
+        filler.addFile(f)
+    return filler
+
+
+#_______________________________________________________________________________
+def book_eff(filler, h_name, h_bins, to_draw, den_cut, extra_num_cut):
+    """Book numerator and denominator of an efficiency plot; nothing is read yet"""
+    nBins  = int(h_bins[1:-1].split(',')[0])
+    minBin = float(h_bins[1:-1].split(',')[1])
+    maxBin = float(h_bins[1:-1].split(',')[2])
+    num_cut = AND(den_cut,extra_num_cut)
+    filler.add1D("num_" + h_name, to_draw, num_cut.GetTitle(), nBins, minBin, maxBin)
+    filler.add1D("den_" + h_name, to_draw, den_cut.GetTitle(), nBins, minBin, maxBin)
+
+
+#_______________________________________________________________________________
+def get_eff(filler, h_name, title = "", color = kBlue, marker_st = 1, marker_sz = 1.):
+    """TEfficiency from histograms booked with book_eff, after filler.fill()"""
+    num = filler.get("num_" + h_name)
+    den = filler.get("den_" + h_name)
+    eff = TEfficiency(num, den)
+    eff.SetTitle(title)
+    eff.SetLineWidth(2)
+    eff.SetLineColor(color)
+    eff.SetMarkerStyle(marker_st)
+    eff.SetMarkerColor(color)
+    eff.SetMarkerSize(marker_sz)
+    SetOwnership(eff, False)
+    return eff
@@ -23,10 +23,11 @@ if __name__ == "__main__":
   for i in range(len(plotter.stationsToUse)):
     st = plotter.stationsToUse[i]
     print "Processing station ", plotter.stations.reverse_mapping[st]
-    simTrackToCscSimHitMatching(plotter,st)
-    simTrackToCscStripsWiresMatching(plotter,st)
-    simTrackToCscStripsWiresMatching_2(plotter,st)
-    simTrackToCscAlctClctMatching(plotter,st)
-    simTrackToCscAlctClctMatching_2(plotter,st)
-    simTrackToCscLctMatching(plotter,st)
-#    simTrackToCscMpLctMatching(plotter,st)
+    makeEffPlots(plotter, st, [simTrackToCscSimHitMatching(plotter),
+                               simTrackToCscStripsWiresMatching(plotter),
+                               simTrackToCscStripsWiresMatching_2(plotter),
+                               simTrackToCscAlctClctMatching(plotter),
+                               simTrackToCscAlctClctMatching_2(plotter),
+                               simTrackToCscLctMatching(plotter),
+#                               simTrackToCscMpLctMatching(plotter),
+                               ])
@@ -2,6 +2,9 @@
 #include "GEMCode/GEMValidation/interface/SimHitMatcher.h"
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tuple>
 
 using namespace std;
 using namespace matching;
@@ -292,56 +295,11 @@ CSCStubMatcher::matchLCTsToSimTrack(const CSCCorrelatedLCTDigiCollection& lcts)
     if (digi_matcher_->nLayersWithStripInChamber(id) >= minNHitsChamberCLCT_ and digi_matcher_->nLayersWithWireInChamber(id) >= minNHitsChamberALCT_) ++n_minLayers;
     CSCDetId ch_id(id);
 
-    auto lcts_in_det = lcts.get(ch_id);
     DigiContainer lcts_tmp;
     CSCCorrelatedLCTDigiContainer cscLcts_tmp;
-    map<int, DigiContainer> bx_to_lcts;
-    for (auto lct = lcts_in_det.first; lct != lcts_in_det.second; ++lct)
-    {
-      if (!lct->isValid()) continue;
-
-      if (verbose()) cout<<"lct in detId "<<ch_id<<" "<<*lct<<endl;
-
-      int bx = lct->getBX();
-
-      // check that the BX for stub wasn't too early or too late
-      if (bx < minBXLCT_ || bx > maxBXLCT_) continue;
-
-      int hs = lct->getStrip() + 1; // LCT halfstrip and wiregoup numbers start from 0
-      int wg = lct->getKeyWG() + 1;
-
-      float dphi = lct->getGEMDPhi();
-
-      auto mydigi = make_digi(id, hs, bx, CSC_LCT, lct->getQuality(), lct->getPattern(), wg, dphi);
-      lcts_tmp.push_back(mydigi);
-      cscLcts_tmp.push_back(*lct);
-      bx_to_lcts[bx].push_back(mydigi);
-
-      // Add ghost LCTs when there are two in bx
-      // and the two don't share half-strip or wiregroup
-      // TODO: when GEMs would be used to resolve this, there might ned to be an option to turn this off!
-      if (bx_to_lcts[bx].size() == 2 and addGhostLCTs_)
-      {
-        auto lct11 = bx_to_lcts[bx][0];
-        auto lct22 = bx_to_lcts[bx][1];
-        int wg1 = digi_wg(lct11);
-        int wg2 = digi_wg(lct22);
-        int hs1 = digi_channel(lct11);
-        int hs2 = digi_channel(lct22);
-
-        if ( ! (wg1 == wg2 || hs1 == hs2) )
-        {
-          auto lct12 = lct11;
-          digi_wg(lct12) = wg2;
-          lcts_tmp.push_back(lct12);
-
-          auto lct21 = lct22;
-          digi_wg(lct21) = wg1;
-          lcts_tmp.push_back(lct21);
-          //cout<<"added ghosts"<<endl<<lct11<<"    "<<lct22<<endl <<lct12<<"    "<<lct21<<endl;
-        }
-      }
-    } // lcts_in_det
+    std::vector<int> source;
+    collectLCTsInChamber(id, lcts, minBXLCT_, maxBXLCT_, addGhostLCTs_, lcts_tmp, cscLcts_tmp, source);
+    if (verbose()) for (auto& lct: cscLcts_tmp) cout<<"lct in detId "<<ch_id<<" "<<lct<<endl;
 
     size_t n_lct = lcts_tmp.size();
     if (verbose()) cout<< "number of lcts = "<<n_lct<<endl;
@@ -359,139 +317,99 @@ CSCStubMatcher::matchLCTsToSimTrack(const CSCCorrelatedLCTDigiCollection& lcts)
     }
 
     // find a matching LCT
-    const GEMDetId gemDetId(GEMDetId(ch_id.zendcap(),1,ch_id.station(),1,ch_id.chamber(),0));
-    // find matching rpc chamber (only valid for me31 and me41)
-    const int csc_trig_sect(CSCTriggerNumbering::triggerSectorFromLabels(ch_id));
-    const int csc_trig_id( CSCTriggerNumbering::triggerCscIdFromLabels(ch_id));
-    const int csc_trig_chid((3*(csc_trig_sect-1)+csc_trig_id)%18 +1);
-    const int rpc_trig_sect((csc_trig_chid-1)/3+1);
-    const int rpc_trig_subsect((csc_trig_chid-1)%3+1);
-    const RPCDetId rpcDetId(RPCDetId(ch_id.zendcap(),1,ch_id.station(),rpc_trig_sect,1,rpc_trig_subsect,0));
-
-    auto clct(clctsInChamber(id));
-    auto alct(alctsInChamber(id));
-    auto pads(gem_digi_matcher_->coPadsInSuperChamber(gemDetId));
-    auto rpcDigis(rpc_digi_matcher_->digisInChamber(rpcDetId));
-    const auto hits = sh_matcher_->hitsInChamber(id);
-    
-    int iLct = -1;
-    for (auto &lct: lcts_tmp)
+    const auto& clct(clctsInChamber(id));
+    const auto& alct(alctsInChamber(id));
+    // every pairing needs an ALCT
+    if (alct.empty()) continue;
+
+    // An LCT matches when one of the following pairings holds:
+    //  - ALCT-CLCT: a CLCT with the LCT half-strip and an ALCT with the LCT
+    //    wiregroup and BX (any BX for LCTs in BX 6)
+    //  - ALCT-GEM (ME1/1, ME2/1): an ALCT with the LCT wiregroup and BX and
+    //    the LCT within 3 half-strips of the simtrack
+    //  - ALCT-RPC (ME3/1, ME4/1): RPC digis in the chamber, an ALCT with the
+    //    LCT wiregroup and the LCT within 3 half-strips of the simtrack
+    //  - any LCT in the other chambers, or when one of the ALCTs is invalid
+    // The ALCT and CLCT keys are sorted once per chamber, so each LCT is
+    // checked with a few binary searches instead of a loop over all ALCT-CLCT pairs.
+    std::vector<std::pair<int,int> > alct_wg_bx;
+    alct_wg_bx.reserve(alct.size());
+    bool invalidAlct(false);
+    for (const auto& a: alct)
     {
-      iLct++;
-      bool lct_matched(false);
-      for (unsigned int j=0; j<alct.size();j++){
-        for (unsigned int i=0; i<clct.size()+1;i++){
-          
-          if (verbose()) 
-            std::cout <<"lct size "<< lcts_tmp.size() << " available LCT " << lct << std::endl;
-          if (verbose())
-            std::cout <<"alcts size "<< alct.size() <<" jth "<<j<< " available ALCT " << alct[j] << std::endl;
-          if (verbose() and i<clct.size()) 
-            std::cout<<"clcts size"<< clct.size()<<" ith "<<i << " available CLCT " << clct[i] << std::endl; 
-          auto hasPad(pads.size()!=0);
-          auto hasDigis(rpcDigis.size()!=0);
-          
-          const bool caseAlctClct(j<alct.size() && i<clct.size());
-          const bool caseAlctGem(is_valid(alct[j]) and i==clct.size() and (ch_id.station() == 1 or ch_id.station() == 2) and ch_id.ring()==1);
-          //const bool caseClctGem(is_valid(clct[i]) and hasPad and !is_valid(alct[j]) and (ch_id.station() == 1 or ch_id.station() == 2));
-          const bool caseAlctRpc(is_valid(alct[j]) and i==clct.size() and (ch_id.station() == 3 or ch_id.station() == 4) and ch_id.ring()==1);
-          //const bool caseClctRpc(is_valid(clct[i]) and hasDigis and !is_valid(alct[j]) and (ch_id.station() == 3 or ch_id.station() == 4));
-          if(verbose()){
-            if (caseAlctGem and hasPad) std::cout <<" caseAlctGem and hasPad "<< std::endl;
-            else if (caseAlctGem and not(hasPad)) cout <<" caseAlct Gem and not hasPad "<< std::endl;
-            if (caseAlctRpc and hasDigis) std::cout <<" caseAlctRpc and hasDigis "<< std::endl;
-            else if (caseAlctRpc and not(hasDigis)) cout <<" caseAlctRpc and not hasDigis "<< std::endl;
-          }
-          const CSCChamber* cscChamber(cscGeometry_->chamber(CSCDetId(id)));
-          
-          const CSCLayer* cscKeyLayer(cscChamber->layer(3));
-          const CSCLayerGeometry* cscKeyLayerGeometry(cscKeyLayer->geometry());
-          const int nStrips(cscKeyLayerGeometry->numberOfStrips());
-          const float averageZ((cscKeyLayer->centerOfStrip(0)).z());
-          auto GpME(propagateToZ(averageZ));
-          auto lpME(cscKeyLayer->toLocal(GpME));
-          
-          const int my_hs_gem_propagate((nStrips-cscKeyLayerGeometry->nearestStrip(lpME))*2);
-          const auto hits = sh_matcher_->hitsInChamber(id);
-          const float my_hs_gemrpc_mean(sh_matcher_->simHitsMeanStrip(hits));
-          //const float my_wg_gemrpc_mean(sh_matcher_->simHitsMeanStrip(hits));
-          bool matchAlctGem_((matchAlctGemME11_ and ch_id.station()==1 )||(matchAlctGemME21_ and ch_id.station()==2));
-          //bool matchClctGem_((matchClctGemME11_ and cscid.station()==1 )||(matchClctGemME21_ and cscid.station()==2));
-          /* Printing Stuff
-             if (caseAlctClct[i][j]) std::cout << "caseAlctClct" << std::endl;
-             else if(matchAlctGem_)std::cout << "caseAlctGem" << std::endl;
-             std::cout << "mean half strip from simhits " << sh_matcher_->simHitsMeanStrip(hits)
-             <<"   half strip by propagating track " << my_hs_gem_propagate << std::endl;
-          */
-          float my_hs_gemrpc;
-          if (hsFromSimHitMean_)  my_hs_gemrpc= my_hs_gemrpc_mean;
-          else my_hs_gemrpc = my_hs_gem_propagate;
-          
-          //All the matching information can go here.
-          
-          auto digi_strips = digi_matcher_->stripsInChamber(id, 1);
-          int my_hs = -1 ;
-          if ( i < clct.size() ) my_hs = digi_channel(clct[i]);
-          
-          const int my_wg(digi_wg(alct[j]));
-          const int my_bx(digi_bx(alct[j]));
-          auto digi_wgs = digi_matcher_->wiregroupsInChamber(id,1);
-          
-          
-          if ( caseAlctClct and !((my_bx == digi_bx(lct) || 6 == digi_bx(lct)) and my_hs == digi_channel(lct) and my_wg == digi_wg(lct))){
-            if (verbose()) cout<<"  BAD LCT in AlctClct case"<<endl;
-            continue;
-          }
-          
-          //add hadPad here
-          if (matchAlctGem_ and caseAlctGem and !( my_bx == digi_bx(lct) and std::abs(my_hs_gemrpc - digi_channel(lct))<3 and my_wg == digi_wg(lct) ) ){
-            if (verbose()) cout<<"  BAD LCT in AlctGem case"<<endl;
-            continue;
-          }
-          else if (caseAlctGem and !matchAlctGem_) continue;
-          
-          /* if (matchClctGem_ and caseClctGem and !(my_bx == digi_bx(lct) and my_hs == digi_channel(lct) and std::abs(my_wg_gemrpc_mean - digi_wg(lct))<3) ){
-             if (verbose()) cout<<"  BAD"<<endl;
-             continue;
-             }*/
-          
-          //if (matchAlctRpc_ and caseAlctRpc and !(my_bx == digi_bx(lct) and std::abs(my_hs_gemrpc - digi_channel(lct))<3 and my_wg == digi_wg(lct) ) ){
-          if (matchAlctRpc_ and caseAlctRpc and !(hasDigis and  std::fabs(my_hs_gemrpc - digi_channel(lct))<3.0 and my_wg == digi_wg(lct) ) ){
-            if (verbose()) cout<<"  BAD LCT in AlctRpc case"<<endl;
-            //std::cout << "my_hs_gemrpc " << my_hs_gemrpc << "  hs from LCT " << digi_channel(lct) 
-            //        <<" my_wg " << my_wg << " wg in LCT "<<digi_wg(lct) <<std::endl;
-            continue;
-          }
-          else if (caseAlctRpc and !matchAlctRpc_) continue;
-          /* if (matchClctRpc_ and caseClctRpc and !(my_bx == digi_bx(lct) and my_hs == digi_channel(lct) and std::abs(my_wg_gemrpc_mean - digi_wg(lct))<3) ){
-             if (verbose()) cout<<"  BAD"<<endl;
-             continue;
-             }*/
-          
-          if (verbose() and ch_id.ring()==1 and (ch_id.station()==1 or ch_id.station()==2) and !caseAlctClct and !caseAlctGem) 
-            std::cout <<"ME11 or ME21: jth alct "<< j<<" ith clct "<<i <<"  not caseAlctClct caseAlctGem, LCT "<< lct << std::endl; 
-          if (chamber_to_lct_.find(id) == chamber_to_lct_.end())   chamber_to_lct_[id] = lct;
-          else if (chamber_to_lct_.find(id) != chamber_to_lct_.end() and 
-                   fabs(digi_channel(chamber_to_lct_[id])-my_hs_gemrpc) > fabs(digi_channel(lct)-my_hs_gemrpc)){
-            if (verbose()){
-              cout<<"ALARM!!! here already was matching LCT "<<chamber_to_lct_[id]<<endl;
-              cout<<"   new digi: "<<lct<<endl;
-            }
-            chamber_to_lct_[id] = lct;
-          }
-          
-          chamber_to_lcts_[id].push_back(lct);
-          chamber_to_cscLcts_[id].push_back(cscLcts_tmp[iLct]);
-          lct_matched = true;
-          
-          if (verbose() and caseAlctClct)  std::cout << " this LCT is matched to simtrack in AlctClct case" << std::endl;
-          if (verbose() and caseAlctGem)  std::cout << " this LCT is matched to simtrack in AlctGem case" << std::endl;
-          if (verbose() and caseAlctRpc)  std::cout << " this LCT is matched to simtrack in AlctRpc case" << std::endl;
-          break;
-        } //clct loop over
-        if (lct_matched) break;
-      }// alct loop over
-      
+      alct_wg_bx.push_back(std::make_pair(digi_wg(a), digi_bx(a)));
+      if (!is_valid(a)) invalidAlct = true;
+    }
+    std::sort(alct_wg_bx.begin(), alct_wg_bx.end());
+
+    std::vector<int> clct_hs;
+    clct_hs.reserve(clct.size());
+    for (const auto& c: clct) clct_hs.push_back(digi_channel(c));
+    std::sort(clct_hs.begin(), clct_hs.end());
+
+    auto hasAlct = [&alct_wg_bx](int wg, int bx) {
+      return std::binary_search(alct_wg_bx.begin(), alct_wg_bx.end(), std::make_pair(wg, bx));
+    };
+    auto hasAlctWG = [&alct_wg_bx](int wg) {
+      auto a = std::lower_bound(alct_wg_bx.begin(), alct_wg_bx.end(), std::make_pair(wg, std::numeric_limits<int>::min()));
+      return a != alct_wg_bx.end() and a->first == wg;
+    };
+
+    const bool isGemChamber(ch_id.ring()==1 and (ch_id.station()==1 or ch_id.station()==2));
+    const bool isRpcChamber(ch_id.ring()==1 and (ch_id.station()==3 or ch_id.station()==4));
+    const bool matchAlctGem_((matchAlctGemME11_ and ch_id.station()==1 )||(matchAlctGemME21_ and ch_id.station()==2));
+
+    bool hasDigis(false);
+    if (isRpcChamber)
+    {
+      // find matching rpc chamber (only valid for me31 and me41)
+      const int csc_trig_sect(CSCTriggerNumbering::triggerSectorFromLabels(ch_id));
+      const int csc_trig_id( CSCTriggerNumbering::triggerCscIdFromLabels(ch_id));
+      const int csc_trig_chid((3*(csc_trig_sect-1)+csc_trig_id)%18 +1);
+      const int rpc_trig_sect((csc_trig_chid-1)/3+1);
+      const int rpc_trig_subsect((csc_trig_chid-1)%3+1);
+      const RPCDetId rpcDetId(RPCDetId(ch_id.zendcap(),1,ch_id.station(),rpc_trig_sect,1,rpc_trig_subsect,0));
+      hasDigis = rpc_digi_matcher_->digisInChamber(rpcDetId).size()!=0;
+    }
+
+    const float my_hs_gemrpc(trackHalfStripInChamber(id));
+
+    for (unsigned int iLct = 0; iLct < n_lct; ++iLct)
+    {
+      const auto& lct(lcts_tmp[iLct]);
+      const int hs(digi_channel(lct));
+      const int wg(digi_wg(lct));
+      const int bx(digi_bx(lct));
+      const bool closeToTrack(std::fabs(my_hs_gemrpc - hs) < 3.0);
+
+      const bool caseAlctClct(!clct_hs.empty() and std::binary_search(clct_hs.begin(), clct_hs.end(), hs) and
+                              (bx == 6 ? hasAlctWG(wg) : hasAlct(wg, bx)));
+      const bool caseAlctGem(isGemChamber and matchAlctGem_ and closeToTrack and hasAlct(wg, bx));
+      const bool caseAlctRpc(isRpcChamber and matchAlctRpc_ and hasDigis and closeToTrack and hasAlctWG(wg));
+      const bool caseAlct(invalidAlct or !(isGemChamber or isRpcChamber));
+
+      if (!(caseAlctClct or caseAlctGem or caseAlctRpc or caseAlct))
+      {
+        if (verbose()) cout<<"  BAD LCT "<<lct<<endl;
+        continue;
+      }
+
+      if (chamber_to_lct_.find(id) == chamber_to_lct_.end())   chamber_to_lct_[id] = lct;
+      else if (fabs(digi_channel(chamber_to_lct_[id])-my_hs_gemrpc) > fabs(hs-my_hs_gemrpc)){
+        if (verbose()){
+          cout<<"ALARM!!! here already was matching LCT "<<chamber_to_lct_[id]<<endl;
+          cout<<"   new digi: "<<lct<<endl;
+        }
+        chamber_to_lct_[id] = lct;
+      }
+
+      chamber_to_lcts_[id].push_back(lct);
+      chamber_to_cscLcts_[id].push_back(cscLcts_tmp[source[iLct]]);
+
+      if (verbose() and caseAlctClct)  std::cout << " this LCT is matched to simtrack in AlctClct case" << std::endl;
+      else if (verbose() and caseAlctGem)  std::cout << " this LCT is matched to simtrack in AlctGem case" << std::endl;
+      else if (verbose() and caseAlctRpc)  std::cout << " this LCT is matched to simtrack in AlctRpc case" << std::endl;
+      else if (verbose())  std::cout << " this LCT is matched to simtrack in Alct case" << std::endl;
     } // lct loop over
     
   }
@@ -540,56 +458,11 @@ CSCStubMatcher::matchMPLCTsToSimTrack(const CSCCorrelatedLCTDigiCollection& mplc
     if (digi_matcher_->nLayersWithStripInChamber(id) >= minNHitsChamberCLCT_ and digi_matcher_->nLayersWithWireInChamber(id) >= minNHitsChamberALCT_) ++n_minLayers;
     CSCDetId ch_id(id);
 
-    auto mplcts_in_det = mplcts.get(ch_id);
     DigiContainer mplcts_tmp;
     CSCCorrelatedLCTDigiContainer cscMplcts_tmp;
-    map<int, DigiContainer> bx_to_mplcts;
-    for (auto lct = mplcts_in_det.first; lct != mplcts_in_det.second; ++lct)
-    {
-      if (!lct->isValid()) continue;
-
-      if (verbose()) cout<<"mplct in detId"<<ch_id<<" "<<*lct<<endl;
-
-      int bx = lct->getBX();
-
-      // check that the BX for stub wasn't too early or too late
-      if (bx < minBXLCT_ || bx > maxBXLCT_) continue;
-
-      int hs = lct->getStrip() + 1; // LCT halfstrip and wiregoup numbers start from 0
-      int wg = lct->getKeyWG() + 1;
-
-      float dphi = lct->getGEMDPhi();
-
-      auto mydigi = make_digi(id, hs, bx, CSC_LCT, lct->getQuality(), lct->getPattern(), wg, dphi);
-      mplcts_tmp.push_back(mydigi);
-      cscMplcts_tmp.push_back(*lct);
-      bx_to_mplcts[bx].push_back(mydigi);
-
-      // Add ghost mplcts when there are two in bx
-      // and the two don't share half-strip or wiregroup
-      // TODO: when GEMs would be used to resolve this, there might ned to be an option to turn this off!
-      if (bx_to_mplcts[bx].size() == 2 and addGhostMPLCTs_)
-      {
-        auto lct11 = bx_to_mplcts[bx][0];
-        auto lct22 = bx_to_mplcts[bx][1];
-        int wg1 = digi_wg(lct11);
-        int wg2 = digi_wg(lct22);
-        int hs1 = digi_channel(lct11);
-        int hs2 = digi_channel(lct22);
-
-        if ( ! (wg1 == wg2 || hs1 == hs2) )
-        {
-          auto lct12 = lct11;
-          digi_wg(lct12) = wg2;
-          mplcts_tmp.push_back(lct12);
-
-          auto lct21 = lct22;
-          digi_wg(lct21) = wg1;
-          mplcts_tmp.push_back(lct21);
-          //cout<<"added ghosts"<<endl<<lct11<<"    "<<lct22<<endl <<lct12<<"    "<<lct21<<endl;
-        }
-      }
-    } // mplcts_in_det
+    std::vector<int> source;
+    collectLCTsInChamber(id, mplcts, minBXLCT_, maxBXLCT_, addGhostMPLCTs_, mplcts_tmp, cscMplcts_tmp, source);
+    if (verbose()) for (auto& lct: cscMplcts_tmp) cout<<"mplct in detId "<<ch_id<<" "<<lct<<endl;
 
     size_t n_lct = mplcts_tmp.size();
     if (verbose()) cout<<"number of mplct = "<<n_lct<<endl;
@@ -608,8 +481,20 @@ CSCStubMatcher::matchMPLCTsToSimTrack(const CSCCorrelatedLCTDigiCollection& mplc
 
     // find a matching LCT
 
-    auto clct(clctsInChamber(id));
-    auto alct(alctsInChamber(id));
+    const auto& clct(clctsInChamber(id));
+    const auto& alct(alctsInChamber(id));
+
+    // (hs, wg, bx, index) of the mplcts, so that the mplcts of every CLCT-ALCT
+    // pair are found in their original order with one binary search
+    typedef std::tuple<int,int,int,unsigned int> LCTKey;
+    std::vector<LCTKey> keys;
+    keys.reserve(n_lct);
+    for (unsigned int k = 0; k < n_lct; ++k)
+    {
+      const auto& lct(mplcts_tmp[k]);
+      keys.push_back(std::make_tuple(digi_channel(lct), digi_wg(lct), digi_bx(lct), k));
+    }
+    std::sort(keys.begin(), keys.end());
 
     for (unsigned int i=0; i<clct.size();i++){
 
@@ -625,23 +510,15 @@ CSCStubMatcher::matchMPLCTsToSimTrack(const CSCCorrelatedLCTDigiCollection& mplc
             int my_bx = digi_bx(alct[j]);
 
             if (verbose()) cout<<"will match hs"<<my_hs<<" wg"<<my_wg<<" bx"<<my_bx<<" to #lct "<<n_lct<<endl;
-            for (auto &lct: mplcts_tmp)
+            auto first = std::lower_bound(keys.begin(), keys.end(), std::make_tuple(my_hs, my_wg, my_bx, 0u));
+            for (auto k = first; k != keys.end() and std::get<0>(*k) == my_hs and std::get<1>(*k) == my_wg and std::get<2>(*k) == my_bx; ++k)
             {
-              if (verbose()) cout<<" corlct "<<lct;
-              if ( is_valid(alct[j]) and is_valid(clct[i]) and !(my_bx == digi_bx(lct) and my_hs == digi_channel(lct) and my_wg == digi_wg(lct)) ){
-              if (verbose()) cout<<"  BAD"<<endl;
-                continue;
-                 }  
-              if (verbose()) cout<<"  GOOD"<<endl;
-
-              if (chamber_to_mplct_.find(id) != chamber_to_mplct_.end())
-                {
-                //cout<<"ALARM!!! there already was matching LCT "<<chamber_to_mplct_[id]<<endl;
-            //cout<<"   new digi: "<<lct<<endl;
-                }
-            chamber_to_mplct_[id] = lct;
-
-      // assign the matching Mplcts
+              const auto& lct(mplcts_tmp[std::get<3>(*k)]);
+              if (verbose()) cout<<" corlct "<<lct<<"  GOOD"<<endl;
+
+              chamber_to_mplct_[id] = lct;
+
+              // assign the matching Mplcts
               chamber_to_mplcts_[id].push_back(lct);
             }
         }//End of ALCT loop 
@@ -672,6 +549,85 @@ CSCStubMatcher::matchMPLCTsToSimTrack(const CSCCorrelatedLCTDigiCollection& mplc
 }
 
 
+void
+CSCStubMatcher::collectLCTsInChamber(unsigned int id, const CSCCorrelatedLCTDigiCollection& lcts,
+                                     int minBX, int maxBX, bool addGhosts,
+                                     DigiContainer& digis, CSCCorrelatedLCTDigiContainer& cscLcts,
+                                     std::vector<int>& source)
+{
+  CSCDetId ch_id(id);
+
+  // position in digis of the first stub and number of stubs in every BX of the window
+  const int nBX(std::max(maxBX - minBX + 1, 0));
+  std::vector<int> first_in_bx(nBX, -1);
+  std::vector<int> n_in_bx(nBX, 0);
+
+  auto lcts_in_det = lcts.get(ch_id);
+  for (auto lct = lcts_in_det.first; lct != lcts_in_det.second; ++lct)
+  {
+    if (!lct->isValid()) continue;
+
+    int bx = lct->getBX();
+
+    // check that the BX for stub wasn't too early or too late
+    if (bx < minBX || bx > maxBX) continue;
+
+    int hs = lct->getStrip() + 1; // LCT halfstrip and wiregoup numbers start from 0
+    int wg = lct->getKeyWG() + 1;
+
+    float dphi = lct->getGEMDPhi();
+
+    auto mydigi = make_digi(id, hs, bx, CSC_LCT, lct->getQuality(), lct->getPattern(), wg, dphi);
+    const int ibx(bx - minBX);
+    if (n_in_bx[ibx]++ == 0) first_in_bx[ibx] = digis.size();
+    digis.push_back(mydigi);
+    source.push_back(cscLcts.size());
+    cscLcts.push_back(*lct);
+
+    // Add ghost LCTs when there are two in bx
+    // and the two don't share half-strip or wiregroup
+    // TODO: when GEMs would be used to resolve this, there might ned to be an option to turn this off!
+    if (n_in_bx[ibx] == 2 and addGhosts)
+    {
+      const int i11(first_in_bx[ibx]);
+      const int i22(digis.size() - 1);
+      int wg1 = digi_wg(digis[i11]);
+      int wg2 = digi_wg(digis[i22]);
+      int hs1 = digi_channel(digis[i11]);
+      int hs2 = digi_channel(digis[i22]);
+
+      if ( ! (wg1 == wg2 || hs1 == hs2) )
+      {
+        auto lct12 = digis[i11];
+        digi_wg(lct12) = wg2;
+        digis.push_back(lct12);
+        source.push_back(source[i11]);
+
+        auto lct21 = digis[i22];
+        digi_wg(lct21) = wg1;
+        digis.push_back(lct21);
+        source.push_back(source[i22]);
+      }
+    }
+  }
+}
+
+
+float
+CSCStubMatcher::trackHalfStripInChamber(unsigned int id) const
+{
+  if (hsFromSimHitMean_) return sh_matcher_->simHitsMeanStrip(sh_matcher_->hitsInChamber(id));
+
+  const CSCChamber* cscChamber(cscGeometry_->chamber(CSCDetId(id)));
+  const CSCLayer* cscKeyLayer(cscChamber->layer(3));
+  const CSCLayerGeometry* cscKeyLayerGeometry(cscKeyLayer->geometry());
+  const int nStrips(cscKeyLayerGeometry->numberOfStrips());
+  const float averageZ((cscKeyLayer->centerOfStrip(0)).z());
+  auto GpME(propagateToZ(averageZ));
+  auto lpME(cscKeyLayer->toLocal(GpME));
+  return (nStrips-cscKeyLayerGeometry->nearestStrip(lpME))*2;
+}
+
 std::set<unsigned int>
 CSCStubMatcher::chamberIdsAllCLCT(int csc_type) const
 {
@@ -1,16 +1,36 @@
 #include "GEMCode/GEMValidation/interface/DisplacedGENMuonMatcher.h"
 
 DisplacedGENMuonMatcher::DisplacedGENMuonMatcher(const SimTrack& t, const SimVertex& v,
-      const edm::ParameterSet& ps, const edm::Event& ev, const edm::EventSetup& es)
+      const edm::ParameterSet& ps, const edm::Event& ev, const edm::EventSetup& es,
+      const GenParticleAncestry* ancestry)
 : BaseMatcher(t, v, ps, ev, es)
 {
   auto displacedGenMu_= conf().getParameter<edm::ParameterSet>("displacedGenMu");
   input_ = displacedGenMu_.getParameter<std::vector<edm::InputTag>>("validInputTags");
   verbose_ = displacedGenMu_.getParameter<int>("verbose");
   run_ = displacedGenMu_.getParameter<bool>("run");
+  motherPdgIds_ = {36, 3000022};
+  if (displacedGenMu_.exists("motherPdgIds")) motherPdgIds_ = displacedGenMu_.getParameter<std::vector<int> >("motherPdgIds");
 
+  if (!run_) return;
+  if (ancestry) {
+    matchDisplacedGENMuonMatcherToSimTrack(*ancestry);
+    return;
+  }
+  edm::Handle<reco::GenParticleCollection> genParticles;
+  if(gemvalidation::getByLabel(input_, genParticles, event()))
+    matchDisplacedGENMuonMatcherToSimTrack(GenParticleAncestry(*genParticles.product()));
+}
+
+std::unique_ptr<GenParticleAncestry>
+DisplacedGENMuonMatcher::eventAncestry(const edm::ParameterSet& ps, const edm::Event& ev)
+{
+  auto displacedGenMu = ps.getParameter<edm::ParameterSet>("displacedGenMu");
+  if (!displacedGenMu.getParameter<bool>("run")) return nullptr;
   edm::Handle<reco::GenParticleCollection> genParticles;
-  if(gemvalidation::getByLabel(input_, genParticles, event())) if (run_) matchDisplacedGENMuonMatcherToSimTrack(*genParticles.product());
+  if (!gemvalidation::getByLabel(displacedGenMu.getParameter<std::vector<edm::InputTag>>("validInputTags"), genParticles, ev))
+    return nullptr;
+  return std::unique_ptr<GenParticleAncestry>(new GenParticleAncestry(*genParticles.product()));
 }
 
 DisplacedGENMuonMatcher::~DisplacedGENMuonMatcher()
@@ -19,8 +39,9 @@ DisplacedGENMuonMatcher::~DisplacedGENMuonMatcher()
 }
 
 void
-DisplacedGENMuonMatcher::matchDisplacedGENMuonMatcherToSimTrack(const reco::GenParticleCollection& genParticles)
+DisplacedGENMuonMatcher::matchDisplacedGENMuonMatcherToSimTrack(const GenParticleAncestry& ancestry)
 {
+  const reco::GenParticleCollection& genParticles(ancestry.particles());
   double eq = 0.000001;
 
   // edm::Handle<reco::BeamSpot> beamSpot;
@@ -45,30 +66,14 @@ DisplacedGENMuonMatcher::matchDisplacedGENMuonMatcherToSimTrack(const reco::GenP
     //    if (verbose_) std::cout << counterGenParticle << " " << iGenParticle->status() << " " << iGenParticle->pdgId() << " " << iGenParticle->vx() << " " << iGenParticle->vy() << " " << iGenParticle->vz() << std::endl;
     if ( fabs( iGenParticle->pdgId() ) == 13 and iGenParticle->status() == 1 ) {
       if (verbose_) std::cout << "Muon " << counterGenParticle << " " << iGenParticle->status() << " " << iGenParticle->pdgId() << " " << iGenParticle->vx() << " " << iGenParticle->vy() << " " << iGenParticle->vz() << std::endl;
-      // Mother of the muon can be muon. Find the last muon in this chain: genMuonCand
-      // Example: a1 -> mu+ (status = 3) mu- (status = 3)
-      //          mu- (status = 3) -> mu- (status = 2) -> mu- (status = 1)
-      const reco::Candidate *genMuonCand = &(*iGenParticle);
-      bool isMuonMother = true;
-      while(isMuonMother) {
-        isMuonMother = false;
-        for ( size_t iMother = 0; iMother < genMuonCand->numberOfMothers(); iMother++ ) {
-          if ( fabs( genMuonCand->mother(iMother)->pdgId() ) == 13 ) {
-            isMuonMother = true;
-            genMuonCand = genMuonCand->mother(iMother);
-          }
-        }
-      }
-      // Loop over all real (non-muon) mothers of the muon (here we use genMuonCand)
-      for ( size_t iMother = 0; iMother < genMuonCand->numberOfMothers(); iMother++ ) {
-        // Check if mother is CP-odd Higgs (PdgId = 36) or gamma_Dark (PdgId = 3000022)
-	//        if ( genMuonCand->mother(iMother)->pdgId() == 36 || genMuonCand->mother(iMother)->pdgId() == 3000022 || genMuonCand->mother(iMother)->pdgId() == 443 ) {
-        if ( genMuonCand->mother(iMother)->pdgId() == 36 || genMuonCand->mother(iMother)->pdgId() == 3000022 ) {
-          // Store the muon (stable, first in chain) into vector
-          genMuons.push_back(&(*iGenParticle));
-          // Store mother of the muon into vector. We need this to group muons into dimuons later
-          genMuonMothers.push_back(genMuonCand->mother(iMother));
-        }
+      // Mother of the muon can be muon (a1 -> mu(status 3) -> mu(status 2) -> mu(status 1)):
+      // the index gives the first non-muon mother of the muon chain directly
+      const int iMother(ancestry.ancestorWithPdgId(iGenParticle - genParticles.begin(), motherPdgIds_));
+      if (iMother >= 0) {
+        // Store the muon (stable, first in chain) into vector
+        genMuons.push_back(&(*iGenParticle));
+        // Store mother of the muon into vector. We need this to group muons into dimuons later
+        genMuonMothers.push_back(&ancestry.particle(iMother));
       }
     }
     // Check if gen particle is
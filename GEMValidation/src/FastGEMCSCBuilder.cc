@@ -99,35 +99,15 @@ void FastGEMCSCBuilder::build(const SimHitMatcher& match_sh)
 
     //cout<<" hitXZ ";
     const auto& hits = match_sh.hitsInChamber(d);
+    points_.clear();
     for (auto& h: hits)
     {
       stub.addStrips( match_sh.hitStripsInDetId(h.detUnitId(), 1) ); // use single strip margin
       stub.addWireGroups( match_sh.hitWiregroupsInDetId(h.detUnitId(), 1) ); // use single WG margin
 
-      GlobalPoint gp = csc_geo_->idToDet(h.detUnitId())->surface().toGlobal(h.entryPoint());
-      //LocalPoint lp = csc_geo_->idToDet(id.chamberId())->surface().toLocal(gp);
-      //cout<< lp.x() <<" "<<gp.z()<<"  ";
-
-      double z[1] = {gp.z()};
-      fitterXZ_->AddPoint(z, gp.x()); // x(z)
-      fitterYZ_->AddPoint(z, gp.y()); // y(z)
+      points_.push_back(csc_geo_->idToDet(h.detUnitId())->surface().toGlobal(h.entryPoint()));
     }
-    //cout<<endl;
-    fitterXZ_->Eval();
-    fitterYZ_->Eval();
-
-    stub.setFitParameters(
-        fitterXZ_->GetParameter(0), fitterXZ_->GetParameter(1),
-        fitterYZ_->GetParameter(0), fitterYZ_->GetParameter(1) );
-
-    //double xz0e = fitterXZ_->GetParError(0);
-    //double xz1e = fitterXZ_->GetParError(1);
-    //double yz0e = fitterYZ_->GetParError(0);
-    //double yz1e = fitterYZ_->GetParError(1);
-
-    // clean-up the fitters
-    fitterXZ_->ClearPoints();
-    fitterYZ_->ClearPoints();
+    fitStub(stub, points_);
 
     // --- find stub global position at CSC chamber key layer
     CSCDetId key_id(id.endcap(), id.station(), id.ring(), id.chamber(), CSCConstants::KEY_CLCT_LAYER);
@@ -199,6 +179,32 @@ void FastGEMCSCBuilder::build(const SimHitMatcher& match_sh)
 }
 
 
+void FastGEMCSCBuilder::fitStub(SimStub& stub, const std::vector<GlobalPoint>& points)
+{
+  for (auto& gp: points)
+  {
+    double z[1] = {gp.z()};
+    fitterXZ_->AddPoint(z, gp.x()); // x(z)
+    fitterYZ_->AddPoint(z, gp.y()); // y(z)
+  }
+  fitterXZ_->Eval();
+  fitterYZ_->Eval();
+
+  stub.setFitParameters(
+      fitterXZ_->GetParameter(0), fitterXZ_->GetParameter(1),
+      fitterYZ_->GetParameter(0), fitterYZ_->GetParameter(1) );
+
+  //double xz0e = fitterXZ_->GetParError(0);
+  //double xz1e = fitterXZ_->GetParError(1);
+  //double yz0e = fitterYZ_->GetParError(0);
+  //double yz1e = fitterYZ_->GetParError(1);
+
+  // clean-up the fitters
+  fitterXZ_->ClearPoints();
+  fitterYZ_->ClearPoints();
+}
+
+
 // ------------ SimStub implementation  ------------
 
 
@@ -0,0 +1,129 @@
+#include "GEMCode/GEMValidation/interface/GEMCSCdPhiLUT.h"
+#include "GEMCode/GEMValidation/interface/Helpers.h"
+#include "FWCore/Utilities/interface/Exception.h"
+
+GEMCSCdPhiLUT::GEMCSCdPhiLUT()
+{
+  constexpr unsigned int nME11 = sizeof(ME11GEMdPhi)/sizeof(ME11GEMdPhi[0]);
+  constexpr unsigned int nME21 = sizeof(ME21GEMdPhi)/sizeof(ME21GEMdPhi[0]);
+  static_assert(nME11 == nME21, "ME11GEMdPhi and ME21GEMdPhi must have the same pT bins");
+
+  nPt_ = nME11;
+  for (unsigned int b = 0; b < nPt_; ++b) ptThresholds_.push_back(ME11GEMdPhi[b][0]);
+
+  // one partition covering the whole endcap
+  for (int s = ME11; s < NStations; ++s) {
+    nEta_[s] = 1;
+    etaStart_[s] = s;
+  }
+  etaMin_.assign(NStations*NParities, 0.);
+  etaMax_.assign(NStations*NParities, 99.);
+
+  cuts_.resize(NStations*nPt_*NParities);
+  for (unsigned int b = 0; b < nPt_; ++b) {
+    for (int p = Odd; p <= Even; ++p) {
+      cuts_[index(ME11, 0, b, p)] = ME11GEMdPhi[b][1+p];
+      cuts_[index(ME21, 0, b, p)] = ME21GEMdPhi[b][1+p];
+    }
+  }
+  relaxME21PtBin_ = ptBin(15.);
+}
+
+
+GEMCSCdPhiLUT::GEMCSCdPhiLUT(const edm::ParameterSet& ps)
+{
+  ptThresholds_ = ps.getParameter<std::vector<double> >("ptThresholds");
+  nPt_ = ptThresholds_.size();
+  if (nPt_ == 0 or !std::is_sorted(ptThresholds_.begin(), ptThresholds_.end()))
+    throw cms::Exception("Configuration") << "GEMCSCdPhiLUT: ptThresholds must be a non-empty increasing list";
+
+  const char* names[NStations] = {"ME11", "ME21"};
+  const char* parities[NParities] = {"odd", "even"};
+
+  unsigned int nEtaTotal = 0;
+  for (int s = ME11; s < NStations; ++s) {
+    const auto st(ps.getParameter<edm::ParameterSet>(names[s]));
+    nEta_[s] = st.getParameter<std::vector<double> >("etaMin_odd").size();
+    etaStart_[s] = nEtaTotal;
+    nEtaTotal += nEta_[s];
+    if (nEta_[s] == 0)
+      throw cms::Exception("Configuration") << "GEMCSCdPhiLUT: no eta partitions for " << names[s];
+  }
+
+  etaMin_.resize(NParities*nEtaTotal);
+  etaMax_.resize(NParities*nEtaTotal);
+  cuts_.resize(nEtaTotal*nPt_*NParities);
+  for (int s = ME11; s < NStations; ++s) {
+    const auto st(ps.getParameter<edm::ParameterSet>(names[s]));
+    const unsigned int nEta(nEta_[s]);
+    for (int p = Odd; p <= Even; ++p) {
+      const std::string par(parities[p]);
+      const auto etaMin(st.getParameter<std::vector<double> >("etaMin_" + par));
+      const auto etaMax(st.getParameter<std::vector<double> >("etaMax_" + par));
+      // eta-major: all pT bins of the first partition, then the second one, ...
+      const auto cuts(st.getParameter<std::vector<double> >("cut_" + par));
+      if (etaMin.size() != nEta or etaMax.size() != nEta or cuts.size() != nEta*nPt_)
+        throw cms::Exception("Configuration") << "GEMCSCdPhiLUT: inconsistent table for " << names[s] << " " << par;
+      for (unsigned int e = 0; e < nEta; ++e) {
+        etaMin_[etaIndex(s, p) + e] = etaMin[e];
+        etaMax_[etaIndex(s, p) + e] = etaMax[e];
+        for (unsigned int b = 0; b < nPt_; ++b) cuts_[index(s, e, b, p)] = cuts[e*nPt_ + b];
+      }
+    }
+  }
+
+  const double relaxPt(ps.getParameter<double>("relaxME21AbovePt"));
+  relaxME21PtBin_ = relaxPt < 0 ? -1 : ptBin(relaxPt);
+}
+
+
+const GEMCSCdPhiLUT&
+GEMCSCdPhiLUT::defaultLUT()
+{
+  static const GEMCSCdPhiLUT lut;
+  return lut;
+}
+
+
+int
+GEMCSCdPhiLUT::etaBin(int st, int par, float eta) const
+{
+  if (nEta_[st] == 1) return 0;
+  const float aeta(std::abs(eta));
+  const float* mins(&etaMin_[etaIndex(st, par)]);
+  const float* maxs(&etaMax_[etaIndex(st, par)]);
+  int closest = 0;
+  float distance = 999.;
+  for (unsigned int e = 0; e < nEta_[st]; ++e) {
+    // unused partitions are marked with negative edges
+    if (maxs[e] < 0) continue;
+    if (aeta >= mins[e] and aeta <= maxs[e]) return e;
+    const float d(std::min(std::abs(aeta - mins[e]), std::abs(aeta - maxs[e])));
+    if (d < distance) { distance = d; closest = e; }
+  }
+  return closest;
+}
+
+
+GEMCSCdPhiLUT::ChamberCut
+GEMCSCdPhiLUT::chamberCut(const CSCDetId& id, int chargesign, float pt, float eta, bool relaxME21) const
+{
+  ChamberCut c;
+  c.chargesign = chargesign;
+  c.relaxCut = -1.;
+  const int st(station(id));
+  c.active = (st >= 0);
+  if (!c.active) {
+    c.cut = c.smallCut = 99.;
+    return c;
+  }
+  const int par(parity(id));
+  const int etabin(etaBin(st, par, eta));
+  const int ptbin(ptBin(pt));
+  c.cut = ptbin < 0 ? -1. : cut(st, par, ptbin, etabin);
+  c.smallCut = nPt_ < 2 ? -1. : cut(st, par, nPt_ - 2, etabin);
+  if (st == ME21 and relaxME21 and relaxME21PtBin_ >= 0 and ptbin >= relaxME21PtBin_)
+    c.relaxCut = cut(st, par, relaxME21PtBin_, etabin);
+  return c;
+}
+
@@ -0,0 +1,84 @@
+#include "GEMCode/GEMValidation/interface/GEMChamberPhiIndex.h"
+#include "FWCore/Utilities/interface/Exception.h"
+
+#include <limits>
+#include <map>
+
+namespace {
+
+float phiDegrees(const GlobalPoint& gp)
+{
+  float phi = gp.phi().degrees();
+  if (phi < 0.) phi += 360.;
+  return phi;
+}
+
+}
+
+
+GEMChamberPhiIndex::GEMChamberPhiIndex(const GEMGeometry& geometry, int station, int refRoll)
+{
+  std::vector<std::pair<float, unsigned int> > centers[2];
+  for (auto p: geometry.etaPartitions()) {
+    const GEMDetId id(p->id());
+    if (id.station() != station or id.layer() != 1 or id.roll() != refRoll) continue;
+    centers[id.region() > 0].push_back(std::make_pair(phiDegrees(p->position()), id.rawId()));
+  }
+  for (int r = 0; r < 2; ++r) build(regions_[r], centers[r]);
+}
+
+
+GEMChamberPhiIndex::GEMChamberPhiIndex(const ME0Geometry& geometry)
+{
+  // first eta partition of every layer 1 chamber, keyed by (region, chamber)
+  std::map<std::pair<int,int>, std::pair<int, const ME0EtaPartition*> > first;
+  for (auto p: geometry.etaPartitions()) {
+    const ME0DetId id(p->id());
+    if (id.layer() != 1) continue;
+    auto& f(first[std::make_pair(id.region(), id.chamber())]);
+    if (f.second == 0 or id.roll() < f.first) f = std::make_pair(id.roll(), p);
+  }
+
+  std::vector<std::pair<float, unsigned int> > centers[2];
+  for (auto& f: first)
+    centers[f.first.first > 0].push_back(std::make_pair(phiDegrees(f.second.second->position()),
+                                                        f.second.second->id().rawId()));
+  for (int r = 0; r < 2; ++r) build(regions_[r], centers[r]);
+}
+
+
+void GEMChamberPhiIndex::build(Region& r, std::vector<std::pair<float, unsigned int> >& centers)
+{
+  r = Region();
+  const unsigned int n = centers.size();
+  if (n < 2) return;
+  std::sort(centers.begin(), centers.end());
+
+  r.phi0 = centers[0].first;
+  float minSpacing = 360.;
+  for (unsigned int k = 0; k < n; ++k) {
+    r.ids.push_back(centers[k].second);
+    r.edges.push_back(centers[k].first - r.phi0);
+    if (k > 0) minSpacing = std::min(minSpacing, r.edges[k] - r.edges[k-1]);
+  }
+  minSpacing = std::min(minSpacing, 360.f - r.edges[n-1]);
+  r.edges.push_back(360.);
+  r.edges.push_back(std::numeric_limits<float>::max());
+  if (minSpacing <= 0.01)
+    throw cms::Exception("GEMChamberPhiIndex") << "chambers " << r.ids[0] << "... have coincident centers in phi\n";
+
+  // bins narrower than the chamber spacing contain at most one center
+  const float binWidth = minSpacing/2.;
+  r.nBins = std::ceil(360./binWidth);
+  r.invBinWidth = 1./binWidth;
+  r.firstCenter.resize(r.nBins);
+  unsigned int k = 0;
+  for (unsigned int b = 0; b < r.nBins; ++b) {
+    const float start = b/r.invBinWidth;
+    while (k+1 < n and r.edges[k+1] <= start) ++k;
+    r.firstCenter[b] = k;
+  }
+
+  for (unsigned int k = 0; k < n; ++k) r.pairs.push_back(ChamberPair(r.ids[k], r.ids[(k+1)%n]));
+  r.pairs.push_back(r.pairs[0]);
+}
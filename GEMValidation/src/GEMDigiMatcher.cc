@@ -111,13 +111,14 @@ GEMDigiMatcher::matchPadsToSimTrack(const GEMCSCPadDigiCollection& pads)
     if (p_id.station()==2) continue;
     GEMDetId superch_id(p_id.region(), p_id.ring(), p_id.station(), 1, p_id.chamber(), 0);
 
-    auto hit_pads = simhit_matcher_->hitPadsInDetId(id);
+    const GE11PadBits& hit_pads = simhit_matcher_->hitPadBitsInDetId(id);
     auto pads_in_det = pads.get(p_id);
 
     if (verbosePad_)
     {
-      cout<<"checkpads "<<hit_pads.size()<<" "<<std::distance(pads_in_det.first, pads_in_det.second)<<" hit_pads: ";
-      copy(hit_pads.begin(), hit_pads.end(), ostream_iterator<int>(cout," "));
+      auto hit_pad_ns = hit_pads.pads();
+      cout<<"checkpads "<<hit_pad_ns.size()<<" "<<std::distance(pads_in_det.first, pads_in_det.second)<<" hit_pads: ";
+      copy(hit_pad_ns.begin(), hit_pad_ns.end(), ostream_iterator<int>(cout," "));
       cout<<endl;
     }
 
@@ -128,7 +129,7 @@ GEMDigiMatcher::matchPadsToSimTrack(const GEMCSCPadDigiCollection& pads)
       if (pad->bx() < minBXGEMPad_ || pad->bx() > maxBXGEMPad_) continue;
       if (verbosePad_) cout<<"chp1"<<endl;
       // check that it matches a pad that was hit by SimHits from our track
-      if (hit_pads.find(pad->pad()) == hit_pads.end()) continue;
+      if (!hit_pads.test(pad->pad())) continue;
       if (verbosePad_) cout<<"chp2"<<endl;
       // ignore hits in the short GE21
       if (p_id.station()==2) continue;
@@ -156,13 +157,14 @@ GEMDigiMatcher::matchCoPadsToSimTrack(const GEMCSCPadDigiCollection& co_pads)
     if (p_id.station()==2) continue;
     GEMDetId superch_id(p_id.region(), p_id.ring(), p_id.station(), 1, p_id.chamber(), 0);
 
-    auto hit_co_pads = simhit_matcher_->hitCoPadsInDetId(id);
+    const GE11PadBits& hit_co_pads = simhit_matcher_->hitCoPadBitsInDetId(id);
     auto co_pads_in_det = co_pads.get(p_id);
 
     if (verboseCoPad_)
     {
-      cout<<"checkpads "<<hit_co_pads.size()<<" "<<std::distance(co_pads_in_det.first, co_pads_in_det.second)<<" hit_pads: ";
-      copy(hit_co_pads.begin(), hit_co_pads.end(), ostream_iterator<int>(cout," "));
+      auto hit_co_pad_ns = hit_co_pads.pads();
+      cout<<"checkpads "<<hit_co_pad_ns.size()<<" "<<std::distance(co_pads_in_det.first, co_pads_in_det.second)<<" hit_pads: ";
+      copy(hit_co_pad_ns.begin(), hit_co_pad_ns.end(), ostream_iterator<int>(cout," "));
       cout<<endl;
     }
 
@@ -173,7 +175,7 @@ GEMDigiMatcher::matchCoPadsToSimTrack(const GEMCSCPadDigiCollection& co_pads)
       if (pad->bx() < minBXGEMCoPad_ || pad->bx() > maxBXGEMCoPad_) continue;
       if (verboseCoPad_) cout<<"CoPad: chp1 "<<*pad<<endl;
       // check that it matches a pad that was hit by SimHits from our track
-      if (hit_co_pads.find(pad->pad()) == hit_co_pads.end()) continue;
+      if (!hit_co_pads.test(pad->pad())) continue;
       if (verboseCoPad_) cout<<"CoPad: chp2 "<<*pad<<endl;
       // ignore hits in the short GE21
       if (p_id.station()==2) continue;
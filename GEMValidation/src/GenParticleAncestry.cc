@@ -0,0 +1,104 @@
+#include "GEMCode/GEMValidation/interface/GenParticleAncestry.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace {
+  const int UNRESOLVED = -2;
+}
+
+GenParticleAncestry::GenParticleAncestry(const reco::GenParticleCollection& particles)
+: particles_(particles)
+, chainTop_(particles.size(), UNRESOLVED)
+, ancestor_(particles.size(), -1)
+, root_(particles.size(), UNRESOLVED)
+, lxy_(particles.size())
+{
+  for (unsigned int i = 0; i < particles_.size(); ++i) {
+    lxy_[i] = std::hypot(particles_[i].vx(), particles_[i].vy());
+    resolveChainTop(i);
+  }
+  // the first non-self ancestor only needs the chain tops
+  for (unsigned int i = 0; i < particles_.size(); ++i) {
+    const reco::GenParticle& top(particles_[chainTop_[i]]);
+    for (unsigned int m = 0; m < top.numberOfMothers(); ++m) {
+      if (std::abs(top.mother(m)->pdgId()) == std::abs(top.pdgId())) continue;
+      ancestor_[i] = index(top.mother(m));
+      break;
+    }
+  }
+  for (unsigned int i = 0; i < particles_.size(); ++i) resolveRoot(i);
+}
+
+
+int
+GenParticleAncestry::index(const reco::Candidate* c) const
+{
+  if (c == nullptr or particles_.empty()) return -1;
+  const reco::GenParticle* p(static_cast<const reco::GenParticle*>(c));
+  const reco::GenParticle* first(&particles_[0]);
+  if (p < first or p >= first + particles_.size()) return -1;
+  return p - first;
+}
+
+
+int
+GenParticleAncestry::ancestorWithPdgId(int i, const std::vector<int>& pdgIds) const
+{
+  const reco::GenParticle& top(particles_[chainTop_[i]]);
+  for (unsigned int m = 0; m < top.numberOfMothers(); ++m) {
+    if (std::find(pdgIds.begin(), pdgIds.end(), top.mother(m)->pdgId()) != pdgIds.end())
+      return index(top.mother(m));
+  }
+  return -1;
+}
+
+
+int
+GenParticleAncestry::resolveChainTop(int i)
+{
+  // walk up the same-flavour mothers until a resolved particle (or the top)
+  // is found, then assign the result to the whole path; with several
+  // same-flavour mothers the last one is followed, as the original loops did
+  std::vector<int> path;
+  int top = i;
+  while (chainTop_[top] == UNRESOLVED) {
+    path.push_back(top);
+    const reco::GenParticle& p(particles_[top]);
+    int next = -1;
+    for (unsigned int m = 0; m < p.numberOfMothers(); ++m) {
+      if (std::abs(p.mother(m)->pdgId()) != std::abs(p.pdgId())) continue;
+      next = index(p.mother(m));
+    }
+    // broken references and loops stop the chain
+    if (next < 0 or std::find(path.begin(), path.end(), next) != path.end()) {
+      chainTop_[top] = top;
+      break;
+    }
+    top = next;
+  }
+  const int result = chainTop_[top];
+  for (auto j: path) chainTop_[j] = result;
+  return result;
+}
+
+
+int
+GenParticleAncestry::resolveRoot(int i)
+{
+  std::vector<int> path;
+  int r = i;
+  while (root_[r] == UNRESOLVED) {
+    path.push_back(r);
+    const int next = ancestor_[r];
+    if (next < 0 or std::find(path.begin(), path.end(), next) != path.end()) {
+      root_[r] = r;
+      break;
+    }
+    r = next;
+  }
+  const int result = root_[r];
+  for (auto j: path) root_[j] = result;
+  return result;
+}
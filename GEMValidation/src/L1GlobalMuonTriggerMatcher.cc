@@ -57,6 +57,12 @@ L1GlobalMuonTriggerMatcher::L1GlobalMuonTriggerMatcher(SimHitMatcher& sh)
   deltaRGmtCand_ = gmtCand.getParameter<double>("deltaR");
   deltaRL1ExtraMuon_ = l1ExtraMuonParticle.getParameter<double>("deltaR");
 
+  globalAssociationGmtCand_ = gmtCand.existsAs<bool>("globalAssociation") and gmtCand.getParameter<bool>("globalAssociation");
+  globalAssociationL1ExtraMuon_ = (l1ExtraMuonParticle.existsAs<bool>("globalAssociation") and
+                                   l1ExtraMuonParticle.getParameter<bool>("globalAssociation"));
+
+  reference_ = SimTrackL1Association::reference(sh);
+
   init();
 }
 
@@ -84,11 +90,30 @@ L1GlobalMuonTriggerMatcher::init()
   edm::Handle<L1MuRegionalCandCollection> hGmtRegCandDT;
   if (gemvalidation::getByLabel(gmtRegCandDTInputLabel_, hGmtRegCandDT, event())) if (runGmtRegCandDT_) matchRegionalCandDTToSimTrack(*hGmtRegCandDT.product());
 
-  edm::Handle<L1MuGMTCandCollection> hGmtCand;
-  if (gemvalidation::getByLabel(gmtCandInputLabel_, hGmtCand, event())) if (runGmtCand_) matchGMTCandToSimTrack(*hGmtCand.product());
+  // with a global association, the candidates are assigned later by setAssociation
+  if (gemvalidation::getByLabel(gmtCandInputLabel_, hGmtCand_, event()))
+    if (runGmtCand_ and !globalAssociationGmtCand_) matchGMTCandToSimTrack(*hGmtCand_.product());
+
+  if (gemvalidation::getByLabel(l1ExtraMuonInputLabel_, hL1ExtraMuonParticle_, event()))
+    if (runL1ExtraMuon_ and !globalAssociationL1ExtraMuon_) matchL1ExtraMuonParticleToSimTrack(*hL1ExtraMuonParticle_.product());
+}
 
-  edm::Handle<l1extra::L1MuonParticleCollection> hL1ExtraMuonParticle;
-  if (gemvalidation::getByLabel(l1ExtraMuonInputLabel_, hL1ExtraMuonParticle, event())) if (runL1ExtraMuon_) matchL1ExtraMuonParticleToSimTrack(*hL1ExtraMuonParticle.product());
+void
+L1GlobalMuonTriggerMatcher::setAssociation(const SimTrackL1Association* gmtCands,
+                                           const SimTrackL1Association* l1ExtraMuons, unsigned int index)
+{
+  if (gmtCands and runGmtCand_ and hGmtCand_.isValid()) {
+    matchedL1GmtCands_.clear();
+    const int i(gmtCands->partner(index));
+    if (i >= 0) matchedL1GmtCands_.push_back((*hGmtCand_)[i]);
+    if (verboseGmtCand_) cout << "Associated GMTCand " << i << " dR = " << gmtCands->partnerDeltaR(index) << endl;
+  }
+  if (l1ExtraMuons and runL1ExtraMuon_ and hL1ExtraMuonParticle_.isValid()) {
+    matchedL1MuonParticles_.clear();
+    const int i(l1ExtraMuons->partner(index));
+    if (i >= 0) matchedL1MuonParticles_.push_back(std::make_pair((*hL1ExtraMuonParticle_)[i], l1ExtraMuons->partnerDeltaR(index)));
+    if (verboseL1ExtraMuon_) cout << "Associated L1ExtraMuonParticle " << i << " dR = " << l1ExtraMuons->partnerDeltaR(index) << endl;
+  }
 }
 
 void 
@@ -209,55 +234,12 @@ L1GlobalMuonTriggerMatcher::matchL1ExtraMuonParticleToSimTrack(const l1extra::L1
       cout << "\tAssociated GMT " << gmt << endl;
     }
 
-    const double absSimEta(std::abs(trk().momentum().eta()));
+    // distance to the station 2/3 reference point of the simtrack, computed once in the constructor
     float dRhit = 99;
-    // propagate the simtrack to the second station DT or CSC and match to the L1Extra particle
-    if (absSimEta < 1.1) {
-      if (verboseL1ExtraMuon_>2) {
-	std::cout << "all hits dt " << std::endl;
-	simhit_matcher_->dtChamberIdsToString(simhit_matcher_->chamberIdsDT(0));
-      }
-      // check for hits in the second station
-      auto q(simhit_matcher_->chamberIdsDTStation(2));  
-      // check for hits in the third station
-      if (q.size()==0) q = simhit_matcher_->chamberIdsDTStation(3);  
-      if (q.size()!=0) {
-	auto hits(simhit_matcher_->hitsInChamber(*q.begin()));
-	auto gp(simhit_matcher_->simHitsMeanPosition(hits));
-	dRhit = deltaR(muon.eta(), muon.phi(), gp.eta(), normalizedPhi(gp.phi()));
-	if (verboseL1ExtraMuon_>1) {
-	  std::cout << "DTChamberId " << DTChamberId(*q.begin()) << std::endl;  
-	  std::cout << "\t" << gp << std::endl;
-	}
-	if (verboseL1ExtraMuon_) std::cout << "\tdRhit = " << dRhit << endl;
-      }
-      if (q.size()==0) {
-	if (verboseL1ExtraMuon_>2) std::cout << "\tNo hits in second or third station DT" << endl;
-      }
+    if (reference_.valid) {
+      dRhit = deltaR(muon.eta(), muon.phi(), reference_.eta, reference_.phi);
+      if (verboseL1ExtraMuon_) std::cout << "\tdRhit = " << dRhit << endl;
     }
-    else if (1.1 < absSimEta and absSimEta < 2.4) {
-      if (verboseL1ExtraMuon_>2) {
-	std::cout << "all hits csc " << std::endl;
-	simhit_matcher_->cscChamberIdsToString(simhit_matcher_->chamberIdsCSC(0));
-      }
-      // check for hits in the second station
-      auto p(simhit_matcher_->chamberIdsCSCStation(2));
-      // check for hits in the third station
-      if (p.size()==0) p = simhit_matcher_->chamberIdsCSCStation(3);  
-      if (p.size()!=0) {
-	auto hits(simhit_matcher_->hitsInChamber(*p.begin()));
-	auto gp(simhit_matcher_->simHitsMeanPosition(hits));
-	dRhit = deltaR(muon.eta(), muon.phi(), gp.eta(), normalizedPhi(gp.phi()));
-	if (verboseL1ExtraMuon_>1) {
-	  std::cout << "CSCDetId " << CSCDetId(*p.begin()) << std::endl;  
-	  std::cout << "\t" << gp << std::endl;
-	}
-	if (verboseL1ExtraMuon_) std::cout << "\tdRhit = " << dRhit << endl;
-      }
-      if (p.size()==0) {
-	if (verboseL1ExtraMuon_>2) std::cout << "\tNo hits in second or third station CSC" << endl;
-      }
-    } 
    // look for the best matching one
     if (dRhit < dRhitMin) {
       dRhitMin = dRhit;
@@ -0,0 +1,99 @@
+#include "GEMCode/GEMValidation/interface/LCTSimTrackAssociation.h"
+
+#include <algorithm>
+
+using namespace matching;
+
+LCTSimTrackAssociation::LCTSimTrackAssociation(unsigned int minMatchedStubs, int minBX, int maxBX)
+: minMatchedStubs_(minMatchedStubs)
+, minBX_(minBX)
+, maxBX_(maxBX)
+, nSimTracks_(0)
+, nTracks_(0)
+{}
+
+
+void
+LCTSimTrackAssociation::clear()
+{
+  owners_.clear();
+  nSimTracks_ = 0;
+  nTracks_ = 0;
+  for (auto& m: matched_) m.clear();
+}
+
+
+void
+LCTSimTrackAssociation::addSimTrack(const CSCStubMatcher& stubs, unsigned int index)
+{
+  nSimTracks_ = std::max(nSimTracks_, index + 1);
+  for (auto id: stubs.chamberIdsMPLCT()) {
+    for (auto& lct: stubs.mplctsInChamber(id)) {
+      owners_.insert(std::make_pair(key(id, digi_channel(lct), digi_wg(lct), digi_bx(lct)), index));
+    }
+  }
+}
+
+
+void
+LCTSimTrackAssociation::matchTracks(const L1CSCTrackCollection& tracks,
+                                    edm::ESHandle<L1MuTriggerScales>& muScales,
+                                    edm::ESHandle<L1MuTriggerPtScale>& muPtScale)
+{
+  if (matched_.size() < nSimTracks_) matched_.resize(nSimTracks_);
+  for (auto& m: matched_) m.clear();
+  owner_.clear();
+  nMatchedStubs_.clear();
+  nTracks_ = 0;
+
+  std::vector<unsigned int> votes(nSimTracks_, 0);
+  for (auto& trk: tracks) {
+    if (trk.first.bx() < minBX_ or trk.first.bx() > maxBX_) continue;
+
+    std::fill(votes.begin(), votes.end(), 0);
+    for (auto detUnitIt = trk.second.begin(); detUnitIt != trk.second.end(); ++detUnitIt) {
+      const unsigned int id((*detUnitIt).first.rawId());
+      const auto& range((*detUnitIt).second);
+      for (auto digiIt = range.first; digiIt != range.second; ++digiIt) {
+        if (!digiIt->isValid()) continue;
+        // same half-strip and wiregroup numbering as CSCStubMatcher
+        auto owners(owners_.equal_range(key(id, digiIt->getStrip() + 1, digiIt->getKeyWG() + 1, digiIt->getBX())));
+        for (auto o = owners.first; o != owners.second; ++o) ++votes[o->second];
+      }
+    }
+    if (votes.empty()) continue;
+    const unsigned int best(std::max_element(votes.begin(), votes.end()) - votes.begin());
+    if (votes[best] == 0 or votes[best] < minMatchedStubs_) continue;
+
+    if (nTracks_ < pool_.size()) pool_[nTracks_].reset(&trk.first, &trk.second);
+    else pool_.emplace_back(&trk.first, &trk.second);
+    pool_[nTracks_].init(muScales, muPtScale);
+    owner_.push_back(best);
+    nMatchedStubs_.push_back(votes[best]);
+    ++nTracks_;
+  }
+
+  // pointers are taken once the pool does not grow anymore; best matched tracks first
+  for (unsigned int i = 0; i < nTracks_; ++i) matched_[owner_[i]].push_back(&pool_[i]);
+  for (auto& m: matched_) {
+    std::stable_sort(m.begin(), m.end(), [this](const TFTrack* a, const TFTrack* b)
+                     { return nMatchedStubs(a) > nMatchedStubs(b); });
+  }
+}
+
+
+const std::vector<const TFTrack*>&
+LCTSimTrackAssociation::tfTracks(unsigned int index) const
+{
+  if (index >= matched_.size()) return noTracks_;
+  return matched_[index];
+}
+
+
+unsigned int
+LCTSimTrackAssociation::nMatchedStubs(const TFTrack* track) const
+{
+  if (nTracks_ == 0) return 0;
+  const size_t i(track - &pool_[0]);
+  return i < nTracks_ ? nMatchedStubs_[i] : 0;
+}
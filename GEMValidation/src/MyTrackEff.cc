@@ -0,0 +1,478 @@
+#include "GEMCode/GEMValidation/interface/MyTrackEff.h"
+
+#include "TTree.h"
+
+void MyTrackEff::init()
+{
+  lumi = -99;
+  run = -99;
+  event = -99;
+
+  pt = 0.;
+  phi = 0.;
+  eta = -9.;
+  charge = -9;
+  endcap = -9;
+  chamber_ME1_csc_sh=0;
+  chamber_ME2_csc_sh=0;
+  chamber_odd = 0;
+  chamber_even = 0;
+  quality_odd = 0;
+  quality_even = 0;
+  bending_sh = -10;
+  phi_cscsh_even = -9.0;
+  phi_cscsh_odd = -9.0;
+  eta_cscsh_even = -9.0;
+  eta_cscsh_odd = -9.0;
+  pt_sh = -9.0;
+  pteta_sh = 0;
+  ptphi_sh = -9.0;
+
+  has_csc_sh = 0;
+  has_csc_strips = 0;
+  has_csc_wires = 0;
+  has_alct = 0;
+  has_clct = 0;
+  has_lct = 0;
+  bend_lct_odd = -9;
+  bend_lct_even = -9;
+  bx_lct_odd = -9;
+  bx_lct_even = -9;
+  hs_lct_odd = 0;
+  hs_lct_even = 0;
+  wg_lct_odd = 0;
+  wg_lct_even = 0;
+  phi_lct_odd = -9.;
+  phi_lct_even = -9.;
+  eta_lct_odd = -9.;
+  eta_lct_even = -9.;
+  dphi_lct_odd = -9.;
+  dphi_lct_even = -9.;
+  passdphi_odd = false;
+  passdphi_even = false;
+  for (auto& wp: passdphi_wp) wp = 0;
+
+  wiregroup_odd = -1;
+  wiregroup_even =-1; 
+  halfstrip_odd =-1;
+  halfstrip_even = -1;
+  quality_clct_odd = -1;
+  quality_clct_even = -1;
+  quality_alct_odd = -1;
+  quality_alct_even = -1;
+  nlayers_csc_sh_odd = -1;
+  nlayers_wg_dg_odd = -1;
+  nlayers_st_dg_odd = -1;
+  nlayers_csc_sh_even = -1;
+  nlayers_wg_dg_even = -1;
+  nlayers_st_dg_even = -1;
+  pad_odd = -1;
+  pad_even = -1;
+  Copad_odd = -1;
+  Copad_even = -1;
+
+  hsfromgem_odd = -1;
+  hsfromgem_even = -1;
+
+  has_gem_sh = 0;
+  has_gem_sh2 = 0;
+  has_gem_dg = 0;
+  has_gem_dg2 = 0;
+  has_gem_pad = 0;
+  has_gem_pad2 = 0;
+  has_gem_copad = 0;
+  strip_gemsh_odd = -9.;
+  strip_gemsh_even = -9.;
+  eta_gemsh_odd = -9.;
+  eta_gemsh_even = -9.;
+  phi_gemsh_odd = -9.;
+  phi_gemsh_even = -9.;
+  dphi_sh_odd = -9;
+  dphi_sh_even = -9;
+  strip_gemdg_odd = -9;
+  strip_gemdg_even = -9;
+ 
+  has_rpc_sh = 0;
+  has_rpc_dg = 0; // bit1: in odd, bit2: even
+  strip_rpcdg_odd = -1;
+  strip_rpcdg_even = -1;
+
+  hsfromrpc_odd = 0;
+  hsfromrpc_even = 0;
+
+  bx_pad_odd = -9;
+  bx_pad_even = -9;
+  phi_pad_odd = -9.;
+  phi_pad_even = -9.;
+  eta_pad_odd = -9.;
+  eta_pad_even = -9.;
+  dphi_pad_odd = -9.;
+  dphi_pad_even = -9.;
+  deta_pad_odd = -9.;
+  deta_pad_even = -9.;
+
+  bx_rpcstrip_odd = -9;
+  bx_rpcstrip_even = -9;
+  phi_rpcstrip_odd = -9.;
+  phi_rpcstrip_even = -9.;
+  eta_rpcstrip_odd = -9.;
+  eta_rpcstrip_even = -9.;
+  dphi_rpcstrip_odd = -9.;
+  dphi_rpcstrip_even = -9.;
+  deta_rpcstrip_odd = -9.;
+  deta_rpcstrip_even = -9.;
+
+  // Track properties
+  has_tfTrack = -99;
+  has_tfCand = -99;
+
+  has_tfTrack_stubs = 0;
+  tfTrack_stubs_pt = -9.;
+  tfTrack_stubs_eta = -9.;
+  tfTrack_stubs_phi = -9.;
+  tfTrack_stubs_nStubs = 0;
+  tfTrack_stubs_nMatchedStubs = 0;
+  has_gmtRegCand = -99;
+  has_gmtCand = -99;
+
+  //csctf
+  trackpt = 0 ;
+  tracketa = 0;
+  trackphi = -9;
+  quality_packed = 0;
+  pt_packed = 0;
+  eta_packed = 0;
+  phi_packed = 0;
+  ME1_hs = -1;
+  ME1_wg = -1;
+  ME2_hs = -1;
+  ME2_wg = -1;
+  chargesign =99;
+  rank = 0;
+  deltaphi12 = 0;
+  deltaphi23 = 0;; 
+  hasME1 = false;
+  hasME2 = false;
+  ME1_ring = -1;
+  ME2_ring = -1;
+  chamberME1 = 0;
+  chamberME2 = 0;
+  dphiGE11 = -99.0;
+  dphiGE21 = -99.0;
+  passGE11 = false;
+  passGE11_pt5 = false;
+  passGE11_pt7 = false;
+  passGE11_pt10 = false;
+  passGE11_pt15 = false;
+  passGE11_pt20 = false;
+  passGE11_pt30 = false;
+  passGE11_pt40 = false;
+  passGE21 = false;
+  passGE21_pt5 = false;
+  passGE21_pt7 = false;
+  passGE21_pt10 = false;
+  passGE21_pt15 = false;
+  passGE21_pt20 = false;
+  passGE21_pt30 = false;
+  passGE21_pt40 = false;
+  passGE11_simpt = false;
+  passGE21_simpt = false;//to debug dphi cut eff
+  nstubs = 0;
+  deltaR = 10;
+  lctdphi12 = -99;
+
+  eta_propagated_ME1 = -9;
+  eta_propagated_ME2 = -9;
+  eta_propagated_ME3 = -9;
+  eta_propagated_ME4 = -9;
+  phi_propagated_ME1 = -9;
+  phi_propagated_ME2 = -9;
+  phi_propagated_ME3 = -9;
+  phi_propagated_ME4 = -9;
+  eta_ME1_TF = -9;
+  eta_ME2_TF = -9;
+  eta_ME3_TF = -9;
+  eta_ME4_TF = -9;
+  phi_ME1_TF = -9;
+  phi_ME2_TF = -9;
+  phi_ME3_TF = -9;
+  phi_ME4_TF = -9;
+ 
+  eta_interStat12 = -9;
+  phi_interStat12 = -9;
+  eta_interStat23 = -9;
+  phi_interStat23 = -9;
+  eta_interStat13 = -9;
+  phi_interStat13 = -9;
+  
+  allstubs_matched_TF = false; 
+
+  has_l1Extra = 0;
+  l1Extra_pt = -99;
+  l1Extra_eta = -99;
+  l1Extra_phi = -99;
+  l1Extra_dR = -99;
+  has_recoTrackExtra = 0;
+  recoTrackExtra_pt_inner = - 99.;
+  recoTrackExtra_eta_inner = - 99.;
+  recoTrackExtra_phi_inner = - 99.;  
+  recoTrackExtra_pt_outer = - 99.;
+  recoTrackExtra_eta_outer = - 99.;
+  recoTrackExtra_phi_outer = - 99.;
+  has_recoTrack = 0;
+  recoTrack_pt_outer = - 99.;
+  recoTrack_eta_outer = - 99.;
+  recoTrack_phi_outer = - 99.;
+  has_recoChargedCandidate = 0;
+  recoChargedCandidate_pt = - 99.;
+  recoChargedCandidate_eta = - 99.;
+  recoChargedCandidate_phi = - 99.;
+
+  recoChargedCandidate_nValidDTHits = 0;
+  recoChargedCandidate_nValidCSCHits = 0;
+  recoChargedCandidate_nValidRPCHits = 0;
+
+  pt_position_sh=-1;
+  pt_position=-1;
+  pt_position2=-1;
+  hasSt1St2St3=false;
+  hasSt1St2St3_sh=false;
+}
+
+
+void MyTrackEff::branches(TTree *t, const std::vector<std::string>& dPhiWorkingPoints)
+{
+  t->Branch("lumi", &lumi);
+  t->Branch("run", &run);
+  t->Branch("event", &event);
+
+  t->Branch("pt", &pt);
+  t->Branch("eta", &eta);
+  t->Branch("phi", &phi);
+  t->Branch("charge", &charge);
+  t->Branch("endcap", &endcap);
+  t->Branch("chamber_ME1_csc_sh", &chamber_ME1_csc_sh);
+  t->Branch("chamber_ME2_csc_sh", &chamber_ME2_csc_sh);
+  t->Branch("chamber_odd", &chamber_odd);
+  t->Branch("chamber_even", &chamber_even);
+  t->Branch("quality_odd", &quality_odd);
+  t->Branch("quality_even", &quality_even);
+  t->Branch("bending_sh", &bending_sh);
+  t->Branch("phi_cscsh_even", &phi_cscsh_even);
+  t->Branch("phi_cscsh_odd", &phi_cscsh_odd);
+  t->Branch("eta_cscsh_even", &eta_cscsh_even);
+  t->Branch("eta_cscsh_odd", &eta_cscsh_odd);
+  t->Branch("pt_sh", &pt_sh);
+  t->Branch("pteta_sh", &pteta_sh);
+  t->Branch("ptphi_sh", &ptphi_sh);
+  t->Branch("has_csc_sh", &has_csc_sh);
+  t->Branch("has_csc_strips", &has_csc_strips);
+  t->Branch("has_csc_wires", &has_csc_wires);
+  t->Branch("has_clct", &has_clct);
+  t->Branch("has_alct", &has_alct);
+  t->Branch("has_lct", &has_lct);
+  t->Branch("bend_lct_odd", &bend_lct_odd);
+  t->Branch("bend_lct_even", &bend_lct_even);
+  t->Branch("bx_lct_odd", &bx_lct_odd);
+  t->Branch("bx_lct_even", &bx_lct_even);
+  t->Branch("hs_lct_odd", &hs_lct_odd);
+  t->Branch("hs_lct_even", &hs_lct_even);
+  t->Branch("wg_lct_even", &wg_lct_even);
+  t->Branch("wg_lct_odd", &wg_lct_odd);
+  t->Branch("phi_lct_odd", &phi_lct_odd);
+  t->Branch("phi_lct_even", &phi_lct_even);
+  t->Branch("eta_lct_odd", &eta_lct_odd);
+  t->Branch("eta_lct_even", &eta_lct_even);
+  t->Branch("dphi_lct_odd", &dphi_lct_odd);
+  t->Branch("dphi_lct_even", &dphi_lct_even);
+  t->Branch("passdphi_odd", &passdphi_odd);
+  t->Branch("passdphi_even", &passdphi_even);
+  for (unsigned int w = 0; w < dPhiWorkingPoints.size() and w < MaxDPhiWorkingPoints; ++w)
+    t->Branch(("passdphi_" + dPhiWorkingPoints[w]).c_str(), &passdphi_wp[w]);
+  
+  t->Branch("wiregroup_odd", &wiregroup_odd);
+  t->Branch("wiregroup_even", &wiregroup_even);
+  t->Branch("halfstrip_odd", &halfstrip_odd);
+  t->Branch("halfstrip_even", &halfstrip_even);
+  t->Branch("quality_clct_odd", &quality_clct_odd);
+  t->Branch("quality_clct_even", &quality_clct_even);
+  t->Branch("quality_alct_odd", &quality_alct_odd);
+  t->Branch("quality_alct_even", &quality_alct_even);
+  t->Branch("nlayers_csc_sh_odd", &nlayers_csc_sh_odd);
+  t->Branch("nlayers_csc_sh_even", &nlayers_csc_sh_even);
+  t->Branch("nlayers_wg_dg_odd", &nlayers_wg_dg_odd);
+  t->Branch("nlayers_wg_dg_even", &nlayers_wg_dg_even);
+  t->Branch("nlayers_st_dg_odd", &nlayers_st_dg_odd);
+  t->Branch("nlayers_st_dg_even", &nlayers_st_dg_even);
+
+  t->Branch("pad_odd", &pad_odd);
+  t->Branch("pad_even", &pad_even);
+  t->Branch("Copad_odd", &Copad_odd);
+  t->Branch("copad_even", &Copad_even);
+
+  t->Branch("hsfromgem_odd", &hsfromgem_odd);
+  t->Branch("hsfromgem_even", &hsfromgem_even);
+
+  t->Branch("has_gem_sh", &has_gem_sh);
+  t->Branch("has_gem_sh2", &has_gem_sh2);
+  t->Branch("has_gem_dg", &has_gem_dg);
+  t->Branch("has_gem_dg2", &has_gem_dg2);
+  t->Branch("has_gem_pad", &has_gem_pad);
+  t->Branch("has_gem_pad2", &has_gem_pad2);
+  t->Branch("has_gem_copad", &has_gem_copad);
+  t->Branch("strip_gemsh_odd", &strip_gemsh_odd);
+  t->Branch("strip_gemsh_even", &strip_gemsh_even);
+  t->Branch("eta_gemsh_odd", &eta_gemsh_odd);
+  t->Branch("eta_gemsh_even", &eta_gemsh_even);
+  t->Branch("phi_gemsh_odd", &phi_gemsh_odd);
+  t->Branch("phi_gemsh_even", &phi_gemsh_even);
+  t->Branch("dphi_sh_odd", &dphi_sh_odd);
+  t->Branch("dphi_sh_even", &dphi_sh_even);
+  t->Branch("strip_gemdg_odd", &strip_gemdg_odd);
+  t->Branch("strip_gemdg_even", &strip_gemdg_even);
+
+  t->Branch("has_rpc_sh", &has_rpc_sh);
+  t->Branch("has_rpc_dg", &has_rpc_dg);
+  t->Branch("strip_rpcdg_odd", &strip_rpcdg_odd);
+  t->Branch("strip_rpcdg_even", &strip_rpcdg_even);
+  t->Branch("hsfromrpc_odd", &hsfromrpc_odd);
+  t->Branch("hsfromrpc_even", &hsfromrpc_even);
+
+  t->Branch("bx_pad_odd", &bx_pad_odd);
+  t->Branch("bx_pad_even", &bx_pad_even);
+  t->Branch("phi_pad_odd", &phi_pad_odd);
+  t->Branch("phi_pad_even", &phi_pad_even);
+  t->Branch("eta_pad_odd", &eta_pad_odd);
+  t->Branch("eta_pad_even", &eta_pad_even);
+  t->Branch("dphi_pad_odd", &dphi_pad_odd);
+  t->Branch("dphi_pad_even", &dphi_pad_even);
+  t->Branch("deta_pad_odd", &deta_pad_odd);
+  t->Branch("deta_pad_even", &deta_pad_even);
+
+  t->Branch("bx_rpcstrip_odd", &bx_rpcstrip_odd);
+  t->Branch("bx_rpcstrip_even", &bx_rpcstrip_even);
+  t->Branch("phi_rpcstrip_odd", &phi_rpcstrip_odd);
+  t->Branch("phi_rpcstrip_even", &phi_rpcstrip_even);
+  t->Branch("eta_rpcstrip_odd", &eta_rpcstrip_odd);
+  t->Branch("eta_rpcstrip_even", &eta_rpcstrip_even);
+  t->Branch("dphi_rpcstrip_odd", &dphi_rpcstrip_odd);
+  t->Branch("dphi_rpcstrip_even", &dphi_rpcstrip_even);
+  t->Branch("deta_rpcstrip_odd", &deta_rpcstrip_odd);
+  t->Branch("deta_rpcstrip_even", &deta_rpcstrip_even);
+
+  //t->Branch("", &);
+  t->Branch("has_tfTrack", &has_tfTrack);
+  t->Branch("has_tfCand", &has_tfCand);
+  t->Branch("has_tfTrack_stubs", &has_tfTrack_stubs);
+  t->Branch("tfTrack_stubs_pt", &tfTrack_stubs_pt);
+  t->Branch("tfTrack_stubs_eta", &tfTrack_stubs_eta);
+  t->Branch("tfTrack_stubs_phi", &tfTrack_stubs_phi);
+  t->Branch("tfTrack_stubs_nStubs", &tfTrack_stubs_nStubs);
+  t->Branch("tfTrack_stubs_nMatchedStubs", &tfTrack_stubs_nMatchedStubs);
+  t->Branch("has_gmtRegCand", &has_gmtRegCand);
+  t->Branch("has_gmtCand", &has_gmtCand);
+  
+  //csctftrack
+  t->Branch("trackpt", &trackpt);
+  t->Branch("tracketa", &tracketa);
+  t->Branch("trackphi", &trackphi);
+  t->Branch("quality_packed",&quality_packed);
+  t->Branch("rank",&rank);
+  t->Branch("pt_packed",&pt_packed);
+  t->Branch("eta_packed",&eta_packed);
+  t->Branch("phi_packed",&phi_packed);
+  t->Branch("chargesign",&chargesign);
+  t->Branch("deltaphi12",&deltaphi12);
+  t->Branch("deltaphi23",&deltaphi23);
+  t->Branch("hasME1",&hasME1);
+  t->Branch("hasME2",&hasME2);
+  t->Branch("ME1_ring",&ME1_ring);
+  t->Branch("ME2_ring",&ME2_ring);
+  t->Branch("chamberME1",&chamberME1);
+  t->Branch("chamberME2",&chamberME2);
+  t->Branch("ME1_hs",&ME1_hs);
+  t->Branch("ME1_wg",&ME1_wg);
+  t->Branch("ME2_hs",&ME2_hs);
+  t->Branch("ME2_wg",&ME2_wg);
+  t->Branch("dphiGE11",&dphiGE11);
+  t->Branch("dphiGE21",&dphiGE21);
+  t->Branch("passGE11",&passGE11);
+  t->Branch("passGE11_pt5",&passGE11_pt5);
+  t->Branch("passGE11_pt7",&passGE11_pt7);
+  t->Branch("passGE11_pt10",&passGE11_pt10);
+  t->Branch("passGE11_pt15",&passGE11_pt15);
+  t->Branch("passGE11_pt20",&passGE11_pt20);
+  t->Branch("passGE11_pt30",&passGE11_pt30);
+  t->Branch("passGE11_pt40",&passGE11_pt40);
+  t->Branch("passGE21",&passGE21);
+  t->Branch("passGE21_pt5",&passGE21_pt5);
+  t->Branch("passGE21_pt7",&passGE21_pt7);
+  t->Branch("passGE21_pt10",&passGE21_pt10);
+  t->Branch("passGE21_pt15",&passGE21_pt15);
+  t->Branch("passGE21_pt20",&passGE21_pt20);
+  t->Branch("passGE21_pt30",&passGE21_pt30);
+  t->Branch("passGE21_pt40",&passGE21_pt40);
+  t->Branch("passGE11_simpt",&passGE11_simpt);
+  t->Branch("passGE21_simpt",&passGE21_simpt);
+  t->Branch("nstubs",&nstubs);
+  t->Branch("deltaR",&deltaR);
+  t->Branch("lctdphi12",&lctdphi12);
+   
+  t->Branch("eta_propagated_ME1",&eta_propagated_ME1);
+  t->Branch("eta_propagated_ME2",&eta_propagated_ME2);
+  t->Branch("eta_propagated_ME3",&eta_propagated_ME3);
+  t->Branch("eta_propagated_ME4",&eta_propagated_ME4);
+  t->Branch("phi_propagated_ME1",&phi_propagated_ME1);
+  t->Branch("phi_propagated_ME2",&phi_propagated_ME2);
+  t->Branch("phi_propagated_ME3",&phi_propagated_ME3);
+  t->Branch("phi_propagated_ME4",&phi_propagated_ME4);
+  t->Branch("eta_ME1_TF",&eta_ME1_TF);
+  t->Branch("eta_ME2_TF",&eta_ME2_TF);
+  t->Branch("eta_ME3_TF",&eta_ME3_TF);
+  t->Branch("eta_ME4_TF",&eta_ME4_TF);
+  t->Branch("phi_ME1_TF",&phi_ME1_TF);
+  t->Branch("phi_ME2_TF",&phi_ME2_TF);
+  t->Branch("phi_ME3_TF",&phi_ME3_TF);
+  t->Branch("phi_ME4_TF",&phi_ME4_TF);
+
+  t->Branch("eta_interStat12",&eta_interStat12);
+  t->Branch("phi_interStat12",&phi_interStat12);
+  t->Branch("eta_interStat23",&eta_interStat23);
+  t->Branch("phi_interStat23",&phi_interStat23);
+  t->Branch("eta_interStat13",&eta_interStat13);
+  t->Branch("phi_interStat13",&phi_interStat13);
+  
+  t->Branch("allstubs_matched_TF",&allstubs_matched_TF);
+
+  t->Branch("has_l1Extra", &has_l1Extra);
+  t->Branch("l1Extra_pt", &l1Extra_pt);
+  t->Branch("l1Extra_eta", &l1Extra_eta);
+  t->Branch("l1Extra_phi", &l1Extra_phi);
+  t->Branch("l1Extra_dR", &l1Extra_dR);
+  t->Branch("has_recoTrackExtra", &has_recoTrackExtra);
+  t->Branch("recoTrackExtra_pt_inner", &recoTrackExtra_pt_inner);
+  t->Branch("recoTrackExtra_eta_inner", &recoTrackExtra_eta_inner);
+  t->Branch("recoTrackExtra_phi_inner", &recoTrackExtra_phi_inner);
+  t->Branch("recoTrackExtra_pt_outer", &recoTrackExtra_pt_outer);
+  t->Branch("recoTrackExtra_eta_outer", &recoTrackExtra_eta_outer);
+  t->Branch("recoTrackExtra_phi_outer", &recoTrackExtra_phi_outer);
+  t->Branch("has_recoTrack", &has_recoTrack);
+  t->Branch("recoTrack_pt_outer", &recoTrack_pt_outer);
+  t->Branch("recoTrack_eta_outer", &recoTrack_eta_outer);
+  t->Branch("recoTrack_phi_outer", &recoTrack_phi_outer);
+  t->Branch("has_recoChargedCandidate", &has_recoChargedCandidate);
+  t->Branch("recoChargedCandidate_pt", &recoChargedCandidate_pt);
+  t->Branch("recoChargedCandidate_eta", &recoChargedCandidate_eta);
+  t->Branch("recoChargedCandidate_phi", &recoChargedCandidate_phi); 
+
+  t->Branch("recoChargedCandidate_nValidDTHits", &recoChargedCandidate_nValidDTHits); 
+  t->Branch("recoChargedCandidate_nValidCSCHits", &recoChargedCandidate_nValidCSCHits); 
+  t->Branch("recoChargedCandidate_nValidRPCHits", &recoChargedCandidate_nValidRPCHits); 
+
+  
+  t->Branch("pt_position_sh", &pt_position_sh); 
+  t->Branch("pt_position", &pt_position); 
+  t->Branch("pt_position2", &pt_position2); 
+  t->Branch("hasSt1St2St3", &hasSt1St2St3); 
+  t->Branch("hasSt1St2St3_sh", &hasSt1St2St3_sh); 
+}
@@ -0,0 +1,107 @@
+#include "GEMCode/GEMValidation/interface/Ptassignment.h"
+#include "FWCore/Utilities/interface/Exception.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+PositionPtLUT::PositionPtLUT()
+: nEta_(EtaPartitions), nParity_(Parity)
+{
+  etaEdges_ = {1.6, 1.8, 2.0, 2.2, 2.4};
+  for (unsigned int p = 0; p < nParity_; ++p) {
+    for (unsigned int e = 0; e < nEta_; ++e) {
+      prop_.push_back(PositionEpLUT[p][e][0]);
+      slope_.push_back(PositionEpLUT[p][e][1]);
+      intercept_.push_back(PositionEpLUT[p][e][2]);
+    }
+  }
+}
+
+
+PositionPtLUT::PositionPtLUT(const edm::ParameterSet& ps)
+{
+  const auto edges(ps.getParameter<std::vector<double> >("etaEdges"));
+  if (edges.size() < 2 or !std::is_sorted(edges.begin(), edges.end()))
+    throw cms::Exception("Configuration") << "PositionPtLUT: etaEdges must be an increasing list of at least two values";
+  etaEdges_.assign(edges.begin(), edges.end());
+  nEta_ = edges.size() - 1;
+  nParity_ = 0;
+  for (unsigned int p = 0; ; ++p) {
+    std::stringstream name;
+    name << "parity" << p;
+    if (!ps.exists(name.str())) break;
+    const auto rows(ps.getParameter<std::vector<double> >(name.str()));
+    if (rows.size() != 3*nEta_)
+      throw cms::Exception("Configuration") << "PositionPtLUT: " << name.str() << " needs " << 3*nEta_ << " values";
+    for (unsigned int e = 0; e < nEta_; ++e) {
+      prop_.push_back(rows[3*e]);
+      slope_.push_back(rows[3*e+1]);
+      intercept_.push_back(rows[3*e+2]);
+    }
+    ++nParity_;
+  }
+  if (nParity_ == 0)
+    throw cms::Exception("Configuration") << "PositionPtLUT: no parity0 row";
+}
+
+
+const PositionPtLUT&
+PositionPtLUT::defaultLUT()
+{
+  static const PositionPtLUT lut;
+  return lut;
+}
+
+
+int
+PositionPtLUT::etaBin(float eta) const
+{
+  const float aeta(std::abs(eta));
+  if (aeta < etaEdges_[0] or aeta >= etaEdges_[nEta_]) return -1;
+  int n = 0;
+  for (unsigned int e = 1; e < nEta_; ++e) n += (aeta >= etaEdges_[e]);
+  return n;
+}
+
+
+void
+Ptassign_Position_batch(const PositionPtInput& in, float* pt, const PositionPtLUT& lut)
+{
+  const unsigned int nEta(lut.nEta());
+  const int nParity(lut.nParity());
+  const float* __restrict__ edges(lut.etaEdges());
+  const float* __restrict__ prop(lut.prop());
+  const float* __restrict__ slope(lut.slope());
+  const float* __restrict__ intercept(lut.intercept());
+  const float etaLow(edges[0]), etaHigh(edges[nEta]);
+
+  const float* __restrict__ x1(in.x1); const float* __restrict__ y1(in.y1);
+  const float* __restrict__ x2(in.x2); const float* __restrict__ y2(in.y2);
+  const float* __restrict__ x3(in.x3); const float* __restrict__ y3(in.y3);
+  const float* __restrict__ eta(in.eta);
+  const int* __restrict__ parity(in.parity);
+  float* __restrict__ out(pt);
+
+  for (unsigned int i = 0; i < in.n; ++i) {
+    // rotate to the frame where station 2 sits on the x axis: sin/cos of its phi are y2/r2, x2/r2
+    const float r2inv = 1.f/std::sqrt(x2[i]*x2[i] + y2[i]*y2[i]);
+    const float s(y2[i]*r2inv), c(x2[i]*r2inv);
+    const float newy1(-x1[i]*s + y1[i]*c);
+    const float newy2(-x2[i]*s + y2[i]*c);
+    const float newy3(-x3[i]*s + y3[i]*c);
+    const float deltay12(newy2 - newy1);
+    const float deltay23(newy3 - newy2);
+
+    const float aeta(std::abs(eta[i]));
+    int neta = 0;
+    for (unsigned int e = 1; e < nEta; ++e) neta += (aeta >= edges[e]);
+    const int par(parity[i]);
+    const bool valid((aeta >= etaLow) & (aeta < etaHigh) & (par >= 0) & (par < nParity));
+    const int row(valid ? par*nEta + neta : 0);
+
+    const float ddy(std::abs(std::abs(deltay23) - prop[row]*std::abs(deltay12)));
+    const float value((1.f/ddy + intercept[row])/slope[row]);
+    out[i] = !valid ? -1.f : (ddy < 0.005f ? 100.f : value);
+  }
+}
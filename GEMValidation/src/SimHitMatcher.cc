@@ -16,6 +16,7 @@ SimHitMatcher::SimHitMatcher(const SimTrack& t, const SimVertex& v,
   simMuOnlyGEM_ = gemSimHit_.getParameter<bool>("simMuOnly");
   discardEleHitsGEM_ = gemSimHit_.getParameter<bool>("discardEleHits");
   runGEMSimHit_ = gemSimHit_.getParameter<bool>("run");
+  matchDeltaPadGEM_ = gemSimHit_.getParameter<int>("matchDeltaPad");
 
   auto cscSimHit_= conf().getParameter<edm::ParameterSet>("cscSimHit");
   verboseCSC_ = cscSimHit_.getParameter<int>("verbose");
@@ -343,51 +344,27 @@ SimHitMatcher::matchGEMSimHitsToSimTrack(std::vector<unsigned int> track_ids, co
   }
 
   // find pads with hits
-  auto detids = detIdsGEM();
-  // find 2-layer coincidence pads with hits
-  for (auto d: detids) {
-    GEMDetId id(d);
-    auto hits = hitsInDetId(d);
-    auto roll = getGEMGeometry()->etaPartition(id);
-    //int max_npads = roll->npads();
-    set<int> pads;
-    for (auto& h: hits) {
+  for (auto& p: gem_detid_to_hits_) {
+    auto roll = getGEMGeometry()->etaPartition(GEMDetId(p.first));
+    GE11PadBits& pads = gem_detids_to_pads_[p.first];
+    for (auto& h: p.second) {
       LocalPoint lp = h.entryPoint();
-      pads.insert( 1 + static_cast<int>(roll->padTopology().channel(lp)) );
+      pads.set( 1 + static_cast<int>(roll->padTopology().channel(lp)) );
     }
-    gem_detids_to_pads_[d] = pads;
   }
-  
+
   // find 2-layer coincidence pads with hits
-  for (auto d: detids) {
-    GEMDetId id1(d);
+  for (auto& p: gem_detids_to_pads_) {
+    GEMDetId id1(p.first);
     if (id1.layer() != 1) continue;
     GEMDetId id2(id1.region(), id1.ring(), id1.station(), 2, id1.chamber(), id1.roll());
     // does layer 2 has simhits?
-    if (detids.find(id2()) == detids.end()) continue;
-    
-    // find pads with hits in layer1
-    auto hits1 = hitsInDetId(d);
-    auto roll1 = getGEMGeometry()->etaPartition(id1);
-    set<int> pads1;
-    for (auto& h: hits1) {
-      LocalPoint lp = h.entryPoint();
-      pads1.insert( 1 + static_cast<int>(roll1->padTopology().channel(lp)) );
-    }
-    
-    // find pads with hits in layer2
-    auto hits2 = hitsInDetId(id2());
-    auto roll2 = getGEMGeometry()->etaPartition(id2);
-    set<int> pads2;
-    for (auto& h: hits2) {
-      LocalPoint lp = h.entryPoint();
-      pads2.insert( 1 + static_cast<int>(roll2->padTopology().channel(lp)) );
-    }
-    
-    set<int> copads;
-    std::set_intersection(pads1.begin(), pads1.end(), pads2.begin(), pads2.end(), std::inserter(copads, copads.begin()));
-    if (copads.empty()) continue;
-    gem_detids_to_copads_[d] = copads;
+    auto pads2 = gem_detids_to_pads_.find(id2());
+    if (pads2 == gem_detids_to_pads_.end()) continue;
+
+    GE11PadBits copads(GE11PadBits::coincidence(p.second, pads2->second, matchDeltaPadGEM_));
+    if (!copads.any()) continue;
+    gem_detids_to_copads_[p.first] = copads;
   }
 }
 
@@ -1337,18 +1314,32 @@ SimHitMatcher::hitWiregroupsInDetId(unsigned int detid, int margin_n_wg) const
 std::set<int> 
 SimHitMatcher::hitPadsInDetId(unsigned int detid) const
 {
-  set<int> none;
-  if (gem_detids_to_pads_.find(detid) == gem_detids_to_pads_.end()) return none;
-  return gem_detids_to_pads_.at(detid);
+  return hitPadBitsInDetId(detid).pads();
 }
 
 
 std::set<int>
 SimHitMatcher::hitCoPadsInDetId(unsigned int detid) const
 {
-  set<int> none;
-  if (gem_detids_to_copads_.find(detid) == gem_detids_to_copads_.end()) return none;
-  return gem_detids_to_copads_.at(detid);
+  return hitCoPadBitsInDetId(detid).pads();
+}
+
+
+const GE11PadBits&
+SimHitMatcher::hitPadBitsInDetId(unsigned int detid) const
+{
+  auto pads = gem_detids_to_pads_.find(detid);
+  if (pads == gem_detids_to_pads_.end()) return no_pads_;
+  return pads->second;
+}
+
+
+const GE11PadBits&
+SimHitMatcher::hitCoPadBitsInDetId(unsigned int detid) const
+{
+  auto pads = gem_detids_to_copads_.find(detid);
+  if (pads == gem_detids_to_copads_.end()) return no_pads_;
+  return pads->second;
 }
 
 
@@ -1429,7 +1420,7 @@ SimHitMatcher::nPadsWithHits() const
   auto pad_ids = detIdsGEM();
   for (auto id: pad_ids)
   {
-    result += hitPadsInDetId(id).size();
+    result += hitPadBitsInDetId(id).count();
   }
   return result;
 }
@@ -1442,7 +1433,7 @@ SimHitMatcher::nCoincidencePadsWithHits() const
   auto copad_ids = detIdsGEMCoincidences();
   for (auto id: copad_ids)
   {
-    result += hitCoPadsInDetId(id).size();
+    result += hitCoPadBitsInDetId(id).count();
   }
   return result;
 }
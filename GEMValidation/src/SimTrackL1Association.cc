@@ -0,0 +1,138 @@
+#include "GEMCode/GEMValidation/interface/SimTrackL1Association.h"
+#include "GEMCode/GEMValidation/interface/SimHitMatcher.h"
+#include "DataFormats/Math/interface/deltaR.h"
+#include "DataFormats/Math/interface/normalizedPhi.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+SimTrackL1Association::SimTrackL1Association(const edm::ParameterSet& ps)
+: deltaR_(ps.getParameter<double>("deltaR"))
+, minBX_(ps.getParameter<int>("minBX"))
+, maxBX_(ps.getParameter<int>("maxBX"))
+, deltaBXCost_(ps.existsAs<double>("deltaBXCost") ? ps.getParameter<double>("deltaBXCost") : 0.)
+, chargeMismatchCost_(ps.existsAs<double>("chargeMismatchCost") ? ps.getParameter<double>("chargeMismatchCost") : 0.)
+{}
+
+
+SimTrackL1Association::Reference
+SimTrackL1Association::reference(const SimHitMatcher& sh)
+{
+  Reference ref;
+  ref.charge = static_cast<int>(sh.trk().charge());
+
+  // propagate the simtrack to the second (or third) station DT or CSC
+  const double absSimEta(std::abs(sh.trk().momentum().eta()));
+  std::set<unsigned int> ids;
+  if (absSimEta < 1.1) {
+    ids = sh.chamberIdsDTStation(2);
+    if (ids.empty()) ids = sh.chamberIdsDTStation(3);
+  }
+  else if (absSimEta < 2.4) {
+    ids = sh.chamberIdsCSCStation(2);
+    if (ids.empty()) ids = sh.chamberIdsCSCStation(3);
+  }
+  if (ids.empty()) return ref;
+
+  const GlobalPoint gp(sh.simHitsMeanPosition(sh.hitsInChamber(*ids.begin())));
+  ref.eta = gp.eta();
+  ref.phi = normalizedPhi(gp.phi());
+  ref.valid = true;
+  return ref;
+}
+
+
+unsigned int
+SimTrackL1Association::addSimTrack(const Reference& ref)
+{
+  tracks_.push_back(ref);
+  partner_.push_back(-1);
+  partnerDeltaR_.push_back(99.);
+  return tracks_.size() - 1;
+}
+
+
+unsigned int
+SimTrackL1Association::addCandidate(float eta, float phi, int bx, int charge)
+{
+  Candidate c;
+  c.eta = eta;
+  c.phi = normalizedPhi(phi);
+  c.bx = bx;
+  c.charge = charge;
+  cands_.push_back(c);
+  return cands_.size() - 1;
+}
+
+
+double
+SimTrackL1Association::cost(const Reference& t, const Candidate& c) const
+{
+  if (!t.valid) return forbidden();
+  if (c.bx < minBX_ or c.bx > maxBX_) return forbidden();
+  const double dR(deltaR(t.eta, t.phi, c.eta, c.phi));
+  if (dR > deltaR_) return forbidden();
+  const bool chargeMismatch(t.charge != 0 and c.charge != 0 and t.charge != c.charge);
+  return dR + deltaBXCost_*std::abs(c.bx) + chargeMismatchCost_*chargeMismatch;
+}
+
+
+void
+SimTrackL1Association::solve()
+{
+  std::fill(partner_.begin(), partner_.end(), -1);
+  std::fill(partnerDeltaR_.begin(), partnerDeltaR_.end(), 99.);
+  if (tracks_.empty() or cands_.empty()) return;
+
+  // square cost matrix; the padding rows/columns are forbidden pairs, so that
+  // the minimum first uses as few forbidden pairs as possible
+  const unsigned int n(std::max(tracks_.size(), cands_.size()));
+  std::vector<double> a(n*n, forbidden());
+  for (unsigned int i = 0; i < tracks_.size(); ++i)
+    for (unsigned int j = 0; j < cands_.size(); ++j)
+      a[i*n + j] = std::min(cost(tracks_[i], cands_[j]), forbidden());
+
+  // Hungarian algorithm with row/column potentials, O(n^3);
+  // rows and columns are 1-based, column 0 is the free starting column
+  const double inf(std::numeric_limits<double>::max());
+  std::vector<double> u(n + 1, 0.), v(n + 1, 0.);
+  std::vector<unsigned int> rowOfCol(n + 1, 0), way(n + 1, 0);
+  for (unsigned int i = 1; i <= n; ++i) {
+    rowOfCol[0] = i;
+    unsigned int j0 = 0;
+    std::vector<double> minv(n + 1, inf);
+    std::vector<char> used(n + 1, 0);
+    do {
+      used[j0] = 1;
+      const unsigned int i0 = rowOfCol[j0];
+      double delta = inf;
+      unsigned int j1 = 0;
+      for (unsigned int j = 1; j <= n; ++j) {
+        if (used[j]) continue;
+        const double cur = a[(i0 - 1)*n + (j - 1)] - u[i0] - v[j];
+        if (cur < minv[j]) { minv[j] = cur; way[j] = j0; }
+        if (minv[j] < delta) { delta = minv[j]; j1 = j; }
+      }
+      for (unsigned int j = 0; j <= n; ++j) {
+        if (used[j]) { u[rowOfCol[j]] += delta; v[j] -= delta; }
+        else minv[j] -= delta;
+      }
+      j0 = j1;
+    } while (rowOfCol[j0] != 0);
+    do {
+      const unsigned int j1 = way[j0];
+      rowOfCol[j0] = rowOfCol[j1];
+      j0 = j1;
+    } while (j0);
+  }
+
+  for (unsigned int j = 1; j <= n; ++j) {
+    const unsigned int i(rowOfCol[j] - 1);
+    if (i >= tracks_.size() or j - 1 >= cands_.size()) continue;
+    if (a[i*n + (j - 1)] >= forbidden()) continue;
+    const Candidate& c(cands_[j - 1]);
+    partner_[i] = j - 1;
+    partnerDeltaR_[i] = deltaR(tracks_[i].eta, tracks_[i].phi, c.eta, c.phi);
+  }
+}
@@ -1,9 +1,10 @@
 #include "GEMCode/GEMValidation/interface/SimTrackMatchManager.h"
 
 SimTrackMatchManager::SimTrackMatchManager(const SimTrack& t, const SimVertex& v,
-      const edm::ParameterSet& ps, const edm::Event& ev, const edm::EventSetup& es)
+      const edm::ParameterSet& ps, const edm::Event& ev, const edm::EventSetup& es,
+      const GenParticleAncestry* genAncestry)
   // need additional protection
-  : genMuons_(t, v, ps, ev, es)
+  : genMuons_(t, v, ps, ev, es, genAncestry)
   , simhits_(t, v, ps, ev, es)
   , gem_digis_(simhits_)
   , gem_rechits_(simhits_)
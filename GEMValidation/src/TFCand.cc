@@ -1,12 +1,18 @@
 #include "GEMCode/GEMValidation/interface/TFCand.h"
 
 TFCand::TFCand(const L1MuRegionalCand* t)
+: l1Cand_(t)
+, tftrack_(0)
+, nIds_(0)
+, pt_(0.)
+, eta_(0.)
+, phi_(0.)
+, dr_(999.)
+, nTFStubs(0)
 {
-  l1Cand_ = t;
 }
 
-TFCand::TFCand(const TFCand& rhs)
-{}
+TFCand::TFCand(const TFCand& rhs) = default;
 
 TFCand::~TFCand()
 {}
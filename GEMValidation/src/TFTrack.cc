@@ -2,9 +2,25 @@
 #include "GEMCode/GEMValidation/interface/Helpers.h"
 
 TFTrack::TFTrack(const csc::L1Track* t, const CSCCorrelatedLCTDigiCollection* lcts)
+{
+  reset(t, lcts);
+}
+
+TFTrack::TFTrack(const TFTrack& rhs) = default;
+
+void
+TFTrack::reset(const csc::L1Track* t, const CSCCorrelatedLCTDigiCollection* lcts)
 {
   l1track_ = t;
   nstubs = 0;
+  dr_ = 999.;
+  debug_ = false;
+  nTriggerDigis_ = nTriggerIds_ = nTriggerEtaPhis_ = nTriggerStubs_ = nMPLCTs_ = nIds_ = 0;
+  deltaOk_ = 0;
+
+  stationMask_ = ((t->mb1ID() > 0) | (t->me1ID() > 0) << 1 | (t->me2ID() > 0) << 2 |
+                  (t->me3ID() > 0) << 3 | (t->me4ID() > 0) << 4);
+  cscOkMask_ = stationMask_ & ~1u;
 
   for (auto detUnitIt = lcts->begin(); detUnitIt != lcts->end(); detUnitIt++) {
     const CSCDetId& id = (*detUnitIt).first;
@@ -18,23 +34,10 @@ TFTrack::TFTrack(const csc::L1Track* t, const CSCCorrelatedLCTDigiCollection* lc
       nstubs++;
     }
   }
-  
-
 }
 
-TFTrack::TFTrack(const TFTrack& rhs)
-{}
-
 TFTrack::~TFTrack()
 {
-//  std::cout<<" deconstrcution of TFTrack"<< std::endl;
-  triggerDigis_.clear();
-  triggerIds_.clear();
-  triggerEtaPhis_.clear();
-  triggerStubs_.clear();
-  mplcts_.clear();
-  ids_.clear(); // chamber ids_
-
 }
 
 void 
@@ -69,67 +72,6 @@ TFTrack::setDR(double dr)
   dr_ = dr;
 }
 
-bool 
-TFTrack::hasStubEndcap(int st) const
-{
-  if(st==1 and l1track_->me1ID() > 0) return true;
-  if(st==2 and l1track_->me2ID() > 0) return true;
-  if(st==3 and l1track_->me3ID() > 0) return true;
-  if(st==4 and l1track_->me4ID() > 0) return true;
-  return false;
-}
-
-bool
-TFTrack::hasStubBarrel() const
-{
-  return l1track_->mb1ID() > 0;
-}
-
-bool 
-TFTrack::hasStubStation(int st) const
-{
-  if(st==0 and hasStubBarrel())       return true;
-  if(st==1 and l1track_->me1ID() > 0) return true;
-  if(st==2 and l1track_->me2ID() > 0) return true;
-  if(st==3 and l1track_->me3ID() > 0) return true;
-  if(st==4 and l1track_->me4ID() > 0) return true;
-  return false;
-}
-
-
-bool 
-TFTrack::hasStubCSCOk(int st) const
-{
-   if (!hasStubEndcap(st)) return false;
-//   bool cscok = 0;
-//   for (size_t s=0; s<ids__.size(); s++) {
-//     if (ids__[s].station() == st and mplcts__[s]->deltaOk) { 
-//       cscok = 1; 
-//       break; 
-//     }
-//   }
-//   return cscok;
-  return true;
-}
-
-
-unsigned int 
-TFTrack::nStubs(bool mb1, bool me1, bool me2, bool me3, bool me4) const
-{
-  return ( (mb1 and hasStubStation(0)) + (me1 and hasStubStation(1)) + 
-	   (me2 and hasStubStation(2)) + (me3 and hasStubStation(3)) + 
-	   (me4 and hasStubStation(4)) );
-}
-
-
-unsigned int 
-TFTrack::nStubsCSCOk(bool me1, bool me2, bool me3, bool me4) const
-{
-  return ( (me1 and hasStubCSCOk(1)) + (me2 and hasStubCSCOk(2)) + 
-	   (me3 and hasStubCSCOk(3)) + (me4 and hasStubCSCOk(4)) );
-}
-
-
 bool 
 TFTrack::passStubsMatch(double steta, int minLowHStubs, int minMidHStubs, int minHighHStubs) const
 {
@@ -143,7 +85,7 @@ TFTrack::passStubsMatch(double steta, int minLowHStubs, int minMidHStubs, int mi
 
 
 void 
-TFTrack::print()
+TFTrack::print() const
 {
   
 //    std::cout<<"#### TFTRACK PRINT: "<<msg<<" #####"<<std::endl;
@@ -158,12 +100,12 @@ TFTrack::print()
         <<" ("<<hasStub(0)<<" "<<hasStub(1)<<" "<<hasStub(2)<<" "<<hasStub(3)<<" "<<hasStub(4)<<")  "
         <<" ("<<hasStubCSCOk(1)<<" "<<hasStubCSCOk(2)<<" "<<hasStubCSCOk(3)<<" "<<hasStubCSCOk(4)<<")"<<std::endl;*/
     std::cout<<"\tptAddress: 0x"<<std::hex<<l1track_->ptLUTAddress()<<std::dec<<"  dphi12: "<<dPhi12()<<"  dphi23: "<<dPhi23()<<std::endl;
-    std::cout<<"\thas "<<triggerDigis_.size()<<" stubs in " << std::endl;
-    for (size_t s=0; s<triggerDigis_.size(); s++) 
+    std::cout<<"\thas "<<int(nTriggerDigis_)<<" stubs in " << std::endl;
+    for (size_t s=0; s<nTriggerDigis_; s++) 
         std::cout<<CSCDetId(triggerIds_[s])<<" w:"<<triggerDigis_[s]->getKeyWG()+1<<" hs:"<<triggerDigis_[s]->getStrip()+1 <<" p:"<<triggerDigis_[s]->getPattern()<<" bx:"<<triggerDigis_[s]->getBX()<<"; " << std::endl;
    
     std::cout<<"\tstub_etaphis:" << std::endl;
-    for (size_t s=0; s<triggerEtaPhis_.size(); s++)
+    for (size_t s=0; s<nTriggerEtaPhis_; s++)
         std::cout<<" eta: "<<triggerEtaPhis_[s].first<<" phi: "<<triggerEtaPhis_[s].second << std::endl;
     /*std::cout<<"\tstub_petaphis:";
     for (size_t s=0; s<triggerStubs_.size(); s++)
@@ -181,10 +123,10 @@ TFTrack::print()
 
 unsigned int TFTrack::digiInME(int st, int ring) const
 {
-  if (triggerDigis_.size() != triggerIds_.size()) std::cout<<" BUG " <<std::endl;
-  for (unsigned int i=0; i<triggerDigis_.size(); i++)
+  if (nTriggerDigis_ != nTriggerIds_) std::cout<<" BUG " <<std::endl;
+  for (unsigned int i=0; i<nTriggerDigis_; i++)
   {
-     auto id(triggerIds_.at(i));
+     const CSCDetId& id(triggerIds_[i]);
      if (id.station()==st && id.ring()==ring) return i;
      else continue;  
   }
@@ -192,75 +134,44 @@ unsigned int TFTrack::digiInME(int st, int ring) const
 
 }
 
-bool TFTrack::passDPhicutTFTrack(int st, float pt) const
+bool TFTrack::passDPhicutTFTrack(int st, float pt, const GEMCSCdPhiLUT& lut) const
 {
-
-  //std::cout <<"TFTracks size() " << tfTracks().size() << std::endl;
-  auto GEMdPhi( st==1 ? ME11GEMdPhi : ME21GEMdPhi);
-  //std::cout <<" sizeof(GEMdPhi) "  << sizeof(GEMdPhi[][]) <<" sizeof(GEMdPhi[0])" << sizeof(GEMdPhi[0]) << std::endl;
-  //std::cout <<" sizeof(ME11GEMdPhi) "  << sizeof(ME11GEMdPhi) <<" sizeof(GEMdPhi[0])" << sizeof(ME11GEMdPhi[0]) << std::endl;
-  //std::cout <<" sizeof(ME21GEMdPhi) "  << sizeof(ME21GEMdPhi) <<" sizeof(GEMdPhi[0])" << sizeof(ME21GEMdPhi[0]) << std::endl;
   unsigned int lct_n = digiInME(st,1);
   if (lct_n == 999 and st==1)
       lct_n = digiInME(st, 4);
   if (lct_n == 999) return false;//no stub in Station
   
-  auto lct(triggerDigis_.at(lct_n));
-  auto id(triggerIds_.at(lct_n));
-  //std::cout <<" id " << id << " LCT " << (*lct) << std::endl;
-  double dphi = lct->getGEMDPhi();
-  bool is_odd(id.chamber()%2==1);
-  bool pass = false;
-  unsigned int LUTsize = (st==1)? sizeof(ME11GEMdPhi)/sizeof(ME11GEMdPhi[0]) :sizeof(ME21GEMdPhi)/sizeof(ME21GEMdPhi[0]);
-  bool smalldphi = ((is_odd and fabs(dphi)<GEMdPhi[LUTsize-2][1]) || (!is_odd and fabs(dphi)<GEMdPhi[LUTsize-2][2]));
-  if (fabs(dphi) < 99 and ((chargesign_ == 1 and dphi < 0) || (chargesign_ == 0 and dphi > 0) || smalldphi)){
-   for (unsigned int b = 0; b < LUTsize; b++)
-   {
-  //      if (st==2)  std::cout <<"TFTrack  LUTpt "<< GEMdPhi[b][0] << " odd " << GEMdPhi[b][1]  <<" even " << GEMdPhi[b][2] <<" dphi "<< dphi <<std::endl;
-	if (double(pt) >= GEMdPhi[b][0])
-	{
-		
-	    if ((is_odd && GEMdPhi[b][1] > fabs(dphi)) ||
-		(!is_odd && GEMdPhi[b][2] > fabs(dphi)))
-		    pass = true;
-	    else    pass = false;
-	}
-    }
-  }
-  else pass = false;
-//if (st==2 and pass) std::cout <<"TFTrack st=2 and pass dphi after comparing with LUT " << std::endl;
- // else if (st==2 and !pass) std::cout <<"TFTrack st=2 and failed to pass dphi after comparing " << std::endl;
-  //if (st==2 and pt>=15 and ((is_odd and fabs(dphi)<GEMdPhi[4][1]) || (!is_odd and fabs(dphi)<GEMdPhi[4][2]))) pass = true;
- // if (st==2 and pass) std::cout <<"TFTrack st=2 and pass dphi after pt>15 " << std::endl;
-//  else if (st==2 and !pass) std::cout <<"TFTrack st=2 and failed to pass dphi after pt>15 " << std::endl;
-
-   return pass;
-
+  auto lct(triggerDigis_[lct_n]);
+  const CSCDetId& id(triggerIds_[lct_n]);
+  // no ME2/1 high-pT relaxation at track level
+  return lut.pass(id, chargesign_, lct->getGEMDPhi(), pt, eta_, false);
 }
 
 
 
 
+// at most one stub per station: the stubs beyond MaxStubs are dropped
+
 void 
 TFTrack::addTriggerDigi(const CSCCorrelatedLCTDigi* digi)
 {
-  triggerDigis_.push_back(digi);
+  if (nTriggerDigis_ < MaxStubs) triggerDigis_[nTriggerDigis_++] = digi;
 }
 
 void 
 TFTrack::addTriggerDigiId(const CSCDetId& id)
 {
-  triggerIds_.push_back(id);
+  if (nTriggerIds_ < MaxStubs) triggerIds_[nTriggerIds_++] = id;
 }
 
 void 
 TFTrack::addTriggerEtaPhi(const std::pair<float,float>& p)
 {
-  triggerEtaPhis_.push_back(p);
+  if (nTriggerEtaPhis_ < MaxStubs) triggerEtaPhis_[nTriggerEtaPhis_++] = p;
 }
 
 void 
 TFTrack::addTriggerStub(const csctf::TrackStub& st)
 {
-  triggerStubs_.push_back(st);
+  if (nTriggerStubs_ < MaxStubs) triggerStubs_[nTriggerStubs_++] = st;
 }
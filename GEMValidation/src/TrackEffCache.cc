@@ -0,0 +1,165 @@
+#include "GEMCode/GEMValidation/interface/TrackEffCache.h"
+#include "FWCore/Utilities/interface/Exception.h"
+
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// bump when the layout of the cache files changes
+const uint64_t CACHE_VERSION = 1;
+
+// FNV-1a
+struct Hasher
+{
+  uint64_t h = 14695981039346656037ULL;
+
+  void add(uint64_t v)
+  {
+    for (int i = 0; i < 8; ++i) {
+      h ^= (v >> (8*i)) & 0xff;
+      h *= 1099511628211ULL;
+    }
+  }
+  void add(const std::string& s)
+  {
+    add(static_cast<uint64_t>(s.size()));
+    for (unsigned char c: s) {
+      h ^= c;
+      h *= 1099511628211ULL;
+    }
+  }
+};
+
+std::string tmpPath(const std::string& path)
+{
+  std::ostringstream s;
+  s << path << ".tmp" << ::getpid();
+  return s.str();
+}
+
+}
+
+
+TrackEffCache::TrackEffCache(const std::string& dir, const std::string& config, const std::vector<std::string>& stations)
+: dir_(dir)
+, stations_(stations)
+, keys_(stations.size(), 0)
+, writers_(stations.size())
+{
+  Hasher hs;
+  hs.add(CACHE_VERSION);
+  hs.add(static_cast<uint64_t>(sizeof(TrackEffRecord)));
+  hs.add(config);
+  configKey_ = hs.h;
+  ::mkdir(dir_.c_str(), 0755);
+}
+
+
+TrackEffCache::~TrackEffCache()
+{
+  abortBlock();
+}
+
+
+std::string
+TrackEffCache::path(unsigned int station) const
+{
+  std::ostringstream s;
+  s << dir_ << "/trkeff_" << stations_[station] << "_" << std::hex << keys_[station] << ".bin";
+  return s.str();
+}
+
+
+void
+TrackEffCache::beginBlock(const std::string& inputFile, const std::string& processHistory,
+                          unsigned int run, unsigned int lumi, const std::string& conditions)
+{
+  abortBlock();
+  for (unsigned int s = 0; s < stations_.size(); ++s) {
+    Hasher hs;
+    hs.add(configKey_);
+    hs.add(inputFile);
+    hs.add(processHistory);
+    hs.add(static_cast<uint64_t>(run));
+    hs.add(static_cast<uint64_t>(lumi));
+    hs.add(conditions);
+    hs.add(stations_[s]);
+    keys_[s] = hs.h;
+  }
+}
+
+
+std::unique_ptr<TrackEffRecordFile>
+TrackEffCache::cached(unsigned int station) const
+{
+  std::unique_ptr<TrackEffRecordFile> rows;
+  const std::string file(path(station));
+  if (::access(file.c_str(), R_OK) != 0) return rows;
+  try {
+    rows.reset(new TrackEffRecordFile(file));
+  }
+  catch (cms::Exception& e) {
+    std::cout << "TrackEffCache: ignoring invalid cache file " << file << std::endl;
+  }
+  return rows;
+}
+
+
+void
+TrackEffCache::record(unsigned int station)
+{
+  const std::string file(tmpPath(path(station)));
+  try {
+    writers_[station].reset(new TrackEffRecordWriter(file, stations_));
+  }
+  catch (cms::Exception& e) {
+    std::cout << "TrackEffCache: cannot write " << file << ", the block will not be cached" << std::endl;
+  }
+}
+
+
+void
+TrackEffCache::write(unsigned int station, unsigned int track, const MyTrackEff& eff)
+{
+  if (!recording(station)) return;
+  try {
+    writers_[station]->write(station, track, eff);
+  }
+  catch (cms::Exception& e) {
+    writers_[station].reset();
+    std::remove(tmpPath(path(station)).c_str());
+    std::cout << "TrackEffCache: cannot write " << tmpPath(path(station)) << ", the block will not be cached" << std::endl;
+  }
+}
+
+
+void
+TrackEffCache::endBlock()
+{
+  for (unsigned int s = 0; s < writers_.size(); ++s) {
+    if (!writers_[s]) continue;
+    const std::string file(path(s)), tmp(tmpPath(file));
+    const bool ok(writers_[s]->close() and std::rename(tmp.c_str(), file.c_str()) == 0);
+    if (!ok) {
+      std::remove(tmp.c_str());
+      std::cout << "TrackEffCache: cannot write " << file << std::endl;
+    }
+    writers_[s].reset();
+  }
+}
+
+
+void
+TrackEffCache::abortBlock()
+{
+  for (unsigned int s = 0; s < writers_.size(); ++s) {
+    if (!writers_[s]) continue;
+    writers_[s].reset();
+    std::remove(tmpPath(path(s)).c_str());
+  }
+}
@@ -0,0 +1,143 @@
+#include "GEMCode/GEMValidation/interface/TrackEffRecord.h"
+#include "FWCore/Utilities/interface/Exception.h"
+
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <type_traits>
+#include <unistd.h>
+
+namespace {
+
+const char record_magic[8] = {'G', 'E', 'M', 'T', 'R', 'K', 'E', 'F'};
+const uint32_t record_version = 2;
+
+static_assert(std::is_trivially_copyable<MyTrackEff>::value, "MyTrackEff records are raw copies");
+static_assert(sizeof(TrackEffRecordHeader) % 8 == 0, "records must stay aligned after the header");
+
+}
+
+
+TrackEffRecordWriter::TrackEffRecordWriter(const std::string& fileName, const std::vector<std::string>& stations,
+                                           const std::vector<std::string>& dPhiWorkingPoints)
+: file_(std::fopen(fileName.c_str(), "wb"))
+, fileName_(fileName)
+, nRecords_(0)
+{
+  if (!file_) throw cms::Exception("TrackEffRecord") << "cannot open " << fileName << " for writing";
+  if (stations.size() > TrackEffRecordHeader::MaxStations)
+    throw cms::Exception("TrackEffRecord") << "too many stations: " << stations.size();
+  if (dPhiWorkingPoints.size() > MyTrackEff::MaxDPhiWorkingPoints)
+    throw cms::Exception("TrackEffRecord") << "too many dPhi working points: " << dPhiWorkingPoints.size();
+
+  TrackEffRecordHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, record_magic, sizeof(header.magic));
+  header.version = record_version;
+  header.recordSize = sizeof(TrackEffRecord);
+  header.nStations = stations.size();
+  for (unsigned int s = 0; s < stations.size(); ++s)
+    std::strncpy(header.stations[s], stations[s].c_str(), TrackEffRecordHeader::MaxNameLength - 1);
+  header.nDPhiWorkingPoints = dPhiWorkingPoints.size();
+  for (unsigned int w = 0; w < dPhiWorkingPoints.size(); ++w)
+    std::strncpy(header.dPhiWorkingPoints[w], dPhiWorkingPoints[w].c_str(), TrackEffRecordHeader::MaxNameLength - 1);
+  if (std::fwrite(&header, sizeof(header), 1, file_) != 1)
+    throw cms::Exception("TrackEffRecord") << "cannot write to " << fileName;
+}
+
+
+TrackEffRecordWriter::~TrackEffRecordWriter()
+{
+  close();
+}
+
+
+bool
+TrackEffRecordWriter::close()
+{
+  if (!file_) return false;
+  const bool ok(std::fclose(file_) == 0);
+  file_ = 0;
+  return ok;
+}
+
+
+void
+TrackEffRecordWriter::write(unsigned int station, unsigned int track, const MyTrackEff& eff)
+{
+  if (!file_) throw cms::Exception("TrackEffRecord") << fileName_ << " is already closed";
+  TrackEffRecord record;
+  std::memset(&record, 0, sizeof(record));
+  record.station = station;
+  record.track = track;
+  record.eff = eff;
+  if (std::fwrite(&record, sizeof(record), 1, file_) != 1)
+    throw cms::Exception("TrackEffRecord") << "cannot write to " << fileName_;
+  ++nRecords_;
+}
+
+
+TrackEffRecordFile::TrackEffRecordFile(const std::string& fileName)
+: data_(0)
+, length_(0)
+, header_(0)
+, records_(0)
+, nRecords_(0)
+{
+  const int fd(::open(fileName.c_str(), O_RDONLY));
+  if (fd < 0) throw cms::Exception("TrackEffRecord") << "cannot open " << fileName;
+  struct stat st;
+  if (::fstat(fd, &st) != 0 or size_t(st.st_size) < sizeof(TrackEffRecordHeader)) {
+    ::close(fd);
+    throw cms::Exception("TrackEffRecord") << fileName << " is not a track efficiency record file";
+  }
+  length_ = st.st_size;
+  data_ = ::mmap(0, length_, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (data_ == MAP_FAILED) {
+    data_ = 0;
+    throw cms::Exception("TrackEffRecord") << "cannot map " << fileName;
+  }
+
+  header_ = static_cast<const TrackEffRecordHeader*>(data_);
+  std::string error;
+  if (std::memcmp(header_->magic, record_magic, sizeof(record_magic)) != 0 or header_->version != record_version)
+    error = " is not a track efficiency record file (version 2)";
+  else if (header_->recordSize != sizeof(TrackEffRecord))
+    error = " was written with another MyTrackEff layout";
+  if (!error.empty()) {
+    ::munmap(data_, length_);
+    data_ = 0;
+    throw cms::Exception("TrackEffRecord") << fileName << error;
+  }
+
+  records_ = reinterpret_cast<const TrackEffRecord*>(static_cast<const char*>(data_) + sizeof(TrackEffRecordHeader));
+  // a file still being written may end with a partial record
+  nRecords_ = (length_ - sizeof(TrackEffRecordHeader))/sizeof(TrackEffRecord);
+}
+
+
+TrackEffRecordFile::~TrackEffRecordFile()
+{
+  if (data_) ::munmap(data_, length_);
+}
+
+
+std::string
+TrackEffRecordFile::stationName(unsigned int station) const
+{
+  if (station >= header_->nStations) return "";
+  return std::string(header_->stations[station], strnlen(header_->stations[station], TrackEffRecordHeader::MaxNameLength));
+}
+
+
+std::vector<std::string>
+TrackEffRecordFile::dPhiWorkingPoints() const
+{
+  std::vector<std::string> names;
+  for (unsigned int w = 0; w < header_->nDPhiWorkingPoints and w < MyTrackEff::MaxDPhiWorkingPoints; ++w)
+    names.push_back(std::string(header_->dPhiWorkingPoints[w],
+                                strnlen(header_->dPhiWorkingPoints[w], TrackEffRecordHeader::MaxNameLength)));
+  return names;
+}
@@ -19,6 +19,7 @@ TrackMatcher::TrackMatcher(SimHitMatcher& sh, CSCDigiMatcher& csc_dg,
   verboseTFTrack_ = tfTrack.getParameter<int>("verbose");
   deltaRTFTrack_ = tfTrack.getParameter<double>("deltaR");
   runTFTrack_ = tfTrack.getParameter<bool>("run");
+  matchTFTrackByDeltaR_ = tfTrack.getParameter<bool>("matchByDeltaR");
   
   auto tfCand = conf().getParameter<edm::ParameterSet>("cscTfCand");
   // cscTfCandInputLabel_ = tfCand.getParameter<edm::InputTag>("input");
@@ -169,7 +170,7 @@ TrackMatcher::init()
 
   // tracks produced by TF
   edm::Handle<L1CSCTrackCollection> hl1Tracks;
-  if (runTFTrack_) {
+  if (runTFTrack_ and matchTFTrackByDeltaR_) {
     event().getByLabel(cscTfTrackInputLabel_,hl1Tracks);
     matchTfTrackToSimTrack(*hl1Tracks.product());
   }
@@ -218,10 +219,7 @@ TrackMatcher::matchTfTrackToSimTrack(const L1CSCTrackCollection& tracks)
       // simmuon.SetPtEtaPhiM(simPt, gp.eta(), gp.phi(), 1.057);
     }
     
-   //propagate simtrack to station2
-   float phi_cor = phiHeavyCorr(simPt, simEta, simPhi, simCharge); 
-   simmuon.SetPtEtaPhiM(simPt, simEta, phi_cor, 0.1057);
-   dR = simmuon.DeltaR(templ1muon);
+   dR = deltaR(*track);
    /*  auto lcts2(lctsInStation(2));
     auto lcts3(lctsInStation(3));
     lcts2.insert(lcts2.end(),lcts3.begin(),lcts3.end());
@@ -314,6 +312,19 @@ TrackMatcher::matchTfTrackToSimTrack(const L1CSCTrackCollection& tracks)
   
 }
 
+double
+TrackMatcher::deltaR(const TFTrack& track) const
+{
+  TLorentzVector l1muon;
+  l1muon.SetPtEtaPhiM(track.pt(), track.eta(), track.phi(), 0.1057);
+
+  //propagate simtrack to station2
+  TLorentzVector simmuon;
+  const float phi_cor(phiHeavyCorr(simPt, simEta, simPhi, simCharge));
+  simmuon.SetPtEtaPhiM(simPt, simEta, phi_cor, 0.1057);
+  return simmuon.DeltaR(l1muon);
+}
+
 void 
 TrackMatcher::matchTfCandToSimTrack(const L1MuRegionalCandCollection& tracks)
 {
@@ -578,7 +589,7 @@ bool TrackMatcher::passDPhicut_TFTrack(int st) const
 */
 
 std::pair<float, float> 
-TrackMatcher::intersectionEtaPhi(CSCDetId id, int wg, int hs)
+TrackMatcher::intersectionEtaPhi(CSCDetId id, int wg, int hs) const
 {
   const CSCDetId layerId(id.endcap(), id.station(), id.ring(), id.chamber(), CSCConstants::KEY_CLCT_LAYER);
   const CSCLayer* csclayer(getCSCGeometry()->layer(layerId));
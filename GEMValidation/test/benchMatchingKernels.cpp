@@ -0,0 +1,594 @@
+// Micro-benchmarks of the matching and trigger-helper kernels that run
+// without an event: position-based pT assignment (scalar and batch), the
+// GEM-CSC dPhi cuts, the event-level SimTrack-L1 association, the dense
+// histogram fills of the efficiency/occupancy modules, and the event-free
+// parts of the matchers:
+//  - SimHitMatcher/GEMDigiMatcher: GE1/1 pads and 2-layer co-pads of the
+//    SimHits as GEMPadBits, and the test of the pad digis against them
+//  - CSCStubMatcher: collection of the (MP)LCTs of a chamber, with ghosts
+//  - FastGEMCSCBuilder: straight line fit of the SimHits of a chamber
+//  - MuSimHitOccupancy: recursive clustering of the CSC SimHits of a layer
+//
+// The inputs of every kernel are synthesized for three scenarios with the
+// per-event populations of a single muon gun, PU140 and PU200 samples (see
+// scenarios below), so no cmsRun and no input file is needed. For every
+// kernel and scenario the time, number of heap allocations and allocated
+// bytes per call (one call = one event) are reported. Results can be written
+// to a JSON file, together with the release and the machine they were
+// measured with, and compared with the JSON of another build:
+//
+//   benchMatchingKernels [--repeat n] [--json out.json] [--baseline ref.json]
+//
+// benchMatchingKernels_baseline.json holds the reference results kept with
+// the code: write it with --json in a release area, and again when a kernel
+// changes on purpose.
+
+#include "GEMCode/GEMValidation/interface/Ptassignment.h"
+#include "GEMCode/GEMValidation/interface/GEMCSCdPhiLUT.h"
+#include "GEMCode/GEMValidation/interface/SimTrackL1Association.h"
+#include "GEMCode/GEMValidation/interface/GEMPadBits.h"
+#include "GEMCode/GEMValidation/interface/CSCStubMatcher.h"
+#include "GEMCode/GEMValidation/interface/FastGEMCSCBuilder.h"
+#include "GEMCode/SimMuL1/interface/DenseHistograms.h"
+#include "GEMCode/SimMuL1/interface/MuNtupleClasses.h"
+
+#include "CLHEP/Random/JamesRandom.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/utsname.h>
+
+// ---- allocation counting -----------------------------------------------------
+
+namespace {
+unsigned long long nAllocs = 0;
+unsigned long long nAllocBytes = 0;
+}
+
+void* operator new(std::size_t n)
+{
+  ++nAllocs;
+  nAllocBytes += n;
+  if (void* p = std::malloc(n ? n : 1)) return p;
+  throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+// ---- scenarios -----------------------------------------------------------------
+
+struct Scenario
+{
+  const char* name;
+  // endcap L1 candidates (3-station pT assignment and association)
+  unsigned int nCandidates;
+  // good SimTracks to associate
+  unsigned int nSimTracks;
+  // ME1/1 and ME2/1 chambers with an LCT, and GEM pads per such chamber
+  unsigned int nGEMChambers;
+  unsigned int nPadsPerChamber;
+  // histogram fills per event in an efficiency/occupancy module
+  unsigned int nFills;
+  // GE1/1 eta partitions with SimHits in both layers, SimHit pads per layer
+  // and pad digis per partition
+  unsigned int nPadPartitions;
+  unsigned int nPadHitsPerPartition;
+  unsigned int nPadDigisPerPartition;
+  // CSC chambers with LCTs, and LCTs per chamber
+  unsigned int nLCTChambers;
+  unsigned int nLCTsPerChamber;
+  // chambers crossed by the SimTracks with enough layers for a SimStub
+  unsigned int nStubChambers;
+  // CSC layers with SimHits, and SimHits per layer
+  unsigned int nClusterLayers;
+  unsigned int nHitsPerLayer;
+};
+
+// rough per-event populations: a single muon crosses 4 stations with one
+// LCT and a couple of pads in front of ME1/1 and ME2/1; at PU140/PU200 the
+// neutron background adds of order 10-20 pads per chamber and many L1
+// candidates and simhits to histogram
+const Scenario scenarios[] = {
+  {"MuGun", 1, 1, 2, 2, 60, 2, 2, 2, 4, 2, 4, 24, 1},
+  {"PU140", 12, 2, 30, 12, 2000, 60, 6, 8, 40, 3, 8, 600, 4},
+  {"PU200", 18, 2, 45, 18, 3000, 90, 8, 12, 60, 4, 8, 900, 5},
+};
+
+// ---- harness -------------------------------------------------------------------
+
+struct Result
+{
+  std::string kernel;
+  std::string scenario;
+  double nsPerCall;
+  double allocsPerCall;
+  double bytesPerCall;
+};
+
+// runs setup once, then call nRepeat times (after a few warm-up calls)
+Result run(const std::string& kernel, const Scenario& sc, unsigned int nRepeat, const std::function<void()>& call)
+{
+  for (unsigned int i = 0; i < 3; ++i) call();
+  const unsigned long long a0(nAllocs), b0(nAllocBytes);
+  const auto t0 = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < nRepeat; ++i) call();
+  const auto t1 = std::chrono::steady_clock::now();
+  Result r;
+  r.kernel = kernel;
+  r.scenario = sc.name;
+  r.nsPerCall = std::chrono::duration<double, std::nano>(t1 - t0).count()/nRepeat;
+  r.allocsPerCall = double(nAllocs - a0)/nRepeat;
+  r.bytesPerCall = double(nAllocBytes - b0)/nRepeat;
+  return r;
+}
+
+// release and machine of a set of results
+struct Environment
+{
+  std::string release, arch, machine, cpu;
+  unsigned int threads;
+};
+
+Environment currentEnvironment()
+{
+  Environment env;
+  const char* release(std::getenv("CMSSW_VERSION"));
+  const char* arch(std::getenv("SCRAM_ARCH"));
+  env.release = release ? release : "";
+  env.arch = arch ? arch : "";
+  struct utsname u;
+  if (uname(&u) == 0) env.machine = std::string(u.nodename) + " " + u.sysname + " " + u.release + " " + u.machine;
+  std::ifstream cpuinfo("/proc/cpuinfo");
+  std::string line;
+  while (env.cpu.empty() and std::getline(cpuinfo, line)) {
+    if (line.compare(0, 10, "model name")) continue;
+    const size_t p(line.find(": "));
+    if (p != std::string::npos) env.cpu = line.substr(p + 2);
+  }
+  env.threads = std::thread::hardware_concurrency();
+  return env;
+}
+
+// one result per line, so that the files diff well and are easy to read back
+void writeJSON(const std::string& file, const Environment& env, const std::vector<Result>& results)
+{
+  std::ofstream out(file.c_str());
+  out << "{\"release\": \"" << env.release << "\", \"arch\": \"" << env.arch << "\"," << std::endl;
+  out << " \"machine\": \"" << env.machine << "\", \"cpu\": \"" << env.cpu << "\", \"threads\": " << env.threads << "," << std::endl;
+  out << " \"benchmarks\": [" << std::endl;
+  for (unsigned int i = 0; i < results.size(); ++i) {
+    const Result& r(results[i]);
+    out << "  {\"kernel\": \"" << r.kernel << "\", \"scenario\": \"" << r.scenario << "\", "
+        << "\"ns_per_call\": " << r.nsPerCall << ", \"allocs_per_call\": " << r.allocsPerCall << ", "
+        << "\"bytes_per_call\": " << r.bytesPerCall << "}" << (i + 1 < results.size() ? "," : "") << std::endl;
+  }
+  out << "]}" << std::endl;
+}
+
+std::string field(const std::string& line, const std::string& key)
+{
+  const std::string k("\"" + key + "\": ");
+  const size_t p(line.find(k));
+  if (p == std::string::npos) return "";
+  size_t b(p + k.size()), e;
+  if (line[b] == '"') e = line.find('"', ++b);
+  else e = line.find_first_of(",}", b);
+  return line.substr(b, e - b);
+}
+
+// kernel/scenario -> result, from a file written by writeJSON
+std::map<std::string, Result> readJSON(const std::string& file, Environment& env)
+{
+  std::map<std::string, Result> results;
+  std::ifstream in(file.c_str());
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.find("\"release\": ") != std::string::npos) {
+      env.release = field(line, "release");
+      env.arch = field(line, "arch");
+    }
+    if (line.find("\"machine\": ") != std::string::npos) {
+      env.machine = field(line, "machine");
+      env.cpu = field(line, "cpu");
+      env.threads = std::atoi(field(line, "threads").c_str());
+    }
+    Result r;
+    r.kernel = field(line, "kernel");
+    r.scenario = field(line, "scenario");
+    if (r.kernel.empty()) continue;
+    r.nsPerCall = std::atof(field(line, "ns_per_call").c_str());
+    r.allocsPerCall = std::atof(field(line, "allocs_per_call").c_str());
+    r.bytesPerCall = std::atof(field(line, "bytes_per_call").c_str());
+    results[r.kernel + "/" + r.scenario] = r;
+  }
+  return results;
+}
+
+// ---- fixtures ------------------------------------------------------------------
+
+// 3-station endcap candidates at z ~ 570, 800, 950 cm bent by a random amount in phi
+struct Candidates
+{
+  Candidates(unsigned int n, std::mt19937& rng)
+  : x1(n), y1(n), x2(n), y2(n), x3(n), y3(n), eta(n), parity(n), pt(n)
+  {
+    std::uniform_real_distribution<float> uPhi(-M_PI, M_PI), uEta(1.55, 2.45), uBend(-0.02, 0.02);
+    std::uniform_int_distribution<int> uParity(0, 3);
+    float* xs[3] = {&x1[0], &x2[0], &x3[0]};
+    float* ys[3] = {&y1[0], &y2[0], &y3[0]};
+    for (unsigned int i = 0; i < n; ++i) {
+      eta[i] = uEta(rng);
+      parity[i] = uParity(rng);
+      const float phi(uPhi(rng)), bend(uBend(rng));
+      const float theta(2*std::atan(std::exp(-eta[i])));
+      for (int s = 0; s < 3; ++s) {
+        const float r(z[s]*std::tan(theta)), p(phi + s*bend);
+        xs[s][i] = r*std::cos(p);
+        ys[s][i] = r*std::sin(p);
+      }
+    }
+  }
+  static constexpr float z[3] = {570., 800., 950.};
+  std::vector<float> x1, y1, x2, y2, x3, y3, eta;
+  std::vector<int> parity;
+  std::vector<float> pt;
+};
+constexpr float Candidates::z[3];
+
+// LCT-pad dphi values of the chambers with GEMs
+struct PadPairs
+{
+  PadPairs(const Scenario& sc, std::mt19937& rng)
+  : dphi(sc.nGEMChambers*sc.nPadsPerChamber), pass(dphi.size())
+  {
+    std::uniform_real_distribution<float> uDPhi(-0.02, 0.02), uPt(2., 50.), uEta(1.6, 2.4);
+    std::uniform_int_distribution<int> uChamber(1, 36), uCharge(0, 1);
+    for (auto& d: dphi) d = uDPhi(rng);
+    for (unsigned int c = 0; c < sc.nGEMChambers; ++c) {
+      ids.push_back(CSCDetId(1, c%2 ? 2 : 1, 1, uChamber(rng), 0));
+      charge.push_back(uCharge(rng));
+      pt.push_back(uPt(rng));
+      eta.push_back(uEta(rng));
+    }
+  }
+  std::vector<float> dphi;
+  std::vector<char> pass;
+  std::vector<CSCDetId> ids;
+  std::vector<int> charge;
+  std::vector<float> pt, eta;
+};
+
+// SimTrack reference points and L1 candidates around them
+struct AssociationInput
+{
+  AssociationInput(const Scenario& sc, std::mt19937& rng)
+  {
+    std::uniform_real_distribution<float> uPhi(-M_PI, M_PI), uEta(-2.4, 2.4), uSmear(-0.05, 0.05);
+    std::uniform_int_distribution<int> uBX(-1, 1), uCharge(0, 1);
+    for (unsigned int i = 0; i < sc.nSimTracks; ++i) {
+      SimTrackL1Association::Reference r;
+      r.eta = uEta(rng);
+      r.phi = uPhi(rng);
+      r.charge = uCharge(rng) ? 1 : -1;
+      r.valid = true;
+      refs.push_back(r);
+    }
+    // one candidate per SimTrack, the others anywhere
+    for (unsigned int j = 0; j < sc.nCandidates; ++j) {
+      const bool near(j < refs.size());
+      eta.push_back(near ? refs[j].eta + uSmear(rng) : uEta(rng));
+      phi.push_back(near ? refs[j].phi + uSmear(rng) : uPhi(rng));
+      bx.push_back(uBX(rng));
+      charge.push_back(uCharge(rng) ? 1 : -1);
+    }
+    ps.addParameter<double>("deltaR", 0.2);
+    ps.addParameter<int>("minBX", -1);
+    ps.addParameter<int>("maxBX", 1);
+    ps.addParameter<double>("deltaBXCost", 0.05);
+    ps.addParameter<double>("chargeMismatchCost", 0.1);
+  }
+  std::vector<SimTrackL1Association::Reference> refs;
+  std::vector<float> eta, phi;
+  std::vector<int> bx, charge;
+  edm::ParameterSet ps;
+};
+
+// occupancy-like fills into a module with 1D and 2D histograms
+struct HistogramFills
+{
+  HistogramFills(const Scenario& sc, std::mt19937& rng)
+  {
+    for (int i = 0; i < 40; ++i) {
+      std::ostringstream name;
+      name << "h1_" << i;
+      h1.push_back(hists.book1D(name.str(), name.str(), 100, 0., 1000.));
+    }
+    for (int i = 0; i < 10; ++i) {
+      std::ostringstream name;
+      name << "h2_" << i;
+      h2.push_back(hists.book2D(name.str(), name.str(), 100, -1000., 1000., 100, -1000., 1000.));
+    }
+    std::uniform_real_distribution<float> uX(-1100., 1100.);
+    std::uniform_int_distribution<int> uH(0, 49);
+    for (unsigned int i = 0; i < sc.nFills; ++i) {
+      which.push_back(uH(rng));
+      x.push_back(uX(rng));
+      y.push_back(uX(rng));
+    }
+  }
+  DenseHistograms hists;
+  DenseHistograms::Buffer buffer;
+  std::vector<DenseHistograms::H1> h1;
+  std::vector<DenseHistograms::H2> h2;
+  std::vector<int> which;
+  std::vector<float> x, y;
+};
+
+// pads of the SimHits in both layers of GE1/1 partitions, and the pad digis
+// of the partitions
+struct PadHits
+{
+  PadHits(const Scenario& sc, std::mt19937& rng)
+  : layer1(sc.nPadPartitions), layer2(sc.nPadPartitions), digis(sc.nPadPartitions), copads(sc.nPadPartitions)
+  , nMatched(0)
+  {
+    std::uniform_int_distribution<int> uPad(1, GE11PadBits::size()), uNear(-2, 2);
+    for (unsigned int p = 0; p < sc.nPadPartitions; ++p) {
+      for (unsigned int h = 0; h < sc.nPadHitsPerPartition; ++h) {
+        layer1[p].push_back(uPad(rng));
+        // the layer 2 hit of the same particle is a couple of pads away at most
+        layer2[p].push_back(layer1[p].back() + uNear(rng));
+      }
+      // half of the digis come from the SimHits
+      for (unsigned int d = 0; d < sc.nPadDigisPerPartition; ++d)
+        digis[p].push_back(d%2 ? uPad(rng) : layer1[p][d%sc.nPadHitsPerPartition]);
+    }
+  }
+  std::vector<std::vector<int> > layer1, layer2, digis;
+  std::vector<GE11PadBits> copads;
+  unsigned int nMatched;
+};
+
+// LCTs of CSC chambers in and around the BX window of the matcher,
+// with pairs in the same BX that make ghosts
+struct LCTChambers
+{
+  LCTChambers(const Scenario& sc, std::mt19937& rng)
+  : nCollected(0)
+  {
+    std::uniform_int_distribution<int> uWG(0, 47), uHS(0, 159), uBX(minBX - 1, maxBX + 1), uQuality(3, 15);
+    for (unsigned int c = 0; c < sc.nLCTChambers; ++c) {
+      // c = 8*chamber + 4*endcap + station, so that the chambers are all different
+      const CSCDetId id(1 + (c/4)%2, 1 + c%4, 1, 1 + (c/8)%36, 0);
+      ids.push_back(id.rawId());
+      const int bx(uBX(rng));
+      for (unsigned int i = 0; i < sc.nLCTsPerChamber; ++i)
+        lcts.insertDigi(id, CSCCorrelatedLCTDigi(i + 1, 1, uQuality(rng), uWG(rng), uHS(rng), 10, 0, i%2 ? bx : uBX(rng)));
+    }
+  }
+  static const int minBX = 5, maxBX = 7;
+  std::vector<unsigned int> ids;
+  CSCCorrelatedLCTDigiCollection lcts;
+  unsigned int nCollected;
+};
+
+// SimHit entry points in the 6 layers of chambers crossed by a muon from the
+// origin, fitted as in FastGEMCSCBuilder::build
+struct StubHits
+{
+  StubHits(const Scenario& sc, std::mt19937& rng)
+  : engine(12345), dphi(sc.nStubChambers)
+  {
+    std::uniform_real_distribution<float> uPhi(-M_PI, M_PI), uEta(1.6, 2.4), uSmear(-0.1, 0.1);
+    for (unsigned int c = 0; c < sc.nStubChambers; ++c) {
+      const float phi(uPhi(rng)), theta(2*std::atan(std::exp(-uEta(rng))));
+      std::vector<GlobalPoint> chamber;
+      for (int l = 0; l < 6; ++l) {
+        const float z(zKey + 2.5*(l - 2.5)), r(z*std::tan(theta));
+        chamber.push_back(GlobalPoint(r*std::cos(phi) + uSmear(rng), r*std::sin(phi) + uSmear(rng), z));
+      }
+      points.push_back(chamber);
+    }
+    ps.addParameter<std::vector<double> >("zOddGEM", std::vector<double>(11, zGEM));
+    ps.addParameter<std::vector<double> >("zEvenGEM", std::vector<double>(11, zGEM));
+    ps.addParameter<std::vector<double> >("phiSmearCSC", std::vector<double>(11, -1.));
+    ps.addParameter<std::vector<double> >("phiSmearGEM", std::vector<double>(11, -1.));
+  }
+  static constexpr double zKey = 600., zGEM = 568.;
+  std::vector<std::vector<GlobalPoint> > points;
+  CLHEP::HepJamesRandom engine;
+  edm::ParameterSet ps;
+  std::vector<double> dphi;
+};
+constexpr double StubHits::zKey;
+constexpr double StubHits::zGEM;
+
+// CSC SimHits of the layers of the occupancy module: one muon or neutron
+// hit plus the hits it makes close by in wiregroup, strip and time
+struct LayerHits
+{
+  LayerHits(const Scenario& sc, std::mt19937& rng)
+  : layers(sc.nClusterLayers), nClusters(0)
+  {
+    std::uniform_int_distribution<int> uWG(1, 112), uStrip(1, 80), uNear(-3, 3);
+    std::uniform_real_distribution<float> uTOF(10., 500.), uDTOF(0., 3.);
+    for (auto& layer: layers) {
+      MyCSCSimHit h = MyCSCSimHit();
+      for (unsigned int i = 0; i < sc.nHitsPerLayer; ++i) {
+        // a new cluster every few hits
+        if (i%3 == 0) {
+          h.w = uWG(rng);
+          h.s = uStrip(rng);
+          h.t = uTOF(rng);
+        }
+        MyCSCSimHit hi(h);
+        hi.w += uNear(rng)/2;
+        hi.s += uNear(rng);
+        hi.t += uDTOF(rng);
+        layer.push_back(hi);
+      }
+    }
+  }
+  std::vector<std::vector<MyCSCSimHit> > layers;
+  unsigned int nClusters;
+};
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  unsigned int nRepeat = 2000;
+  std::string jsonFile, baselineFile;
+  for (int i = 1; i < argc; ++i) {
+    if (!std::strcmp(argv[i], "--repeat") and i + 1 < argc) nRepeat = std::atoi(argv[++i]);
+    else if (!std::strcmp(argv[i], "--json") and i + 1 < argc) jsonFile = argv[++i];
+    else if (!std::strcmp(argv[i], "--baseline") and i + 1 < argc) baselineFile = argv[++i];
+    else {
+      std::cerr << "usage: " << argv[0] << " [--repeat n] [--json out.json] [--baseline ref.json]" << std::endl;
+      return 1;
+    }
+  }
+
+  const Environment env(currentEnvironment());
+  std::vector<Result> results;
+  for (const Scenario& sc: scenarios) {
+    std::mt19937 rng(12345);
+
+    Candidates cands(sc.nCandidates, rng);
+    results.push_back(run("Ptassign_Position_gp", sc, nRepeat, [&]() {
+      for (unsigned int i = 0; i < sc.nCandidates; ++i)
+        cands.pt[i] = Ptassign_Position_gp(GlobalPoint(cands.x1[i], cands.y1[i], Candidates::z[0]),
+                                           GlobalPoint(cands.x2[i], cands.y2[i], Candidates::z[1]),
+                                           GlobalPoint(cands.x3[i], cands.y3[i], Candidates::z[2]),
+                                           cands.eta[i], cands.parity[i]);
+    }));
+    results.push_back(run("Ptassign_Position_batch", sc, nRepeat, [&]() {
+      const PositionPtInput in = {&cands.x1[0], &cands.y1[0], &cands.x2[0], &cands.y2[0],
+                                  &cands.x3[0], &cands.y3[0], &cands.eta[0], &cands.parity[0], sc.nCandidates};
+      Ptassign_Position_batch(in, &cands.pt[0]);
+    }));
+
+    PadPairs pads(sc, rng);
+    const GEMCSCdPhiLUT& lut(GEMCSCdPhiLUT::defaultLUT());
+    results.push_back(run("GEMCSCdPhiLUT::pass", sc, nRepeat, [&]() {
+      for (unsigned int c = 0; c < sc.nGEMChambers; ++c) {
+        const GEMCSCdPhiLUT::ChamberCut cut(lut.chamberCut(pads.ids[c], pads.charge[c], pads.pt[c], pads.eta[c]));
+        const unsigned int first(c*sc.nPadsPerChamber);
+        for (unsigned int i = first; i < first + sc.nPadsPerChamber; ++i)
+          pads.pass[i] = GEMCSCdPhiLUT::pass(cut, pads.dphi[i]);
+      }
+    }));
+
+    AssociationInput assoc(sc, rng);
+    results.push_back(run("SimTrackL1Association::solve", sc, nRepeat, [&]() {
+      SimTrackL1Association a(assoc.ps);
+      for (auto& r: assoc.refs) a.addSimTrack(r);
+      for (unsigned int j = 0; j < assoc.eta.size(); ++j)
+        a.addCandidate(assoc.eta[j], assoc.phi[j], assoc.bx[j], assoc.charge[j]);
+      a.solve();
+    }));
+
+    HistogramFills fills(sc, rng);
+    results.push_back(run("DenseHistograms::flush", sc, nRepeat, [&]() {
+      for (unsigned int i = 0; i < fills.which.size(); ++i) {
+        const int h(fills.which[i]);
+        if (h < 40) fills.buffer.fill(fills.h1[h], std::abs(fills.x[i]));
+        else fills.buffer.fill(fills.h2[h - 40], fills.x[i], fills.y[i]);
+      }
+      fills.hists.flush(fills.buffer);
+    }));
+
+    // SimHitMatcher pads and co-pads of a partition, GEMDigiMatcher test of its pad digis
+    PadHits padHits(sc, rng);
+    results.push_back(run("GEMPadBits::coincidence", sc, nRepeat, [&]() {
+      for (unsigned int p = 0; p < sc.nPadPartitions; ++p) {
+        GE11PadBits pads1, pads2;
+        for (int pad: padHits.layer1[p]) pads1.set(pad);
+        for (int pad: padHits.layer2[p]) pads2.set(pad);
+        padHits.copads[p] = GE11PadBits::coincidence(pads1, pads2, 1);
+        for (int pad: padHits.digis[p]) padHits.nMatched += pads1.test(pad) + padHits.copads[p].test(pad);
+      }
+    }));
+
+    LCTChambers lcts(sc, rng);
+    results.push_back(run("CSCStubMatcher::collectLCTsInChamber", sc, nRepeat, [&]() {
+      lcts.nCollected = 0;
+      for (auto id: lcts.ids) {
+        // fresh containers for every chamber, as in CSCStubMatcher::matchLCTsToSimTrack
+        matching::DigiContainer digis;
+        CSCCorrelatedLCTDigiContainer cscLcts;
+        std::vector<int> source;
+        CSCStubMatcher::collectLCTsInChamber(id, lcts.lcts, LCTChambers::minBX, LCTChambers::maxBX, true,
+                                             digis, cscLcts, source);
+        lcts.nCollected += digis.size();
+      }
+    }));
+
+    StubHits stubHits(sc, rng);
+    FastGEMCSCBuilder builder(stubHits.ps, stubHits.engine);
+    results.push_back(run("FastGEMCSCBuilder::fitStub", sc, nRepeat, [&]() {
+      for (unsigned int c = 0; c < sc.nStubChambers; ++c) {
+        SimStub stub(StubHits::zGEM);
+        builder.fitStub(stub, stubHits.points[c]);
+        GlobalPoint gp_csc(stub.globalPointAtZ(StubHits::zKey));
+        GlobalPoint gp_gem(stub.globalPointAtZ(StubHits::zGEM));
+        stub.setCSC(gp_csc);
+        stub.setGEMLinear(gp_gem);
+        stubHits.dphi[c] = stub.dPhiGEMCSCLinear();
+      }
+    }));
+
+    LayerHits layerHits(sc, rng);
+    results.push_back(run("clusterCSCSimHits", sc, nRepeat, [&]() {
+      layerHits.nClusters = 0;
+      for (auto& layer: layerHits.layers) {
+        // the module clusters a copy of the hits of every layer
+        std::vector<MyCSCSimHit> hits(layer);
+        layerHits.nClusters += clusterCSCSimHits(hits).size();
+      }
+    }));
+  }
+
+  std::map<std::string, Result> baseline;
+  Environment baselineEnv = Environment();
+  if (!baselineFile.empty()) baseline = readJSON(baselineFile, baselineEnv);
+
+  std::cout << "release " << (env.release.empty() ? "-" : env.release) << " " << env.arch
+            << ", " << env.cpu << ", " << env.threads << " threads" << std::endl;
+  if (!baselineFile.empty())
+    std::cout << "baseline " << (baselineEnv.release.empty() ? "-" : baselineEnv.release) << " " << baselineEnv.arch
+              << ", " << baselineEnv.cpu << ", " << baselineEnv.threads << " threads" << std::endl;
+
+  std::cout << std::left << std::setw(40) << "kernel" << std::setw(8) << "events"
+            << std::right << std::setw(14) << "ns/call" << std::setw(12) << "allocs" << std::setw(12) << "bytes";
+  if (!baseline.empty()) std::cout << std::setw(12) << "time/ref";
+  std::cout << std::endl;
+  for (auto& r: results) {
+    std::cout << std::left << std::setw(40) << r.kernel << std::setw(8) << r.scenario << std::right << std::fixed
+              << std::setprecision(1) << std::setw(14) << r.nsPerCall << std::setw(12) << r.allocsPerCall
+              << std::setw(12) << r.bytesPerCall;
+    auto ref(baseline.find(r.kernel + "/" + r.scenario));
+    if (ref != baseline.end() and ref->second.nsPerCall > 0.)
+      std::cout << std::setw(12) << std::setprecision(2) << r.nsPerCall/ref->second.nsPerCall;
+    std::cout << std::endl;
+  }
+
+  if (!jsonFile.empty()) writeJSON(jsonFile, env, results);
+  return 0;
+}
@@ -0,0 +1,69 @@
+// Timing of the scalar position-based pT assignment (Ptassign_Position_gp)
+// against Ptassign_Position_batch on synthetic 3-station candidates.
+//
+//   benchPtassignment [nCandidates] [nRepeat]
+
+#include "GEMCode/GEMValidation/interface/Ptassignment.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+  const unsigned int n = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  const unsigned int nRepeat = argc > 2 ? std::atoi(argv[2]) : 10;
+
+  std::mt19937 rng(12345);
+  std::uniform_real_distribution<float> uPhi(-M_PI, M_PI), uEta(1.55, 2.45), uBend(-0.02, 0.02);
+  std::uniform_int_distribution<int> uParity(0, 3);
+
+  // stations at z ~ 570, 800, 950 cm bent by a random amount in phi
+  std::vector<float> x1(n), y1(n), x2(n), y2(n), x3(n), y3(n), eta(n);
+  std::vector<int> parity(n);
+  const float z[3] = {570., 800., 950.};
+  for (unsigned int i = 0; i < n; ++i) {
+    eta[i] = uEta(rng);
+    parity[i] = uParity(rng);
+    const float phi(uPhi(rng)), bend(uBend(rng));
+    const float theta(2*std::atan(std::exp(-eta[i])));
+    float* xs[3] = {&x1[i], &x2[i], &x3[i]};
+    float* ys[3] = {&y1[i], &y2[i], &y3[i]};
+    for (int s = 0; s < 3; ++s) {
+      const float r(z[s]*std::tan(theta)), p(phi + s*bend);
+      *xs[s] = r*std::cos(p);
+      *ys[s] = r*std::sin(p);
+    }
+  }
+
+  std::vector<float> ptScalar(n), ptBatch(n);
+
+  auto t0 = std::chrono::steady_clock::now();
+  for (unsigned int r = 0; r < nRepeat; ++r) {
+    for (unsigned int i = 0; i < n; ++i) {
+      ptScalar[i] = Ptassign_Position_gp(GlobalPoint(x1[i], y1[i], z[0]), GlobalPoint(x2[i], y2[i], z[1]),
+                                         GlobalPoint(x3[i], y3[i], z[2]), eta[i], parity[i]);
+    }
+  }
+  auto t1 = std::chrono::steady_clock::now();
+
+  const PositionPtInput in = {&x1[0], &y1[0], &x2[0], &y2[0], &x3[0], &y3[0], &eta[0], &parity[0], n};
+  for (unsigned int r = 0; r < nRepeat; ++r) Ptassign_Position_batch(in, &ptBatch[0]);
+  auto t2 = std::chrono::steady_clock::now();
+
+  float maxRelDiff = 0.;
+  for (unsigned int i = 0; i < n; ++i) {
+    const float d(std::abs(ptScalar[i] - ptBatch[i])/std::max(1.f, std::abs(ptScalar[i])));
+    if (d > maxRelDiff) maxRelDiff = d;
+  }
+
+  const double norm = 1./(double(n)*nRepeat);
+  std::cout << "candidates: " << n << " x " << nRepeat << std::endl
+            << "scalar: " << std::chrono::duration<double, std::nano>(t1 - t0).count()*norm << " ns/candidate" << std::endl
+            << "batch:  " << std::chrono::duration<double, std::nano>(t2 - t1).count()*norm << " ns/candidate" << std::endl
+            << "max relative difference: " << maxRelDiff << std::endl;
+  return 0;
+}
@@ -0,0 +1,242 @@
+// Rebuilds the trk_eff_* trees of GEMCSCAnalyzer from a record file written in
+// capture mode (trackEffRecordFile), without cmsRun. The records are split in
+// equal ranges over the threads; every thread fills its own part file, and the
+// parts are merged at the end.
+//
+//   replayTrackEff input.bin output.root [--threads N] [--min-pt X] [--min-eta X] [--max-eta X]
+//                  [--dphi-lut default|cuts_cfg.py] [--dphi-pt X]
+//
+// The SimTrack selection can be tightened with respect to the one of the
+// capture job. The passdphi branches keep the values of the capture job,
+// unless --dphi-lut is given: "default" evaluates passdphi_odd/even again with
+// the default GEM-CSC bending angle cuts (GEMCSCdPhiLUT), and a configuration
+// file evaluates again the cuts it defines, as in the configuration of
+// GEMCSCAnalyzer:
+//
+//   process.dPhiLUT = dPhiLUTFromDict(...)                  # passdphi_odd/even
+//   process.dPhiWorkingPoints = cms.VPSet(dPhiWorkingPoint(...), ...)  # passdphi_<name>
+//
+// where the working points must have been captured under the same name. The
+// cuts are evaluated at the SimTrack pT, or at the fixed pT given with --dphi-pt.
+
+#include "GEMCode/GEMValidation/interface/TrackEffRecord.h"
+#include "GEMCode/GEMValidation/interface/GEMCSCdPhiLUT.h"
+#include "DataFormats/MuonDetId/interface/CSCDetId.h"
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
+#include "FWCore/PythonParameterSet/interface/MakeParameterSets.h"
+#include "FWCore/Utilities/interface/Exception.h"
+
+#include "TFile.h"
+#include "TFileMerger.h"
+#include "TROOT.h"
+#include "TTree.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// (station, ring) of the station numbers of the records, as cscStationsCo_ in GEMCSCAnalyzer
+const int station_ring[12][2] = {{-99,-99}, {1,-99}, {1,4}, {1,1}, {1,2}, {1,3},
+                                 {2,1}, {2,2}, {3,1}, {3,2}, {4,1}, {4,2}};
+
+struct Options
+{
+  unsigned int nThreads = std::thread::hardware_concurrency();
+  float minPt = 0.;
+  float minEta = 0.;
+  float maxEta = 99.;
+  std::string dphiLUT;
+  float dphiPt = -1.;
+};
+
+// cuts evaluated again, from --dphi-lut
+struct DPhiCuts
+{
+  // passdphi_odd/even; null to keep the captured values
+  std::unique_ptr<GEMCSCdPhiLUT> lut;
+  // (index in passdphi_wp, cuts) of the working points to evaluate again
+  std::vector<std::pair<unsigned int, GEMCSCdPhiLUT> > workingPoints;
+
+  bool empty() const { return !lut and workingPoints.empty(); }
+};
+
+DPhiCuts loadDPhiCuts(const std::string& name, const std::vector<std::string>& capturedWorkingPoints)
+{
+  DPhiCuts cuts;
+  if (name.empty()) return cuts;
+  if (name == "default") {
+    cuts.lut.reset(new GEMCSCdPhiLUT());
+    return cuts;
+  }
+  const edm::ParameterSet process(edm::readPSetsFrom(name)->getParameter<edm::ParameterSet>("process"));
+  if (process.exists("dPhiLUT"))
+    cuts.lut.reset(new GEMCSCdPhiLUT(process.getParameter<edm::ParameterSet>("dPhiLUT")));
+  if (process.exists("dPhiWorkingPoints")) {
+    for (auto& wp: process.getParameter<std::vector<edm::ParameterSet> >("dPhiWorkingPoints")) {
+      const std::string wpName(wp.getParameter<std::string>("name"));
+      auto w(std::find(capturedWorkingPoints.begin(), capturedWorkingPoints.end(), wpName));
+      if (w == capturedWorkingPoints.end())
+        throw cms::Exception("replayTrackEff") << "dPhi working point " << wpName << " of " << name
+                                               << " was not captured, its passdphi branch does not exist";
+      cuts.workingPoints.push_back(std::make_pair(w - capturedWorkingPoints.begin(), GEMCSCdPhiLUT(wp)));
+    }
+  }
+  if (cuts.empty())
+    throw cms::Exception("replayTrackEff") << name << " defines neither process.dPhiLUT nor process.dPhiWorkingPoints";
+  return cuts;
+}
+
+// chamber, charge sign and dphi of a passdphi bit, as in GEMCSCAnalyzer: bit 1 (2) the LCT in
+// the odd (even) chamber of a station, bit 4 (8) the GE11 (GE21) stub of the TF track of
+// station 0; false when the record has none
+bool dPhiStub(unsigned int st, UChar_t bit, const MyTrackEff& eff, CSCDetId& id, int& chargesign, float& dphi)
+{
+  const int endcap(eff.eta > 0 ? 1 : 2);
+  if (bit == 1 or bit == 2) {
+    const bool odd(bit == 1);
+    if (st < 1 or st >= 12 or !((odd ? eff.chamber_odd : eff.chamber_even) & 2)) return false;
+    const int ring(station_ring[st][1] == -99 ? 1 : station_ring[st][1]);
+    id = CSCDetId(endcap, station_ring[st][0], ring, odd ? 1 : 2, 0);
+    chargesign = eff.charge > 0 ? 1 : 0;
+    dphi = odd ? eff.dphi_lct_odd : eff.dphi_lct_even;
+    return true;
+  }
+  const bool ge11(bit == 4);
+  const int parities(ge11 ? eff.chamberME1 : eff.chamberME2);
+  if (st != 0 or parities == 0) return false;
+  id = CSCDetId(endcap, ge11 ? 1 : 2, ge11 ? eff.ME1_ring : eff.ME2_ring, (parities & 1) ? 1 : 2, 0);
+  chargesign = eff.chargesign;
+  dphi = ge11 ? eff.dphiGE11 : eff.dphiGE21;
+  return true;
+}
+
+void passDPhi(const DPhiCuts& cuts, unsigned int st, MyTrackEff& eff, const Options& opt)
+{
+  const float pt(opt.dphiPt > 0 ? opt.dphiPt : eff.pt);
+  for (auto& wp: cuts.workingPoints) eff.passdphi_wp[wp.first] = 0;
+  for (UChar_t bit = 1; bit <= 8; bit <<= 1) {
+    CSCDetId id;
+    int chargesign;
+    float dphi;
+    if (!dPhiStub(st, bit, eff, id, chargesign, dphi)) continue;
+    if (cuts.lut and bit == 1) eff.passdphi_odd = cuts.lut->pass(id, chargesign, dphi, pt, eff.eta);
+    if (cuts.lut and bit == 2) eff.passdphi_even = cuts.lut->pass(id, chargesign, dphi, pt, eff.eta);
+    for (auto& wp: cuts.workingPoints)
+      if (wp.second.pass(id, chargesign, dphi, pt, eff.eta)) eff.passdphi_wp[wp.first] |= bit;
+  }
+}
+
+void replay(const TrackEffRecordFile& records, unsigned long long first, unsigned long long last,
+            const std::string& partName, const DPhiCuts& cuts, const Options& opt, unsigned long long& nFilled)
+{
+  TFile part(partName.c_str(), "RECREATE");
+  // all the trees share one row, a record is copied in before Fill
+  MyTrackEff eff;
+  eff.init();
+  const std::vector<std::string> workingPoints(records.dPhiWorkingPoints());
+  std::vector<TTree*> trees(records.nStations(), 0);
+  for (unsigned int s = 0; s < records.nStations(); ++s) {
+    const std::string name("trk_eff_" + records.stationName(s));
+    trees[s] = new TTree(name.c_str(), name.c_str());
+    eff.branches(trees[s], workingPoints);
+  }
+
+  nFilled = 0;
+  for (unsigned long long i = first; i < last; ++i) {
+    const TrackEffRecord& r(records[i]);
+    if (r.station >= trees.size()) continue;
+    if (r.eff.pt < opt.minPt or std::fabs(r.eff.eta) < opt.minEta or std::fabs(r.eff.eta) > opt.maxEta) continue;
+
+    eff = r.eff;
+    if (!cuts.empty()) passDPhi(cuts, r.station, eff, opt);
+    trees[r.station]->Fill();
+    ++nFilled;
+  }
+  part.Write();
+  part.Close();
+}
+
+}
+
+
+int main(int argc, char** argv)
+{
+  if (argc < 3) {
+    std::cout << "usage: replayTrackEff input.bin output.root [--threads N] [--min-pt X] [--min-eta X]"
+              << " [--max-eta X] [--dphi-lut default|cuts_cfg.py] [--dphi-pt X]" << std::endl;
+    return 1;
+  }
+  const std::string input(argv[1]), output(argv[2]);
+  Options opt;
+  for (int a = 3; a + 1 < argc; a += 2) {
+    const std::string o(argv[a]);
+    const double v(std::atof(argv[a+1]));
+    if (o == "--threads") opt.nThreads = v;
+    else if (o == "--min-pt") opt.minPt = v;
+    else if (o == "--min-eta") opt.minEta = v;
+    else if (o == "--max-eta") opt.maxEta = v;
+    else if (o == "--dphi-lut") opt.dphiLUT = argv[a+1];
+    else if (o == "--dphi-pt") opt.dphiPt = v;
+    else {
+      std::cout << "unknown option " << o << std::endl;
+      return 1;
+    }
+  }
+  if (opt.nThreads < 1) opt.nThreads = 1;
+
+  try {
+    const TrackEffRecordFile records(input);
+    std::cout << input << ": " << records.size() << " records, " << records.nStations() << " stations" << std::endl;
+    if (opt.nThreads > records.size()) opt.nThreads = std::max<unsigned long long>(records.size(), 1);
+    const DPhiCuts cuts(loadDPhiCuts(opt.dphiLUT, records.dPhiWorkingPoints()));
+
+    ROOT::EnableThreadSafety();
+    auto t0 = std::chrono::steady_clock::now();
+
+    std::vector<std::string> parts(opt.nThreads);
+    std::vector<unsigned long long> nFilled(opt.nThreads, 0);
+    std::vector<std::thread> threads;
+    const unsigned long long chunk((records.size() + opt.nThreads - 1)/opt.nThreads);
+    for (unsigned int t = 0; t < opt.nThreads; ++t) {
+      std::ostringstream ss;
+      ss << output << ".part" << t;
+      parts[t] = ss.str();
+      const unsigned long long first(std::min(records.size(), t*chunk));
+      const unsigned long long last(std::min(records.size(), first + chunk));
+      threads.emplace_back(replay, std::cref(records), first, last, parts[t], std::cref(cuts), std::cref(opt),
+                           std::ref(nFilled[t]));
+    }
+    for (auto& t: threads) t.join();
+
+    // parts in order, so that the rows keep the order of the capture job
+    TFileMerger merger(false);
+    merger.OutputFile(output.c_str(), "RECREATE");
+    for (auto& p: parts) merger.AddFile(p.c_str(), false);
+    const bool merged(merger.Merge());
+    for (auto& p: parts) std::remove(p.c_str());
+    if (!merged) {
+      std::cout << "cannot merge the parts into " << output << std::endl;
+      return 1;
+    }
+
+    unsigned long long n = 0;
+    for (auto f: nFilled) n += f;
+    const double dt(std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count());
+    std::cout << output << ": " << n << " rows filled with " << opt.nThreads << " threads in " << dt << " s" << std::endl;
+  }
+  catch (cms::Exception& e) {
+    std::cout << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
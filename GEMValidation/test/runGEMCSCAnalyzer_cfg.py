@@ -53,6 +53,11 @@ process.GEMCSCAnalyzer = cms.EDAnalyzer("GEMCSCAnalyzer",
     verbose = cms.untracked.int32(0),
     simTrackMatching = SimTrackMatching
 )
+## capture mode: also write the trk_eff rows to a record file, see test/replayTrackEff.cpp
+#process.GEMCSCAnalyzer.trackEffRecordFile = cms.untracked.string("out_ana_trkeff.bin")
+## reuse the trk_eff rows of the luminosity blocks already analyzed with the same inputs and
+## configuration (apart from cscStationsToUse); needs maxEvents = -1
+#process.GEMCSCAnalyzer.resultCacheDir = cms.untracked.string("gem_csc_cache")
 matching = process.GEMCSCAnalyzer.simTrackMatching
 matching.simTrack.minPt = 1.5
 matching.matchprint = cms.bool(False)
@@ -68,6 +73,18 @@ if doGem:
   matching.cscLCT.matchAlctGemME11 = True
   matching.cscLCT.matchAlctGemME21 = True
   matching.cscMPLCT.minNHitsChamber = 3
+## several GEM-CSC dPhi working points in the same pass, as passdphi_<name> bitmask branches:
+## Eff95/Eff98/Eff99 of GEMCSCdPhiDict, binned in the GE11-9-10 and GE21L eta partitions
+doDPhiWorkingPoints = False
+if doDPhiWorkingPoints:
+  from GEMCode.GEMValidation.simTrackMatching_cfi import dPhiLUTFromDict, dPhiWorkingPoint
+  from GEMCode.SimMuL1.GEMCSCdPhiDict import dphi_lct_pad
+  import os, sys
+  sys.path.append(os.path.expandvars('$CMSSW_BASE/src/GEMCode/SimMuL1/scripts'))
+  from cuts import eta_partitions
+  matching.dPhiWorkingPoints = cms.VPSet(
+    [dPhiWorkingPoint(eff, dPhiLUTFromDict(dphi_lct_pad, eff, eta_partitions['GE11-9-10'], eta_partitions['GE21L']))
+     for eff in ["Eff95", "Eff98", "Eff99"]])
 doRpc = False
 if doRpc:
   matching.cscLCT.matchAlctRpc = True
@@ -51,6 +51,8 @@ process.L1TTriggerRate = cms.EDAnalyzer('L1MuonTTriggerRate',
         maxPt = cms.double(100.0),
         minEta = cms.double(1.6),
         maxEta = cms.double(2.4),
+        ## pT thresholds of the passGE11_ptX/passGE21_ptX branches
+        dPhiPtThresholds = cms.untracked.vdouble(5, 7, 10, 15, 20, 30, 40),
     )
 process.pL1TAnalyser = cms.Path(process.L1TTriggerRate)
     
@@ -0,0 +1,33 @@
+import FWCore.ParameterSet.Config as cms
+
+## Muon-only slim skim of FEVTDEBUG files: the slim output is read by
+## runGEMCSCAnalyzer_cfg.py and the other validation jobs without changes
+## to their InputTags. No geometry nor GlobalTag is needed.
+
+## steering
+events = -1
+inputFile = 'file:out_hlt.test.root'
+outputFile = 'out_muon_slim.root'
+## process of the g4SimHits products in the input files
+simProcessName = 'SIM'
+## muons whose SimTrack families are kept
+minPt = 0.
+
+process = cms.Process("MUONSLIM")
+
+process.load("FWCore.MessageService.MessageLogger_cfi")
+process.MessageLogger.cerr.FwkReport.reportEvery = 100
+
+process.maxEvents = cms.untracked.PSet( input = cms.untracked.int32(events) )
+process.options = cms.untracked.PSet( wantSummary = cms.untracked.bool(True) )
+
+process.source = cms.Source("PoolSource",
+    fileNames = cms.untracked.vstring(inputFile)
+)
+
+from GEMCode.GEMValidation.muonSlimSkim_cff import addMuonSlimSkim
+process = addMuonSlimSkim(process, outputFile, simProcessName)
+process.g4SimHits.minPt = minPt
+#process.g4SimHits.verbose = 1
+## keep all the muon SimHits, e.g. for MuSimHitOccupancy
+#process.g4SimHits.pruneSimHits = False
@@ -0,0 +1,137 @@
+#ifndef SimMuL1_DenseHistograms_h
+#define SimMuL1_DenseHistograms_h
+
+/**\class DenseHistograms
+
+ Description: fixed-binning 1D/2D histograms of a module kept in one contiguous array
+
+ Booking returns a small handle instead of a TH1D/TH2D; the sums of weights
+ and of squared weights of all histograms live in a single arena, so a fill
+ is a bin computation and two additions, with no virtual call and no
+ pointer chasing. Fills can be collected in a Buffer while an event is
+ processed and applied in one pass. The TH1D/TH2D objects are only created
+ at the end of the job by materialize(), with the same names, binning,
+ contents, errors, entries and statistics as if they had been filled directly.
+
+   DenseHistograms hists;
+   DenseHistograms::Buffer fills;
+   DenseHistograms::H1 h_eta = hists.book1D("h_eta", "h_eta", 50, 0.9, 2.4);
+   ...
+   fills.fill(h_eta, eta);     // per track
+   hists.flush(fills);         // per event
+   ...
+   hists.materialize(*fs);     // endJob
+*/
+
+#include <string>
+#include <vector>
+
+class TFileDirectory;
+
+class DenseHistograms
+{
+public:
+
+  /// handles of the booked histograms
+  struct H1 { H1(): index(~0u) {} explicit H1(unsigned int i): index(i) {} unsigned int index; };
+  struct H2 { H2(): index(~0u) {} explicit H2(unsigned int i): index(i) {} unsigned int index; };
+
+  /// fills of one event, applied together by DenseHistograms::flush
+  class Buffer
+  {
+  public:
+    void fill(H1 h, double x, double w = 1.) { entries_.push_back(Entry(h.index, x, 0., w)); }
+    void fill(H2 h, double x, double y, double w = 1.) { entries_.push_back(Entry(h.index, x, y, w)); }
+    size_t size() const { return entries_.size(); }
+    void clear() { entries_.clear(); }
+
+  private:
+    friend class DenseHistograms;
+    struct Entry
+    {
+      Entry(unsigned int i, double xx, double yy, double ww): index(i), x(xx), y(yy), w(ww) {}
+      unsigned int index;
+      double x, y, w;
+    };
+    std::vector<Entry> entries_;
+  };
+
+  H1 book1D(const std::string& name, const std::string& title, int nx, double xmin, double xmax);
+  H2 book2D(const std::string& name, const std::string& title, int nx, double xmin, double xmax,
+            int ny, double ymin, double ymax);
+
+  void fill(H1 h, double x, double w = 1.) { fillCell(h.index, x, 0., w); }
+  void fill(H2 h, double x, double y, double w = 1.) { fillCell(h.index, x, y, w); }
+
+  /// applies and clears the buffered fills
+  void flush(Buffer& buffer);
+
+  /// creates the TH1D/TH2D objects in dir, with the accumulated contents
+  void materialize(TFileDirectory& dir) const;
+
+private:
+
+  struct Axis
+  {
+    Axis(): n(0), min(0.), max(0.) {}
+    Axis(int nbins, double xmin, double xmax): n(nbins), min(xmin), max(xmax) {}
+
+    // same expression as TAxis::FindFixBin, so that values on a bin edge
+    // land in the same bin as with TH1::Fill
+    int bin(double v) const
+    {
+      if (v < min) return 0;
+      if (!(v < max)) return n + 1;
+      return 1 + int(n*(v - min)/(max - min));
+    }
+
+    int n;
+    double min, max;
+  };
+
+  struct Spec
+  {
+    std::string name, title;
+    Axis x, y;
+    bool is2D;
+    // sums of weights at [offset, offset + ncells), sums of squared weights right after
+    size_t offset;
+    size_t ncells;
+    double entries;
+    // sumw, sumw2, sumwx, sumwx2, sumwy, sumwy2, sumwxy, as TH1::GetStats
+    double stats[7];
+    bool weighted;
+  };
+
+  unsigned int book(const std::string& name, const std::string& title, const Axis& x, const Axis& y, bool is2D);
+
+  void fillCell(unsigned int index, double x, double y, double w)
+  {
+    Spec& s = specs_[index];
+    const int bx = s.x.bin(x);
+    const int by = s.is2D ? s.y.bin(y) : 0;
+    const size_t cell = bx + (s.x.n + 2)*by;
+    arena_[s.offset + cell] += w;
+    arena_[s.offset + s.ncells + cell] += w*w;
+    s.entries += 1.;
+    s.weighted = s.weighted or w != 1.;
+
+    // like ROOT, the statistics only use the fills within the axis ranges
+    if (bx == 0 or bx > s.x.n) return;
+    if (s.is2D and (by == 0 or by > s.y.n)) return;
+    s.stats[0] += w;
+    s.stats[1] += w*w;
+    s.stats[2] += w*x;
+    s.stats[3] += w*x*x;
+    if (s.is2D) {
+      s.stats[4] += w*y;
+      s.stats[5] += w*y*y;
+      s.stats[6] += w*x*y;
+    }
+  }
+
+  std::vector<Spec> specs_;
+  std::vector<double> arena_;
+};
+
+#endif
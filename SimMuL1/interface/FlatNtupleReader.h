@@ -0,0 +1,156 @@
+#ifndef SimMuL1_FlatNtupleReader_h
+#define SimMuL1_FlatNtupleReader_h
+
+/**\class FlatNtupleReader
+
+ Description: reader of the flat layout of the SimpleMuon ntuple (flatNtuple = True)
+
+ Every nested collection <group>_<field> is stored as one array with the
+ values of all tracks in the event, plus a <group>_offsets array shared by
+ the group: the values of track i are [offsets[i], offsets[i+1]). Only the
+ branches of the requested columns are read, and the per-track views point
+ into the arrays filled by ROOT, so nothing is allocated per track.
+
+ Only depends on ROOT, so it can be used from compiled plotting macros:
+
+   FlatNtupleReader reader(tree);
+   FlatNtupleReader::Column<Float_t> lx(reader.column<Float_t>("csc_sh", "lx"));
+   FlatNtupleReader::Column<Int_t> detId(reader.column<Int_t>("csc_sh", "detUnitId"));
+   for (Long64_t e = 0; e < reader.entries(); ++e) {
+     reader.getEntry(e);
+     for (unsigned t = 0; t < lx.nTracks(); ++t) {
+       FlatView<Float_t> trackLx(lx(t));
+       for (unsigned h = 0; h < trackLx.size(); ++h) ... trackLx[h] ... detId(t)[h] ...
+     }
+   }
+
+*/
+
+#include "TTree.h"
+
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+/// read-only range of values of one track
+template <class T>
+class FlatView
+{
+ public:
+  FlatView(): begin_(0), end_(0) {}
+  FlatView(const T* begin, const T* end): begin_(begin), end_(end) {}
+
+  const T* begin() const { return begin_; }
+  const T* end() const { return end_; }
+  unsigned size() const { return end_ - begin_; }
+  bool empty() const { return begin_ == end_; }
+  const T& operator[](unsigned i) const { return begin_[i]; }
+
+ private:
+  const T* begin_;
+  const T* end_;
+};
+
+
+class FlatNtupleReader
+{
+ public:
+
+  /// one nested collection: values of all tracks plus the offsets of its group
+  template <class T>
+  class Column
+  {
+   public:
+    Column(): offsets_(0), values_(0) {}
+    Column(std::vector<Int_t>* const* offsets, std::vector<T>* const* values): offsets_(offsets), values_(values) {}
+
+    unsigned nTracks() const
+    {
+      const std::vector<Int_t>& o(**offsets_);
+      return o.empty() ? 0 : o.size() - 1;
+    }
+
+    /// values of track i in the current entry
+    FlatView<T> operator()(unsigned i) const
+    {
+      const std::vector<Int_t>& o(**offsets_);
+      const std::vector<T>& v(**values_);
+      if (v.empty()) return FlatView<T>();
+      return FlatView<T>(&v[0] + o[i], &v[0] + o[i+1]);
+    }
+
+    /// values of all tracks in the current entry
+    FlatView<T> all() const
+    {
+      const std::vector<T>& v(**values_);
+      if (v.empty()) return FlatView<T>();
+      return FlatView<T>(&v[0], &v[0] + v.size());
+    }
+
+   private:
+    // ROOT may replace the objects behind the branch addresses, so keep the address of the pointer
+    std::vector<Int_t>* const* offsets_;
+    std::vector<T>* const* values_;
+  };
+
+  /// only the branches of the columns requested later are read
+  explicit FlatNtupleReader(TTree* tree): tree_(tree)
+  {
+    tree_->SetBranchStatus("*", 0);
+  }
+
+  ~FlatNtupleReader()
+  {
+    tree_->ResetBranchAddresses();
+    clear(ints_);
+    clear(floats_);
+  }
+
+  /// column <group>_<field> with element type T (Int_t or Float_t)
+  template <class T>
+  Column<T> column(const std::string& group, const std::string& field)
+  {
+    std::vector<Int_t>* const* offsets(bind(group + "_offsets", ints_));
+    std::vector<T>* const* values(bind(group + "_" + field, storage((T*)0)));
+    return Column<T>(offsets, values);
+  }
+
+  Long64_t entries() const { return tree_->GetEntries(); }
+  Int_t getEntry(Long64_t i) { return tree_->GetEntry(i); }
+
+ private:
+
+  FlatNtupleReader(const FlatNtupleReader&);
+  FlatNtupleReader& operator=(const FlatNtupleReader&);
+
+  std::map<std::string, std::vector<Int_t>*>& storage(Int_t*) { return ints_; }
+  std::map<std::string, std::vector<Float_t>*>& storage(Float_t*) { return floats_; }
+
+  template <class T>
+  std::vector<T>* const* bind(const std::string& branch, std::map<std::string, std::vector<T>*>& branches)
+  {
+    typename std::map<std::string, std::vector<T>*>::iterator b(branches.find(branch));
+    if (b != branches.end()) return &(b->second);
+    std::vector<T>*& address(branches[branch]);
+    address = new std::vector<T>();
+    tree_->SetBranchStatus(branch.c_str(), 1);
+    if (tree_->SetBranchAddress(branch.c_str(), &address) < 0)
+      std::cerr << "FlatNtupleReader: cannot read branch " << branch << std::endl;
+    return &address;
+  }
+
+  template <class T>
+  static void clear(std::map<std::string, std::vector<T>*>& branches)
+  {
+    for (typename std::map<std::string, std::vector<T>*>::iterator b = branches.begin(); b != branches.end(); ++b)
+      delete b->second;
+    branches.clear();
+  }
+
+  TTree* tree_;
+  std::map<std::string, std::vector<Int_t>*> ints_;
+  std::map<std::string, std::vector<Float_t>*> floats_;
+};
+
+#endif
@@ -83,11 +83,33 @@ public:
   // strk's ID is first element, followed by IDs of its children SimTracks
   std::vector<unsigned> familyIds;
   
+  // read-only view of a subset of simHits, e.g. the hits in one chamber;
+  // no hit is copied, a view stays valid until the next addSimHit
+  class SimHitView
+  {
+  public:
+    SimHitView(): hits_(0), index_(0) {}
+    SimHitView(const std::vector<PSimHit>* hits, const std::vector<unsigned>* index): hits_(hits), index_(index) {}
+
+    size_t size() const {return index_ ? index_->size() : 0;}
+    bool empty() const {return size() == 0;}
+    const PSimHit& operator[](size_t i) const {return (*hits_)[(*index_)[i]];}
+
+  private:
+    const std::vector<PSimHit>* hits_;
+    const std::vector<unsigned>* index_;
+  };
+
   // matching SimHits of muon strk and (if !doSimpleSimHitToTrackMatch_) its children 
   void addSimHit( PSimHit & h );
   std::vector<PSimHit> simHits;
-  std::map<int, std::vector<PSimHit> > hitsMapLayer;
-  std::map<int, std::vector<PSimHit> > hitsMapChamber;
+  // positions in simHits of the hits in each layer and chamber, of all hits and of muon hits only
+  std::map<int, std::vector<unsigned> > hitsMapLayer;
+  std::map<int, std::vector<unsigned> > hitsMapChamber;
+  std::map<int, std::vector<unsigned> > muHitsMapLayer;
+  std::map<int, std::vector<unsigned> > muHitsMapChamber;
+  std::vector<unsigned> allHits;
+  std::vector<unsigned> muHits;
 
   // if( muOnly == true ) only hits with |particleType|==13 are considered
   
@@ -99,9 +121,9 @@ public:
   std::set<int> gemDetIdsAssociated(int station=0, int ring=0);
   bool isCSCDetIdAssociated(CSCDetId id);
   bool isGEMDetIdAssociated(CSCDetId id);
-  std::vector<PSimHit> layerHits( int detId );
-  std::vector<PSimHit> chamberHits( int detId );
-  std::vector<PSimHit> allSimHits();
+  SimHitView layerHits( int detId );
+  SimHitView chamberHits( int detId );
+  SimHitView allSimHits();
   int numberOfLayersWithHitsInChamber( int detId );
   std::pair<int,int> wireGroupAndStripInChamber( int detId );
 
@@ -0,0 +1,78 @@
+#ifndef SimMuL1_MuGeometryCache_h
+#define SimMuL1_MuGeometryCache_h
+
+/**\class MuGeometryCache
+
+ Description:
+
+ Derived geometry tables (MuGeometryAreas, MuFiducial LUTs) that are computed
+ once per geometry instead of in every module and every job.
+
+ The tables are keyed by the MuonGeometryRecord they were built from, and
+ the key is only computed again when the record changes, so asking for a
+ table costs no geometry walk. Within a job the tables are shared read-only
+ by all the modules that ask for the same record. The muon geometry carries
+ no version, so the tables are only kept in the cache directory when the
+ job declares one (geometryVersion, e.g. the name of the geometry cff): the
+ files are keyed by the declared version and the first run of the IOV of the
+ record, and later jobs with the same key map them with mmap instead of
+ walking the layer topologies. A wrong version gives wrong tables.
+*/
+
+#include "GEMCode/SimMuL1/interface/MuGeometryHelpers.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+class CSCGeometry;
+class GEMGeometry;
+class RPCGeometry;
+class DTGeometry;
+class MuonGeometryRecord;
+
+namespace mugeo {
+
+class MuGeometryCache
+{
+public:
+
+  /// cache files are kept in dir for the declared geometryVersion; with an empty dir
+  /// or version the tables are only shared within the job
+  explicit MuGeometryCache(const std::string& dir = "", const std::string& geometryVersion = "")
+  : dir_(dir), geometryVersion_(geometryVersion), cacheId_(0), key_(0) {}
+
+  /// areas of the non-null geometries of the record; the areas of the other detectors are zero
+  std::shared_ptr<const MuGeometryAreas> areas(const MuonGeometryRecord& record,
+                                               const CSCGeometry* csc, const GEMGeometry* gem,
+                                               const RPCGeometry* rpc, const DTGeometry* dt) const;
+
+  /// MuFiducial::buildGEMLUT/buildCSCLUT tables
+  std::shared_ptr<const fidLUT> gemLUT(const MuonGeometryRecord& record, const GEMGeometry* g) const;
+  std::shared_ptr<const fidLUT> cscLUT(const MuonGeometryRecord& record, const CSCGeometry* g) const;
+
+private:
+
+  // key of the tables of a record, computed again only when the record changes
+  uint64_t key(const MuonGeometryRecord& record) const;
+  // the tables can be kept in the cache directory
+  bool persistent() const { return !dir_.empty() and !geometryVersion_.empty(); }
+
+  // file of a table in the cache directory
+  std::string path(const std::string& table, uint64_t key) const;
+
+  // mmap a table of values of type T; returns false if there is no valid file
+  template <class T> bool read(const std::string& table, uint64_t key, std::vector<T>& values) const;
+  // write it next to its final name and rename, so that parallel jobs never see a partial file
+  template <class T> void write(const std::string& table, uint64_t key, const std::vector<T>& values) const;
+
+  std::string dir_;
+  std::string geometryVersion_;
+  mutable unsigned long long cacheId_;
+  mutable uint64_t key_;
+};
+
+} // namespace
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef SimMuL1_MuGeometryConstants_h
+#define SimMuL1_MuGeometryConstants_h
+
+/**\file MuGeometryConstants
+
+ Description:
+
+ Chamber type counts and segmentation of the muon detectors. Kept free of
+ CMSSW dependencies so that standalone ROOT tools can use them too.
+*/
+
+namespace mugeo {
+
+// constants
+enum ETrigCSC {MAX_CSC_STATIONS = 4, CSC_TYPES = 10};
+enum ETrigGEM {MAX_GEM_STATIONS = 2, GEM_TYPES = 2};
+enum ETrigDT  {MAX_DT_STATIONS = 4, DT_TYPES = 12};
+enum ETrigRPCF {MAX_RPCF_STATIONS = 4, RPCF_TYPES = 12};
+enum ETrigRPCB {MAX_RPCB_STATIONS = 4, RPCB_TYPES = 12};
+
+// chamber radial segmentation numbers (including factor of 2 for non-zero wheels in barrel):
+const double csc_radial_segm[CSC_TYPES+1] = {1, 36, 36, 36, 36, 18, 36, 18, 36, 18, 36};
+const double gem_radial_segm[GEM_TYPES+1] = {1, 36};
+const double dt_radial_segm[DT_TYPES+1]   = {1, 12, 12*2, 12*2, 12, 12*2, 12*2, 12, 12*2, 12*2, 14, 14*2, 14*2};
+const double rpcb_radial_segm[RPCF_TYPES+1] = {1, 12, 12*2, 12*2, 12, 12*2, 12*2, 24, 24*2, 24*2, 12, 24*2, 24*2};
+const double rpcf_radial_segm[RPCF_TYPES+1] = {1, 36, 36, 36, 18, 36, 36, 18, 36, 36, 18, 36, 36};
+
+} // namespace
+
+#endif
@@ -8,6 +8,8 @@
  Utils to summarize and access some of the muon detectors' information, sensitive volumes areas in particular.
 */
 
+#include "GEMCode/SimMuL1/interface/MuGeometryConstants.h"
+
 #include "DataFormats/MuonDetId/interface/CSCDetId.h"
 #include "DataFormats/MuonDetId/interface/GEMDetId.h"
 #include "DataFormats/MuonDetId/interface/RPCDetId.h"
@@ -20,6 +22,7 @@
 #include <vector>
 #include <cmath>
 #include <map>
+#include <memory>
 #include <set>
 
 #include "DataFormats/Math/interface/LorentzVector.h"
@@ -39,13 +42,6 @@ inline bool isME1aEtaRegion(float eta, float eta_min = 2.14){return fabs(eta) >=
 inline bool isME42EtaRegion(float eta){return fabs(eta)>=1.2499 && fabs(eta)<=1.8;}
 inline bool isME42RPCEtaRegion(float eta){return fabs(eta)>=1.2499 && fabs(eta)<=1.6;}
 
-// constants
-enum ETrigCSC {MAX_CSC_STATIONS = 4, CSC_TYPES = 10};
-enum ETrigGEM {MAX_GEM_STATIONS = 2, GEM_TYPES = 2};
-enum ETrigDT  {MAX_DT_STATIONS = 4, DT_TYPES = 12};
-enum ETrigRPCF {MAX_RPCF_STATIONS = 4, RPCF_TYPES = 12};
-enum ETrigRPCB {MAX_RPCB_STATIONS = 4, RPCB_TYPES = 12};
-
 // chamber types
 inline int type(CSCDetId &d)  {return  d.iChamberType();}
 inline int type(GEMDetId &d)  {return  3*d.station() + d.ring() - 3;}
@@ -107,13 +103,6 @@ const std::string csc_type_a[CSC_TYPES+2] =
 const std::string csc_type_a_[CSC_TYPES+2] =
    { "NA", "ME1A", "ME1B", "ME12", "ME13", "ME21", "ME22", "ME31", "ME32", "ME41", "ME42", "ME1T"};
 
-// chamber radial segmentation numbers (including factor of 2 for non-zero wheels in barrel):
-const double csc_radial_segm[CSC_TYPES+1] = {1, 36, 36, 36, 36, 18, 36, 18, 36, 18, 36};
-const double gem_radial_segm[GEM_TYPES+1] = {1, 36};
-const double dt_radial_segm[DT_TYPES+1]   = {1, 12, 12*2, 12*2, 12, 12*2, 12*2, 12, 12*2, 12*2, 14, 14*2, 14*2};
-const double rpcb_radial_segm[RPCF_TYPES+1] = {1, 12, 12*2, 12*2, 12, 12*2, 12*2, 24, 24*2, 24*2, 12, 24*2, 24*2};
-const double rpcf_radial_segm[RPCF_TYPES+1] = {1, 36, 36, 36, 18, 36, 36, 18, 36, 36, 18, 36, 36};
-
 // DT # of superlayers in chamber
 const double dt_n_superlayers[DT_TYPES+1]   = {1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2};
 
@@ -162,14 +151,17 @@ private:
 class MuFiducial
 {
  public:
-  MuFiducial() {}
+  MuFiducial(): cscGeometry(0), gemGeometry(0) {}
   ~MuFiducial() {}
 
   void buildGEMLUT();
   void buildCSCLUT();
 
-  fidLUT getGEMLUT() const;
-  fidLUT getCSCLUT() const;
+  /// the LUTs are read-only once built, so they can be shared (see MuGeometryCache)
+  std::shared_ptr<const fidLUT> getGEMLUT() const {return gemLUT_;}
+  std::shared_ptr<const fidLUT> getCSCLUT() const {return cscLUT_;}
+  void setGEMLUT(std::shared_ptr<const fidLUT> lut) {gemLUT_ = lut;}
+  void setCSCLUT(std::shared_ptr<const fidLUT> lut) {cscLUT_ = lut;}
   const GEMGeometry* getGEMGeometry() const {return gemGeometry;}
   const CSCGeometry* getCSCGeometry() const {return cscGeometry;}
   void setGEMGeometry(const GEMGeometry* geom) {gemGeometry = geom;}
@@ -180,9 +172,9 @@ class MuFiducial
 
  private:
   // Rmin, Rmax, PhiMin, PhiMax, Zmin, Zmax
-  fidLUT gemLUT_;
+  std::shared_ptr<const fidLUT> gemLUT_;
   // Rmin, Rmax, PhiMin, PhiMax, Zmin, Zmax
-  fidLUT cscLUT_;
+  std::shared_ptr<const fidLUT> cscLUT_;
 
   const CSCGeometry* cscGeometry;
   const GEMGeometry* gemGeometry;
@@ -16,6 +16,8 @@ Various data classes to use for analysis ntuples
 
 #include "TTree.h"
 
+#include <vector>
+
 class CSCGeometry;
 class GEMGeometry;
 class RPCGeometry;
@@ -354,4 +356,15 @@ struct MyDTSimHit
 };
 
 
+// ================================================================================================
+// SimHit clustering
+
+// Recursive clustering of the hits of a CSC layer, a GEM eta partition or a
+// RPC roll: the first hit in the sort order makes a cluster with the hits
+// close to it in wiregroup, strip and TOF, and the other hits are clustered
+// again. The hits are sorted in place.
+std::vector<std::vector<MyCSCSimHit> > clusterCSCSimHits(std::vector<MyCSCSimHit> &hits, bool verbose = false);
+std::vector<std::vector<MyGEMSimHit> > clusterGEMSimHits(std::vector<MyGEMSimHit> &hits, bool verbose = false);
+std::vector<std::vector<MyRPCSimHit> > clusterRPCSimHits(std::vector<MyRPCSimHit> &hits, bool verbose = false);
+
 #endif
@@ -0,0 +1,457 @@
+#ifndef SimMuL1_MuOccupancyNormalization_h
+#define SimMuL1_MuOccupancyNormalization_h
+
+/**\file MuOccupancyNormalization
+
+ Description:
+
+ Conversion of the raw MuSimHitOccupancy counts into fluxes per cm2 and rates
+ per chamber at L=10^34.
+
+ Every job writes, next to its histograms, one row of the MuOccupancyExposure
+ tree with its event counters and the detector areas. Jobs that run with
+ normalizeInJob = False keep the histograms as raw counts (with Sumw2), so the
+ outputs of many jobs can be added with hadd or mergeMuSimHitOccupancy and
+ normalized once with the summed exposure:
+
+   mergeMuSimHitOccupancy -o merged.root job_*.root
+
+ Only depends on ROOT, so that the merge tool does not need CMSSW.
+*/
+
+#include "GEMCode/SimMuL1/interface/MuGeometryConstants.h"
+
+#include "TDirectory.h"
+#include "TGraphErrors.h"
+#include "TH1.h"
+#include "TTree.h"
+
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace mugeo {
+
+/// GE1/1 partition quantities are indexed by roll number
+enum EGEMPartitions {GEM_PART_SLOTS = 12};
+
+/// event counters and geometry of one job (one row of the MuOccupancyExposure tree),
+/// or the sum over several jobs
+struct MuOccupancyExposure
+{
+  MuOccupancyExposure() { reset(); }
+
+  void reset()
+  {
+    njobs = 0;
+    evtn = 0;
+    nevt_with_cscsh = nevt_with_cscsh_in_rpc = n_cscsh = n_cscsh_in_rpc = 0;
+    nevt_with_gemsh = n_gemsh = 0;
+    nevt_with_rpcsh = nevt_with_rpcsh_e = nevt_with_rpcsh_b = n_rpcsh = n_rpcsh_e = n_rpcsh_b = 0;
+    nevt_with_dtsh = n_dtsh = 0;
+    input_is_neutrons = do_csc = do_gem = do_rpc = do_dt = normalized = false;
+    fill(csc_total_areas_cm2, CSC_TYPES+1);
+    fill(gem_total_areas_cm2, GEM_TYPES+1);
+    fill(rpcf_total_areas_cm2, RPCF_TYPES+1);
+    fill(rpcb_total_areas_cm2, RPCB_TYPES+1);
+    fill(dt_total_areas_cm2, DT_TYPES+1);
+    fill(ge11_part_areas_cm2, GEM_PART_SLOTS);
+    fill(ge11_part_radius, GEM_PART_SLOTS);
+    fill(ge11_part_halfheight, GEM_PART_SLOTS);
+    fill(csc_ch_radius, CSC_TYPES+1);
+    fill(csc_ch_halfheight, CSC_TYPES+1);
+    fill(dt_ch_z, DT_TYPES+1);
+    fill(dt_ch_halfspanz, DT_TYPES+1);
+  }
+
+  /// write one row per job
+  void book(TTree* t) { connect(t, true); }
+  /// read the rows of a merged tree
+  void setBranchAddresses(TTree* t) { connect(t, false); }
+
+  /// adds the counters of another job; false if it was run with a different setup or geometry
+  bool add(const MuOccupancyExposure& o)
+  {
+    if (o.normalized) return false;
+    if (njobs == 0) {
+      *this = o;
+      return true;
+    }
+    if (o.input_is_neutrons != input_is_neutrons or o.do_csc != do_csc or o.do_gem != do_gem or
+        o.do_rpc != do_rpc or o.do_dt != do_dt or normalized or
+        !same(o.csc_total_areas_cm2, csc_total_areas_cm2, CSC_TYPES+1) or
+        !same(o.gem_total_areas_cm2, gem_total_areas_cm2, GEM_TYPES+1) or
+        !same(o.rpcf_total_areas_cm2, rpcf_total_areas_cm2, RPCF_TYPES+1) or
+        !same(o.rpcb_total_areas_cm2, rpcb_total_areas_cm2, RPCB_TYPES+1) or
+        !same(o.dt_total_areas_cm2, dt_total_areas_cm2, DT_TYPES+1) or
+        !same(o.ge11_part_areas_cm2, ge11_part_areas_cm2, GEM_PART_SLOTS))
+      return false;
+    njobs += o.njobs;
+    evtn += o.evtn;
+    nevt_with_cscsh += o.nevt_with_cscsh;
+    nevt_with_cscsh_in_rpc += o.nevt_with_cscsh_in_rpc;
+    n_cscsh += o.n_cscsh;
+    n_cscsh_in_rpc += o.n_cscsh_in_rpc;
+    nevt_with_gemsh += o.nevt_with_gemsh;
+    n_gemsh += o.n_gemsh;
+    nevt_with_rpcsh += o.nevt_with_rpcsh;
+    nevt_with_rpcsh_e += o.nevt_with_rpcsh_e;
+    nevt_with_rpcsh_b += o.nevt_with_rpcsh_b;
+    n_rpcsh += o.n_rpcsh;
+    n_rpcsh_e += o.n_rpcsh_e;
+    n_rpcsh_b += o.n_rpcsh_b;
+    nevt_with_dtsh += o.nevt_with_dtsh;
+    n_dtsh += o.n_dtsh;
+    return true;
+  }
+
+  void print() const
+  {
+    using std::cout;
+    using std::endl;
+    cout<<"******************* COUNTERS *******************"<<endl;
+    cout<<"* #events: "<< evtn <<endl;
+    cout<<"* #events with SimHits in:"<<endl;
+    cout<<"*   CSC:                     "<<nevt_with_cscsh<<" ("<<(double)nevt_with_cscsh/evtn*100<<"%)"<<endl;
+    cout<<"*   CSC (|eta|<1.6, st 1-3): "<<nevt_with_cscsh_in_rpc<<" ("<<(double)nevt_with_cscsh_in_rpc/evtn*100<<"%)"<<endl;
+    cout<<"*   GEM:                     "<<nevt_with_gemsh<<" ("<<(double)nevt_with_gemsh/evtn*100<<"%)"<<endl;
+    cout<<"*   RPC:                     "<<nevt_with_rpcsh<<" ("<<(double)nevt_with_rpcsh/evtn*100<<"%)"<<endl;
+    cout<<"*   RPC endcaps:             "<<nevt_with_rpcsh_e<<" ("<<(double)nevt_with_rpcsh_e/evtn*100<<"%)"<<endl;
+    cout<<"*   RPC barrel:              "<<nevt_with_rpcsh_b<<" ("<<(double)nevt_with_rpcsh_b/evtn*100<<"%)"<<endl;
+    cout<<"*   DT:                      "<<nevt_with_dtsh<<" ("<<(double)nevt_with_dtsh/evtn*100<<"%)"<<endl;
+    cout<<"* total SimHit numbers in: "<<endl;
+    cout<<"*   CSC:                     "<<n_cscsh<<" (~"<<(double)n_cscsh/nevt_with_cscsh<<" sh/evt with hits)"<<endl;
+    cout<<"*   CSC (|eta|<1.6, st 1-3): "<<n_cscsh_in_rpc<<" (~"<<(double)n_cscsh_in_rpc/nevt_with_cscsh_in_rpc<<" sh/evt with hits)"<<endl;
+    cout<<"*   GEM:                     "<<n_gemsh<<" (~"<<(double)n_gemsh/nevt_with_gemsh<<" sh/evt with hits)"<<endl;
+    cout<<"*   RPC:                     "<<n_rpcsh<<" (~"<<(double)n_rpcsh/nevt_with_rpcsh<<" sh/evt with hits)"<<endl;
+    cout<<"*   RPC endcaps:             "<<n_rpcsh_e<<" (~"<<(double)n_rpcsh_e/nevt_with_rpcsh_e<<" sh/evt with hits)"<<endl;
+    cout<<"*   RPC barrel:              "<<n_rpcsh_b<<" (~"<< ( (nevt_with_rpcsh_b>0) ? (double)n_rpcsh_b/nevt_with_rpcsh_b : 0 )<<" sh/evt with hits)"<<endl;
+    cout<<"*   DT:                      "<<n_dtsh<<" (~"<<(double)n_dtsh/nevt_with_dtsh<<" sh/evt with hits)"<<endl;
+    cout<<"************************************************"<<endl;
+  }
+
+  // counters; njobs is 1 in the output of every job
+  Long64_t njobs;
+  Long64_t evtn;
+  Long64_t nevt_with_cscsh, nevt_with_cscsh_in_rpc;
+  Long64_t n_cscsh, n_cscsh_in_rpc;
+  Long64_t nevt_with_gemsh;
+  Long64_t n_gemsh;
+  Long64_t nevt_with_rpcsh, nevt_with_rpcsh_e, nevt_with_rpcsh_b;
+  Long64_t n_rpcsh, n_rpcsh_e, n_rpcsh_b;
+  Long64_t nevt_with_dtsh;
+  Long64_t n_dtsh;
+
+  // job setup; normalized is set when the histograms of the job were already normalized
+  Bool_t input_is_neutrons;
+  Bool_t do_csc, do_gem, do_rpc, do_dt;
+  Bool_t normalized;
+
+  // sensitive areas
+  Float_t csc_total_areas_cm2[CSC_TYPES+1];
+  Float_t gem_total_areas_cm2[GEM_TYPES+1];
+  Float_t rpcf_total_areas_cm2[RPCF_TYPES+1];
+  Float_t rpcb_total_areas_cm2[RPCB_TYPES+1];
+  Float_t dt_total_areas_cm2[DT_TYPES+1];
+  Float_t ge11_part_areas_cm2[GEM_PART_SLOTS];
+
+  // positions of the points of the flux graphs
+  Float_t ge11_part_radius[GEM_PART_SLOTS];
+  Float_t ge11_part_halfheight[GEM_PART_SLOTS];
+  Float_t csc_ch_radius[CSC_TYPES+1];
+  Float_t csc_ch_halfheight[CSC_TYPES+1];
+  Float_t dt_ch_z[DT_TYPES+1];
+  Float_t dt_ch_halfspanz[DT_TYPES+1];
+
+private:
+
+  static void fill(Float_t* a, int n) { for (int i=0; i<n; i++) a[i] = 0.; }
+  static bool same(const Float_t* a, const Float_t* b, int n)
+  {
+    for (int i=0; i<n; i++) if (std::abs(a[i] - b[i]) > 1.e-3 * std::abs(b[i])) return false;
+    return true;
+  }
+
+  static void link(TTree* t, bool book, const char* name, void* address, const char* type, int n = 0)
+  {
+    if (!book) {
+      t->SetBranchAddress(name, address);
+      return;
+    }
+    std::ostringstream leaves;
+    leaves << name;
+    if (n > 0) leaves << "[" << n << "]";
+    leaves << "/" << type;
+    t->Branch(name, address, leaves.str().c_str());
+  }
+
+  void connect(TTree* t, bool book)
+  {
+    link(t, book, "njobs", &njobs, "L");
+    link(t, book, "evtn", &evtn, "L");
+    link(t, book, "nevt_with_cscsh", &nevt_with_cscsh, "L");
+    link(t, book, "nevt_with_cscsh_in_rpc", &nevt_with_cscsh_in_rpc, "L");
+    link(t, book, "n_cscsh", &n_cscsh, "L");
+    link(t, book, "n_cscsh_in_rpc", &n_cscsh_in_rpc, "L");
+    link(t, book, "nevt_with_gemsh", &nevt_with_gemsh, "L");
+    link(t, book, "n_gemsh", &n_gemsh, "L");
+    link(t, book, "nevt_with_rpcsh", &nevt_with_rpcsh, "L");
+    link(t, book, "nevt_with_rpcsh_e", &nevt_with_rpcsh_e, "L");
+    link(t, book, "nevt_with_rpcsh_b", &nevt_with_rpcsh_b, "L");
+    link(t, book, "n_rpcsh", &n_rpcsh, "L");
+    link(t, book, "n_rpcsh_e", &n_rpcsh_e, "L");
+    link(t, book, "n_rpcsh_b", &n_rpcsh_b, "L");
+    link(t, book, "nevt_with_dtsh", &nevt_with_dtsh, "L");
+    link(t, book, "n_dtsh", &n_dtsh, "L");
+    link(t, book, "input_is_neutrons", &input_is_neutrons, "O");
+    link(t, book, "do_csc", &do_csc, "O");
+    link(t, book, "do_gem", &do_gem, "O");
+    link(t, book, "do_rpc", &do_rpc, "O");
+    link(t, book, "do_dt", &do_dt, "O");
+    link(t, book, "normalized", &normalized, "O");
+    link(t, book, "csc_total_areas_cm2", csc_total_areas_cm2, "F", CSC_TYPES+1);
+    link(t, book, "gem_total_areas_cm2", gem_total_areas_cm2, "F", GEM_TYPES+1);
+    link(t, book, "rpcf_total_areas_cm2", rpcf_total_areas_cm2, "F", RPCF_TYPES+1);
+    link(t, book, "rpcb_total_areas_cm2", rpcb_total_areas_cm2, "F", RPCB_TYPES+1);
+    link(t, book, "dt_total_areas_cm2", dt_total_areas_cm2, "F", DT_TYPES+1);
+    link(t, book, "ge11_part_areas_cm2", ge11_part_areas_cm2, "F", GEM_PART_SLOTS);
+    link(t, book, "ge11_part_radius", ge11_part_radius, "F", GEM_PART_SLOTS);
+    link(t, book, "ge11_part_halfheight", ge11_part_halfheight, "F", GEM_PART_SLOTS);
+    link(t, book, "csc_ch_radius", csc_ch_radius, "F", CSC_TYPES+1);
+    link(t, book, "csc_ch_halfheight", csc_ch_halfheight, "F", CSC_TYPES+1);
+    link(t, book, "dt_ch_z", dt_ch_z, "F", DT_TYPES+1);
+    link(t, book, "dt_ch_halfspanz", dt_ch_halfspanz, "F", DT_TYPES+1);
+  }
+};
+
+
+/// luminosity scaling of the counts
+struct MuOccupancyScale
+{
+  explicit MuOccupancyScale(bool input_is_neutrons)
+  : n_pu(25.)
+  , f_full_bx(input_is_neutrons ? 0.7879 : 1.)
+  , bxrate(40000000.)
+  {}
+
+  // pileup at nominal lumi
+  double n_pu;
+  // fraction of full BXs : 2808 filled bickets out of 3564
+  double f_full_bx;
+  // bx rate 40 MHz
+  double bxrate;
+};
+
+
+/// normalization of the histograms of one MuSimHitOccupancy directory
+class MuOccupancyNormalizer
+{
+public:
+
+  /// histograms that are later scaled per bin; enabling Sumw2 before merging keeps their errors
+  static void sumw2(TDirectory* dir)
+  {
+    const char* names[] = {
+      "h_csc_nevt_fraction_with_sh", "h_gem_nevt_fraction_with_sh", "h_rpcf_nevt_fraction_with_sh",
+      "h_rpcb_nevt_fraction_with_sh", "h_dt_nevt_fraction_with_sh",
+      "h_csc_hit_flux_per_layer", "h_csc_hit_rate_per_ch", "h_csc_clu_flux_per_layer", "h_csc_clu_rate_per_ch",
+      "h_gem_hit_flux_per_layer", "h_gem_hit_rate_per_ch", "h_gem_clu_flux_per_layer", "h_gem_clu_rate_per_ch",
+      "h_gem_nhit_avg_per_ch", "h_gem_hit_flux_per_partlayer_ge11", "h_gem_hit_avg_per_part_ge11",
+      "h_rpcf_hit_flux_per_layer", "h_rpcf_hit_rate_per_ch", "h_rpcf_clu_flux_per_layer", "h_rpcf_clu_rate_per_ch",
+      "h_rpcb_hit_flux_per_layer", "h_rpcb_hit_rate_per_ch", "h_rpcb_clu_flux_per_layer", "h_rpcb_clu_rate_per_ch",
+      "h_dt_hit_flux_per_layer", "h_dt_hit_rate_per_ch"};
+    for (unsigned i=0; i<sizeof(names)/sizeof(names[0]); i++) {
+      TH1* h = get(dir, names[i]);
+      if (h and h->GetSumw2N() == 0) h->Sumw2();
+    }
+  }
+
+  /// converts the raw counts in dir into fractions, fluxes and rates, fills the total area
+  /// histograms and the flux graphs (booked in dir if they do not exist yet)
+  static bool normalize(TDirectory* dir, const MuOccupancyExposure& e, const MuOccupancyScale& s)
+  {
+    if (e.normalized or e.evtn == 0) {
+      std::cout<<"MuOccupancyNormalizer: nothing to normalize ("<<(e.normalized ? "already normalized" : "no events")<<")"<<std::endl;
+      return false;
+    }
+    const double evtn = e.evtn;
+    const double lumi = s.bxrate * s.n_pu * s.f_full_bx;
+    double scale;
+
+    sumw2(dir);
+
+    // convert to fraction:
+    const char* fractions[] = {"h_csc_nevt_fraction_with_sh", "h_gem_nevt_fraction_with_sh",
+                               "h_rpcf_nevt_fraction_with_sh", "h_rpcb_nevt_fraction_with_sh", "h_dt_nevt_fraction_with_sh"};
+    for (int i=0; i<5; i++) if (TH1* h = get(dir, fractions[i])) h->Scale(1./evtn);
+
+    // ---- calculate fluxes per cm2 and rates per chamber at L=10^34 ----
+
+    setTotalArea(get(dir, "h_csc_total_area"), e.do_csc, e.csc_total_areas_cm2, CSC_TYPES, evtn);
+    TH1* h_csc_hit_flux_per_layer = get(dir, "h_csc_hit_flux_per_layer");
+    if (e.do_csc) for (int t=1; t <= CSC_TYPES; t++)
+    {
+      // 2 endcaps , 6 layers
+      scale = lumi /e.csc_total_areas_cm2[t]/evtn;
+      scaleOneBin(h_csc_hit_flux_per_layer, t, scale);
+      scaleOneBin(get(dir, "h_csc_clu_flux_per_layer"), t, scale);
+
+      scale = lumi /csc_radial_segm[t]/2./evtn/1000.;
+      scaleOneBin(get(dir, "h_csc_hit_rate_per_ch"), t, scale);
+      scaleOneBin(get(dir, "h_csc_clu_rate_per_ch"), t, scale);
+    }
+    if (e.do_csc and h_csc_hit_flux_per_layer)
+    {
+      // first CSC type and number of types of every station
+      const int first[4] = {1, 5, 7, 9}, npoints[4] = {4, 2, 2, 2};
+      for (int st=0; st<4; st++)
+      {
+        std::ostringstream name, title;
+        name << "gr_csc_hit_flux_me" << st+1;
+        title << "SimHit Flux in ME" << st+1 << ";r, cm;Hz/cm^{2}";
+        TGraphErrors* gr = graph(dir, name.str(), npoints[st], title.str());
+        for (int i=0; i<npoints[st]; i++)
+        {
+          const int t = first[st] + i;
+          gr->SetPoint(i, e.csc_ch_radius[t], h_csc_hit_flux_per_layer->GetBinContent(t) );
+          gr->SetPointError(i, e.csc_ch_halfheight[t], h_csc_hit_flux_per_layer->GetBinError(t) );
+        }
+      }
+    }
+
+
+    setTotalArea(get(dir, "h_gem_total_area"), e.do_gem, e.gem_total_areas_cm2, GEM_TYPES, evtn);
+    if (e.do_gem) for (int t=1; t<=GEM_TYPES; t++)
+    {
+      scale = lumi /e.gem_total_areas_cm2[t]/evtn;
+      scaleOneBin(get(dir, "h_gem_hit_flux_per_layer"), t, scale);
+      scaleOneBin(get(dir, "h_gem_clu_flux_per_layer"), t, scale);
+
+      scale = lumi /gem_radial_segm[t]/2/evtn/1000;
+      scaleOneBin(get(dir, "h_gem_hit_rate_per_ch"), t, scale);
+      scaleOneBin(get(dir, "h_gem_clu_rate_per_ch"), t, scale);
+
+      scale = 1. /evtn /gem_radial_segm[t]/2./2.; // gem
+      scaleOneBin(get(dir, "h_gem_nhit_avg_per_ch"), t, scale);
+    }
+
+    TH1* h_gem_hit_flux_per_partlayer_ge11 = get(dir, "h_gem_hit_flux_per_partlayer_ge11");
+    if (e.do_gem) for (int i=1; i<=10; i++)
+    {
+      if (e.ge11_part_areas_cm2[i] == 0.) continue;
+      scale = lumi /evtn /e.ge11_part_areas_cm2[i];
+      scaleOneBin(h_gem_hit_flux_per_partlayer_ge11, i, scale);
+    }
+    if (e.do_gem)
+    {
+      scale = 1. /evtn /gem_radial_segm[1]/2./2.; // gem
+      if (TH1* h = get(dir, "h_gem_hit_avg_per_part_ge11")) h->Scale(scale);
+    }
+    if (e.do_gem and h_gem_hit_flux_per_partlayer_ge11)
+    {
+      TGraphErrors* gr = graph(dir, "gr_gem_hit_flux_ge1", 10, "SimHit Flux in GE1;r, cm;Hz/pad");
+      for (int i=0; i<=10; i++)
+      {
+        gr->SetPoint(i, e.ge11_part_radius[i+1], h_gem_hit_flux_per_partlayer_ge11->GetBinContent(i+1) );
+        gr->SetPointError(i, e.ge11_part_halfheight[i+1], h_gem_hit_flux_per_partlayer_ge11->GetBinError(i+1) );
+      }
+    }
+    graph(dir, "gr_gem_hit_padflux_ge1", 10, "SimHit Flux in GE1;r, cm;Hz/pad");
+
+
+    setTotalArea(get(dir, "h_rpcf_total_area"), e.do_rpc, e.rpcf_total_areas_cm2, RPCF_TYPES, evtn);
+    if (e.do_rpc) for (int t=1; t<=RPCF_TYPES; t++)
+    {
+      scale = lumi /e.rpcf_total_areas_cm2[t]/evtn;
+      scaleOneBin(get(dir, "h_rpcf_hit_flux_per_layer"), t, scale);
+      scaleOneBin(get(dir, "h_rpcf_clu_flux_per_layer"), t, scale);
+
+      scale = lumi /rpcf_radial_segm[t]/2/evtn/1000;
+      scaleOneBin(get(dir, "h_rpcf_hit_rate_per_ch"), t, scale);
+      scaleOneBin(get(dir, "h_rpcf_clu_rate_per_ch"), t, scale);
+    }
+
+    setTotalArea(get(dir, "h_rpcb_total_area"), e.do_rpc, e.rpcb_total_areas_cm2, RPCB_TYPES, evtn);
+    if (e.do_rpc) for (int t=1; t<=RPCB_TYPES; t++)
+    {
+      scale = lumi /e.rpcb_total_areas_cm2[t]/evtn;
+      scaleOneBin(get(dir, "h_rpcb_hit_flux_per_layer"), t, scale);
+      scaleOneBin(get(dir, "h_rpcb_clu_flux_per_layer"), t, scale);
+
+      scale = lumi /rpcb_radial_segm[t]/evtn/1000;
+      scaleOneBin(get(dir, "h_rpcb_hit_rate_per_ch"), t, scale);
+      scaleOneBin(get(dir, "h_rpcb_clu_rate_per_ch"), t, scale);
+    }
+
+
+    setTotalArea(get(dir, "h_dt_total_area"), e.do_dt, e.dt_total_areas_cm2, DT_TYPES, evtn);
+    TH1* h_dt_hit_flux_per_layer = get(dir, "h_dt_hit_flux_per_layer");
+    if (e.do_dt) for (int t=1; t<=DT_TYPES; t++)
+    {
+      // 2 endcaps , 6 layers
+      scale = lumi /e.dt_total_areas_cm2[t] /evtn;
+      scaleOneBin(h_dt_hit_flux_per_layer, t, scale);
+
+      scale = lumi /dt_radial_segm[t]/evtn/1000.;
+      scaleOneBin(get(dir, "h_dt_hit_rate_per_ch"), t, scale);
+    }
+    if (e.do_dt and h_dt_hit_flux_per_layer)
+    {
+      for (int st=0; st<4; st++)
+      {
+        std::ostringstream name, title;
+        name << "gr_dt_hit_flux_mb" << st+1;
+        title << "SimHit Flux in MB" << st+1 << ";z, cm;Hz/cm^{2}";
+        TGraphErrors* gr = graph(dir, name.str(), 3, title.str());
+        for (int i=0; i<3; i++)
+        {
+          const int t = 3*st + i + 1;
+          gr->SetPoint(i, e.dt_ch_z[t], h_dt_hit_flux_per_layer->GetBinContent(t) );
+          gr->SetPointError(i, e.dt_ch_halfspanz[t], h_dt_hit_flux_per_layer->GetBinError(t) );
+        }
+      }
+    }
+    return true;
+  }
+
+private:
+
+  static TH1* get(TDirectory* dir, const char* name)
+  {
+    return dynamic_cast<TH1*>(dir->Get(name));
+  }
+
+  static TGraphErrors* graph(TDirectory* dir, const std::string& name, int n, const std::string& title)
+  {
+    TGraphErrors* gr = dynamic_cast<TGraphErrors*>(dir->Get(name.c_str()));
+    if (gr) return gr;
+    gr = new TGraphErrors(n);
+    gr->SetName(name.c_str());
+    gr->SetTitle(title.c_str());
+    dir->Append(gr);
+    return gr;
+  }
+
+  static void scaleOneBin(TH1* h, int bin, double scale)
+  {
+    if (!h) return;
+    double rt = scale * h->GetBinContent(bin);
+    double er = scale * h->GetBinError(bin);
+    h->SetBinContent(bin, rt);
+    h->SetBinError(bin, er);
+  }
+
+  // areas per type (the underflow is the total area), number of events in the overflow
+  static void setTotalArea(TH1* h, bool filled, const Float_t* areas, int ntypes, double evtn)
+  {
+    if (!h) return;
+    if (filled) for (int t=0; t <= ntypes; t++) h->SetBinContent(t, areas[t]);
+    h->SetBinContent(ntypes+1, evtn); // store it in overflow
+    h->SetEntries(ntypes+2);
+  }
+};
+
+} // namespace
+
+#endif
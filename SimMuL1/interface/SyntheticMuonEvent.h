@@ -0,0 +1,154 @@
+#ifndef SimMuL1_SyntheticMuonEvent_h
+#define SimMuL1_SyntheticMuonEvent_h
+
+/**\class SyntheticMuonEventGenerator
+
+ Description: synthetic muon system events, a local stand-in for GEN-SIM-DIGI files
+
+ Muons of configurable kinematics are propagated from the origin to the endcap
+ stations on helices in a uniform solenoid field, and neutron-like background
+ hits are thrown uniformly over every chamber layer, with a mean multiplicity
+ proportional to the pileup. The chambers are placed with the chamber type
+ tables of MuGeometryHelpers (radial centres, half-heights and segmentation)
+ and approximate station z positions, not with the DDD geometry: the events
+ are good for functional and scaling tests of the matching and rate code, not
+ for physics.
+
+ From the hits, the generator builds the collections of the full simulation:
+ SimTracks, PSimHits, GEM, RPC and CSC wire/comparator digis, GE1/1 pads and
+ co-pads, and CSC ALCTs, CLCTs, LCTs and MPC LCTs in the chambers with at
+ least minLayersForStub layers hit by a muon (plus optional random background
+ stubs). An event depends only on its seed, so that several producers with the
+ same configuration see the same event.
+
+   SyntheticMuonEventGenerator generator(ps);
+   SyntheticMuonEvent event;
+   generator.generate(generator.eventSeed(run, evt), event);
+   ... *event.gemPads ...
+
+*/
+
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
+
+#include "SimDataFormats/Track/interface/SimTrackContainer.h"
+#include "SimDataFormats/Vertex/interface/SimVertexContainer.h"
+#include "SimDataFormats/TrackingHit/interface/PSimHitContainer.h"
+
+#include "DataFormats/GEMDigi/interface/GEMDigiCollection.h"
+#include "DataFormats/GEMDigi/interface/GEMCSCPadDigiCollection.h"
+#include "DataFormats/RPCDigi/interface/RPCDigiCollection.h"
+#include "DataFormats/CSCDigi/interface/CSCWireDigiCollection.h"
+#include "DataFormats/CSCDigi/interface/CSCComparatorDigiCollection.h"
+#include "DataFormats/CSCDigi/interface/CSCALCTDigiCollection.h"
+#include "DataFormats/CSCDigi/interface/CSCCLCTDigiCollection.h"
+#include "DataFormats/CSCDigi/interface/CSCCorrelatedLCTDigiCollection.h"
+
+#include "GEMCode/SimMuL1/interface/MuGeometryConstants.h"
+
+#include <memory>
+#include <random>
+#include <vector>
+#include <stdint.h>
+
+namespace mugeo {
+
+/// all the collections of one synthetic event; a producer takes ownership with release()
+struct SyntheticMuonEvent
+{
+  SyntheticMuonEvent();
+
+  std::unique_ptr<edm::SimTrackContainer> simTracks;
+  std::unique_ptr<edm::SimVertexContainer> simVertices;
+  std::unique_ptr<edm::PSimHitContainer> cscSimHits;
+  std::unique_ptr<edm::PSimHitContainer> gemSimHits;
+  std::unique_ptr<edm::PSimHitContainer> rpcSimHits;
+
+  std::unique_ptr<GEMDigiCollection> gemDigis;
+  std::unique_ptr<GEMCSCPadDigiCollection> gemPads;
+  std::unique_ptr<GEMCSCPadDigiCollection> gemCoPads;
+  std::unique_ptr<RPCDigiCollection> rpcDigis;
+  std::unique_ptr<CSCWireDigiCollection> cscWireDigis;
+  std::unique_ptr<CSCComparatorDigiCollection> cscComparatorDigis;
+
+  std::unique_ptr<CSCALCTDigiCollection> alcts;
+  std::unique_ptr<CSCCLCTDigiCollection> clcts;
+  std::unique_ptr<CSCCorrelatedLCTDigiCollection> lcts;
+  std::unique_ptr<CSCCorrelatedLCTDigiCollection> mplcts;
+};
+
+
+class SyntheticMuonEventGenerator
+{
+public:
+
+  explicit SyntheticMuonEventGenerator(const edm::ParameterSet& ps);
+
+  /// seed of an event, from the configured seed and the event id
+  uint64_t eventSeed(unsigned int run, unsigned long long event) const;
+
+  /// fills a new (empty) event
+  void generate(uint64_t seed, SyntheticMuonEvent& ev) const;
+
+private:
+
+  typedef std::mt19937_64 Engine;
+
+  // one hit in a CSC layer or in a GEM/RPC eta partition
+  struct LayerHit
+  {
+    unsigned int detId;
+    int type;
+    // fractional position across (phi) and along (r) the chamber, in [0,1)
+    float u, v;
+    // local position, cm
+    float x, y;
+    int bx;
+    float tof;
+    unsigned int trackId;
+    int particleType;
+    float p, theta, phi;
+  };
+
+  struct Muon
+  {
+    float pt, eta, phi;
+    int charge;
+  };
+
+  void generateMuon(Engine& engine, unsigned int trackId, SyntheticMuonEvent& ev, std::vector<LayerHit>& csc,
+                    std::vector<LayerHit>& gem, std::vector<LayerHit>& rpc) const;
+  void generateBackground(Engine& engine, std::vector<LayerHit>& csc, std::vector<LayerHit>& gem,
+                          std::vector<LayerHit>& rpc) const;
+
+  // position of a muon at |z|; false when it curls up before
+  bool propagate(const Muon& mu, float absz, float& r, float& phi) const;
+
+  void fillSimHits(const std::vector<LayerHit>& hits, float thickness, edm::PSimHitContainer& out) const;
+  void digitizeGEM(const std::vector<LayerHit>& hits, SyntheticMuonEvent& ev) const;
+  void digitizeRPC(const std::vector<LayerHit>& hits, SyntheticMuonEvent& ev) const;
+  void digitizeCSC(const std::vector<LayerHit>& hits, SyntheticMuonEvent& ev) const;
+  void buildStubs(Engine& engine, const std::vector<LayerHit>& hits, SyntheticMuonEvent& ev) const;
+
+  uint64_t seed_;
+  int nMuons_;
+  double minPt_, maxPt_;
+  double minEta_, maxEta_;
+  int charge_;
+  double magneticField_;
+  double fieldEndZ_;
+
+  double pileup_;
+  std::vector<double> cscBackgroundHitsPerLayer_;
+  double gemBackgroundHitsPerLayer_;
+  double rpcBackgroundHitsPerLayer_;
+  std::vector<double> cscBackgroundStubsPerChamber_;
+  int backgroundMinBX_, backgroundMaxBX_;
+
+  double digiEfficiency_;
+  int minLayersForStub_;
+  int verbose_;
+};
+
+} // namespace
+
+#endif
@@ -173,6 +173,11 @@ GEMCSCTriggerEfficiency::GEMCSCTriggerEfficiency(const edm::ParameterSet& iConfi
 
     // properly treat ganged ME1a in matching (consider triple ambiguity)
     gangedME1a = iConfig.getUntrackedParameter<bool>("gangedME1a", false);
+
+    // the fiducial LUT is only rebuilt when the GEM geometry changes, and is shared through the geometry cache
+    geometryCache_ = MuGeometryCache(iConfig.getUntrackedParameter<std::string>("geometryCacheDir", ""),
+                                     iConfig.getUntrackedParameter<std::string>("geometryVersion", ""));
+    mufiducial_ = new MuFiducial();
     //if (defaultME1a) gangedME1a = true;
 
     addGhostLCTs_ = iConfig.getUntrackedParameter< bool >("addGhostLCTs",true);
@@ -240,25 +245,25 @@ GEMCSCTriggerEfficiency::GEMCSCTriggerEfficiency(const edm::ParameterSet& iConfi
     //   double ETA_START_DT = 0.;
     //   double ETA_END_DT   = 1.2;
 
-    h_N_mctr  = fs->make<TH1D>("h_N_mctr","No of MC muons",16,-0.5,15.5);
-    h_N_simtr = fs->make<TH1D>("h_N_simtr","No of SimTrack muons",16,-0.5,15.5);
+    h_N_mctr  = hists_.book1D("h_N_mctr","No of MC muons",16,-0.5,15.5);
+    h_N_simtr = hists_.book1D("h_N_simtr","No of SimTrack muons",16,-0.5,15.5);
 
-    h_pt_mctr  = fs->make<TH1D>("h_pt_mctr","p_{T} of MC muons",50, 0.,100.);
-    h_eta_mctr  = fs->make<TH1D>("h_eta_mctr","#eta of MC muons",N_ETA_BINS, ETA_START, ETA_END);
-    h_phi_mctr  = fs->make<TH1D>("h_phi_mctr","#phi of MC muons",100, -M_PI,M_PI);
+    h_pt_mctr  = hists_.book1D("h_pt_mctr","p_{T} of MC muons",50, 0.,100.);
+    h_eta_mctr  = hists_.book1D("h_eta_mctr","#eta of MC muons",N_ETA_BINS, ETA_START, ETA_END);
+    h_phi_mctr  = hists_.book1D("h_phi_mctr","#phi of MC muons",100, -M_PI,M_PI);
 
-    h_DR_mctr_simtr    = fs->make<TH1D>("h_DR_mctr_simtr","#Delta R(MC trk, SimTrack)",300,0.,M_PI); 
-    h_MinDR_mctr_simtr = fs->make<TH1D>("h_MinDR_mctr_simtr","min #Delta R(MC trk, SimTrack)",300,0.,M_PI); 
+    h_DR_mctr_simtr    = hists_.book1D("h_DR_mctr_simtr","#Delta R(MC trk, SimTrack)",300,0.,M_PI); 
+    h_MinDR_mctr_simtr = hists_.book1D("h_MinDR_mctr_simtr","min #Delta R(MC trk, SimTrack)",300,0.,M_PI); 
 
-    h_DR_2SimTr        = fs->make<TH1D>("h_DR_2SimTr","#Delta R(SimTr 1, SimTr 2)",270,0.,M_PI*3/2); 
+    h_DR_2SimTr        = hists_.book1D("h_DR_2SimTr","#Delta R(SimTr 1, SimTr 2)",270,0.,M_PI*3/2); 
 
 
     // debug
-    // h_csctype_vs_alct_occup = fs->make<TH2D>("h_csctype_vs_alct_occup", "CSC type vs. ALCT chamber occupancy", 10, -0.5,  9.5, 5,-0.5,4.5);
+    // h_csctype_vs_alct_occup = hists_.book2D("h_csctype_vs_alct_occup", "CSC type vs. ALCT chamber occupancy", 10, -0.5,  9.5, 5,-0.5,4.5);
     // for (int i=1; i<=h_csctype_vs_alct_occup->GetXaxis()->GetNbins();i++)
     //   h_csctype_vs_alct_occup->GetXaxis()->SetBinLabel(i,csc_type[i-1].c_str());
 
-    // h_csctype_vs_clct_occup = fs->make<TH2D>("h_csctype_vs_clct_occup", "CSC type vs. CLCT chamber occupancy", 10, -0.5,  9.5, 5,-0.5,4.5);
+    // h_csctype_vs_clct_occup = hists_.book2D("h_csctype_vs_clct_occup", "CSC type vs. CLCT chamber occupancy", 10, -0.5,  9.5, 5,-0.5,4.5);
     // for (int i=1; i<=h_csctype_vs_clct_occup->GetXaxis()->GetNbins();i++)
     //   h_csctype_vs_clct_occup->GetXaxis()->SetBinLabel(i,csc_type[i-1].c_str());
 
@@ -268,66 +273,66 @@ GEMCSCTriggerEfficiency::GEMCSCTriggerEfficiency(const edm::ParameterSet& iConfi
         if (me==3 && !doME1a_) continue; // ME1/a
 
         sprintf(label,"h_bx__alct_cscdet_%s",csc_type_[me].c_str());
-        h_bx__alct_cscdet[me]  = fs->make<TH1D>(label, label, 13,-6.5, 6.5);
+        h_bx__alct_cscdet[me]  = hists_.book1D(label, label, 13,-6.5, 6.5);
 
         sprintf(label,"h_bx_min__alct_cscdet_%s",csc_type_[me].c_str());
-        h_bx_min__alct_cscdet[me]  = fs->make<TH1D>(label, label, 13,-6.5, 6.5);
+        h_bx_min__alct_cscdet[me]  = hists_.book1D(label, label, 13,-6.5, 6.5);
 
         sprintf(label,"h_bx__alctOk_cscdet_%s",csc_type_[me].c_str());
-        h_bx__alctOk_cscdet[me]  = fs->make<TH1D>(label, label, 13,-6.5, 6.5);
+        h_bx__alctOk_cscdet[me]  = hists_.book1D(label, label, 13,-6.5, 6.5);
 
         sprintf(label,"h_bx__alctOkBest_cscdet_%s",csc_type_[me].c_str());
-        h_bx__alctOkBest_cscdet[me]  = fs->make<TH1D>(label, label, 13,-6.5, 6.5);
+        h_bx__alctOkBest_cscdet[me]  = hists_.book1D(label, label, 13,-6.5, 6.5);
 
         sprintf(label,"h_bx__clctOkBest_cscdet_%s",csc_type_[me].c_str());
-        h_bx__clctOkBest_cscdet[me]  = fs->make<TH1D>(label, label, 13,-6.5, 6.5);
+        h_bx__clctOkBest_cscdet[me]  = hists_.book1D(label, label, 13,-6.5, 6.5);
 
         sprintf(label,"h_wg_vs_bx__alctOkBest_cscdet_%s",csc_type_[me].c_str());
-        h_wg_vs_bx__alctOkBest_cscdet[me]  = fs->make<TH2D>(label, label, 51, -1, 50, 13,-6.5, 6.5);
+        h_wg_vs_bx__alctOkBest_cscdet[me]  = hists_.book2D(label, label, 51, -1, 50, 13,-6.5, 6.5);
 
         sprintf(label,"h_bxf__alct_cscdet_%s",csc_type_[me].c_str());
-        h_bxf__alct_cscdet[me]  = fs->make<TH1D>(label, label, 13,-6.5, 6.5);
+        h_bxf__alct_cscdet[me]  = hists_.book1D(label, label, 13,-6.5, 6.5);
 
         sprintf(label,"h_bxf__alctOk_cscdet_%s",csc_type_[me].c_str());
-        h_bxf__alctOk_cscdet[me]  = fs->make<TH1D>(label, label, 13,-6.5, 6.5);
+        h_bxf__alctOk_cscdet[me]  = hists_.book1D(label, label, 13,-6.5, 6.5);
 
         sprintf(label,"h_dbxbxf__alct_cscdet_%s",csc_type_[me].c_str());
-        h_dbxbxf__alct_cscdet[me]  = fs->make<TH1D>(label, label, 13,-6.5, 6.5);
+        h_dbxbxf__alct_cscdet[me]  = hists_.book1D(label, label, 13,-6.5, 6.5);
 
         sprintf(label,"h_tf_stub_bx_cscdet_%s",csc_type_[me].c_str());
-        h_tf_stub_bx_cscdet[me] = fs->make<TH1D>(label, label, 15,-7.5, 7.5);
+        h_tf_stub_bx_cscdet[me] = hists_.book1D(label, label, 15,-7.5, 7.5);
 
         sprintf(label,"h_tf_stub_qu_cscdet_%s",csc_type_[me].c_str());
-        h_tf_stub_qu_cscdet[me] = fs->make<TH1D>(label, label, 17,-0.5, 16.5);
+        h_tf_stub_qu_cscdet[me] = hists_.book1D(label, label, 17,-0.5, 16.5);
     }//for (int me=0; me<CSC_TYPES; me++) 
 
-    h_tf_stub_bx = fs->make<TH1D>("h_tf_stub_bx","h_tf_stub_bx",15,-7.5, 7.5);
-    h_tf_stub_qu = fs->make<TH1D>("h_tf_stub_qu","h_tf_stub_qu",17,-0.5, 16.5);
-    h_tf_stub_qu_vs_bx = fs->make<TH2D>("h_tf_stub_qu_vs_bx","h_tf_stub_qu_vs_bx",17,-0.5, 16.5,15,-7.5, 7.5);
+    h_tf_stub_bx = hists_.book1D("h_tf_stub_bx","h_tf_stub_bx",15,-7.5, 7.5);
+    h_tf_stub_qu = hists_.book1D("h_tf_stub_qu","h_tf_stub_qu",17,-0.5, 16.5);
+    h_tf_stub_qu_vs_bx = hists_.book2D("h_tf_stub_qu_vs_bx","h_tf_stub_qu_vs_bx",17,-0.5, 16.5,15,-7.5, 7.5);
 
-    //  h_bx_me1_aclct_ok_lct_no__bx_alct_vs_dbx_ACLCT = fs->make<TH2D>("h_bx_me1_aclct_ok_lct_no__bx_alct_vs_dbx_ACLCT","h_bx_me1_aclct_ok_lct_no__bx_alct_vs_dbx_ACLCT",13,-0.5,12.5, 13, -6.5,6.5);
+    //  h_bx_me1_aclct_ok_lct_no__bx_alct_vs_dbx_ACLCT = hists_.book2D("h_bx_me1_aclct_ok_lct_no__bx_alct_vs_dbx_ACLCT","h_bx_me1_aclct_ok_lct_no__bx_alct_vs_dbx_ACLCT",13,-0.5,12.5, 13, -6.5,6.5);
 
     h_tf_stub_csctype = fs->make<TH1D>("h_tf_stub_csctype", "CSC type of TF track stubs", 10, -0.5,  9.5);
     for (int i=1; i<=h_tf_stub_csctype->GetXaxis()->GetNbins();i++)
         h_tf_stub_csctype->GetXaxis()->SetBinLabel(i,csc_type[i-1].c_str());
 
-    h_strip_v_wireg_me1a = fs->make<TH2D>("h_strip_v_wireg_me1a","h_strip_v_wireg_me1a",97,-0.5, 96.5, 20,-0.5,19.5);
-    h_strip_v_wireg_me1b = fs->make<TH2D>("h_strip_v_wireg_me1b","h_strip_v_wireg_me1b",129,-0.5, 128.5, 40, 8.5,48.5);
+    h_strip_v_wireg_me1a = hists_.book2D("h_strip_v_wireg_me1a","h_strip_v_wireg_me1a",97,-0.5, 96.5, 20,-0.5,19.5);
+    h_strip_v_wireg_me1b = hists_.book2D("h_strip_v_wireg_me1b","h_strip_v_wireg_me1b",129,-0.5, 128.5, 40, 8.5,48.5);
 
-    h_tfqu_pt10 = fs->make<TH1D>("h_tfqu_pt10","h_tfqu_pt10",5,-0.5, 4.5);
-    h_tfqu_pt10_no = fs->make<TH1D>("h_tfqu_pt10_no","h_tfqu_pt10_no",5,-0.5, 4.5);
+    h_tfqu_pt10 = hists_.book1D("h_tfqu_pt10","h_tfqu_pt10",5,-0.5, 4.5);
+    h_tfqu_pt10_no = hists_.book1D("h_tfqu_pt10_no","h_tfqu_pt10_no",5,-0.5, 4.5);
 
-    h_nMplct_vs_nDigiMplct = fs->make<TH2D>("h_nMplct_vs_nDigiMplct","h_nMplct_vs_nDigiMplct",9,-.5, 8.5,9,-.5, 8.5);
-    h_qu_vs_nDigiMplct = fs->make<TH2D>("h_qu_vs_nDigiMplct","h_qu_vs_nDigiMplct",5,-0.5, 4.5,9,-.5, 8.5);
+    h_nMplct_vs_nDigiMplct = hists_.book2D("h_nMplct_vs_nDigiMplct","h_nMplct_vs_nDigiMplct",9,-.5, 8.5,9,-.5, 8.5);
+    h_qu_vs_nDigiMplct = hists_.book2D("h_qu_vs_nDigiMplct","h_qu_vs_nDigiMplct",5,-0.5, 4.5,9,-.5, 8.5);
 
-    h_ntftrackall_vs_ntftrack = fs->make<TH2D>("h_ntftrackall_vs_ntftrack","h_ntftrackall_vs_ntftrack",6,-0.5,5.5,6,-0.5,5.5);
-    h_ntfcandall_vs_ntfcand = fs->make<TH2D>("h_ntfcandall_vs_ntfcand","h_ntfcandall_vs_ntfcand",6,-0.5,5.5,6,-0.5,5.5);
+    h_ntftrackall_vs_ntftrack = hists_.book2D("h_ntftrackall_vs_ntftrack","h_ntftrackall_vs_ntftrack",6,-0.5,5.5,6,-0.5,5.5);
+    h_ntfcandall_vs_ntfcand = hists_.book2D("h_ntfcandall_vs_ntfcand","h_ntfcandall_vs_ntfcand",6,-0.5,5.5,6,-0.5,5.5);
 
-    h_pt_vs_ntfcand = fs->make<TH2D>("h_pt_vs_ntfcand","h_pt_vs_ntfcand",50, 0.,100.,6,-0.5,5.5);
-    h_eta_vs_ntfcand = fs->make<TH2D>("h_eta_vs_ntfcand","h_eta_vs_ntfcand",N_ETA_BINS, ETA_START, ETA_END,4,-0.5,3.5); 
+    h_pt_vs_ntfcand = hists_.book2D("h_pt_vs_ntfcand","h_pt_vs_ntfcand",50, 0.,100.,6,-0.5,5.5);
+    h_eta_vs_ntfcand = hists_.book2D("h_eta_vs_ntfcand","h_eta_vs_ntfcand",N_ETA_BINS, ETA_START, ETA_END,4,-0.5,3.5); 
 
-    h_pt_vs_qu = fs->make<TH2D>("h_pt_vs_qu","h_pt_vs_qu",100, 0.,100.,5,-0.5, 4.5);
-    h_eta_vs_qu = fs->make<TH2D>("h_eta_vs_qu","h_eta_vs_qu",N_ETA_BINS, ETA_START, ETA_END,5,-0.5, 4.5);
+    h_pt_vs_qu = hists_.book2D("h_pt_vs_qu","h_pt_vs_qu",100, 0.,100.,5,-0.5, 4.5);
+    h_eta_vs_qu = hists_.book2D("h_eta_vs_qu","h_eta_vs_qu",N_ETA_BINS, ETA_START, ETA_END,5,-0.5, 4.5);
 
     h_cscdet_of_chamber = fs->make<TH1D>("h_cscdet_of_chamber","h_cscdet_of_chamber",10, -0.5,  9.5);
     h_cscdet_of_chamber_w_alct = fs->make<TH1D>("h_cscdet_of_chamber_w_alct","h_cscdet_of_chamber_w_alct",10, -0.5,  9.5);
@@ -344,229 +349,229 @@ GEMCSCTriggerEfficiency::GEMCSCTriggerEfficiency(const edm::ParameterSet& iConfi
     double PT_START = 0.;
     double PT_END = 100.;
 
-    h_pt_initial0 = fs->make<TH1D>("h_pt_initial0","h_pt_initial0",N_PT_BINS, PT_START, PT_END);
-    h_pt_initial = fs->make<TH1D>("h_pt_initial","h_pt_initial",N_PT_BINS, PT_START, PT_END);
-    h_pt_initial_1b = fs->make<TH1D>("h_pt_initial_1b","h_pt_initial_1b",N_PT_BINS, PT_START, PT_END);
-    h_pt_initial_gem_1b = fs->make<TH1D>("h_pt_initial_gem_1b","h_pt_initial_gem_1b",N_PT_BINS, PT_START, PT_END);
+    h_pt_initial0 = hists_.book1D("h_pt_initial0","h_pt_initial0",N_PT_BINS, PT_START, PT_END);
+    h_pt_initial = hists_.book1D("h_pt_initial","h_pt_initial",N_PT_BINS, PT_START, PT_END);
+    h_pt_initial_1b = hists_.book1D("h_pt_initial_1b","h_pt_initial_1b",N_PT_BINS, PT_START, PT_END);
+    h_pt_initial_gem_1b = hists_.book1D("h_pt_initial_gem_1b","h_pt_initial_gem_1b",N_PT_BINS, PT_START, PT_END);
 
-    h_pt_me1_initial = fs->make<TH1D>("h_pt_me1_initial","h_pt_me1_initial",N_PT_BINS, PT_START, PT_END);
-    h_pt_me2_initial = fs->make<TH1D>("h_pt_me2_initial","h_pt_me2_initial",N_PT_BINS, PT_START, PT_END);
-    h_pt_me3_initial = fs->make<TH1D>("h_pt_me3_initial","h_pt_me3_initial",N_PT_BINS, PT_START, PT_END);
-    h_pt_me4_initial = fs->make<TH1D>("h_pt_me4_initial","h_pt_me4_initial",N_PT_BINS, PT_START, PT_END);
+    h_pt_me1_initial = hists_.book1D("h_pt_me1_initial","h_pt_me1_initial",N_PT_BINS, PT_START, PT_END);
+    h_pt_me2_initial = hists_.book1D("h_pt_me2_initial","h_pt_me2_initial",N_PT_BINS, PT_START, PT_END);
+    h_pt_me3_initial = hists_.book1D("h_pt_me3_initial","h_pt_me3_initial",N_PT_BINS, PT_START, PT_END);
+    h_pt_me4_initial = hists_.book1D("h_pt_me4_initial","h_pt_me4_initial",N_PT_BINS, PT_START, PT_END);
 
-    h_pt_initial_1st = fs->make<TH1D>("h_pt_initial_1st","h_pt_initial_1st",N_PT_BINS, PT_START, PT_END);
-    h_pt_initial_2st = fs->make<TH1D>("h_pt_initial_2st","h_pt_initial_2st",N_PT_BINS, PT_START, PT_END);
-    h_pt_initial_3st = fs->make<TH1D>("h_pt_initial_3st","h_pt_initial_3st",N_PT_BINS, PT_START, PT_END);
+    h_pt_initial_1st = hists_.book1D("h_pt_initial_1st","h_pt_initial_1st",N_PT_BINS, PT_START, PT_END);
+    h_pt_initial_2st = hists_.book1D("h_pt_initial_2st","h_pt_initial_2st",N_PT_BINS, PT_START, PT_END);
+    h_pt_initial_3st = hists_.book1D("h_pt_initial_3st","h_pt_initial_3st",N_PT_BINS, PT_START, PT_END);
 
-    h_pt_me1_initial_2st = fs->make<TH1D>("h_pt_me1_initial_2st","h_pt_me1_initial_2st",N_PT_BINS, PT_START, PT_END);
-    h_pt_me1_initial_3st = fs->make<TH1D>("h_pt_me1_initial_3st","h_pt_me1_initial_3st",N_PT_BINS, PT_START, PT_END);
+    h_pt_me1_initial_2st = hists_.book1D("h_pt_me1_initial_2st","h_pt_me1_initial_2st",N_PT_BINS, PT_START, PT_END);
+    h_pt_me1_initial_3st = hists_.book1D("h_pt_me1_initial_3st","h_pt_me1_initial_3st",N_PT_BINS, PT_START, PT_END);
 
 
-    h_pt_gem_1b = fs->make<TH1D>("h_pt_gem_1b","h_pt_gem_1b",N_PT_BINS, PT_START, PT_END);
-    h_pt_lctgem_1b = fs->make<TH1D>("h_pt_lctgem_1b","h_pt_lctgem_1b",N_PT_BINS, PT_START, PT_END);
+    h_pt_gem_1b = hists_.book1D("h_pt_gem_1b","h_pt_gem_1b",N_PT_BINS, PT_START, PT_END);
+    h_pt_lctgem_1b = hists_.book1D("h_pt_lctgem_1b","h_pt_lctgem_1b",N_PT_BINS, PT_START, PT_END);
 
-    h_pt_me1_mpc = fs->make<TH1D>("h_pt_me1_mpc","h_pt_me1_mpc",N_PT_BINS, PT_START, PT_END);
-    h_pt_me2_mpc = fs->make<TH1D>("h_pt_me2_mpc","h_pt_me2_mpc",N_PT_BINS, PT_START, PT_END);
-    h_pt_me3_mpc = fs->make<TH1D>("h_pt_me3_mpc","h_pt_me3_mpc",N_PT_BINS, PT_START, PT_END);
-    h_pt_me4_mpc = fs->make<TH1D>("h_pt_me4_mpc","h_pt_me4_mpc",N_PT_BINS, PT_START, PT_END);
+    h_pt_me1_mpc = hists_.book1D("h_pt_me1_mpc","h_pt_me1_mpc",N_PT_BINS, PT_START, PT_END);
+    h_pt_me2_mpc = hists_.book1D("h_pt_me2_mpc","h_pt_me2_mpc",N_PT_BINS, PT_START, PT_END);
+    h_pt_me3_mpc = hists_.book1D("h_pt_me3_mpc","h_pt_me3_mpc",N_PT_BINS, PT_START, PT_END);
+    h_pt_me4_mpc = hists_.book1D("h_pt_me4_mpc","h_pt_me4_mpc",N_PT_BINS, PT_START, PT_END);
 
-    h_pt_mpc_1st = fs->make<TH1D>("h_pt_mpc_1st","h_pt_mpc_1st",N_PT_BINS, PT_START, PT_END);
-    h_pt_mpc_2st = fs->make<TH1D>("h_pt_mpc_2st","h_pt_mpc_2st",N_PT_BINS, PT_START, PT_END);
-    h_pt_mpc_3st = fs->make<TH1D>("h_pt_mpc_3st","h_pt_mpc_3st",N_PT_BINS, PT_START, PT_END);
+    h_pt_mpc_1st = hists_.book1D("h_pt_mpc_1st","h_pt_mpc_1st",N_PT_BINS, PT_START, PT_END);
+    h_pt_mpc_2st = hists_.book1D("h_pt_mpc_2st","h_pt_mpc_2st",N_PT_BINS, PT_START, PT_END);
+    h_pt_mpc_3st = hists_.book1D("h_pt_mpc_3st","h_pt_mpc_3st",N_PT_BINS, PT_START, PT_END);
 
-    h_pt_me1_mpc_2st = fs->make<TH1D>("h_pt_me1_mpc_2st","h_pt_me1_mpc_2st",N_PT_BINS, PT_START, PT_END);
-    h_pt_me1_mpc_3st = fs->make<TH1D>("h_pt_me1_mpc_3st","h_pt_me1_mpc_3st",N_PT_BINS, PT_START, PT_END);
+    h_pt_me1_mpc_2st = hists_.book1D("h_pt_me1_mpc_2st","h_pt_me1_mpc_2st",N_PT_BINS, PT_START, PT_END);
+    h_pt_me1_mpc_3st = hists_.book1D("h_pt_me1_mpc_3st","h_pt_me1_mpc_3st",N_PT_BINS, PT_START, PT_END);
 
 
-    h_eta_initial0 = fs->make<TH1D>("h_eta_initial0","h_eta_initial0",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_initial = fs->make<TH1D>("h_eta_initial","h_eta_initial",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_initial0 = hists_.book1D("h_eta_initial0","h_eta_initial0",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_initial = hists_.book1D("h_eta_initial","h_eta_initial",N_ETA_BINS, ETA_START, ETA_END);
 
-    h_eta_me11_initial = fs->make<TH1D>("h_eta_me11_initial","h_eta_me11_initial",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_initial = fs->make<TH1D>("h_eta_me1_initial","h_eta_me1_initial",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me2_initial = fs->make<TH1D>("h_eta_me2_initial","h_eta_me2_initial",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me3_initial = fs->make<TH1D>("h_eta_me3_initial","h_eta_me3_initial",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me4_initial = fs->make<TH1D>("h_eta_me4_initial","h_eta_me4_initial",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me11_initial = hists_.book1D("h_eta_me11_initial","h_eta_me11_initial",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_initial = hists_.book1D("h_eta_me1_initial","h_eta_me1_initial",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me2_initial = hists_.book1D("h_eta_me2_initial","h_eta_me2_initial",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me3_initial = hists_.book1D("h_eta_me3_initial","h_eta_me3_initial",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me4_initial = hists_.book1D("h_eta_me4_initial","h_eta_me4_initial",N_ETA_BINS, ETA_START, ETA_END);
 
-    h_eta_initial_1st = fs->make<TH1D>("h_eta_initial_1st","h_eta_initial_1st",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_initial_2st = fs->make<TH1D>("h_eta_initial_2st","h_eta_initial_2st",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_initial_3st = fs->make<TH1D>("h_eta_initial_3st","h_eta_initial_3st",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_initial_1st = hists_.book1D("h_eta_initial_1st","h_eta_initial_1st",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_initial_2st = hists_.book1D("h_eta_initial_2st","h_eta_initial_2st",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_initial_3st = hists_.book1D("h_eta_initial_3st","h_eta_initial_3st",N_ETA_BINS, ETA_START, ETA_END);
 
-    h_eta_me1_initial_2st = fs->make<TH1D>("h_eta_me1_initial_2st","h_eta_me1_initial_2st",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_initial_3st = fs->make<TH1D>("h_eta_me1_initial_3st","h_eta_me1_initial_3st",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_initial_2st = hists_.book1D("h_eta_me1_initial_2st","h_eta_me1_initial_2st",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_initial_3st = hists_.book1D("h_eta_me1_initial_3st","h_eta_me1_initial_3st",N_ETA_BINS, ETA_START, ETA_END);
 
 
-    h_eta_me1_mpc = fs->make<TH1D>("h_eta_me1_mpc","h_eta_me1_mpc",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me2_mpc = fs->make<TH1D>("h_eta_me2_mpc","h_eta_me2_mpc",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me3_mpc = fs->make<TH1D>("h_eta_me3_mpc","h_eta_me3_mpc",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me4_mpc = fs->make<TH1D>("h_eta_me4_mpc","h_eta_me4_mpc",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_mpc = hists_.book1D("h_eta_me1_mpc","h_eta_me1_mpc",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me2_mpc = hists_.book1D("h_eta_me2_mpc","h_eta_me2_mpc",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me3_mpc = hists_.book1D("h_eta_me3_mpc","h_eta_me3_mpc",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me4_mpc = hists_.book1D("h_eta_me4_mpc","h_eta_me4_mpc",N_ETA_BINS, ETA_START, ETA_END);
 
-    h_eta_mpc_1st = fs->make<TH1D>("h_eta_mpc_1st","h_eta_mpc_1st",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_mpc_2st = fs->make<TH1D>("h_eta_mpc_2st","h_eta_mpc_2st",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_mpc_3st = fs->make<TH1D>("h_eta_mpc_3st","h_eta_mpc_3st",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_mpc_1st = hists_.book1D("h_eta_mpc_1st","h_eta_mpc_1st",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_mpc_2st = hists_.book1D("h_eta_mpc_2st","h_eta_mpc_2st",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_mpc_3st = hists_.book1D("h_eta_mpc_3st","h_eta_mpc_3st",N_ETA_BINS, ETA_START, ETA_END);
 
-    h_eta_me1_mpc_2st = fs->make<TH1D>("h_eta_me1_mpc_2st","h_eta_me1_mpc_2st",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_mpc_3st = fs->make<TH1D>("h_eta_me1_mpc_3st","h_eta_me1_mpc_3st",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_mpc_2st = hists_.book1D("h_eta_me1_mpc_2st","h_eta_me1_mpc_2st",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_mpc_3st = hists_.book1D("h_eta_me1_mpc_3st","h_eta_me1_mpc_3st",N_ETA_BINS, ETA_START, ETA_END);
 
 
-    h_eta_vs_ncscsh = fs->make<TH2D>("h_eta_vs_ncscsh","h_eta_vs_ncscsh",N_ETA_BINS, ETA_START, ETA_END,41,-0.5,40.5); 
-    h_eta_vs_nalct = fs->make<TH2D>("h_eta_vs_nalct","h_eta_vs_nalct",N_ETA_BINS, ETA_START, ETA_END,13,-0.5,12.5); 
-    h_eta_vs_nclct = fs->make<TH2D>("h_eta_vs_nclct","h_eta_vs_nclct",N_ETA_BINS, ETA_START, ETA_END,13,-0.5,12.5); 
-    h_eta_vs_nlct  = fs->make<TH2D>("h_eta_vs_nlct","h_eta_vs_nlct",N_ETA_BINS, ETA_START, ETA_END,13,-0.5,12.5); 
-    h_eta_vs_nmplct  = fs->make<TH2D>("h_eta_vs_nmplct","h_eta_vs_nmplct",N_ETA_BINS, ETA_START, ETA_END,13,-0.5,12.5); 
+    h_eta_vs_ncscsh = hists_.book2D("h_eta_vs_ncscsh","h_eta_vs_ncscsh",N_ETA_BINS, ETA_START, ETA_END,41,-0.5,40.5); 
+    h_eta_vs_nalct = hists_.book2D("h_eta_vs_nalct","h_eta_vs_nalct",N_ETA_BINS, ETA_START, ETA_END,13,-0.5,12.5); 
+    h_eta_vs_nclct = hists_.book2D("h_eta_vs_nclct","h_eta_vs_nclct",N_ETA_BINS, ETA_START, ETA_END,13,-0.5,12.5); 
+    h_eta_vs_nlct  = hists_.book2D("h_eta_vs_nlct","h_eta_vs_nlct",N_ETA_BINS, ETA_START, ETA_END,13,-0.5,12.5); 
+    h_eta_vs_nmplct  = hists_.book2D("h_eta_vs_nmplct","h_eta_vs_nmplct",N_ETA_BINS, ETA_START, ETA_END,13,-0.5,12.5); 
 
-    h_pt_vs_ncscsh = fs->make<TH2D>("h_pt_vs_ncscsh","h_pt_vs_ncscsh",50, 0.,100.,41,-0.5,40.5); 
-    h_pt_vs_nalct = fs->make<TH2D>("h_pt_vs_nalct","h_pt_vs_nalct",50, 0.,100.,13,-0.5,12.5);
-    h_pt_vs_nclct = fs->make<TH2D>("h_pt_vs_nclct","h_pt_vs_nclct",50, 0.,100.,13,-0.5,12.5);
-    h_pt_vs_nlct = fs->make<TH2D>("h_pt_vs_nlct","h_pt_vs_nlct",50, 0.,100.,13,-0.5,12.5);
-    h_pt_vs_nmplct = fs->make<TH2D>("h_pt_vs_nmplct","h_pt_vs_nmplct",50, 0.,100.,13,-0.5,12.5);
+    h_pt_vs_ncscsh = hists_.book2D("h_pt_vs_ncscsh","h_pt_vs_ncscsh",50, 0.,100.,41,-0.5,40.5); 
+    h_pt_vs_nalct = hists_.book2D("h_pt_vs_nalct","h_pt_vs_nalct",50, 0.,100.,13,-0.5,12.5);
+    h_pt_vs_nclct = hists_.book2D("h_pt_vs_nclct","h_pt_vs_nclct",50, 0.,100.,13,-0.5,12.5);
+    h_pt_vs_nlct = hists_.book2D("h_pt_vs_nlct","h_pt_vs_nlct",50, 0.,100.,13,-0.5,12.5);
+    h_pt_vs_nmplct = hists_.book2D("h_pt_vs_nmplct","h_pt_vs_nmplct",50, 0.,100.,13,-0.5,12.5);
 
-    h_pt_after_alct = fs->make<TH1D>("h_pt_after_alct","h_pt_after_alct",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_clct = fs->make<TH1D>("h_pt_after_clct","h_pt_after_clct",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_alct = hists_.book1D("h_pt_after_alct","h_pt_after_alct",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_clct = hists_.book1D("h_pt_after_clct","h_pt_after_clct",N_PT_BINS, PT_START, PT_END);
 
-    h_pt_me1_after_alct = fs->make<TH1D>("h_pt_me1_after_alct","h_pt_me1_after_alct",N_PT_BINS, PT_START, PT_END);
-    h_pt_me1_after_clct = fs->make<TH1D>("h_pt_me1_after_clct","h_pt_me1_after_clct",N_PT_BINS, PT_START, PT_END);
-    h_pt_me1_after_alct_okAlct = fs->make<TH1D>("h_pt_me1_after_alct_okAlct","h_pt_me1_after_alct_okAlct",N_PT_BINS, PT_START, PT_END);
-    h_pt_me1_after_clct_okClct = fs->make<TH1D>("h_pt_me1_after_clct_okClct","h_pt_me1_after_clct_okClct",N_PT_BINS, PT_START, PT_END);
+    h_pt_me1_after_alct = hists_.book1D("h_pt_me1_after_alct","h_pt_me1_after_alct",N_PT_BINS, PT_START, PT_END);
+    h_pt_me1_after_clct = hists_.book1D("h_pt_me1_after_clct","h_pt_me1_after_clct",N_PT_BINS, PT_START, PT_END);
+    h_pt_me1_after_alct_okAlct = hists_.book1D("h_pt_me1_after_alct_okAlct","h_pt_me1_after_alct_okAlct",N_PT_BINS, PT_START, PT_END);
+    h_pt_me1_after_clct_okClct = hists_.book1D("h_pt_me1_after_clct_okClct","h_pt_me1_after_clct_okClct",N_PT_BINS, PT_START, PT_END);
 
-    h_pt_after_lct = fs->make<TH1D>("h_pt_after_lct","h_pt_after_lct",N_PT_BINS, PT_START, PT_END);
-    h_pt_me1_after_lct_okAlctClct = fs->make<TH1D>("h_pt_me1_after_lct_okAlctClct","h_pt_me1_after_lct_okAlctClct",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_lct = hists_.book1D("h_pt_after_lct","h_pt_after_lct",N_PT_BINS, PT_START, PT_END);
+    h_pt_me1_after_lct_okAlctClct = hists_.book1D("h_pt_me1_after_lct_okAlctClct","h_pt_me1_after_lct_okAlctClct",N_PT_BINS, PT_START, PT_END);
 
 
-    h_pt_after_mpc = fs->make<TH1D>("h_pt_after_mpc","h_pt_after_mpc",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_mpc_ok_plus = fs->make<TH1D>("h_pt_after_mpc_ok_plus","h_pt_after_mpc_ok_plus",N_PT_BINS, PT_START, PT_END);
-    h_pt_me1_after_mpc_ok_plus = fs->make<TH1D>("h_pt_after_mpc_me1_plus","h_pt_me1_after_mpc_ok_plus",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_tftrack = fs->make<TH1D>("h_pt_after_tftrack","h_pt_after_tftrack",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_mpc = hists_.book1D("h_pt_after_mpc","h_pt_after_mpc",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_mpc_ok_plus = hists_.book1D("h_pt_after_mpc_ok_plus","h_pt_after_mpc_ok_plus",N_PT_BINS, PT_START, PT_END);
+    h_pt_me1_after_mpc_ok_plus = hists_.book1D("h_pt_after_mpc_me1_plus","h_pt_me1_after_mpc_ok_plus",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_tftrack = hists_.book1D("h_pt_after_tftrack","h_pt_after_tftrack",N_PT_BINS, PT_START, PT_END);
 
-    h_pt_after_tfcand = fs->make<TH1D>("h_pt_after_tfcand","h_pt_after_tfcand",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_tfcand_pt10 = fs->make<TH1D>("h_pt_after_tfcand_pt10","h_pt_after_tfcand_pt10",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_tfcand_pt20 = fs->make<TH1D>("h_pt_after_tfcand_pt20","h_pt_after_tfcand_pt20",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_tfcand_pt40 = fs->make<TH1D>("h_pt_after_tfcand_pt40","h_pt_after_tfcand_pt40",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_tfcand_pt60 = fs->make<TH1D>("h_pt_after_tfcand_pt60","h_pt_after_tfcand_pt60",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_tfcand = hists_.book1D("h_pt_after_tfcand","h_pt_after_tfcand",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_tfcand_pt10 = hists_.book1D("h_pt_after_tfcand_pt10","h_pt_after_tfcand_pt10",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_tfcand_pt20 = hists_.book1D("h_pt_after_tfcand_pt20","h_pt_after_tfcand_pt20",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_tfcand_pt40 = hists_.book1D("h_pt_after_tfcand_pt40","h_pt_after_tfcand_pt40",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_tfcand_pt60 = hists_.book1D("h_pt_after_tfcand_pt60","h_pt_after_tfcand_pt60",N_PT_BINS, PT_START, PT_END);
 
     //h_pt_after_tftrack_ok = fs->make<TH1D>("h_pt_after_tftrack_ok","h_pt_after_tftrack_ok",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_tfcand_ok = fs->make<TH1D>("h_pt_after_tfcand_ok","h_pt_after_tfcand_ok",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_tfcand_pt10_ok = fs->make<TH1D>("h_pt_after_tfcand_pt10_ok","h_pt_after_tfcand_pt10_ok",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_tfcand_pt20_ok = fs->make<TH1D>("h_pt_after_tfcand_pt20_ok","h_pt_after_tfcand_pt20_ok",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_tfcand_pt40_ok = fs->make<TH1D>("h_pt_after_tfcand_pt40_ok","h_pt_after_tfcand_pt40_ok",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_tfcand_pt60_ok = fs->make<TH1D>("h_pt_after_tfcand_pt60_ok","h_pt_after_tfcand_pt60_ok",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_tfcand_ok = hists_.book1D("h_pt_after_tfcand_ok","h_pt_after_tfcand_ok",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_tfcand_pt10_ok = hists_.book1D("h_pt_after_tfcand_pt10_ok","h_pt_after_tfcand_pt10_ok",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_tfcand_pt20_ok = hists_.book1D("h_pt_after_tfcand_pt20_ok","h_pt_after_tfcand_pt20_ok",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_tfcand_pt40_ok = hists_.book1D("h_pt_after_tfcand_pt40_ok","h_pt_after_tfcand_pt40_ok",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_tfcand_pt60_ok = hists_.book1D("h_pt_after_tfcand_pt60_ok","h_pt_after_tfcand_pt60_ok",N_PT_BINS, PT_START, PT_END);
 
     const int Nthr = 7;
     std::string str_pts[Nthr] = {"", "_pt10", "_pt15", "_pt20", "_pt25", "_pt30","_pt40"};
     for (int i = 0; i < Nthr; ++i) {
         std::string prefix = "h_pt_after_tfcand_eta1b_";
-        h_pt_after_tfcand_eta1b_2s[i] = fs->make<TH1D>((prefix + "2s" + str_pts[i]).c_str(), (prefix + "2s" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
-        h_pt_after_tfcand_eta1b_2s1b[i] = fs->make<TH1D>((prefix + "2s1b" + str_pts[i]).c_str(), (prefix + "2s1b" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
-        h_pt_after_tfcand_eta1b_2s123[i] = fs->make<TH1D>((prefix + "2s123" + str_pts[i]).c_str(), (prefix + "2s123" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
-        h_pt_after_tfcand_eta1b_2s13[i] = fs->make<TH1D>((prefix + "2s13" + str_pts[i]).c_str(), (prefix + "2s13" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
-        h_pt_after_tfcand_eta1b_3s[i] = fs->make<TH1D>((prefix + "3s" + str_pts[i]).c_str(), (prefix + "3s" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
-        h_pt_after_tfcand_eta1b_3s1b[i] = fs->make<TH1D>((prefix + "3s1b" + str_pts[i]).c_str(), (prefix + "3s1b" + str_pts[i]).c_str(),N_PT_BINS, PT_START, PT_END);
+        h_pt_after_tfcand_eta1b_2s[i] = hists_.book1D((prefix + "2s" + str_pts[i]).c_str(), (prefix + "2s" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
+        h_pt_after_tfcand_eta1b_2s1b[i] = hists_.book1D((prefix + "2s1b" + str_pts[i]).c_str(), (prefix + "2s1b" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
+        h_pt_after_tfcand_eta1b_2s123[i] = hists_.book1D((prefix + "2s123" + str_pts[i]).c_str(), (prefix + "2s123" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
+        h_pt_after_tfcand_eta1b_2s13[i] = hists_.book1D((prefix + "2s13" + str_pts[i]).c_str(), (prefix + "2s13" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
+        h_pt_after_tfcand_eta1b_3s[i] = hists_.book1D((prefix + "3s" + str_pts[i]).c_str(), (prefix + "3s" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
+        h_pt_after_tfcand_eta1b_3s1b[i] = hists_.book1D((prefix + "3s1b" + str_pts[i]).c_str(), (prefix + "3s1b" + str_pts[i]).c_str(),N_PT_BINS, PT_START, PT_END);
         prefix = "h_pt_after_tfcand_gem1b_";
-        h_pt_after_tfcand_gem1b_2s1b[i] = fs->make<TH1D>((prefix + "2s1b" + str_pts[i]).c_str(), (prefix + "2s1b" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
-        h_pt_after_tfcand_gem1b_2s123[i] = fs->make<TH1D>((prefix + "2s123" + str_pts[i]).c_str(), (prefix + "2s123" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
-        h_pt_after_tfcand_gem1b_2s13[i] = fs->make<TH1D>((prefix + "2s13" + str_pts[i]).c_str(), (prefix + "2s13" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
-        h_pt_after_tfcand_gem1b_3s1b[i] = fs->make<TH1D>((prefix + "3s1b" + str_pts[i]).c_str(), (prefix + "3s1b" + str_pts[i]).c_str(),N_PT_BINS, PT_START, PT_END);
+        h_pt_after_tfcand_gem1b_2s1b[i] = hists_.book1D((prefix + "2s1b" + str_pts[i]).c_str(), (prefix + "2s1b" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
+        h_pt_after_tfcand_gem1b_2s123[i] = hists_.book1D((prefix + "2s123" + str_pts[i]).c_str(), (prefix + "2s123" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
+        h_pt_after_tfcand_gem1b_2s13[i] = hists_.book1D((prefix + "2s13" + str_pts[i]).c_str(), (prefix + "2s13" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
+        h_pt_after_tfcand_gem1b_3s1b[i] = hists_.book1D((prefix + "3s1b" + str_pts[i]).c_str(), (prefix + "3s1b" + str_pts[i]).c_str(),N_PT_BINS, PT_START, PT_END);
         prefix = "h_pt_after_tfcand_dphigem1b_";
-        h_pt_after_tfcand_dphigem1b_2s1b[i] = fs->make<TH1D>((prefix + "2s1b" + str_pts[i]).c_str(), (prefix + "2s1b" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
-        h_pt_after_tfcand_dphigem1b_2s123[i] = fs->make<TH1D>((prefix + "2s123" + str_pts[i]).c_str(), (prefix + "2s123" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
-        h_pt_after_tfcand_dphigem1b_2s13[i] = fs->make<TH1D>((prefix + "2s13" + str_pts[i]).c_str(), (prefix + "2s13" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
-        h_pt_after_tfcand_dphigem1b_3s1b[i] = fs->make<TH1D>((prefix + "3s1b" + str_pts[i]).c_str(), (prefix + "3s1b" + str_pts[i]).c_str(),N_PT_BINS, PT_START, PT_END);
+        h_pt_after_tfcand_dphigem1b_2s1b[i] = hists_.book1D((prefix + "2s1b" + str_pts[i]).c_str(), (prefix + "2s1b" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
+        h_pt_after_tfcand_dphigem1b_2s123[i] = hists_.book1D((prefix + "2s123" + str_pts[i]).c_str(), (prefix + "2s123" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
+        h_pt_after_tfcand_dphigem1b_2s13[i] = hists_.book1D((prefix + "2s13" + str_pts[i]).c_str(), (prefix + "2s13" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
+        h_pt_after_tfcand_dphigem1b_3s1b[i] = hists_.book1D((prefix + "3s1b" + str_pts[i]).c_str(), (prefix + "3s1b" + str_pts[i]).c_str(),N_PT_BINS, PT_START, PT_END);
 
         prefix = "h_mode_tfcand_gem1b_2s1b_1b_";
         h_mode_tfcand_gem1b_2s1b_1b[i] = fs->make<TH1D>((prefix + str_pts[i]).c_str(), (prefix + str_pts[i]).c_str(), 16, -0.5, 15.5);
         setupTFModeHisto(h_mode_tfcand_gem1b_2s1b_1b[i]);
     }
 
-    h_pt_after_tfcand_ok_plus = fs->make<TH1D>("h_pt_after_tfcand_ok_plus","h_pt_after_tfcand_ok_plus",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_tfcand_ok_plus_pt10 = fs->make<TH1D>("h_pt_after_tfcand_ok_plus_pt10","h_pt_after_tfcand_ok_plus_pt10",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_tfcand_ok_plus_q[0] = fs->make<TH1D>("h_pt_after_tfcand_ok_plus_q1","h_pt_after_tfcand_ok_plus_q1",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_tfcand_ok_plus_q[1] = fs->make<TH1D>("h_pt_after_tfcand_ok_plus_q2","h_pt_after_tfcand_ok_plus_q2",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_tfcand_ok_plus_q[2] = fs->make<TH1D>("h_pt_after_tfcand_ok_plus_q3","h_pt_after_tfcand_ok_plus_q3",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_tfcand_ok_plus_pt10_q[0] = fs->make<TH1D>("h_pt_after_tfcand_ok_plus_pt10_q1","h_pt_after_tfcand_ok_plus_pt10_q1",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_tfcand_ok_plus_pt10_q[1] = fs->make<TH1D>("h_pt_after_tfcand_ok_plus_pt10_q2","h_pt_after_tfcand_ok_plus_pt10_q2",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_tfcand_ok_plus_pt10_q[2] = fs->make<TH1D>("h_pt_after_tfcand_ok_plus_pt10_q3","h_pt_after_tfcand_ok_plus_pt10_q3",N_PT_BINS, PT_START, PT_END);
-
-    h_pt_after_tfcand_all = fs->make<TH1D>("h_pt_after_tfcand_all","h_pt_after_tfcand_all",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_tfcand_all_ok = fs->make<TH1D>("h_pt_after_tfcand_all_ok","h_pt_after_tfcand_all_ok",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_tfcand_all_pt10_ok = fs->make<TH1D>("h_pt_after_tfcand_all_pt10_ok","h_pt_after_tfcand_all_pt10_ok",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_tfcand_all_pt20_ok = fs->make<TH1D>("h_pt_after_tfcand_all_pt20_ok","h_pt_after_tfcand_all_pt20_ok",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_tfcand_all_pt40_ok = fs->make<TH1D>("h_pt_after_tfcand_all_pt40_ok","h_pt_after_tfcand_all_pt40_ok",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_tfcand_all_pt60_ok = fs->make<TH1D>("h_pt_after_tfcand_all_pt60_ok","h_pt_after_tfcand_all_pt60_ok",N_PT_BINS, PT_START, PT_END);
-
-    h_pt_after_gmtreg = fs->make<TH1D>("h_pt_after_gmtreg","h_pt_after_gmtreg",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_gmtreg_all = fs->make<TH1D>("h_pt_after_gmtreg_all","h_pt_after_gmtreg_all",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_gmtreg_dr = fs->make<TH1D>("h_pt_after_gmtreg_dr","h_pt_after_gmtreg_dr",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_gmt = fs->make<TH1D>("h_pt_after_gmt","h_pt_after_gmt",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_gmt_all = fs->make<TH1D>("h_pt_after_gmt_all","h_pt_after_gmt_all",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_gmt_dr = fs->make<TH1D>("h_pt_after_gmt_dr","h_pt_after_gmt_dr",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_gmt_dr_nocsc = fs->make<TH1D>("h_pt_after_gmt_dr_nocsc","h_pt_after_gmt_dr_nocsc",N_PT_BINS, PT_START, PT_END);
-
-    h_pt_after_gmtreg_pt10 = fs->make<TH1D>("h_pt_after_gmtreg_pt10","h_pt_after_gmtreg_pt10",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_gmtreg_all_pt10 = fs->make<TH1D>("h_pt_after_gmtreg_all_pt10","h_pt_after_gmtreg_all_pt10",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_gmtreg_dr_pt10 = fs->make<TH1D>("h_pt_after_gmtreg_dr_pt10","h_pt_after_gmtreg_dr_pt10",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_gmt_pt10 = fs->make<TH1D>("h_pt_after_gmt_pt10","h_pt_after_gmt_pt10",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_gmt_all_pt10 = fs->make<TH1D>("h_pt_after_gmt_all_pt10","h_pt_after_gmt_all_pt10",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_gmt_dr_pt10 = fs->make<TH1D>("h_pt_after_gmt_dr_pt10","h_pt_after_gmt_dr_pt10",N_PT_BINS, PT_START, PT_END);
-    h_pt_after_gmt_dr_nocsc_pt10 = fs->make<TH1D>("h_pt_after_gmt_dr_nocsc_pt10","h_pt_after_gmt_dr_nocsc_pt10",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_tfcand_ok_plus = hists_.book1D("h_pt_after_tfcand_ok_plus","h_pt_after_tfcand_ok_plus",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_tfcand_ok_plus_pt10 = hists_.book1D("h_pt_after_tfcand_ok_plus_pt10","h_pt_after_tfcand_ok_plus_pt10",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_tfcand_ok_plus_q[0] = hists_.book1D("h_pt_after_tfcand_ok_plus_q1","h_pt_after_tfcand_ok_plus_q1",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_tfcand_ok_plus_q[1] = hists_.book1D("h_pt_after_tfcand_ok_plus_q2","h_pt_after_tfcand_ok_plus_q2",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_tfcand_ok_plus_q[2] = hists_.book1D("h_pt_after_tfcand_ok_plus_q3","h_pt_after_tfcand_ok_plus_q3",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_tfcand_ok_plus_pt10_q[0] = hists_.book1D("h_pt_after_tfcand_ok_plus_pt10_q1","h_pt_after_tfcand_ok_plus_pt10_q1",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_tfcand_ok_plus_pt10_q[1] = hists_.book1D("h_pt_after_tfcand_ok_plus_pt10_q2","h_pt_after_tfcand_ok_plus_pt10_q2",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_tfcand_ok_plus_pt10_q[2] = hists_.book1D("h_pt_after_tfcand_ok_plus_pt10_q3","h_pt_after_tfcand_ok_plus_pt10_q3",N_PT_BINS, PT_START, PT_END);
+
+    h_pt_after_tfcand_all = hists_.book1D("h_pt_after_tfcand_all","h_pt_after_tfcand_all",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_tfcand_all_ok = hists_.book1D("h_pt_after_tfcand_all_ok","h_pt_after_tfcand_all_ok",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_tfcand_all_pt10_ok = hists_.book1D("h_pt_after_tfcand_all_pt10_ok","h_pt_after_tfcand_all_pt10_ok",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_tfcand_all_pt20_ok = hists_.book1D("h_pt_after_tfcand_all_pt20_ok","h_pt_after_tfcand_all_pt20_ok",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_tfcand_all_pt40_ok = hists_.book1D("h_pt_after_tfcand_all_pt40_ok","h_pt_after_tfcand_all_pt40_ok",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_tfcand_all_pt60_ok = hists_.book1D("h_pt_after_tfcand_all_pt60_ok","h_pt_after_tfcand_all_pt60_ok",N_PT_BINS, PT_START, PT_END);
+
+    h_pt_after_gmtreg = hists_.book1D("h_pt_after_gmtreg","h_pt_after_gmtreg",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_gmtreg_all = hists_.book1D("h_pt_after_gmtreg_all","h_pt_after_gmtreg_all",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_gmtreg_dr = hists_.book1D("h_pt_after_gmtreg_dr","h_pt_after_gmtreg_dr",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_gmt = hists_.book1D("h_pt_after_gmt","h_pt_after_gmt",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_gmt_all = hists_.book1D("h_pt_after_gmt_all","h_pt_after_gmt_all",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_gmt_dr = hists_.book1D("h_pt_after_gmt_dr","h_pt_after_gmt_dr",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_gmt_dr_nocsc = hists_.book1D("h_pt_after_gmt_dr_nocsc","h_pt_after_gmt_dr_nocsc",N_PT_BINS, PT_START, PT_END);
+
+    h_pt_after_gmtreg_pt10 = hists_.book1D("h_pt_after_gmtreg_pt10","h_pt_after_gmtreg_pt10",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_gmtreg_all_pt10 = hists_.book1D("h_pt_after_gmtreg_all_pt10","h_pt_after_gmtreg_all_pt10",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_gmtreg_dr_pt10 = hists_.book1D("h_pt_after_gmtreg_dr_pt10","h_pt_after_gmtreg_dr_pt10",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_gmt_pt10 = hists_.book1D("h_pt_after_gmt_pt10","h_pt_after_gmt_pt10",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_gmt_all_pt10 = hists_.book1D("h_pt_after_gmt_all_pt10","h_pt_after_gmt_all_pt10",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_gmt_dr_pt10 = hists_.book1D("h_pt_after_gmt_dr_pt10","h_pt_after_gmt_dr_pt10",N_PT_BINS, PT_START, PT_END);
+    h_pt_after_gmt_dr_nocsc_pt10 = hists_.book1D("h_pt_after_gmt_dr_nocsc_pt10","h_pt_after_gmt_dr_nocsc_pt10",N_PT_BINS, PT_START, PT_END);
 
     for (int i = 0; i < Nthr; ++i) {
         std::string prefix = "h_pt_after_gmt_eta1b_";
-        h_pt_after_gmt_eta1b_1mu[i] = fs->make<TH1D>((prefix + "1mu" + str_pts[i]).c_str(), (prefix + "1mu" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
+        h_pt_after_gmt_eta1b_1mu[i] = hists_.book1D((prefix + "1mu" + str_pts[i]).c_str(), (prefix + "1mu" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
         prefix = "h_pt_after_gmt_gem1b_";
-        h_pt_after_gmt_gem1b_1mu[i] = fs->make<TH1D>((prefix + "1mu" + str_pts[i]).c_str(), (prefix + "1mu" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
+        h_pt_after_gmt_gem1b_1mu[i] = hists_.book1D((prefix + "1mu" + str_pts[i]).c_str(), (prefix + "1mu" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
         prefix = "h_pt_after_gmt_dphigem1b_";
-        h_pt_after_gmt_dphigem1b_1mu[i] = fs->make<TH1D>((prefix + "1mu" + str_pts[i]).c_str(), (prefix + "1mu" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
+        h_pt_after_gmt_dphigem1b_1mu[i] = hists_.book1D((prefix + "1mu" + str_pts[i]).c_str(), (prefix + "1mu" + str_pts[i]).c_str(), N_PT_BINS, PT_START, PT_END);
     }
 
 
 
-    h_pt_me1_after_tf_ok_plus = fs->make<TH1D>("h_pt_me1_after_tf_ok_plus","h_pt_me1_after_tf_ok_plus",N_PT_BINS, PT_START, PT_END);
-    h_pt_me1_after_tf_ok_plus_pt10 = fs->make<TH1D>("h_pt_me1_after_tf_ok_plus_pt10","h_pt_me1_after_tf_ok_plus_pt10",N_PT_BINS, PT_START, PT_END);
-    h_pt_me1_after_tf_ok_plus_q[0] = fs->make<TH1D>("h_pt_me1_after_tf_ok_plus_q1","h_pt_me1_after_tf_ok_plus_q1",N_PT_BINS, PT_START, PT_END);
-    h_pt_me1_after_tf_ok_plus_q[1] = fs->make<TH1D>("h_pt_me1_after_tf_ok_plus_q2","h_pt_me1_after_tf_ok_plus_q2",N_PT_BINS, PT_START, PT_END);
-    h_pt_me1_after_tf_ok_plus_q[2] = fs->make<TH1D>("h_pt_me1_after_tf_ok_plus_q3","h_pt_me1_after_tf_ok_plus_q3",N_PT_BINS, PT_START, PT_END);
-    h_pt_me1_after_tf_ok_plus_pt10_q[0] = fs->make<TH1D>("h_pt_me1_after_tf_ok_plus_pt10_q1","h_pt_me1_after_tf_ok_plus_pt10_q1",N_PT_BINS, PT_START, PT_END);
-    h_pt_me1_after_tf_ok_plus_pt10_q[1] = fs->make<TH1D>("h_pt_me1_after_tf_ok_plus_pt10_q2","h_pt_me1_after_tf_ok_plus_pt10_q2",N_PT_BINS, PT_START, PT_END);
-    h_pt_me1_after_tf_ok_plus_pt10_q[2] = fs->make<TH1D>("h_pt_me1_after_tf_ok_plus_pt10_q3","h_pt_me1_after_tf_ok_plus_pt10_q3",N_PT_BINS, PT_START, PT_END);
+    h_pt_me1_after_tf_ok_plus = hists_.book1D("h_pt_me1_after_tf_ok_plus","h_pt_me1_after_tf_ok_plus",N_PT_BINS, PT_START, PT_END);
+    h_pt_me1_after_tf_ok_plus_pt10 = hists_.book1D("h_pt_me1_after_tf_ok_plus_pt10","h_pt_me1_after_tf_ok_plus_pt10",N_PT_BINS, PT_START, PT_END);
+    h_pt_me1_after_tf_ok_plus_q[0] = hists_.book1D("h_pt_me1_after_tf_ok_plus_q1","h_pt_me1_after_tf_ok_plus_q1",N_PT_BINS, PT_START, PT_END);
+    h_pt_me1_after_tf_ok_plus_q[1] = hists_.book1D("h_pt_me1_after_tf_ok_plus_q2","h_pt_me1_after_tf_ok_plus_q2",N_PT_BINS, PT_START, PT_END);
+    h_pt_me1_after_tf_ok_plus_q[2] = hists_.book1D("h_pt_me1_after_tf_ok_plus_q3","h_pt_me1_after_tf_ok_plus_q3",N_PT_BINS, PT_START, PT_END);
+    h_pt_me1_after_tf_ok_plus_pt10_q[0] = hists_.book1D("h_pt_me1_after_tf_ok_plus_pt10_q1","h_pt_me1_after_tf_ok_plus_pt10_q1",N_PT_BINS, PT_START, PT_END);
+    h_pt_me1_after_tf_ok_plus_pt10_q[1] = hists_.book1D("h_pt_me1_after_tf_ok_plus_pt10_q2","h_pt_me1_after_tf_ok_plus_pt10_q2",N_PT_BINS, PT_START, PT_END);
+    h_pt_me1_after_tf_ok_plus_pt10_q[2] = hists_.book1D("h_pt_me1_after_tf_ok_plus_pt10_q3","h_pt_me1_after_tf_ok_plus_pt10_q3",N_PT_BINS, PT_START, PT_END);
 
 
     // high eta
-    h_pth_initial = fs->make<TH1D>("h_pth_initial","h_pth_initial",N_PT_BINS, PT_START, PT_END);
-    h_pth_after_mpc = fs->make<TH1D>("h_pth_after_mpc","h_pth_after_mpc",N_PT_BINS, PT_START, PT_END);
-    h_pth_after_mpc_ok_plus = fs->make<TH1D>("h_pth_after_mpc_ok_plus","h_pth_after_mpc_ok_plus",N_PT_BINS, PT_START, PT_END);
+    h_pth_initial = hists_.book1D("h_pth_initial","h_pth_initial",N_PT_BINS, PT_START, PT_END);
+    h_pth_after_mpc = hists_.book1D("h_pth_after_mpc","h_pth_after_mpc",N_PT_BINS, PT_START, PT_END);
+    h_pth_after_mpc_ok_plus = hists_.book1D("h_pth_after_mpc_ok_plus","h_pth_after_mpc_ok_plus",N_PT_BINS, PT_START, PT_END);
 
-    h_pth_after_tfcand = fs->make<TH1D>("h_pth_after_tfcand","h_pth_after_tfcand",N_PT_BINS, PT_START, PT_END);
-    h_pth_after_tfcand_pt10 = fs->make<TH1D>("h_pth_after_tfcand_pt10","h_pth_after_tfcand_pt10",N_PT_BINS, PT_START, PT_END);
+    h_pth_after_tfcand = hists_.book1D("h_pth_after_tfcand","h_pth_after_tfcand",N_PT_BINS, PT_START, PT_END);
+    h_pth_after_tfcand_pt10 = hists_.book1D("h_pth_after_tfcand_pt10","h_pth_after_tfcand_pt10",N_PT_BINS, PT_START, PT_END);
 
-    h_pth_after_tfcand_ok = fs->make<TH1D>("h_pth_after_tfcand_ok","h_pth_after_tfcand_ok",N_PT_BINS, PT_START, PT_END);
-    h_pth_after_tfcand_pt10_ok = fs->make<TH1D>("h_pth_after_tfcand_pt10_ok","h_pth_after_tfcand_pt10_ok",N_PT_BINS, PT_START, PT_END);
+    h_pth_after_tfcand_ok = hists_.book1D("h_pth_after_tfcand_ok","h_pth_after_tfcand_ok",N_PT_BINS, PT_START, PT_END);
+    h_pth_after_tfcand_pt10_ok = hists_.book1D("h_pth_after_tfcand_pt10_ok","h_pth_after_tfcand_pt10_ok",N_PT_BINS, PT_START, PT_END);
 
-    h_pth_after_tfcand_ok_plus = fs->make<TH1D>("h_pth_after_tfcand_ok_plus","h_pth_after_tfcand_ok_plus",N_PT_BINS, PT_START, PT_END);
-    h_pth_after_tfcand_ok_plus_pt10 = fs->make<TH1D>("h_pth_after_tfcand_ok_plus_pt10","h_pth_after_tfcand_ok_plus_pt10",N_PT_BINS, PT_START, PT_END);
-    h_pth_after_tfcand_ok_plus_q[0] = fs->make<TH1D>("h_pth_after_tfcand_ok_plus_q1","h_pth_after_tfcand_ok_plus_q1",N_PT_BINS, PT_START, PT_END);
-    h_pth_after_tfcand_ok_plus_q[1] = fs->make<TH1D>("h_pth_after_tfcand_ok_plus_q2","h_pth_after_tfcand_ok_plus_q2",N_PT_BINS, PT_START, PT_END);
-    h_pth_after_tfcand_ok_plus_q[2] = fs->make<TH1D>("h_pth_after_tfcand_ok_plus_q3","h_pth_after_tfcand_ok_plus_q3",N_PT_BINS, PT_START, PT_END);
-    h_pth_after_tfcand_ok_plus_pt10_q[0] = fs->make<TH1D>("h_pth_after_tfcand_ok_plus_pt10_q1","h_pth_after_tfcand_ok_plus_pt10_q1",N_PT_BINS, PT_START, PT_END);
-    h_pth_after_tfcand_ok_plus_pt10_q[1] = fs->make<TH1D>("h_pth_after_tfcand_ok_plus_pt10_q2","h_pth_after_tfcand_ok_plus_pt10_q2",N_PT_BINS, PT_START, PT_END);
-    h_pth_after_tfcand_ok_plus_pt10_q[2] = fs->make<TH1D>("h_pth_after_tfcand_ok_plus_pt10_q3","h_pth_after_tfcand_ok_plus_pt10_q3",N_PT_BINS, PT_START, PT_END);
+    h_pth_after_tfcand_ok_plus = hists_.book1D("h_pth_after_tfcand_ok_plus","h_pth_after_tfcand_ok_plus",N_PT_BINS, PT_START, PT_END);
+    h_pth_after_tfcand_ok_plus_pt10 = hists_.book1D("h_pth_after_tfcand_ok_plus_pt10","h_pth_after_tfcand_ok_plus_pt10",N_PT_BINS, PT_START, PT_END);
+    h_pth_after_tfcand_ok_plus_q[0] = hists_.book1D("h_pth_after_tfcand_ok_plus_q1","h_pth_after_tfcand_ok_plus_q1",N_PT_BINS, PT_START, PT_END);
+    h_pth_after_tfcand_ok_plus_q[1] = hists_.book1D("h_pth_after_tfcand_ok_plus_q2","h_pth_after_tfcand_ok_plus_q2",N_PT_BINS, PT_START, PT_END);
+    h_pth_after_tfcand_ok_plus_q[2] = hists_.book1D("h_pth_after_tfcand_ok_plus_q3","h_pth_after_tfcand_ok_plus_q3",N_PT_BINS, PT_START, PT_END);
+    h_pth_after_tfcand_ok_plus_pt10_q[0] = hists_.book1D("h_pth_after_tfcand_ok_plus_pt10_q1","h_pth_after_tfcand_ok_plus_pt10_q1",N_PT_BINS, PT_START, PT_END);
+    h_pth_after_tfcand_ok_plus_pt10_q[1] = hists_.book1D("h_pth_after_tfcand_ok_plus_pt10_q2","h_pth_after_tfcand_ok_plus_pt10_q2",N_PT_BINS, PT_START, PT_END);
+    h_pth_after_tfcand_ok_plus_pt10_q[2] = hists_.book1D("h_pth_after_tfcand_ok_plus_pt10_q3","h_pth_after_tfcand_ok_plus_pt10_q3",N_PT_BINS, PT_START, PT_END);
 
-    h_pth_me1_after_mpc_ok_plus = fs->make<TH1D>("h_pth_after_mpc_me1_plus","h_pth_me1_after_mpc_ok_plus",N_PT_BINS, PT_START, PT_END);
-    h_pth_me1_after_tf_ok_plus = fs->make<TH1D>("h_pth_me1_after_tf_ok_plus","h_pth_me1_after_tf_ok_plus",N_PT_BINS, PT_START, PT_END);
-    h_pth_me1_after_tf_ok_plus_pt10 = fs->make<TH1D>("h_pth_me1_after_tf_ok_plus_pt10","h_pth_me1_after_tf_ok_plus_pt10",N_PT_BINS, PT_START, PT_END);
-    h_pth_me1_after_tf_ok_plus_q[0] = fs->make<TH1D>("h_pth_me1_after_tf_ok_plus_q1","h_pth_me1_after_tf_ok_plus_q1",N_PT_BINS, PT_START, PT_END);
-    h_pth_me1_after_tf_ok_plus_q[1] = fs->make<TH1D>("h_pth_me1_after_tf_ok_plus_q2","h_pth_me1_after_tf_ok_plus_q2",N_PT_BINS, PT_START, PT_END);
-    h_pth_me1_after_tf_ok_plus_q[2] = fs->make<TH1D>("h_pth_me1_after_tf_ok_plus_q3","h_pth_me1_after_tf_ok_plus_q3",N_PT_BINS, PT_START, PT_END);
-    h_pth_me1_after_tf_ok_plus_pt10_q[0] = fs->make<TH1D>("h_pth_me1_after_tf_ok_plus_pt10_q1","h_pth_me1_after_tf_ok_plus_pt10_q1",N_PT_BINS, PT_START, PT_END);
-    h_pth_me1_after_tf_ok_plus_pt10_q[1] = fs->make<TH1D>("h_pth_me1_after_tf_ok_plus_pt10_q2","h_pth_me1_after_tf_ok_plus_pt10_q2",N_PT_BINS, PT_START, PT_END);
-    h_pth_me1_after_tf_ok_plus_pt10_q[2] = fs->make<TH1D>("h_pth_me1_after_tf_ok_plus_pt10_q3","h_pth_me1_after_tf_ok_plus_pt10_q3",N_PT_BINS, PT_START, PT_END);
+    h_pth_me1_after_mpc_ok_plus = hists_.book1D("h_pth_after_mpc_me1_plus","h_pth_me1_after_mpc_ok_plus",N_PT_BINS, PT_START, PT_END);
+    h_pth_me1_after_tf_ok_plus = hists_.book1D("h_pth_me1_after_tf_ok_plus","h_pth_me1_after_tf_ok_plus",N_PT_BINS, PT_START, PT_END);
+    h_pth_me1_after_tf_ok_plus_pt10 = hists_.book1D("h_pth_me1_after_tf_ok_plus_pt10","h_pth_me1_after_tf_ok_plus_pt10",N_PT_BINS, PT_START, PT_END);
+    h_pth_me1_after_tf_ok_plus_q[0] = hists_.book1D("h_pth_me1_after_tf_ok_plus_q1","h_pth_me1_after_tf_ok_plus_q1",N_PT_BINS, PT_START, PT_END);
+    h_pth_me1_after_tf_ok_plus_q[1] = hists_.book1D("h_pth_me1_after_tf_ok_plus_q2","h_pth_me1_after_tf_ok_plus_q2",N_PT_BINS, PT_START, PT_END);
+    h_pth_me1_after_tf_ok_plus_q[2] = hists_.book1D("h_pth_me1_after_tf_ok_plus_q3","h_pth_me1_after_tf_ok_plus_q3",N_PT_BINS, PT_START, PT_END);
+    h_pth_me1_after_tf_ok_plus_pt10_q[0] = hists_.book1D("h_pth_me1_after_tf_ok_plus_pt10_q1","h_pth_me1_after_tf_ok_plus_pt10_q1",N_PT_BINS, PT_START, PT_END);
+    h_pth_me1_after_tf_ok_plus_pt10_q[1] = hists_.book1D("h_pth_me1_after_tf_ok_plus_pt10_q2","h_pth_me1_after_tf_ok_plus_pt10_q2",N_PT_BINS, PT_START, PT_END);
+    h_pth_me1_after_tf_ok_plus_pt10_q[2] = hists_.book1D("h_pth_me1_after_tf_ok_plus_pt10_q3","h_pth_me1_after_tf_ok_plus_pt10_q3",N_PT_BINS, PT_START, PT_END);
 
-    h_pth_over_tfpt_resol = fs->make<TH1D>("h_pth_over_pttf_resol","h_pth_over_pttf_resol",300, -1.5,1.5);
-    h_pth_over_tfpt_resol_vs_pt = fs->make<TH2D>("h_pth_over_pttf_resol_vs_pt","h_pth_over_pttf_resol_vs_pt",150, -1.5,1.5,N_PT_BINS, PT_START, PT_END);
+    h_pth_over_tfpt_resol = hists_.book1D("h_pth_over_pttf_resol","h_pth_over_pttf_resol",300, -1.5,1.5);
+    h_pth_over_tfpt_resol_vs_pt = hists_.book2D("h_pth_over_pttf_resol_vs_pt","h_pth_over_pttf_resol_vs_pt",150, -1.5,1.5,N_PT_BINS, PT_START, PT_END);
 
 
-    h_pth_after_tfcand_ok_plus_3st1a = fs->make<TH1D>("h_pth_after_tfcand_ok_plus_3st1a","h_pth_after_tfcand_ok_plus_3st1a",N_PT_BINS, PT_START, PT_END);
-    h_pth_after_tfcand_ok_plus_pt10_3st1a = fs->make<TH1D>("h_pth_after_tfcand_ok_plus_pt10_3st1a","h_pth_after_tfcand_ok_plus_pt10_3st1a",N_PT_BINS, PT_START, PT_END);
-    h_pth_me1_after_tf_ok_plus_3st1a = fs->make<TH1D>("h_pth_me1_after_tf_ok_plus_3st1a","h_pth_me1_after_tf_ok_plus_3st1a",N_PT_BINS, PT_START, PT_END);
-    h_pth_me1_after_tf_ok_plus_pt10_3st1a = fs->make<TH1D>("h_pth_me1_after_tf_ok_plus_pt10_3st1a","h_pth_me1_after_tf_ok_plus_pt10_3st1a",N_PT_BINS, PT_START, PT_END);
+    h_pth_after_tfcand_ok_plus_3st1a = hists_.book1D("h_pth_after_tfcand_ok_plus_3st1a","h_pth_after_tfcand_ok_plus_3st1a",N_PT_BINS, PT_START, PT_END);
+    h_pth_after_tfcand_ok_plus_pt10_3st1a = hists_.book1D("h_pth_after_tfcand_ok_plus_pt10_3st1a","h_pth_after_tfcand_ok_plus_pt10_3st1a",N_PT_BINS, PT_START, PT_END);
+    h_pth_me1_after_tf_ok_plus_3st1a = hists_.book1D("h_pth_me1_after_tf_ok_plus_3st1a","h_pth_me1_after_tf_ok_plus_3st1a",N_PT_BINS, PT_START, PT_END);
+    h_pth_me1_after_tf_ok_plus_pt10_3st1a = hists_.book1D("h_pth_me1_after_tf_ok_plus_pt10_3st1a","h_pth_me1_after_tf_ok_plus_pt10_3st1a",N_PT_BINS, PT_START, PT_END);
 
 
 
@@ -575,274 +580,274 @@ GEMCSCTriggerEfficiency::GEMCSCTriggerEfficiency(const edm::ParameterSet& iConfi
     {
         int tfpt = (int)PT_THRESHOLDS[i];
         sprintf(label,"h_eta_tf_initial0_tfpt%d",tfpt);
-        h_eta_tf_initial0_tfpt[i]  = fs->make<TH1D>(label, label, N_ETA_BINS, ETA_START, ETA_END);
+        h_eta_tf_initial0_tfpt[i]  = hists_.book1D(label, label, N_ETA_BINS, ETA_START, ETA_END);
         sprintf(label,"h_eta_tf_initial_tfpt%d",tfpt);
-        h_eta_tf_initial_tfpt[i]  = fs->make<TH1D>(label, label, N_ETA_BINS, ETA_START, ETA_END);
+        h_eta_tf_initial_tfpt[i]  = hists_.book1D(label, label, N_ETA_BINS, ETA_START, ETA_END);
         sprintf(label,"h_eta_tf_stubs222_tfpt%d",tfpt);
-        h_eta_tf_stubs222_tfpt[i]  = fs->make<TH1D>(label, label, N_ETA_BINS, ETA_START, ETA_END);
+        h_eta_tf_stubs222_tfpt[i]  = hists_.book1D(label, label, N_ETA_BINS, ETA_START, ETA_END);
         sprintf(label,"h_eta_tf_stubs223_tfpt%d",tfpt);
-        h_eta_tf_stubs223_tfpt[i]  = fs->make<TH1D>(label, label, N_ETA_BINS, ETA_START, ETA_END);
+        h_eta_tf_stubs223_tfpt[i]  = hists_.book1D(label, label, N_ETA_BINS, ETA_START, ETA_END);
         sprintf(label,"h_eta_tf_stubs233_tfpt%d",tfpt);
-        h_eta_tf_stubs233_tfpt[i]  = fs->make<TH1D>(label, label, N_ETA_BINS, ETA_START, ETA_END);
+        h_eta_tf_stubs233_tfpt[i]  = hists_.book1D(label, label, N_ETA_BINS, ETA_START, ETA_END);
     }
 
 
-    h_eta_after_alct = fs->make<TH1D>("h_eta_after_alct","h_eta_after_alct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_clct = fs->make<TH1D>("h_eta_after_clct","h_eta_after_clct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_lct = fs->make<TH1D>("h_eta_after_lct","h_eta_after_lct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_mpc = fs->make<TH1D>("h_eta_after_mpc","h_eta_after_mpc",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_mpc_ok = fs->make<TH1D>("h_eta_after_mpc_ok","h_eta_after_mpc_ok",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_mpc_ok_plus = fs->make<TH1D>("h_eta_after_mpc_ok_plus","h_eta_after_mpc_ok_plus",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_mpc_ok_plus_3st = fs->make<TH1D>("h_eta_after_mpc_ok_plus_3st","h_eta_after_mpc_ok_plus_3st",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_mpc_st1 = fs->make<TH1D>("h_eta_after_mpc_st1","h_eta_after_mpc_st1",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_mpc_st1_good = fs->make<TH1D>("h_eta_after_mpc_st1_good","h_eta_after_mpc_st1_good",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_tftrack = fs->make<TH1D>("h_eta_after_tftrack","h_eta_after_tftrack",N_ETA_BINS, ETA_START, ETA_END);
-    //h_eta_after_tftrack_q[0] = fs->make<TH1D>("h_eta_after_tftrack_q1","h_eta_after_tftrack_q1",N_ETA_BINS, ETA_START, ETA_END);
-    //h_eta_after_tftrack_q[1] = fs->make<TH1D>("h_eta_after_tftrack_q2","h_eta_after_tftrack_q2",N_ETA_BINS, ETA_START, ETA_END);
-    //h_eta_after_tftrack_q[2] = fs->make<TH1D>("h_eta_after_tftrack_q3","h_eta_after_tftrack_q3",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_tfcand = fs->make<TH1D>("h_eta_after_tfcand","h_eta_after_tfcand",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_tfcand_q[0] = fs->make<TH1D>("h_eta_after_tfcand_q1","h_eta_after_tfcand_q1",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_tfcand_q[1] = fs->make<TH1D>("h_eta_after_tfcand_q2","h_eta_after_tfcand_q2",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_tfcand_q[2] = fs->make<TH1D>("h_eta_after_tfcand_q3","h_eta_after_tfcand_q3",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_tfcand_ok = fs->make<TH1D>("h_eta_after_tfcand_ok","h_eta_after_tfcand_ok",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_tfcand_ok_plus = fs->make<TH1D>("h_eta_after_tfcand_ok_plus","h_eta_after_tfcand_ok_plus",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_tfcand_ok_pt10 = fs->make<TH1D>("h_eta_after_tfcand_ok_pt10","h_eta_after_tfcand_ok_pt10",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_tfcand_ok_plus_pt10 = fs->make<TH1D>("h_eta_after_tfcand_ok_plus_pt10","h_eta_after_tfcand_ok_plus_pt10",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_tfcand_ok_plus_q[0] = fs->make<TH1D>("h_eta_after_tfcand_ok_plus_q1","h_eta_after_tfcand_ok_plus_q1",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_tfcand_ok_plus_q[1] = fs->make<TH1D>("h_eta_after_tfcand_ok_plus_q2","h_eta_after_tfcand_ok_plus_q2",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_tfcand_ok_plus_q[2] = fs->make<TH1D>("h_eta_after_tfcand_ok_plus_q3","h_eta_after_tfcand_ok_plus_q3",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_tfcand_ok_plus_pt10_q[0] = fs->make<TH1D>("h_eta_after_tfcand_ok_plus_pt10_q1","h_eta_after_tfcand_ok_plus_pt10_q1",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_tfcand_ok_plus_pt10_q[1] = fs->make<TH1D>("h_eta_after_tfcand_ok_plus_pt10_q2","h_eta_after_tfcand_ok_plus_pt10_q2",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_tfcand_ok_plus_pt10_q[2] = fs->make<TH1D>("h_eta_after_tfcand_ok_plus_pt10_q3","h_eta_after_tfcand_ok_plus_pt10_q3",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_tfcand_all = fs->make<TH1D>("h_eta_after_tfcand_all","h_eta_after_tfcand_all",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_tfcand_pt10 = fs->make<TH1D>("h_eta_after_tfcand_pt10","h_eta_after_tfcand_pt10",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_tfcand_all_pt10 = fs->make<TH1D>("h_eta_after_tfcand_all_pt10","h_eta_after_tfcand_all_pt10",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_tfcand_my_st1 = fs->make<TH1D>("h_eta_after_tfcand_my_st1","h_eta_after_tfcand_my_st1",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_tfcand_org_st1 = fs->make<TH1D>("h_eta_after_tfcand_org_st1","h_eta_after_tfcand_org_st1",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_tfcand_comm_st1 = fs->make<TH1D>("h_eta_after_tfcand_comm_st1","h_eta_after_tfcand_comm_st1",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_tfcand_my_st1_pt10 = fs->make<TH1D>("h_eta_after_tfcand_my_st1_pt10","h_eta_after_tfcand_my_st1_pt10",N_ETA_BINS, ETA_START, ETA_END);
-
-    h_eta_after_gmtreg = fs->make<TH1D>("h_eta_after_gmtreg","h_eta_after_gmtreg",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_gmtreg_all = fs->make<TH1D>("h_eta_after_gmtreg_all","h_eta_after_gmtreg_all",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_gmtreg_dr = fs->make<TH1D>("h_eta_after_gmtreg_dr","h_eta_after_gmtreg_dr",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_gmt = fs->make<TH1D>("h_eta_after_gmt","h_eta_after_gmt",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_gmt_all = fs->make<TH1D>("h_eta_after_gmt_all","h_eta_after_gmt_all",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_gmt_dr = fs->make<TH1D>("h_eta_after_gmt_dr","h_eta_after_gmt_dr",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_gmt_dr_nocsc = fs->make<TH1D>("h_eta_after_gmt_dr_nocsc","h_eta_after_gmt_dr_nocsc",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_gmtreg_pt10 = fs->make<TH1D>("h_eta_after_gmtreg_pt10","h_eta_after_gmtreg_pt10",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_gmtreg_all_pt10 = fs->make<TH1D>("h_eta_after_gmtreg_all_pt10","h_eta_after_gmtreg_all_pt10",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_gmtreg_dr_pt10 = fs->make<TH1D>("h_eta_after_gmtreg_dr_pt10","h_eta_after_gmtreg_dr_pt10",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_gmt_pt10 = fs->make<TH1D>("h_eta_after_gmt_pt10","h_eta_after_gmt_pt10",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_gmt_all_pt10 = fs->make<TH1D>("h_eta_after_gmt_all_pt10","h_eta_after_gmt_all_pt10",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_gmt_dr_pt10 = fs->make<TH1D>("h_eta_after_gmt_dr_pt10","h_eta_after_gmt_dr_pt10",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_gmt_dr_nocsc_pt10 = fs->make<TH1D>("h_eta_after_gmt_dr_nocsc_pt10","h_eta_after_gmt_dr_nocsc_pt10",N_ETA_BINS, ETA_START, ETA_END);
-
-    h_eta_vs_bx_after_alct = fs->make<TH2D>("h_eta_vs_bx_after_alct","h_eta_vs_bx_after_alct",N_ETA_BINS, ETA_START, ETA_END,13,-6.5, 6.5);
-    h_eta_vs_bx_after_mpc = fs->make<TH2D>("h_eta_vs_bx_after_mpc","h_eta_vs_bx_after_mpc",N_ETA_BINS, ETA_START, ETA_END,13,-6.5, 6.5);
-
-    h_eta_me1_after_alct = fs->make<TH1D>("h_eta_me1_after_alct","h_eta_me1_after_alct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_after_alct_okAlct = fs->make<TH1D>("h_eta_me1_after_alct_okAlct","h_eta_me1_after_alct_okAlct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_after_clct = fs->make<TH1D>("h_eta_me1_after_clct","h_eta_me1_after_clct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_after_clct_okClct = fs->make<TH1D>("h_eta_me1_after_clct_okClct","h_eta_me1_after_clct_okClct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_after_alctclct = fs->make<TH1D>("h_eta_me1_after_alctclct","h_eta_me1_after_alctclct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_after_alctclct_okAlct = fs->make<TH1D>("h_eta_me1_after_alctclct_okAlct","h_eta_me1_after_alctclct_okAlct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_after_alctclct_okClct = fs->make<TH1D>("h_eta_me1_after_alctclct_okClct","h_eta_me1_after_alctclct_okClct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_after_alctclct_okAlctClct = fs->make<TH1D>("h_eta_me1_after_alctclct_okAlctClct","h_eta_me1_after_alctclct_okAlctClct",N_ETA_BINS, ETA_START, ETA_END);
-
-    h_eta_me11_after_alct = fs->make<TH1D>("h_eta_me11_after_alct","h_eta_me11_after_alct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me11_after_alct_okAlct = fs->make<TH1D>("h_eta_me11_after_alct_okAlct","h_eta_me11_after_alct_okAlct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me11_after_clct = fs->make<TH1D>("h_eta_me11_after_clct","h_eta_me11_after_clct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me11_after_clct_okClct = fs->make<TH1D>("h_eta_me11_after_clct_okClct","h_eta_me11_after_clct_okClct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me11_after_alctclct = fs->make<TH1D>("h_eta_me11_after_alctclct","h_eta_me11_after_alctclct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me11_after_alctclct_okAlct = fs->make<TH1D>("h_eta_me11_after_alctclct_okAlct","h_eta_me11_after_alctclct_okAlct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me11_after_alctclct_okClct = fs->make<TH1D>("h_eta_me11_after_alctclct_okClct","h_eta_me11_after_alctclct_okClct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me11_after_alctclct_okAlctClct = fs->make<TH1D>("h_eta_me11_after_alctclct_okAlctClct","h_eta_me11_after_alctclct_okAlctClct",N_ETA_BINS, ETA_START, ETA_END);
-
-    h_eta_me1_after_lct = fs->make<TH1D>("h_eta_me1_after_lct","h_eta_me1_after_lct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_after_lct_okAlct = fs->make<TH1D>("h_eta_me1_after_lct_okAlct","h_eta_me1_after_lct_okAlct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_after_lct_okAlctClct = fs->make<TH1D>("h_eta_me1_after_lct_okAlctClct","h_eta_me1_after_lct_okAlctClct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_after_lct_okClct = fs->make<TH1D>("h_eta_me1_after_lct_okClct","h_eta_me1_after_lct_okClct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_after_lct_okClctAlct = fs->make<TH1D>("h_eta_me1_after_lct_okClctAlct","h_eta_me1_after_lct_okClctAlct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_after_mplct_okAlctClct = fs->make<TH1D>("h_eta_me1_after_mplct_okAlctClct","h_eta_me1_after_mplct_okAlctClct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_after_mplct_okAlctClct_plus = fs->make<TH1D>("h_eta_me1_after_mplct_okAlctClct_plus","h_eta_me1_after_mplct_okAlctClct_plus",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me11_after_lct = fs->make<TH1D>("h_eta_me11_after_lct","h_eta_me11_after_lct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me11_after_lct_okAlct = fs->make<TH1D>("h_eta_me11_after_lct_okAlct","h_eta_me11_after_lct_okAlct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me11_after_lct_okAlctClct = fs->make<TH1D>("h_eta_me11_after_lct_okAlctClct","h_eta_me11_after_lct_okAlctClct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me11_after_lct_okClct = fs->make<TH1D>("h_eta_me11_after_lct_okClct","h_eta_me11_after_lct_okClct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me11_after_lct_okClctAlct = fs->make<TH1D>("h_eta_me11_after_lct_okClctAlct","h_eta_me11_after_lct_okClctAlct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me11_after_mplct_okAlctClct = fs->make<TH1D>("h_eta_me11_after_mplct_okAlctClct","h_eta_me11_after_mplct_okAlctClct",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me11_after_mplct_okAlctClct_plus = fs->make<TH1D>("h_eta_me11_after_mplct_okAlctClct_plus","h_eta_me11_after_mplct_okAlctClct_plus",N_ETA_BINS, ETA_START, ETA_END);
-
-    h_eta_me1_after_tf_ok = fs->make<TH1D>("h_eta_me1_after_tf_ok","h_eta_me1_after_tf_ok",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_after_tf_ok_pt10 = fs->make<TH1D>("h_eta_me1_after_tf_ok_pt10","h_eta_me1_after_tf_ok_pt10",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_after_tf_ok_plus = fs->make<TH1D>("h_eta_me1_after_tf_ok_plus","h_eta_me1_after_tf_ok_plus",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_after_tf_ok_plus_pt10 = fs->make<TH1D>("h_eta_me1_after_tf_ok_plus_pt10","h_eta_me1_after_tf_ok_plus_pt10",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_after_tf_ok_plus_q[0] = fs->make<TH1D>("h_eta_me1_after_tf_ok_plus_q1","h_eta_me1_after_tf_ok_plus_q1",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_after_tf_ok_plus_q[1] = fs->make<TH1D>("h_eta_me1_after_tf_ok_plus_q2","h_eta_me1_after_tf_ok_plus_q2",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_after_tf_ok_plus_q[2] = fs->make<TH1D>("h_eta_me1_after_tf_ok_plus_q3","h_eta_me1_after_tf_ok_plus_q3",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_after_tf_ok_plus_pt10_q[0] = fs->make<TH1D>("h_eta_me1_after_tf_ok_plus_pt10_q1","h_eta_me1_after_tf_ok_plus_pt10_q1",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_after_tf_ok_plus_pt10_q[1] = fs->make<TH1D>("h_eta_me1_after_tf_ok_plus_pt10_q2","h_eta_me1_after_tf_ok_plus_pt10_q2",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_after_tf_ok_plus_pt10_q[2] = fs->make<TH1D>("h_eta_me1_after_tf_ok_plus_pt10_q3","h_eta_me1_after_tf_ok_plus_pt10_q3",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_alct = hists_.book1D("h_eta_after_alct","h_eta_after_alct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_clct = hists_.book1D("h_eta_after_clct","h_eta_after_clct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_lct = hists_.book1D("h_eta_after_lct","h_eta_after_lct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_mpc = hists_.book1D("h_eta_after_mpc","h_eta_after_mpc",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_mpc_ok = hists_.book1D("h_eta_after_mpc_ok","h_eta_after_mpc_ok",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_mpc_ok_plus = hists_.book1D("h_eta_after_mpc_ok_plus","h_eta_after_mpc_ok_plus",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_mpc_ok_plus_3st = hists_.book1D("h_eta_after_mpc_ok_plus_3st","h_eta_after_mpc_ok_plus_3st",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_mpc_st1 = hists_.book1D("h_eta_after_mpc_st1","h_eta_after_mpc_st1",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_mpc_st1_good = hists_.book1D("h_eta_after_mpc_st1_good","h_eta_after_mpc_st1_good",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_tftrack = hists_.book1D("h_eta_after_tftrack","h_eta_after_tftrack",N_ETA_BINS, ETA_START, ETA_END);
+    //h_eta_after_tftrack_q[0] = hists_.book1D("h_eta_after_tftrack_q1","h_eta_after_tftrack_q1",N_ETA_BINS, ETA_START, ETA_END);
+    //h_eta_after_tftrack_q[1] = hists_.book1D("h_eta_after_tftrack_q2","h_eta_after_tftrack_q2",N_ETA_BINS, ETA_START, ETA_END);
+    //h_eta_after_tftrack_q[2] = hists_.book1D("h_eta_after_tftrack_q3","h_eta_after_tftrack_q3",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_tfcand = hists_.book1D("h_eta_after_tfcand","h_eta_after_tfcand",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_tfcand_q[0] = hists_.book1D("h_eta_after_tfcand_q1","h_eta_after_tfcand_q1",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_tfcand_q[1] = hists_.book1D("h_eta_after_tfcand_q2","h_eta_after_tfcand_q2",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_tfcand_q[2] = hists_.book1D("h_eta_after_tfcand_q3","h_eta_after_tfcand_q3",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_tfcand_ok = hists_.book1D("h_eta_after_tfcand_ok","h_eta_after_tfcand_ok",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_tfcand_ok_plus = hists_.book1D("h_eta_after_tfcand_ok_plus","h_eta_after_tfcand_ok_plus",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_tfcand_ok_pt10 = hists_.book1D("h_eta_after_tfcand_ok_pt10","h_eta_after_tfcand_ok_pt10",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_tfcand_ok_plus_pt10 = hists_.book1D("h_eta_after_tfcand_ok_plus_pt10","h_eta_after_tfcand_ok_plus_pt10",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_tfcand_ok_plus_q[0] = hists_.book1D("h_eta_after_tfcand_ok_plus_q1","h_eta_after_tfcand_ok_plus_q1",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_tfcand_ok_plus_q[1] = hists_.book1D("h_eta_after_tfcand_ok_plus_q2","h_eta_after_tfcand_ok_plus_q2",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_tfcand_ok_plus_q[2] = hists_.book1D("h_eta_after_tfcand_ok_plus_q3","h_eta_after_tfcand_ok_plus_q3",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_tfcand_ok_plus_pt10_q[0] = hists_.book1D("h_eta_after_tfcand_ok_plus_pt10_q1","h_eta_after_tfcand_ok_plus_pt10_q1",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_tfcand_ok_plus_pt10_q[1] = hists_.book1D("h_eta_after_tfcand_ok_plus_pt10_q2","h_eta_after_tfcand_ok_plus_pt10_q2",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_tfcand_ok_plus_pt10_q[2] = hists_.book1D("h_eta_after_tfcand_ok_plus_pt10_q3","h_eta_after_tfcand_ok_plus_pt10_q3",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_tfcand_all = hists_.book1D("h_eta_after_tfcand_all","h_eta_after_tfcand_all",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_tfcand_pt10 = hists_.book1D("h_eta_after_tfcand_pt10","h_eta_after_tfcand_pt10",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_tfcand_all_pt10 = hists_.book1D("h_eta_after_tfcand_all_pt10","h_eta_after_tfcand_all_pt10",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_tfcand_my_st1 = hists_.book1D("h_eta_after_tfcand_my_st1","h_eta_after_tfcand_my_st1",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_tfcand_org_st1 = hists_.book1D("h_eta_after_tfcand_org_st1","h_eta_after_tfcand_org_st1",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_tfcand_comm_st1 = hists_.book1D("h_eta_after_tfcand_comm_st1","h_eta_after_tfcand_comm_st1",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_tfcand_my_st1_pt10 = hists_.book1D("h_eta_after_tfcand_my_st1_pt10","h_eta_after_tfcand_my_st1_pt10",N_ETA_BINS, ETA_START, ETA_END);
+
+    h_eta_after_gmtreg = hists_.book1D("h_eta_after_gmtreg","h_eta_after_gmtreg",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_gmtreg_all = hists_.book1D("h_eta_after_gmtreg_all","h_eta_after_gmtreg_all",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_gmtreg_dr = hists_.book1D("h_eta_after_gmtreg_dr","h_eta_after_gmtreg_dr",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_gmt = hists_.book1D("h_eta_after_gmt","h_eta_after_gmt",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_gmt_all = hists_.book1D("h_eta_after_gmt_all","h_eta_after_gmt_all",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_gmt_dr = hists_.book1D("h_eta_after_gmt_dr","h_eta_after_gmt_dr",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_gmt_dr_nocsc = hists_.book1D("h_eta_after_gmt_dr_nocsc","h_eta_after_gmt_dr_nocsc",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_gmtreg_pt10 = hists_.book1D("h_eta_after_gmtreg_pt10","h_eta_after_gmtreg_pt10",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_gmtreg_all_pt10 = hists_.book1D("h_eta_after_gmtreg_all_pt10","h_eta_after_gmtreg_all_pt10",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_gmtreg_dr_pt10 = hists_.book1D("h_eta_after_gmtreg_dr_pt10","h_eta_after_gmtreg_dr_pt10",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_gmt_pt10 = hists_.book1D("h_eta_after_gmt_pt10","h_eta_after_gmt_pt10",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_gmt_all_pt10 = hists_.book1D("h_eta_after_gmt_all_pt10","h_eta_after_gmt_all_pt10",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_gmt_dr_pt10 = hists_.book1D("h_eta_after_gmt_dr_pt10","h_eta_after_gmt_dr_pt10",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_gmt_dr_nocsc_pt10 = hists_.book1D("h_eta_after_gmt_dr_nocsc_pt10","h_eta_after_gmt_dr_nocsc_pt10",N_ETA_BINS, ETA_START, ETA_END);
+
+    h_eta_vs_bx_after_alct = hists_.book2D("h_eta_vs_bx_after_alct","h_eta_vs_bx_after_alct",N_ETA_BINS, ETA_START, ETA_END,13,-6.5, 6.5);
+    h_eta_vs_bx_after_mpc = hists_.book2D("h_eta_vs_bx_after_mpc","h_eta_vs_bx_after_mpc",N_ETA_BINS, ETA_START, ETA_END,13,-6.5, 6.5);
+
+    h_eta_me1_after_alct = hists_.book1D("h_eta_me1_after_alct","h_eta_me1_after_alct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_after_alct_okAlct = hists_.book1D("h_eta_me1_after_alct_okAlct","h_eta_me1_after_alct_okAlct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_after_clct = hists_.book1D("h_eta_me1_after_clct","h_eta_me1_after_clct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_after_clct_okClct = hists_.book1D("h_eta_me1_after_clct_okClct","h_eta_me1_after_clct_okClct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_after_alctclct = hists_.book1D("h_eta_me1_after_alctclct","h_eta_me1_after_alctclct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_after_alctclct_okAlct = hists_.book1D("h_eta_me1_after_alctclct_okAlct","h_eta_me1_after_alctclct_okAlct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_after_alctclct_okClct = hists_.book1D("h_eta_me1_after_alctclct_okClct","h_eta_me1_after_alctclct_okClct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_after_alctclct_okAlctClct = hists_.book1D("h_eta_me1_after_alctclct_okAlctClct","h_eta_me1_after_alctclct_okAlctClct",N_ETA_BINS, ETA_START, ETA_END);
+
+    h_eta_me11_after_alct = hists_.book1D("h_eta_me11_after_alct","h_eta_me11_after_alct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me11_after_alct_okAlct = hists_.book1D("h_eta_me11_after_alct_okAlct","h_eta_me11_after_alct_okAlct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me11_after_clct = hists_.book1D("h_eta_me11_after_clct","h_eta_me11_after_clct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me11_after_clct_okClct = hists_.book1D("h_eta_me11_after_clct_okClct","h_eta_me11_after_clct_okClct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me11_after_alctclct = hists_.book1D("h_eta_me11_after_alctclct","h_eta_me11_after_alctclct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me11_after_alctclct_okAlct = hists_.book1D("h_eta_me11_after_alctclct_okAlct","h_eta_me11_after_alctclct_okAlct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me11_after_alctclct_okClct = hists_.book1D("h_eta_me11_after_alctclct_okClct","h_eta_me11_after_alctclct_okClct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me11_after_alctclct_okAlctClct = hists_.book1D("h_eta_me11_after_alctclct_okAlctClct","h_eta_me11_after_alctclct_okAlctClct",N_ETA_BINS, ETA_START, ETA_END);
+
+    h_eta_me1_after_lct = hists_.book1D("h_eta_me1_after_lct","h_eta_me1_after_lct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_after_lct_okAlct = hists_.book1D("h_eta_me1_after_lct_okAlct","h_eta_me1_after_lct_okAlct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_after_lct_okAlctClct = hists_.book1D("h_eta_me1_after_lct_okAlctClct","h_eta_me1_after_lct_okAlctClct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_after_lct_okClct = hists_.book1D("h_eta_me1_after_lct_okClct","h_eta_me1_after_lct_okClct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_after_lct_okClctAlct = hists_.book1D("h_eta_me1_after_lct_okClctAlct","h_eta_me1_after_lct_okClctAlct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_after_mplct_okAlctClct = hists_.book1D("h_eta_me1_after_mplct_okAlctClct","h_eta_me1_after_mplct_okAlctClct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_after_mplct_okAlctClct_plus = hists_.book1D("h_eta_me1_after_mplct_okAlctClct_plus","h_eta_me1_after_mplct_okAlctClct_plus",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me11_after_lct = hists_.book1D("h_eta_me11_after_lct","h_eta_me11_after_lct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me11_after_lct_okAlct = hists_.book1D("h_eta_me11_after_lct_okAlct","h_eta_me11_after_lct_okAlct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me11_after_lct_okAlctClct = hists_.book1D("h_eta_me11_after_lct_okAlctClct","h_eta_me11_after_lct_okAlctClct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me11_after_lct_okClct = hists_.book1D("h_eta_me11_after_lct_okClct","h_eta_me11_after_lct_okClct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me11_after_lct_okClctAlct = hists_.book1D("h_eta_me11_after_lct_okClctAlct","h_eta_me11_after_lct_okClctAlct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me11_after_mplct_okAlctClct = hists_.book1D("h_eta_me11_after_mplct_okAlctClct","h_eta_me11_after_mplct_okAlctClct",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me11_after_mplct_okAlctClct_plus = hists_.book1D("h_eta_me11_after_mplct_okAlctClct_plus","h_eta_me11_after_mplct_okAlctClct_plus",N_ETA_BINS, ETA_START, ETA_END);
+
+    h_eta_me1_after_tf_ok = hists_.book1D("h_eta_me1_after_tf_ok","h_eta_me1_after_tf_ok",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_after_tf_ok_pt10 = hists_.book1D("h_eta_me1_after_tf_ok_pt10","h_eta_me1_after_tf_ok_pt10",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_after_tf_ok_plus = hists_.book1D("h_eta_me1_after_tf_ok_plus","h_eta_me1_after_tf_ok_plus",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_after_tf_ok_plus_pt10 = hists_.book1D("h_eta_me1_after_tf_ok_plus_pt10","h_eta_me1_after_tf_ok_plus_pt10",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_after_tf_ok_plus_q[0] = hists_.book1D("h_eta_me1_after_tf_ok_plus_q1","h_eta_me1_after_tf_ok_plus_q1",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_after_tf_ok_plus_q[1] = hists_.book1D("h_eta_me1_after_tf_ok_plus_q2","h_eta_me1_after_tf_ok_plus_q2",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_after_tf_ok_plus_q[2] = hists_.book1D("h_eta_me1_after_tf_ok_plus_q3","h_eta_me1_after_tf_ok_plus_q3",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_after_tf_ok_plus_pt10_q[0] = hists_.book1D("h_eta_me1_after_tf_ok_plus_pt10_q1","h_eta_me1_after_tf_ok_plus_pt10_q1",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_after_tf_ok_plus_pt10_q[1] = hists_.book1D("h_eta_me1_after_tf_ok_plus_pt10_q2","h_eta_me1_after_tf_ok_plus_pt10_q2",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_after_tf_ok_plus_pt10_q[2] = hists_.book1D("h_eta_me1_after_tf_ok_plus_pt10_q3","h_eta_me1_after_tf_ok_plus_pt10_q3",N_ETA_BINS, ETA_START, ETA_END);
     //h_eta_me1_after_tf_all = fs->make<TH1D>("h_eta_me1_after_tf_all","h_eta_me1_after_tf_all",N_ETA_BINS, ETA_START, ETA_END);
     //h_eta_me1_after_tf_all_pt10 = fs->make<TH1D>("h_eta_me1_after_tf_all_pt10","h_eta_me1_after_tf_all_pt10",N_ETA_BINS, ETA_START, ETA_END);
 
 
-    h_eta_me1_after_mplct_ok = fs->make<TH1D>("h_eta_me1_after_mplct_ok","h_eta_me1_after_mplct_ok",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me2_after_mplct_ok = fs->make<TH1D>("h_eta_me2_after_mplct_ok","h_eta_me2_after_mplct_ok",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me3_after_mplct_ok = fs->make<TH1D>("h_eta_me3_after_mplct_ok","h_eta_me3_after_mplct_ok",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me4_after_mplct_ok = fs->make<TH1D>("h_eta_me4_after_mplct_ok","h_eta_me4_after_mplct_ok",N_ETA_BINS, ETA_START, ETA_END);
-
-
-    h_eta_after_mpc_ok_plus_3st1a = fs->make<TH1D>("h_eta_after_mpc_ok_plus_3st1a","h_eta_after_mpc_ok_plus_3st1a",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_tfcand_ok_plus_3st1a= fs->make<TH1D>("h_eta_after_tfcand_ok_plus_3st1a","h_eta_after_tfcand_ok_plus_3st1a",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_after_tfcand_ok_plus_pt10_3st1a = fs->make<TH1D>("h_eta_after_tfcand_ok_plus_pt10_3st1a","h_eta_after_tfcand_ok_plus_pt10_3st1a",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_after_tf_ok_plus_3st1a= fs->make<TH1D>("h_eta_me1_after_tf_ok_plus_3st1a","h_eta_me1_after_tf_ok_plus_3st1a",N_ETA_BINS, ETA_START, ETA_END);
-    h_eta_me1_after_tf_ok_plus_pt10_3st1a = fs->make<TH1D>("h_eta_me1_after_tf_ok_plus_pt10_3st1a","h_eta_me1_after_tf_ok_plus_pt10_3st1a",N_ETA_BINS, ETA_START, ETA_END);
-
-
-    h_bx_after_alct = fs->make<TH1D>("h_bx_after_alct","h_bx_after_alct",13,-6.5, 6.5);
-    h_bx_after_mpc = fs->make<TH1D>("h_bx_after_mpc","h_bx_after_mpc",13,-6.5, 6.5);
-
-
-    h_wg_me11_initial = fs->make<TH1D>("h_wg_me11_initial","h_wg_me11_initial",50, -1,49);
-    h_wg_me11_after_alct_okAlct = fs->make<TH1D>("h_wg_me11_after_alct_okAlct","h_wg_me11_after_alct_okAlct",50, -1,49);
-    h_wg_me11_after_alctclct_okAlctClct = fs->make<TH1D>("h_wg_me11_after_alctclct_okAlctClct","h_wg_me11_after_alctclct_okAlctClct",50, -1,49);
-    h_wg_me11_after_lct_okAlctClct = fs->make<TH1D>("h_wg_me11_after_lct_okAlctClct","h_wg_me11_after_lct_okAlctClct",50, -1,49);
-
-
-    h_strip_me1a_initial = fs->make<TH1D>("h_strip_me1a_initial","h_strip_me1a_initial",48, -0.5,47.5);
-    h_strip_me1b_initial = fs->make<TH1D>("h_strip_me1b_initial","h_strip_me1b_initial",64, -0.5,63.5);
-    h_strip_me1a_after_clct = fs->make<TH1D>("h_strip_me1a_after_clct","h_strip_me1a_after_clct",48, -0.5,47.5);
-    h_strip_me1b_after_clct = fs->make<TH1D>("h_strip_me1b_after_clct","h_strip_me1b_after_clct",64, -0.5,63.5);
-    h_strip_me1a_after_clct_okClct = fs->make<TH1D>("h_strip_me1a_after_clct_okClct","h_strip_me1a_after_clct_okClct",48, -0.5,47.5);
-    h_strip_me1b_after_clct_okClct = fs->make<TH1D>("h_strip_me1b_after_clct_okClct","h_strip_me1b_after_clct_okClct",64, -0.5,63.5);
-
-
-
-    h_phi_initial  = fs->make<TH1D>("h_phi_initial","h_phi_initial",128, -M_PI,M_PI);
-    h_phi_after_alct  = fs->make<TH1D>("h_phi_after_alct","h_phi_after_alct",128, -M_PI,M_PI);
-    h_phi_after_clct  = fs->make<TH1D>("h_phi_after_clct","h_phi_after_clct",128, -M_PI,M_PI);
-    h_phi_after_lct  = fs->make<TH1D>("h_phi_after_lct","h_phi_after_lct",128, -M_PI,M_PI);
-    h_phi_after_mpc  = fs->make<TH1D>("h_phi_after_mpc","h_phi_after_mpc",128, -M_PI,M_PI);
-    h_phi_after_tftrack  = fs->make<TH1D>("h_phi_after_tftrack","h_phi_after_tftrack",128, -M_PI,M_PI);
-    h_phi_after_tfcand  = fs->make<TH1D>("h_phi_after_tfcand","h_phi_after_tfcand",128, -M_PI,M_PI);
-    h_phi_after_tfcand_all = fs->make<TH1D>("h_phi_after_tfcand_all","h_phi_after_tfcand_all",128, -M_PI,M_PI);
-    h_phi_after_gmtreg = fs->make<TH1D>("h_phi_after_gmtreg","h_phi_after_gmtreg",128, -M_PI,M_PI);
-    h_phi_after_gmtreg_all = fs->make<TH1D>("h_phi_after_gmtreg_all","h_phi_after_gmtreg_all",128, -M_PI,M_PI);
-    h_phi_after_gmtreg_dr = fs->make<TH1D>("h_phi_after_gmtreg_dr","h_phi_after_gmtreg_dr",128, -M_PI,M_PI);
-    h_phi_after_gmt = fs->make<TH1D>("h_phi_after_gmt","h_phi_after_gmt",128, -M_PI,M_PI);
-    h_phi_after_gmt_all = fs->make<TH1D>("h_phi_after_gmt_all","h_phi_after_gmt_all",128, -M_PI,M_PI);
-    h_phi_after_gmt_dr = fs->make<TH1D>("h_phi_after_gmt_dr","h_phi_after_gmt_dr",128, -M_PI,M_PI);
-    h_phi_after_gmt_dr_nocsc = fs->make<TH1D>("h_phi_after_gmt_dr_nocsc","h_phi_after_gmt_dr_nocsc",128, -M_PI,M_PI);
-
-    h_phi_me1_after_alct = fs->make<TH1D>("h_phi_me1_after_alct","h_phi_me1_after_alct",128, -M_PI, M_PI);
-    h_phi_me1_after_alct_okAlct = fs->make<TH1D>("h_phi_me1_after_alct_okAlct","h_phi_me1_after_alct_okAlct",128, -M_PI, M_PI);
-    h_phi_me1_after_clct = fs->make<TH1D>("h_phi_me1_after_clct","h_phi_me1_after_clct",128, -M_PI, M_PI);
-    h_phi_me1_after_clct_okClct = fs->make<TH1D>("h_phi_me1_after_clct_okClct","h_phi_me1_after_clct_okClct",128, -M_PI, M_PI);
-    h_phi_me1_after_alctclct = fs->make<TH1D>("h_phi_me1_after_alctclct","h_phi_me1_after_alctclct",128, -M_PI, M_PI);
-    h_phi_me1_after_alctclct_okAlct = fs->make<TH1D>("h_phi_me1_after_alctclct_okAlct","h_phi_me1_after_alctclct_okAlct",128, -M_PI, M_PI);
-    h_phi_me1_after_alctclct_okClct = fs->make<TH1D>("h_phi_me1_after_alctclct_okClct","h_phi_me1_after_alctclct_okClct",128, -M_PI, M_PI);
-    h_phi_me1_after_alctclct_okAlctClct = fs->make<TH1D>("h_phi_me1_after_alctclct_okAlctClct","h_phi_me1_after_alctclct_okAlctClct",128, -M_PI, M_PI);
-
-    h_phi_me1_after_lct = fs->make<TH1D>("h_phi_me1_after_lct","h_phi_me1_after_lct",128, -M_PI, M_PI);
-    h_phi_me1_after_lct_okAlct = fs->make<TH1D>("h_phi_me1_after_lct_okAlct","h_phi_me1_after_lct_okAlct",128, -M_PI, M_PI);
-    h_phi_me1_after_lct_okAlctClct = fs->make<TH1D>("h_phi_me1_after_lct_okAlctClct","h_phi_me1_after_lct_okAlctClct",128, -M_PI, M_PI);
-    h_phi_me1_after_lct_okClct = fs->make<TH1D>("h_phi_me1_after_lct_okClct","h_phi_me1_after_lct_okClct",128, -M_PI, M_PI);
-    h_phi_me1_after_lct_okClctAlct = fs->make<TH1D>("h_phi_me1_after_lct_okClctAlct","h_phi_me1_after_lct_okClctAlct",128, -M_PI, M_PI);
-    h_phi_me1_after_mplct_ok = fs->make<TH1D>("h_phi_me1_after_mplct_ok","h_phi_me1_after_mplct_ok",128, -M_PI, M_PI);
-    h_phi_me1_after_mplct_okAlctClct = fs->make<TH1D>("h_phi_me1_after_mplct_okAlctClct","h_phi_me1_after_mplct_okAlctClct",128, -M_PI, M_PI);
-    h_phi_me1_after_mplct_okAlctClct_plus = fs->make<TH1D>("h_phi_me1_after_mplct_okAlctClct_plus","h_phi_me1_after_mplct_okAlctClct_plus",128, -M_PI, M_PI);
-    h_phi_me1_after_tf_ok = fs->make<TH1D>("h_phi_me1_after_tf_ok","h_phi_me1_after_tf_ok",128, -M_PI, M_PI);
-
-    h_qu_alct = fs->make<TH1D>("h_qu_alct","h_qu_alct",17,-0.5, 16.5);
-    h_qu_mplct = fs->make<TH1D>("h_qu_mplct","h_qu_mplct",17,-0.5, 16.5);
-    h_qu_vs_bx__alct = fs->make<TH2D>("h_qu_vs_bx__alct","h_qu_vs_bx__alct",17,-0.5, 16.5, 15,-7.5, 7.5);
-    h_qu_vs_bx__mplct = fs->make<TH2D>("h_qu_vs_bx__mplct","h_qu_vs_bx__mplct",17,-0.5, 16.5, 15,-7.5, 7.5);
-
-    h_tf_n_stubs = fs->make<TH1D>("h_tf_n_stubs","h_tf_n_stubs",16, 0.,16.);
-    h_tf_n_matchstubs = fs->make<TH1D>("h_tf_n_matchstubs","h_tf_n_matchstubs",16, 0.,16.);
-    h_tf_n_stubs_vs_matchstubs = fs->make<TH2D>("h_tf_n_stubs_vs_matchstubs","h_tf_n_stubs_vs_matchstubs",16, 0.,16.,16, 0.,16.);
-
-    h_tfpt = fs->make<TH1D>("h_tfpt","h_tfpt",300, 0.,150.);
-    h_tfeta = fs->make<TH1D>("h_tfeta","h_tfeta",500,-2.5, 2.5);
-    h_tfphi = fs->make<TH1D>("h_tfphi","h_tfphi",128*5, -M_PI,M_PI);
-    h_tfbx = fs->make<TH1D>("h_tfbx","h_tfbx",13,-6.5, 6.5);
-    h_tfqu = fs->make<TH1D>("h_tfqu","h_tfqu",5,-0.5, 4.5);
-    h_tfdr = fs->make<TH1D>("h_tfdr","h_tfdr",120,0., 0.6);
-    h_tfpt_vs_qu = fs->make<TH2D>("h_tfpt_vs_qu","h_tfpt_vs_qu",N_PT_BINS*2, 0.,150.,5,-0.5, 4.5);
+    h_eta_me1_after_mplct_ok = hists_.book1D("h_eta_me1_after_mplct_ok","h_eta_me1_after_mplct_ok",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me2_after_mplct_ok = hists_.book1D("h_eta_me2_after_mplct_ok","h_eta_me2_after_mplct_ok",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me3_after_mplct_ok = hists_.book1D("h_eta_me3_after_mplct_ok","h_eta_me3_after_mplct_ok",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me4_after_mplct_ok = hists_.book1D("h_eta_me4_after_mplct_ok","h_eta_me4_after_mplct_ok",N_ETA_BINS, ETA_START, ETA_END);
+
+
+    h_eta_after_mpc_ok_plus_3st1a = hists_.book1D("h_eta_after_mpc_ok_plus_3st1a","h_eta_after_mpc_ok_plus_3st1a",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_tfcand_ok_plus_3st1a= hists_.book1D("h_eta_after_tfcand_ok_plus_3st1a","h_eta_after_tfcand_ok_plus_3st1a",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_after_tfcand_ok_plus_pt10_3st1a = hists_.book1D("h_eta_after_tfcand_ok_plus_pt10_3st1a","h_eta_after_tfcand_ok_plus_pt10_3st1a",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_after_tf_ok_plus_3st1a= hists_.book1D("h_eta_me1_after_tf_ok_plus_3st1a","h_eta_me1_after_tf_ok_plus_3st1a",N_ETA_BINS, ETA_START, ETA_END);
+    h_eta_me1_after_tf_ok_plus_pt10_3st1a = hists_.book1D("h_eta_me1_after_tf_ok_plus_pt10_3st1a","h_eta_me1_after_tf_ok_plus_pt10_3st1a",N_ETA_BINS, ETA_START, ETA_END);
+
+
+    h_bx_after_alct = hists_.book1D("h_bx_after_alct","h_bx_after_alct",13,-6.5, 6.5);
+    h_bx_after_mpc = hists_.book1D("h_bx_after_mpc","h_bx_after_mpc",13,-6.5, 6.5);
+
+
+    h_wg_me11_initial = hists_.book1D("h_wg_me11_initial","h_wg_me11_initial",50, -1,49);
+    h_wg_me11_after_alct_okAlct = hists_.book1D("h_wg_me11_after_alct_okAlct","h_wg_me11_after_alct_okAlct",50, -1,49);
+    h_wg_me11_after_alctclct_okAlctClct = hists_.book1D("h_wg_me11_after_alctclct_okAlctClct","h_wg_me11_after_alctclct_okAlctClct",50, -1,49);
+    h_wg_me11_after_lct_okAlctClct = hists_.book1D("h_wg_me11_after_lct_okAlctClct","h_wg_me11_after_lct_okAlctClct",50, -1,49);
+
+
+    h_strip_me1a_initial = hists_.book1D("h_strip_me1a_initial","h_strip_me1a_initial",48, -0.5,47.5);
+    h_strip_me1b_initial = hists_.book1D("h_strip_me1b_initial","h_strip_me1b_initial",64, -0.5,63.5);
+    h_strip_me1a_after_clct = hists_.book1D("h_strip_me1a_after_clct","h_strip_me1a_after_clct",48, -0.5,47.5);
+    h_strip_me1b_after_clct = hists_.book1D("h_strip_me1b_after_clct","h_strip_me1b_after_clct",64, -0.5,63.5);
+    h_strip_me1a_after_clct_okClct = hists_.book1D("h_strip_me1a_after_clct_okClct","h_strip_me1a_after_clct_okClct",48, -0.5,47.5);
+    h_strip_me1b_after_clct_okClct = hists_.book1D("h_strip_me1b_after_clct_okClct","h_strip_me1b_after_clct_okClct",64, -0.5,63.5);
+
+
+
+    h_phi_initial  = hists_.book1D("h_phi_initial","h_phi_initial",128, -M_PI,M_PI);
+    h_phi_after_alct  = hists_.book1D("h_phi_after_alct","h_phi_after_alct",128, -M_PI,M_PI);
+    h_phi_after_clct  = hists_.book1D("h_phi_after_clct","h_phi_after_clct",128, -M_PI,M_PI);
+    h_phi_after_lct  = hists_.book1D("h_phi_after_lct","h_phi_after_lct",128, -M_PI,M_PI);
+    h_phi_after_mpc  = hists_.book1D("h_phi_after_mpc","h_phi_after_mpc",128, -M_PI,M_PI);
+    h_phi_after_tftrack  = hists_.book1D("h_phi_after_tftrack","h_phi_after_tftrack",128, -M_PI,M_PI);
+    h_phi_after_tfcand  = hists_.book1D("h_phi_after_tfcand","h_phi_after_tfcand",128, -M_PI,M_PI);
+    h_phi_after_tfcand_all = hists_.book1D("h_phi_after_tfcand_all","h_phi_after_tfcand_all",128, -M_PI,M_PI);
+    h_phi_after_gmtreg = hists_.book1D("h_phi_after_gmtreg","h_phi_after_gmtreg",128, -M_PI,M_PI);
+    h_phi_after_gmtreg_all = hists_.book1D("h_phi_after_gmtreg_all","h_phi_after_gmtreg_all",128, -M_PI,M_PI);
+    h_phi_after_gmtreg_dr = hists_.book1D("h_phi_after_gmtreg_dr","h_phi_after_gmtreg_dr",128, -M_PI,M_PI);
+    h_phi_after_gmt = hists_.book1D("h_phi_after_gmt","h_phi_after_gmt",128, -M_PI,M_PI);
+    h_phi_after_gmt_all = hists_.book1D("h_phi_after_gmt_all","h_phi_after_gmt_all",128, -M_PI,M_PI);
+    h_phi_after_gmt_dr = hists_.book1D("h_phi_after_gmt_dr","h_phi_after_gmt_dr",128, -M_PI,M_PI);
+    h_phi_after_gmt_dr_nocsc = hists_.book1D("h_phi_after_gmt_dr_nocsc","h_phi_after_gmt_dr_nocsc",128, -M_PI,M_PI);
+
+    h_phi_me1_after_alct = hists_.book1D("h_phi_me1_after_alct","h_phi_me1_after_alct",128, -M_PI, M_PI);
+    h_phi_me1_after_alct_okAlct = hists_.book1D("h_phi_me1_after_alct_okAlct","h_phi_me1_after_alct_okAlct",128, -M_PI, M_PI);
+    h_phi_me1_after_clct = hists_.book1D("h_phi_me1_after_clct","h_phi_me1_after_clct",128, -M_PI, M_PI);
+    h_phi_me1_after_clct_okClct = hists_.book1D("h_phi_me1_after_clct_okClct","h_phi_me1_after_clct_okClct",128, -M_PI, M_PI);
+    h_phi_me1_after_alctclct = hists_.book1D("h_phi_me1_after_alctclct","h_phi_me1_after_alctclct",128, -M_PI, M_PI);
+    h_phi_me1_after_alctclct_okAlct = hists_.book1D("h_phi_me1_after_alctclct_okAlct","h_phi_me1_after_alctclct_okAlct",128, -M_PI, M_PI);
+    h_phi_me1_after_alctclct_okClct = hists_.book1D("h_phi_me1_after_alctclct_okClct","h_phi_me1_after_alctclct_okClct",128, -M_PI, M_PI);
+    h_phi_me1_after_alctclct_okAlctClct = hists_.book1D("h_phi_me1_after_alctclct_okAlctClct","h_phi_me1_after_alctclct_okAlctClct",128, -M_PI, M_PI);
+
+    h_phi_me1_after_lct = hists_.book1D("h_phi_me1_after_lct","h_phi_me1_after_lct",128, -M_PI, M_PI);
+    h_phi_me1_after_lct_okAlct = hists_.book1D("h_phi_me1_after_lct_okAlct","h_phi_me1_after_lct_okAlct",128, -M_PI, M_PI);
+    h_phi_me1_after_lct_okAlctClct = hists_.book1D("h_phi_me1_after_lct_okAlctClct","h_phi_me1_after_lct_okAlctClct",128, -M_PI, M_PI);
+    h_phi_me1_after_lct_okClct = hists_.book1D("h_phi_me1_after_lct_okClct","h_phi_me1_after_lct_okClct",128, -M_PI, M_PI);
+    h_phi_me1_after_lct_okClctAlct = hists_.book1D("h_phi_me1_after_lct_okClctAlct","h_phi_me1_after_lct_okClctAlct",128, -M_PI, M_PI);
+    h_phi_me1_after_mplct_ok = hists_.book1D("h_phi_me1_after_mplct_ok","h_phi_me1_after_mplct_ok",128, -M_PI, M_PI);
+    h_phi_me1_after_mplct_okAlctClct = hists_.book1D("h_phi_me1_after_mplct_okAlctClct","h_phi_me1_after_mplct_okAlctClct",128, -M_PI, M_PI);
+    h_phi_me1_after_mplct_okAlctClct_plus = hists_.book1D("h_phi_me1_after_mplct_okAlctClct_plus","h_phi_me1_after_mplct_okAlctClct_plus",128, -M_PI, M_PI);
+    h_phi_me1_after_tf_ok = hists_.book1D("h_phi_me1_after_tf_ok","h_phi_me1_after_tf_ok",128, -M_PI, M_PI);
+
+    h_qu_alct = hists_.book1D("h_qu_alct","h_qu_alct",17,-0.5, 16.5);
+    h_qu_mplct = hists_.book1D("h_qu_mplct","h_qu_mplct",17,-0.5, 16.5);
+    h_qu_vs_bx__alct = hists_.book2D("h_qu_vs_bx__alct","h_qu_vs_bx__alct",17,-0.5, 16.5, 15,-7.5, 7.5);
+    h_qu_vs_bx__mplct = hists_.book2D("h_qu_vs_bx__mplct","h_qu_vs_bx__mplct",17,-0.5, 16.5, 15,-7.5, 7.5);
+
+    h_tf_n_stubs = hists_.book1D("h_tf_n_stubs","h_tf_n_stubs",16, 0.,16.);
+    h_tf_n_matchstubs = hists_.book1D("h_tf_n_matchstubs","h_tf_n_matchstubs",16, 0.,16.);
+    h_tf_n_stubs_vs_matchstubs = hists_.book2D("h_tf_n_stubs_vs_matchstubs","h_tf_n_stubs_vs_matchstubs",16, 0.,16.,16, 0.,16.);
+
+    h_tfpt = hists_.book1D("h_tfpt","h_tfpt",300, 0.,150.);
+    h_tfeta = hists_.book1D("h_tfeta","h_tfeta",500,-2.5, 2.5);
+    h_tfphi = hists_.book1D("h_tfphi","h_tfphi",128*5, -M_PI,M_PI);
+    h_tfbx = hists_.book1D("h_tfbx","h_tfbx",13,-6.5, 6.5);
+    h_tfqu = hists_.book1D("h_tfqu","h_tfqu",5,-0.5, 4.5);
+    h_tfdr = hists_.book1D("h_tfdr","h_tfdr",120,0., 0.6);
+    h_tfpt_vs_qu = hists_.book2D("h_tfpt_vs_qu","h_tfpt_vs_qu",N_PT_BINS*2, 0.,150.,5,-0.5, 4.5);
 
     h_tf_mode = fs->make<TH1D>("h_tf_mode","TF Track Mode", 16, -0.5, 15.5);
     setupTFModeHisto(h_tf_mode);
     h_tf_mode->SetTitle("TF Track Mode (SimTrack match)");
 
-    h_tf_pt_h42_2st = fs->make<TH1D>("h_tf_pt_h42_2st","h_tf_pt_h42_2st",300, 0.,150.);
-    h_tf_pt_h42_3st = fs->make<TH1D>("h_tf_pt_h42_3st","h_tf_pt_h42_3st",300, 0.,150.);
-    h_tf_pt_h42_2st_w = fs->make<TH1D>("h_tf_pt_h42_2st_w","h_tf_pt_h42_2st_w",300, 0.,150.);
-    h_tf_pt_h42_3st_w = fs->make<TH1D>("h_tf_pt_h42_3st_w","h_tf_pt_h42_3st_w",300, 0.,150.);
-
-
-    h_gmtpt = fs->make<TH1D>("h_gmtpt","h_gmtpt",300, 0.,150.);
-    h_gmteta = fs->make<TH1D>("h_gmteta","h_gmteta",500,-2.5, 2.5);
-    h_gmtphi = fs->make<TH1D>("h_gmtphi","h_gmtphi",128*5, -M_PI,M_PI);
-    h_gmtbx = fs->make<TH1D>("h_gmtbx","h_gmtbx",13,-6.5, 6.5);
-    h_gmtrank = fs->make<TH1D>("h_gmtrank","h_gmtrank",250,-0.001, 250-0.001);
-    h_gmtqu = fs->make<TH1D>("h_gmtqu","h_gmtqu",11,-0.5, 10.5);
-    h_gmtisrpc = fs->make<TH1D>("h_gmtisrpc","h_gmtisrpc",4,-0.5, 3.5);
-    h_gmtdr = fs->make<TH1D>("h_gmtdr","h_gmtdr",120,0., 0.6);
-
-    h_gmtxpt = fs->make<TH1D>("h_gmtxpt","h_gmtxpt",300, 0.,150.);
-    h_gmtxeta = fs->make<TH1D>("h_gmtxeta","h_gmtxeta",500,-2.5, 2.5);
-    h_gmtxphi = fs->make<TH1D>("h_gmtxphi","h_gmtxphi",128*5, -M_PI,M_PI);
-    h_gmtxbx = fs->make<TH1D>("h_gmtxbx","h_gmtxbx",13,-6.5, 6.5);
-    h_gmtxrank = fs->make<TH1D>("h_gmtxrank","h_gmtxrank",250,-0.001, 250-0.001);
-    h_gmtxqu = fs->make<TH1D>("h_gmtxqu","h_gmtxqu",11,-0.5, 10.5);
-    h_gmtxisrpc = fs->make<TH1D>("h_gmtxisrpc","h_gmtxisrpc",4,-0.5, 3.5);
-    h_gmtxdr = fs->make<TH1D>("h_gmtxdr","h_gmtxdr",120,0., 0.6);
-
-    h_gmtxpt_nocsc = fs->make<TH1D>("h_gmtxpt_nocsc","h_gmtxpt_nocsc",300, 0.,150.);
-    h_gmtxeta_nocsc = fs->make<TH1D>("h_gmtxeta_nocsc","h_gmtxeta_nocsc",500,-2.5, 2.5);
-    h_gmtxphi_nocsc = fs->make<TH1D>("h_gmtxphi_nocsc","h_gmtxphi_nocsc",128*5, -M_PI,M_PI);
-    h_gmtxbx_nocsc = fs->make<TH1D>("h_gmtxbx_nocsc","h_gmtxbx_nocsc",13,-6.5, 6.5);
-    h_gmtxrank_nocsc = fs->make<TH1D>("h_gmtxrank_nocsc","h_gmtxrank_nocsc",250,0, 250);
-    h_gmtxqu_nocsc = fs->make<TH1D>("h_gmtxqu_nocsc","h_gmtxqu_nocsc",11,-0.5, 10.5);
-    h_gmtxisrpc_nocsc = fs->make<TH1D>("h_gmtxisrpc_nocsc","h_gmtxisrpc_nocsc",4,-0.5, 3.5);
-    h_gmtxdr_nocsc = fs->make<TH1D>("h_gmtxdr_nocsc","h_gmtxdr_nocsc",120,0., 0.6);
-
-    h_gmtxqu_nogmtreg = fs->make<TH1D>("h_gmtxqu_nogmtreg","h_gmtxqu_nogmtreg",11,-0.5, 10.5);
-    h_gmtxisrpc_nogmtreg = fs->make<TH1D>("h_gmtxisrpc_nogmtreg","h_gmtxisrpc_nogmtreg",4,-0.5, 3.5);
-    h_gmtxqu_notfcand = fs->make<TH1D>("h_gmtxqu_notfcand","h_gmtxqu_notfcand",11,-0.5, 10.5);
-    h_gmtxisrpc_notfcand = fs->make<TH1D>("h_gmtxisrpc_notfcand","h_gmtxisrpc_notfcand",4,-0.5, 3.5);
-    h_gmtxqu_nompc = fs->make<TH1D>("h_gmtxqu_nompc","h_gmtxqu_nompc",11,-0.5, 10.5);
-    h_gmtxisrpc_nompc = fs->make<TH1D>("h_gmtxisrpc_nompc","h_gmtxisrpc_nompc",4,-0.5, 3.5);
-
-    h_n_simHits = fs->make<TH1D>("h_n_simHits", "h_n_simHits", 41,-0.5,40.5);
-    h_n_alct = fs->make<TH1D>("h_n_alct", "h_n_alct", 9,-0.5,8.5);
-    h_n_clct = fs->make<TH1D>("h_n_clct", "h_n_clct", 9,-0.5,8.5);
-    h_n_lct = fs->make<TH1D>("h_n_lct", "h_n_lct", 9,-0.5,8.5);
-    h_n_mplct = fs->make<TH1D>("h_n_mplct", "h_n_mplct", 9,-0.5,8.5);
-    h_n_tftrack = fs->make<TH1D>("h_n_tftrack", "h_n_tftrack", 6,-0.5,5.5);
-    h_n_tftrack_all = fs->make<TH1D>("h_n_tftrack_all", "h_n_tftrack_all", 6,-0.5,5.5);
-    h_n_tfcand = fs->make<TH1D>("h_n_tfcand", "h_n_tfcand", 6,-0.5,5.5);
-    h_n_tfcand_all = fs->make<TH1D>("h_n_tfcand_all", "h_n_tfcand_all", 6,-0.5,5.5);
-    h_n_gmtregcand = fs->make<TH1D>("h_n_gmtregcand", "h_n_gmtregcand", 6,-0.5,5.5);
-    h_n_gmtregcand_all = fs->make<TH1D>("h_n_gmtregcand_all", "h_n_gmtregcand_all", 6,-0.5,5.5);
-    h_n_gmtcand = fs->make<TH1D>("h_n_gmtcand", "h_n_gmtcand", 6,-0.5,5.5);
-    h_n_gmtcand_all = fs->make<TH1D>("h_n_gmtcand_all", "h_n_gmtcand_all", 6,-0.5,5.5);
-
-    h_n_ch_w_alct = fs->make<TH1D>("h_n_ch_w_alct", "h_n_ch_w_alct", 9,-0.5,8.5);
-    h_n_ch_w_clct = fs->make<TH1D>("h_n_ch_w_clct", "h_n_ch_w_clct", 9,-0.5,8.5);
-    h_n_ch_w_lct = fs->make<TH1D>("h_n_ch_w_lct", "h_n_ch_w_lct", 9,-0.5,8.5);
-    h_n_ch_w_mplct = fs->make<TH1D>("h_n_ch_w_mplct", "h_n_ch_w_mplct", 9,-0.5,8.5);
-
-
-    h_pt_over_tfpt_resol = fs->make<TH1D>("h_pt_over_pttf_resol","h_pt_over_pttf_resol",300, -1.5,1.5);
-    h_pt_over_tfpt_resol_vs_pt = fs->make<TH2D>("h_pt_over_pttf_resol_vs_pt","h_pt_over_pttf_resol_vs_pt",150, -1.5,1.5,N_PT_BINS, PT_START, PT_END);
-
-    h_eta_minus_tfeta_resol = fs->make<TH1D>("h_eta_minus_tfeta_resol","h_eta_minus_tfeta_resol",N_ETA_BINS,-1., 1.);
-    h_phi_minus_tfphi_resol = fs->make<TH1D>("h_phi_minus_tfphi_resol","h_phi_minus_tfphi_resol",200,-1., 1.);
-
-    h_gmt_mindr = fs->make<TH1D>("h_gmt_mindr","h_gmt_mindr",500, 0, 2*M_PI);
-    h_gmt_dr_maxrank = fs->make<TH1D>("h_gmt_dr_maxrank","h_gmt_dr_maxrank",500, 0, 2*M_PI);
+    h_tf_pt_h42_2st = hists_.book1D("h_tf_pt_h42_2st","h_tf_pt_h42_2st",300, 0.,150.);
+    h_tf_pt_h42_3st = hists_.book1D("h_tf_pt_h42_3st","h_tf_pt_h42_3st",300, 0.,150.);
+    h_tf_pt_h42_2st_w = hists_.book1D("h_tf_pt_h42_2st_w","h_tf_pt_h42_2st_w",300, 0.,150.);
+    h_tf_pt_h42_3st_w = hists_.book1D("h_tf_pt_h42_3st_w","h_tf_pt_h42_3st_w",300, 0.,150.);
+
+
+    h_gmtpt = hists_.book1D("h_gmtpt","h_gmtpt",300, 0.,150.);
+    h_gmteta = hists_.book1D("h_gmteta","h_gmteta",500,-2.5, 2.5);
+    h_gmtphi = hists_.book1D("h_gmtphi","h_gmtphi",128*5, -M_PI,M_PI);
+    h_gmtbx = hists_.book1D("h_gmtbx","h_gmtbx",13,-6.5, 6.5);
+    h_gmtrank = hists_.book1D("h_gmtrank","h_gmtrank",250,-0.001, 250-0.001);
+    h_gmtqu = hists_.book1D("h_gmtqu","h_gmtqu",11,-0.5, 10.5);
+    h_gmtisrpc = hists_.book1D("h_gmtisrpc","h_gmtisrpc",4,-0.5, 3.5);
+    h_gmtdr = hists_.book1D("h_gmtdr","h_gmtdr",120,0., 0.6);
+
+    h_gmtxpt = hists_.book1D("h_gmtxpt","h_gmtxpt",300, 0.,150.);
+    h_gmtxeta = hists_.book1D("h_gmtxeta","h_gmtxeta",500,-2.5, 2.5);
+    h_gmtxphi = hists_.book1D("h_gmtxphi","h_gmtxphi",128*5, -M_PI,M_PI);
+    h_gmtxbx = hists_.book1D("h_gmtxbx","h_gmtxbx",13,-6.5, 6.5);
+    h_gmtxrank = hists_.book1D("h_gmtxrank","h_gmtxrank",250,-0.001, 250-0.001);
+    h_gmtxqu = hists_.book1D("h_gmtxqu","h_gmtxqu",11,-0.5, 10.5);
+    h_gmtxisrpc = hists_.book1D("h_gmtxisrpc","h_gmtxisrpc",4,-0.5, 3.5);
+    h_gmtxdr = hists_.book1D("h_gmtxdr","h_gmtxdr",120,0., 0.6);
+
+    h_gmtxpt_nocsc = hists_.book1D("h_gmtxpt_nocsc","h_gmtxpt_nocsc",300, 0.,150.);
+    h_gmtxeta_nocsc = hists_.book1D("h_gmtxeta_nocsc","h_gmtxeta_nocsc",500,-2.5, 2.5);
+    h_gmtxphi_nocsc = hists_.book1D("h_gmtxphi_nocsc","h_gmtxphi_nocsc",128*5, -M_PI,M_PI);
+    h_gmtxbx_nocsc = hists_.book1D("h_gmtxbx_nocsc","h_gmtxbx_nocsc",13,-6.5, 6.5);
+    h_gmtxrank_nocsc = hists_.book1D("h_gmtxrank_nocsc","h_gmtxrank_nocsc",250,0, 250);
+    h_gmtxqu_nocsc = hists_.book1D("h_gmtxqu_nocsc","h_gmtxqu_nocsc",11,-0.5, 10.5);
+    h_gmtxisrpc_nocsc = hists_.book1D("h_gmtxisrpc_nocsc","h_gmtxisrpc_nocsc",4,-0.5, 3.5);
+    h_gmtxdr_nocsc = hists_.book1D("h_gmtxdr_nocsc","h_gmtxdr_nocsc",120,0., 0.6);
+
+    h_gmtxqu_nogmtreg = hists_.book1D("h_gmtxqu_nogmtreg","h_gmtxqu_nogmtreg",11,-0.5, 10.5);
+    h_gmtxisrpc_nogmtreg = hists_.book1D("h_gmtxisrpc_nogmtreg","h_gmtxisrpc_nogmtreg",4,-0.5, 3.5);
+    h_gmtxqu_notfcand = hists_.book1D("h_gmtxqu_notfcand","h_gmtxqu_notfcand",11,-0.5, 10.5);
+    h_gmtxisrpc_notfcand = hists_.book1D("h_gmtxisrpc_notfcand","h_gmtxisrpc_notfcand",4,-0.5, 3.5);
+    h_gmtxqu_nompc = hists_.book1D("h_gmtxqu_nompc","h_gmtxqu_nompc",11,-0.5, 10.5);
+    h_gmtxisrpc_nompc = hists_.book1D("h_gmtxisrpc_nompc","h_gmtxisrpc_nompc",4,-0.5, 3.5);
+
+    h_n_simHits = hists_.book1D("h_n_simHits", "h_n_simHits", 41,-0.5,40.5);
+    h_n_alct = hists_.book1D("h_n_alct", "h_n_alct", 9,-0.5,8.5);
+    h_n_clct = hists_.book1D("h_n_clct", "h_n_clct", 9,-0.5,8.5);
+    h_n_lct = hists_.book1D("h_n_lct", "h_n_lct", 9,-0.5,8.5);
+    h_n_mplct = hists_.book1D("h_n_mplct", "h_n_mplct", 9,-0.5,8.5);
+    h_n_tftrack = hists_.book1D("h_n_tftrack", "h_n_tftrack", 6,-0.5,5.5);
+    h_n_tftrack_all = hists_.book1D("h_n_tftrack_all", "h_n_tftrack_all", 6,-0.5,5.5);
+    h_n_tfcand = hists_.book1D("h_n_tfcand", "h_n_tfcand", 6,-0.5,5.5);
+    h_n_tfcand_all = hists_.book1D("h_n_tfcand_all", "h_n_tfcand_all", 6,-0.5,5.5);
+    h_n_gmtregcand = hists_.book1D("h_n_gmtregcand", "h_n_gmtregcand", 6,-0.5,5.5);
+    h_n_gmtregcand_all = hists_.book1D("h_n_gmtregcand_all", "h_n_gmtregcand_all", 6,-0.5,5.5);
+    h_n_gmtcand = hists_.book1D("h_n_gmtcand", "h_n_gmtcand", 6,-0.5,5.5);
+    h_n_gmtcand_all = hists_.book1D("h_n_gmtcand_all", "h_n_gmtcand_all", 6,-0.5,5.5);
+
+    h_n_ch_w_alct = hists_.book1D("h_n_ch_w_alct", "h_n_ch_w_alct", 9,-0.5,8.5);
+    h_n_ch_w_clct = hists_.book1D("h_n_ch_w_clct", "h_n_ch_w_clct", 9,-0.5,8.5);
+    h_n_ch_w_lct = hists_.book1D("h_n_ch_w_lct", "h_n_ch_w_lct", 9,-0.5,8.5);
+    h_n_ch_w_mplct = hists_.book1D("h_n_ch_w_mplct", "h_n_ch_w_mplct", 9,-0.5,8.5);
+
+
+    h_pt_over_tfpt_resol = hists_.book1D("h_pt_over_pttf_resol","h_pt_over_pttf_resol",300, -1.5,1.5);
+    h_pt_over_tfpt_resol_vs_pt = hists_.book2D("h_pt_over_pttf_resol_vs_pt","h_pt_over_pttf_resol_vs_pt",150, -1.5,1.5,N_PT_BINS, PT_START, PT_END);
+
+    h_eta_minus_tfeta_resol = hists_.book1D("h_eta_minus_tfeta_resol","h_eta_minus_tfeta_resol",N_ETA_BINS,-1., 1.);
+    h_phi_minus_tfphi_resol = hists_.book1D("h_phi_minus_tfphi_resol","h_phi_minus_tfphi_resol",200,-1., 1.);
+
+    h_gmt_mindr = hists_.book1D("h_gmt_mindr","h_gmt_mindr",500, 0, 2*M_PI);
+    h_gmt_dr_maxrank = hists_.book1D("h_gmt_dr_maxrank","h_gmt_dr_maxrank",500, 0, 2*M_PI);
 }
 
 
@@ -853,6 +858,8 @@ GEMCSCTriggerEfficiency::~GEMCSCTriggerEfficiency()
     if(ptLUT) delete ptLUT;
     ptLUT = NULL;
 
+    delete mufiducial_;
+
     for(int e=0; e<2; e++) for (int s=0; s<6; s++){
         if  (my_SPs[e][s]) delete my_SPs[e][s];
         my_SPs[e][s] = NULL;
@@ -954,11 +961,12 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
     iSetup.get<TrackingComponentsRecord>().get("SmartPropagatorAnyRK", propagatorAlong);
     iSetup.get<TrackingComponentsRecord>().get("SmartPropagatorAnyOpposite", propagatorOpposite);
 
-    if (mufiducial_) delete mufiducial_;
-    mufiducial_ = new MuFiducial();
-    mufiducial_->setGEMGeometry(gemGeometry);    
+    if (mufiducial_->getGEMGeometry() != gemGeometry)
+    {
+      mufiducial_->setGEMGeometry(gemGeometry);
+      mufiducial_->setGEMLUT(geometryCache_.gemLUT(iSetup.get< MuonGeometryRecord >(), gemGeometry));
+    }
     mufiducial_->setCSCGeometry(cscGeometry);
-    mufiducial_->buildGEMLUT();
 
 
     // ================================================================================================ 
@@ -1151,9 +1159,9 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
         mceta = cand->eta();
         mcphi = normalizedPhi(cand->phi());
 
-        h_pt_mctr ->Fill(mcpt);
-        h_eta_mctr->Fill(mceta);
-        h_phi_mctr->Fill(mcphi);
+        eventFills_.fill(h_pt_mctr, mcpt);
+        eventFills_.fill(h_eta_mctr, mceta);
+        eventFills_.fill(h_phi_mctr, mcphi);
 
         // ignore muons with huge eta
         if (fabs(mceta)>10) continue;
@@ -1186,7 +1194,7 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
             if (debugMC) std::cout << "sim_n " << sim_n << std::endl;
 
             double dr = deltaR(mceta, mcphi, steta, stphi);
-            h_DR_mctr_simtr->Fill(dr);
+            eventFills_.fill(h_DR_mctr_simtr, dr);
             // there is a generator level match!
             if (dr < minDeltaRSimTr){
                 matchSimTr = istrk;
@@ -1194,7 +1202,7 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
             }
         }
 
-        h_N_simtr->Fill(numberSimTr);
+        eventFills_.fill(h_N_simtr, numberSimTr);
 
         if (matchSimTr == simTracks.end()) {
             std::cout<<"+++ Warning: no matching sim track for MC track!"<<std::endl;
@@ -1202,16 +1210,16 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
         }
 
         if (matchSimTr == simTracks.end()) continue;
-        h_MinDR_mctr_simtr->Fill(minDeltaRSimTr);
+        eventFills_.fill(h_MinDR_mctr_simtr, minDeltaRSimTr);
 
     } // MC cands loop
 
-    h_N_mctr->Fill(numberMCTr);
+    eventFills_.fill(h_N_mctr, numberMCTr);
 
     double deltaR2Tr = -1;
     if (sim_n>1) {
         deltaR2Tr = deltaR(sim_eta[0],sim_phi[0],sim_eta[1],sim_phi[1]);
-        h_DR_2SimTr->Fill(deltaR2Tr);
+        eventFills_.fill(h_DR_2SimTr, deltaR2Tr);
         if (deltaR2Tr>M_PI && debugALLEVENT) std::cout<<"PI<deltaR2Tr="<<deltaR2Tr<<std::endl;
 
         // select only well separated or close simtracks
@@ -1287,7 +1295,7 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
     // 	  noALCTs++;
     // 	  if (debugALLEVENT) std::cout<<" * raw ID "<<id.rawId()<<" "<<id<<std::endl<<"   "<<(*digiIt)<<std::endl;
     // 	}
-    //     h_csctype_vs_alct_occup->Fill( getCSCType( id ), noALCTs);
+    //     eventFills_.fill(h_csctype_vs_alct_occup,  getCSCType( id ), noALCTs);
     //   }
 
     // if (debugALLEVENT) std::cout<<"--- ALL CLCTs ---"<<std::endl;
@@ -1302,7 +1310,7 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
     // 	  noCLCTs++;
     // 	  if (debugALLEVENT) std::cout<<" * raw ID "<<id.rawId()<<" "<<id<<std::endl<<"   "<<(*digiIt)<<std::endl;
     // 	}
-    //     h_csctype_vs_clct_occup->Fill( getCSCType( id ), noCLCTs);
+    //     eventFills_.fill(h_csctype_vs_clct_occup,  getCSCType( id ), noCLCTs);
     //   }
 
 
@@ -1321,7 +1329,10 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
     }
     if ( primaryVert == -1 ) { 
         if (debugALLEVENT) std::cout<<" Warning: NO PRIMARY SIMVERTEX!"<<std::endl; 
-        if (simTracks.size()>0) return;
+        if (simTracks.size()>0) {
+            hists_.flush(eventFills_);
+            return;
+        }
     }
 
 
@@ -1581,77 +1592,77 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
         unsigned nst_with_mpcs = has_mpcs_in_st[1] + has_mpcs_in_st[2] + has_mpcs_in_st[3] + has_mpcs_in_st[4];
 
         if (pt_ok) {
-            h_eta_initial0->Fill(steta);
-
-            h_n_simHits->Fill(match->simHits.size());
-            h_n_alct->Fill(match->ALCTsInReadOut().size());
-            h_n_clct->Fill(match->CLCTsInReadOut().size());
-            h_n_lct->Fill(match->LCTsInReadOut().size());
-            h_n_mplct->Fill(match->MPLCTsInReadOut().size());
-            h_n_tftrack->Fill(match->TFTRACKs.size());
-            h_n_tftrack_all->Fill(match->TFTRACKsAll.size());
-            h_n_tfcand->Fill(match->TFCANDs.size());
-            h_n_tfcand_all->Fill(match->TFCANDsAll.size());
-            h_n_gmtregcand->Fill(match->GMTREGCANDs.size());
-            h_n_gmtregcand_all->Fill(match->GMTREGCANDsAll.size());
-            h_n_gmtcand->Fill(match->GMTCANDs.size());
-            h_n_gmtcand_all->Fill(match->GMTCANDsAll.size());
+            eventFills_.fill(h_eta_initial0, steta);
+
+            eventFills_.fill(h_n_simHits, match->simHits.size());
+            eventFills_.fill(h_n_alct, match->ALCTsInReadOut().size());
+            eventFills_.fill(h_n_clct, match->CLCTsInReadOut().size());
+            eventFills_.fill(h_n_lct, match->LCTsInReadOut().size());
+            eventFills_.fill(h_n_mplct, match->MPLCTsInReadOut().size());
+            eventFills_.fill(h_n_tftrack, match->TFTRACKs.size());
+            eventFills_.fill(h_n_tftrack_all, match->TFTRACKsAll.size());
+            eventFills_.fill(h_n_tfcand, match->TFCANDs.size());
+            eventFills_.fill(h_n_tfcand_all, match->TFCANDsAll.size());
+            eventFills_.fill(h_n_gmtregcand, match->GMTREGCANDs.size());
+            eventFills_.fill(h_n_gmtregcand_all, match->GMTREGCANDsAll.size());
+            eventFills_.fill(h_n_gmtcand, match->GMTCANDs.size());
+            eventFills_.fill(h_n_gmtcand_all, match->GMTCANDsAll.size());
 
             // SimHIts:
-            if (has_hits_in_me11) h_eta_me11_initial->Fill(steta);
-            if (has_hits_in_st[1]) h_eta_me1_initial->Fill(steta);
-            if (has_hits_in_st[2]) h_eta_me2_initial->Fill(steta);
-            if (has_hits_in_st[3]) h_eta_me3_initial->Fill(steta);
-            if (has_hits_in_st[4]) h_eta_me4_initial->Fill(steta);
+            if (has_hits_in_me11) eventFills_.fill(h_eta_me11_initial, steta);
+            if (has_hits_in_st[1]) eventFills_.fill(h_eta_me1_initial, steta);
+            if (has_hits_in_st[2]) eventFills_.fill(h_eta_me2_initial, steta);
+            if (has_hits_in_st[3]) eventFills_.fill(h_eta_me3_initial, steta);
+            if (has_hits_in_st[4]) eventFills_.fill(h_eta_me4_initial, steta);
 
-            if (nst_with_hits>0) h_eta_initial_1st->Fill(steta);
-            if (nst_with_hits>1) h_eta_initial_2st->Fill(steta);
-            if (nst_with_hits>2) h_eta_initial_3st->Fill(steta);
+            if (nst_with_hits>0) eventFills_.fill(h_eta_initial_1st, steta);
+            if (nst_with_hits>1) eventFills_.fill(h_eta_initial_2st, steta);
+            if (nst_with_hits>2) eventFills_.fill(h_eta_initial_3st, steta);
 
-            if (has_hits_in_st[1] && nst_with_hits>1) h_eta_me1_initial_2st->Fill(steta);
-            if (has_hits_in_st[1] && nst_with_hits>2) h_eta_me1_initial_3st->Fill(steta);
+            if (has_hits_in_st[1] && nst_with_hits>1) eventFills_.fill(h_eta_me1_initial_2st, steta);
+            if (has_hits_in_st[1] && nst_with_hits>2) eventFills_.fill(h_eta_me1_initial_3st, steta);
 
             // MPC:
-            if (has_mpcs_in_st[1]) h_eta_me1_mpc->Fill(steta);
-            if (has_mpcs_in_st[2]) h_eta_me2_mpc->Fill(steta);
-            if (has_mpcs_in_st[3]) h_eta_me3_mpc->Fill(steta);
-            if (has_mpcs_in_st[4]) h_eta_me4_mpc->Fill(steta);
+            if (has_mpcs_in_st[1]) eventFills_.fill(h_eta_me1_mpc, steta);
+            if (has_mpcs_in_st[2]) eventFills_.fill(h_eta_me2_mpc, steta);
+            if (has_mpcs_in_st[3]) eventFills_.fill(h_eta_me3_mpc, steta);
+            if (has_mpcs_in_st[4]) eventFills_.fill(h_eta_me4_mpc, steta);
 
-            if (nst_with_mpcs>0) h_eta_mpc_1st->Fill(steta);
-            if (nst_with_mpcs>1) h_eta_mpc_2st->Fill(steta);
-            if (nst_with_mpcs>2) h_eta_mpc_3st->Fill(steta);
+            if (nst_with_mpcs>0) eventFills_.fill(h_eta_mpc_1st, steta);
+            if (nst_with_mpcs>1) eventFills_.fill(h_eta_mpc_2st, steta);
+            if (nst_with_mpcs>2) eventFills_.fill(h_eta_mpc_3st, steta);
 
-            if (has_mpcs_in_st[1] && nst_with_mpcs>1) h_eta_me1_mpc_2st->Fill(steta);
-            if (has_mpcs_in_st[1] && nst_with_mpcs>2) h_eta_me1_mpc_3st->Fill(steta);
+            if (has_mpcs_in_st[1] && nst_with_mpcs>1) eventFills_.fill(h_eta_me1_mpc_2st, steta);
+            if (has_mpcs_in_st[1] && nst_with_mpcs>2) eventFills_.fill(h_eta_me1_mpc_3st, steta);
         }
         if (eta_ok) {
-            h_pt_initial0->Fill(stpt);
+            eventFills_.fill(h_pt_initial0, stpt);
 
             // SimHIts:
-            if (has_hits_in_st[1]) h_pt_me1_initial->Fill(stpt);
-            if (has_hits_in_st[2]) h_pt_me2_initial->Fill(stpt);
-            if (has_hits_in_st[3]) h_pt_me3_initial->Fill(stpt);
-            if (has_hits_in_st[4]) h_pt_me4_initial->Fill(stpt);
+            if (has_hits_in_st[1]) eventFills_.fill(h_pt_me1_initial, stpt);
+            if (has_hits_in_st[2]) eventFills_.fill(h_pt_me2_initial, stpt);
+            if (has_hits_in_st[3]) eventFills_.fill(h_pt_me3_initial, stpt);
+            if (has_hits_in_st[4]) eventFills_.fill(h_pt_me4_initial, stpt);
 
-            if (nst_with_hits>0) h_pt_initial_1st->Fill(stpt);
-            if (nst_with_hits>1) h_pt_initial_2st->Fill(stpt);
-            if (nst_with_hits>2) h_pt_initial_3st->Fill(stpt);
+            if (nst_with_hits>0) eventFills_.fill(h_pt_initial_1st, stpt);
+            if (nst_with_hits>1) eventFills_.fill(h_pt_initial_2st, stpt);
+            if (nst_with_hits>2) eventFills_.fill(h_pt_initial_3st, stpt);
 
-            if (has_hits_in_st[1] && nst_with_hits>1) h_pt_me1_initial_2st->Fill(stpt);
-            if (has_hits_in_st[1] && nst_with_hits>2) h_pt_me1_initial_3st->Fill(stpt);
+            if (has_hits_in_st[1] && nst_with_hits>1) eventFills_.fill(h_pt_me1_initial_2st, stpt);
+            if (has_hits_in_st[1] && nst_with_hits>2) eventFills_.fill(h_pt_me1_initial_3st, stpt);
 
             // MPC:
-            if (has_mpcs_in_st[1]) h_pt_me1_mpc->Fill(stpt);
-            if (has_mpcs_in_st[2]) h_pt_me2_mpc->Fill(stpt);
-            if (has_mpcs_in_st[3]) h_pt_me3_mpc->Fill(stpt);
-            if (has_mpcs_in_st[4]) h_pt_me4_mpc->Fill(stpt);
+            if (has_mpcs_in_st[1]) eventFills_.fill(h_pt_me1_mpc, stpt);
+            if (has_mpcs_in_st[2]) eventFills_.fill(h_pt_me2_mpc, stpt);
+            if (has_mpcs_in_st[3]) eventFills_.fill(h_pt_me3_mpc, stpt);
+            if (has_mpcs_in_st[4]) eventFills_.fill(h_pt_me4_mpc, stpt);
 
-            if (nst_with_mpcs>0) h_pt_mpc_1st->Fill(stpt);
-            if (nst_with_mpcs>1) h_pt_mpc_2st->Fill(stpt);
-            if (nst_with_mpcs>2) h_pt_mpc_3st->Fill(stpt);
+            if (nst_with_mpcs>0) eventFills_.fill(h_pt_mpc_1st, stpt);
+            if (nst_with_mpcs>1) eventFills_.fill(h_pt_mpc_2st, stpt);
+            if (nst_with_mpcs>2) eventFills_.fill(h_pt_mpc_3st, stpt);
 
-            if (has_mpcs_in_st[1] && nst_with_mpcs>1) h_pt_me1_mpc_2st->Fill(stpt);
-            if (has_mpcs_in_st[1] && nst_with_mpcs>2) h_pt_me1_mpc_3st->Fill(stpt);
+            if (has_mpcs_in_st[1] && nst_with_mpcs>1) eventFills_.fill(h_pt_me1_mpc_2st, stpt);
+            if (has_mpcs_in_st[1] && nst_with_mpcs>2) eventFills_.fill(h_pt_me1_mpc_3st, stpt);
         }
 
         MatchCSCMuL1::TFCAND * tfc = match->bestTFCAND(match->TFCANDs, bestPtMatch_);
@@ -1692,41 +1703,41 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
         if (lookAtTrackCondition_ != nokeey) continue;
 
         // fill these histograms only with stubs in the readout!
-        h_eta_vs_ncscsh->Fill(steta, match->simHits.size());
-        h_eta_vs_nalct->Fill(steta, match->ALCTsInReadOut().size());
-        h_eta_vs_nclct->Fill(steta, match->CLCTsInReadOut().size()); 
-        h_eta_vs_nlct->Fill(steta, match->LCTsInReadOut().size());
-        h_eta_vs_nmplct->Fill(steta, match->MPLCTsInReadOut().size());
-
-        h_pt_vs_ncscsh->Fill(stpt, match->simHits.size());
-        h_pt_vs_nalct->Fill(stpt, match->ALCTsInReadOut().size());
-        h_pt_vs_nclct->Fill(stpt, match->CLCTsInReadOut().size());
-        h_pt_vs_nlct->Fill(stpt, match->LCTsInReadOut().size());
-        h_pt_vs_nmplct->Fill(stpt, match->MPLCTsInReadOut().size());
+        eventFills_.fill(h_eta_vs_ncscsh, steta, match->simHits.size());
+        eventFills_.fill(h_eta_vs_nalct, steta, match->ALCTsInReadOut().size());
+        eventFills_.fill(h_eta_vs_nclct, steta, match->CLCTsInReadOut().size()); 
+        eventFills_.fill(h_eta_vs_nlct, steta, match->LCTsInReadOut().size());
+        eventFills_.fill(h_eta_vs_nmplct, steta, match->MPLCTsInReadOut().size());
+
+        eventFills_.fill(h_pt_vs_ncscsh, stpt, match->simHits.size());
+        eventFills_.fill(h_pt_vs_nalct, stpt, match->ALCTsInReadOut().size());
+        eventFills_.fill(h_pt_vs_nclct, stpt, match->CLCTsInReadOut().size());
+        eventFills_.fill(h_pt_vs_nlct, stpt, match->LCTsInReadOut().size());
+        eventFills_.fill(h_pt_vs_nmplct, stpt, match->MPLCTsInReadOut().size());
 
         //============ Initial ==================
 
         if (tftAll) {
-            h_nMplct_vs_nDigiMplct->Fill(tftAll->mplcts.size(), tftAll->trgdigis.size());
-            h_qu_vs_nDigiMplct->Fill(tftAll->q_packed, tftAll->trgdigis.size());
+            eventFills_.fill(h_nMplct_vs_nDigiMplct, tftAll->mplcts.size(), tftAll->trgdigis.size());
+            eventFills_.fill(h_qu_vs_nDigiMplct, tftAll->q_packed, tftAll->trgdigis.size());
         } else {
-            h_nMplct_vs_nDigiMplct->Fill(0.,0.);
-            h_qu_vs_nDigiMplct->Fill(0.,0.);
+            eventFills_.fill(h_nMplct_vs_nDigiMplct, 0.,0.);
+            eventFills_.fill(h_qu_vs_nDigiMplct, 0.,0.);
         }
 
-        h_ntftrackall_vs_ntftrack->Fill(match->TFTRACKsAll.size(),match->TFTRACKs.size());
-        h_ntfcandall_vs_ntfcand->Fill(match->TFCANDsAll.size(),match->TFCANDs.size());
+        eventFills_.fill(h_ntftrackall_vs_ntftrack, match->TFTRACKsAll.size(),match->TFTRACKs.size());
+        eventFills_.fill(h_ntfcandall_vs_ntfcand, match->TFCANDsAll.size(),match->TFCANDs.size());
 
-        if (eta_ok) h_pt_vs_ntfcand->Fill(stpt,match->TFCANDs.size());
-        if (pt_ok) h_eta_vs_ntfcand->Fill(steta,match->TFCANDs.size());
+        if (eta_ok) eventFills_.fill(h_pt_vs_ntfcand, stpt,match->TFCANDs.size());
+        if (pt_ok) eventFills_.fill(h_eta_vs_ntfcand, steta,match->TFCANDs.size());
 
-        if (eta_ok) h_pt_initial->Fill(stpt);
-        if (eta_high) h_pth_initial->Fill(stpt);
-        if (pt_ok)  h_eta_initial->Fill(steta);
-        if (etapt_ok) h_phi_initial->Fill(stphi);
+        if (eta_ok) eventFills_.fill(h_pt_initial, stpt);
+        if (eta_high) eventFills_.fill(h_pth_initial, stpt);
+        if (pt_ok)  eventFills_.fill(h_eta_initial, steta);
+        if (etapt_ok) eventFills_.fill(h_phi_initial, stphi);
 
-        if (eta_1b) h_pt_initial_1b->Fill(stpt);
-        if (eta_gem_1b) h_pt_initial_gem_1b->Fill(stpt);
+        if (eta_1b) eventFills_.fill(h_pt_initial_1b, stpt);
+        if (eta_gem_1b) eventFills_.fill(h_pt_initial_gem_1b, stpt);
 
         std::vector<int> chIds = match->chambersWithHits(0,0,minNHitsChamber_);
         std::vector<int> fillIds;
@@ -1744,10 +1755,10 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
                     int wg = match->wireGroupAndStripInChamber(chIds[ch]).first;
 		    int strip = match->wireGroupAndStripInChamber(chIds[ch]).second-1;
 		    
-                    h_wg_me11_initial->Fill(wg);
+                    eventFills_.fill(h_wg_me11_initial, wg);
 
-                  if (csct==3)    h_strip_me1a_initial->Fill(strip);
-	          if (csct==0)    h_strip_me1b_initial->Fill(strip);
+                  if (csct==3)    eventFills_.fill(h_strip_me1a_initial, strip);
+	          if (csct==0)    eventFills_.fill(h_strip_me1b_initial, strip);
 	             }
             }
 
@@ -1774,8 +1785,8 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
         //     }
         // }
 
-        // if (eta_gem_1b && match_has_gem) h_pt_gem_1b->Fill(stpt);
-        // if (eta_gem_1b && match_has_gem && has_mplct_me1b) h_pt_lctgem_1b->Fill(stpt);
+        // if (eta_gem_1b && match_has_gem) eventFills_.fill(h_pt_gem_1b, stpt);
+        // if (eta_gem_1b && match_has_gem && has_mplct_me1b) eventFills_.fill(h_pt_lctgem_1b, stpt);
 
 
         //============ ALCTs ==================
@@ -1787,9 +1798,9 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
         std::vector<MatchCSCMuL1::ALCT> rALCTs = match->ALCTsInReadOut();
         if (rALCTs.size()) 
         {
-            if (eta_ok) h_pt_after_alct->Fill(stpt);
-            if (pt_ok) h_eta_after_alct->Fill(steta);
-            if (etapt_ok) h_phi_after_alct->Fill(stphi);
+            if (eta_ok) eventFills_.fill(h_pt_after_alct, stpt);
+            if (pt_ok) eventFills_.fill(h_eta_after_alct, steta);
+            if (etapt_ok) eventFills_.fill(h_phi_after_alct, stphi);
             int minbx[CSC_TYPES]={99,99,99,99,99,99,99,99,99,99};
             if (pt_ok) 
                 for (unsigned i=0; i<rALCTs.size();i++)
@@ -1797,29 +1808,29 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
                     if (rALCTs[i].inReadOut()==0) continue;
                     int bx = rALCTs[i].getBX() - 6;   
                     int bxf = rALCTs[i].trgdigi->getFullBX() - 6;  
-                    h_eta_vs_bx_after_alct->Fill( steta, bx ); // drop it
-                    h_bx_after_alct->Fill( bx );
+                    eventFills_.fill(h_eta_vs_bx_after_alct,  steta, bx ); // drop it
+                    eventFills_.fill(h_bx_after_alct,  bx );
                     int csct = getCSCType( rALCTs[i].id );
-                    h_bx__alct_cscdet[ csct ]->Fill( bx );
-                    h_bxf__alct_cscdet[ csct ]->Fill( bxf );
-                    h_dbxbxf__alct_cscdet[ csct ]->Fill( bx-bxf );
+                    eventFills_.fill(h_bx__alct_cscdet[ csct ],  bx );
+                    eventFills_.fill(h_bxf__alct_cscdet[ csct ],  bxf );
+                    eventFills_.fill(h_dbxbxf__alct_cscdet[ csct ],  bx-bxf );
                     if (rALCTs[i].deltaOk) {
-                        h_bx__alctOk_cscdet[ csct ]->Fill( bx );
-                        h_bxf__alctOk_cscdet[ csct ]->Fill( bxf );
+                        eventFills_.fill(h_bx__alctOk_cscdet[ csct ],  bx );
+                        eventFills_.fill(h_bxf__alctOk_cscdet[ csct ],  bxf );
                         if (debugINHISTOS && bx<-1) {    // method to dumpwire digis in case there is out of time alcts
                             std::cout<<" OOW good ALCT: "<<*(rALCTs[i].trgdigi)<<std::endl;
                             dumpWireDigis(rALCTs[i].id, wiredc);
                         }
                     }
                     if ( fabs(bx) < fabs(minbx[csct]) ) minbx[csct] = bx;
-                    h_qu_alct->Fill(rALCTs[i].trgdigi->getQuality());
-                    h_qu_vs_bx__alct->Fill(rALCTs[i].trgdigi->getQuality(), bx);
+                    eventFills_.fill(h_qu_alct, rALCTs[i].trgdigi->getQuality());
+                    eventFills_.fill(h_qu_vs_bx__alct, rALCTs[i].trgdigi->getQuality(), bx);
                 }
             if (pt_ok) for (int i=0; i<CSC_TYPES;i++)
-                if (minbx[i]<99) h_bx_min__alct_cscdet[ i ]->Fill( minbx[i] );
+                if (minbx[i]<99) eventFills_.fill(h_bx_min__alct_cscdet[ i ],  minbx[i] );
 
             std::vector<int> chIDs = match->chambersWithALCTs();
-            if (pt_ok) h_n_ch_w_alct->Fill(chIDs.size());
+            if (pt_ok) eventFills_.fill(h_n_ch_w_alct, chIDs.size());
             if (pt_ok) 
                 for (size_t ch = 0; ch < chIDs.size(); ch++) 
                 {
@@ -1830,8 +1841,8 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
                     MatchCSCMuL1::ALCT *bestALCT = match->bestALCT( chId );
                     if (bestALCT==0) std::cout<<"STRANGE: no best ALCT in chamber with ALCTs"<<std::endl;
                     if (bestALCT and bestALCT->deltaOk) {
-                        h_bx__alctOkBest_cscdet[ csct ]->Fill( bestALCT->getBX() - 6 );   // useful histogram  
-                        h_wg_vs_bx__alctOkBest_cscdet[ csct ]->Fill( match->wireGroupAndStripInChamber(chIDs[ch]).first, bestALCT->getBX() - 6);
+                        eventFills_.fill(h_bx__alctOkBest_cscdet[ csct ],  bestALCT->getBX() - 6 );   // useful histogram  
+                        eventFills_.fill(h_wg_vs_bx__alctOkBest_cscdet[ csct ],  match->wireGroupAndStripInChamber(chIDs[ch]).first, bestALCT->getBX() - 6);
                     }
                 }
 
@@ -1868,22 +1879,22 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
                 }
             if(okME1alct) {
                 if (debugALCT) std::cout << "okME1alct OK" << std::endl;
-                h_eta_me1_after_alct->Fill(steta);
-                h_phi_me1_after_alct->Fill(stphi);
-	        h_pt_me1_after_alct->Fill(stpt);	
+                eventFills_.fill(h_eta_me1_after_alct, steta);
+                eventFills_.fill(h_phi_me1_after_alct, stphi);
+	        eventFills_.fill(h_pt_me1_after_alct, stpt);	
             }
             if(okME11alct) {
                 if (debugALCT) std::cout << "okME1alct OK" << std::endl;
-                h_eta_me11_after_alct->Fill(steta);
+                eventFills_.fill(h_eta_me11_after_alct, steta);
             }
             if(okME11alctg) {
-                h_eta_me11_after_alct_okAlct->Fill(steta);
+                eventFills_.fill(h_eta_me11_after_alct_okAlct, steta);
             }
             if(okME1alctg) 
             {
-                h_eta_me1_after_alct_okAlct->Fill(steta);
-                h_phi_me1_after_alct_okAlct->Fill(stphi);
-                h_pt_me1_after_alct_okAlct->Fill(stpt);
+                eventFills_.fill(h_eta_me1_after_alct_okAlct, steta);
+                eventFills_.fill(h_phi_me1_after_alct_okAlct, stphi);
+                eventFills_.fill(h_pt_me1_after_alct_okAlct, stpt);
 
                 std::vector<int> chIDs = match->chambersWithALCTs();
                 std::vector<int> chWHIDs = match->chambersWithHits(0,0,minNHitsChamber_);
@@ -1894,7 +1905,7 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
                     int csct = getCSCType( chId );
                     if (!(csct==0 || csct==3)) continue;
                     int wg = match->wireGroupAndStripInChamber(chIDs[ch]).first;
-                    h_wg_me11_after_alct_okAlct->Fill(wg);    // This is important to keep
+                    eventFills_.fill(h_wg_me11_after_alct_okAlct, wg);    // This is important to keep
                 }
             }
 
@@ -1927,13 +1938,13 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
         std::vector<MatchCSCMuL1::CLCT> rCLCTs = match->CLCTsInReadOut();
         if (rCLCTs.size()) 
         {
-            if (eta_ok) h_pt_after_clct->Fill(stpt);
-            if (pt_ok) h_eta_after_clct->Fill(steta);
-            if (etapt_ok) h_phi_after_clct->Fill(stphi);
+            if (eta_ok) eventFills_.fill(h_pt_after_clct, stpt);
+            if (pt_ok) eventFills_.fill(h_eta_after_clct, steta);
+            if (etapt_ok) eventFills_.fill(h_phi_after_clct, stphi);
 
 
             std::vector<int> chIDs = match->chambersWithCLCTs();
-            if (pt_ok) h_n_ch_w_clct->Fill(chIDs.size());
+            if (pt_ok) eventFills_.fill(h_n_ch_w_clct, chIDs.size());
             if (pt_ok) 
                 for (size_t ch = 0; ch < chIDs.size(); ch++) 
                 {
@@ -1944,7 +1955,7 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
                     MatchCSCMuL1::CLCT *bestCLCT = match->bestCLCT( chId );
                     if (bestCLCT==0) std::cout<<"STRANGE: no best CLCT in chamber with CLCTs"<<std::endl;
                     if (bestCLCT and bestCLCT->deltaOk) {
-                        h_bx__clctOkBest_cscdet[ csct ]->Fill( bestCLCT->trgdigi->getBX() - 6 );  // keep this but drop what is not related to this
+                        eventFills_.fill(h_bx__clctOkBest_cscdet[ csct ],  bestCLCT->trgdigi->getBX() - 6 );  // keep this but drop what is not related to this
                     }
                 }
 
@@ -1976,9 +1987,9 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
                     }
                 }
             if(okME1clct) {
-                h_eta_me1_after_clct->Fill(steta);
-                h_phi_me1_after_clct->Fill(stphi);
-		h_pt_me1_after_clct->Fill(stpt);
+                eventFills_.fill(h_eta_me1_after_clct, steta);
+                eventFills_.fill(h_phi_me1_after_clct, stphi);
+		eventFills_.fill(h_pt_me1_after_clct, stpt);
 
 
                 std::vector<int> chIDs = match->chambersWithCLCTs();
@@ -1991,22 +2002,22 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
                     if (!(csct==0 || csct==3)) continue;
                     int strip = match->wireGroupAndStripInChamber(chIDs[ch]).second-1;
 
-		    if (csct==3)   	h_strip_me1a_after_clct->Fill(strip);
-		    if (csct==0)  	h_strip_me1b_after_clct->Fill(strip);
+		    if (csct==3)   	eventFills_.fill(h_strip_me1a_after_clct, strip);
+		    if (csct==0)  	eventFills_.fill(h_strip_me1b_after_clct, strip);
 
 		    chWHIDs.erase(std::find(chWHIDs.begin(),chWHIDs.end(),chIDs[ch]));
                 }
             }
             if(okME11clct) {
-                h_eta_me11_after_clct->Fill(steta);
+                eventFills_.fill(h_eta_me11_after_clct, steta);
             }
             if(okME11clctg) {
-                h_eta_me11_after_clct_okClct->Fill(steta);
+                eventFills_.fill(h_eta_me11_after_clct_okClct, steta);
             }
             if(okME1clctg) {
-                h_eta_me1_after_clct_okClct->Fill(steta);
-                h_phi_me1_after_clct_okClct->Fill(stphi);
-                h_pt_me1_after_clct_okClct->Fill(stpt);
+                eventFills_.fill(h_eta_me1_after_clct_okClct, steta);
+                eventFills_.fill(h_phi_me1_after_clct_okClct, stphi);
+                eventFills_.fill(h_pt_me1_after_clct_okClct, stpt);
                 
                 std::vector<int> chIDs = match->chambersWithCLCTs();
                 std::vector<int> chWHIDs = match->chambersWithHits(0,0,minNHitsChamber_);
@@ -2017,8 +2028,8 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
                     int csct = getCSCType( chId );
                     if (!(csct==0 || csct==3)) continue;
                     int strip = match->wireGroupAndStripInChamber(chIDs[ch]).second-1;
-		    if (csct==3)   h_strip_me1a_after_clct_okClct->Fill(strip);
-		    if (csct==0)   h_strip_me1b_after_clct_okClct->Fill(strip);
+		    if (csct==3)   eventFills_.fill(h_strip_me1a_after_clct_okClct, strip);
+		    if (csct==0)   eventFills_.fill(h_strip_me1b_after_clct_okClct, strip);
 
 		    chWHIDs.erase(std::find(chWHIDs.begin(),chWHIDs.end(),chIDs[ch]));
                 }
@@ -2027,33 +2038,33 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
         
         
         if (hasME1alct && hasME1clct) {
-            h_eta_me1_after_alctclct->Fill(steta);
-            h_phi_me1_after_alctclct->Fill(stphi);
+            eventFills_.fill(h_eta_me1_after_alctclct, steta);
+            eventFills_.fill(h_phi_me1_after_alctclct, stphi);
         }
         if (hasME11alct && hasME11clct) { 
-            h_eta_me11_after_alctclct->Fill(steta);
+            eventFills_.fill(h_eta_me11_after_alctclct, steta);
         }
         if (ME1ALCTsOk.size() && hasME1clct) {
-            h_eta_me1_after_alctclct_okAlct->Fill(steta);
-            h_phi_me1_after_alctclct_okAlct->Fill(stphi);
+            eventFills_.fill(h_eta_me1_after_alctclct_okAlct, steta);
+            eventFills_.fill(h_phi_me1_after_alctclct_okAlct, stphi);
         }
         if (ME11ALCTsOk.size() && hasME11clct) {
-            h_eta_me11_after_alctclct_okAlct->Fill(steta);
+            eventFills_.fill(h_eta_me11_after_alctclct_okAlct, steta);
         }
         if (ME1CLCTsOk.size() && hasME1alct) {
-            h_eta_me1_after_alctclct_okClct->Fill(steta);
-            h_phi_me1_after_alctclct_okClct->Fill(stphi);
+            eventFills_.fill(h_eta_me1_after_alctclct_okClct, steta);
+            eventFills_.fill(h_phi_me1_after_alctclct_okClct, stphi);
         }
         if (ME11CLCTsOk.size() && hasME11alct) {
-            h_eta_me11_after_alctclct_okClct->Fill(steta);
+            eventFills_.fill(h_eta_me11_after_alctclct_okClct, steta);
         }
         if (ME11ALCTsOk.size() && ME11CLCTsOk.size()) {
-            h_eta_me11_after_alctclct_okAlctClct->Fill(steta);
+            eventFills_.fill(h_eta_me11_after_alctclct_okAlctClct, steta);
         }
         if (ME1ALCTsOk.size() && ME1CLCTsOk.size()) 
         {
-            h_eta_me1_after_alctclct_okAlctClct->Fill(steta);
-            h_phi_me1_after_alctclct_okAlctClct->Fill(stphi);
+            eventFills_.fill(h_eta_me1_after_alctclct_okAlctClct, steta);
+            eventFills_.fill(h_phi_me1_after_alctclct_okAlctClct, stphi);
 
 
             //  This is important 
@@ -2076,7 +2087,7 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
                 if (has_clct==0) continue;
 
                 int wg = match->wireGroupAndStripInChamber(chIDs[ch]).first;
-                h_wg_me11_after_alctclct_okAlctClct->Fill(wg);
+                eventFills_.fill(h_wg_me11_after_alctclct_okAlctClct, wg);
             }
         }
 
@@ -2108,12 +2119,12 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
         std::vector<MatchCSCMuL1::LCT> rLCTs = match->LCTsInReadOut();
         if (rLCTs.size()) 
         {
-            if (eta_ok) h_pt_after_lct->Fill(stpt);
-            if (pt_ok) h_eta_after_lct->Fill(steta);
-            if (etapt_ok) h_phi_after_lct->Fill(stphi);
+            if (eta_ok) eventFills_.fill(h_pt_after_lct, stpt);
+            if (pt_ok) eventFills_.fill(h_eta_after_lct, steta);
+            if (etapt_ok) eventFills_.fill(h_phi_after_lct, stphi);
 
             std::vector<int> chIDs = match->chambersWithLCTs();
-            if (pt_ok) h_n_ch_w_lct->Fill(chIDs.size());
+            if (pt_ok) eventFills_.fill(h_n_ch_w_lct, chIDs.size());
 
 
             bool okME1lct = 0, okME1alct=0, okME1alctclct=0, okME1clct=0, okME1clctalct=0;
@@ -2164,36 +2175,36 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
                     }
                 }
             if(okME1lct) {
-                h_eta_me1_after_lct->Fill(steta);
-                h_phi_me1_after_lct->Fill(stphi);
+                eventFills_.fill(h_eta_me1_after_lct, steta);
+                eventFills_.fill(h_phi_me1_after_lct, stphi);
             }
             if(okME11lct) {
-                h_eta_me11_after_lct->Fill(steta);
+                eventFills_.fill(h_eta_me11_after_lct, steta);
             }
             if(okME1alct){ 
-                h_eta_me1_after_lct_okAlct->Fill(steta);
-                h_phi_me1_after_lct_okAlct->Fill(stphi);
+                eventFills_.fill(h_eta_me1_after_lct_okAlct, steta);
+                eventFills_.fill(h_phi_me1_after_lct_okAlct, stphi);
             }	    
             if(okME11alct){ 
-                h_eta_me11_after_lct_okAlct->Fill(steta);
+                eventFills_.fill(h_eta_me11_after_lct_okAlct, steta);
             }
             if(okME1clct) {
-                h_eta_me1_after_lct_okClct->Fill(steta);
-                h_phi_me1_after_lct_okClct->Fill(stphi);
+                eventFills_.fill(h_eta_me1_after_lct_okClct, steta);
+                eventFills_.fill(h_phi_me1_after_lct_okClct, stphi);
             }	    
             if(okME11clct) {
-                h_eta_me11_after_lct_okClct->Fill(steta);
+                eventFills_.fill(h_eta_me11_after_lct_okClct, steta);
             }
 
             if(okME11alctclct) 
             {
-                h_eta_me11_after_lct_okAlctClct->Fill(steta);
+                eventFills_.fill(h_eta_me11_after_lct_okAlctClct, steta);
             }
             if(okME1alctclct) 
             {
-                h_eta_me1_after_lct_okAlctClct->Fill(steta);
-                h_phi_me1_after_lct_okAlctClct->Fill(stphi);
-                h_pt_me1_after_lct_okAlctClct->Fill(stpt);
+                eventFills_.fill(h_eta_me1_after_lct_okAlctClct, steta);
+                eventFills_.fill(h_phi_me1_after_lct_okAlctClct, stphi);
+                eventFills_.fill(h_pt_me1_after_lct_okAlctClct, stpt);
 
                 std::vector<int> chIDs = match->chambersWithLCTs();
                 std::vector<int> chWHIDs = match->chambersWithHits(0,0,minNHitsChamber_);
@@ -2207,16 +2218,16 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
                     for (size_t i=0; i<ME1LCTsOk.size(); i++)
                         if (ME1LCTsOk[i].id.rawId()==(unsigned int)chIDs[ch]) has_lct=1;
                     if (has_lct==0) continue;
-                    h_wg_me11_after_lct_okAlctClct->Fill(match->wireGroupAndStripInChamber(chIDs[ch]).first);
+                    eventFills_.fill(h_wg_me11_after_lct_okAlctClct, match->wireGroupAndStripInChamber(chIDs[ch]).first);
                 }
             }
             if(okME1clctalct) {
-                h_eta_me1_after_lct_okClctAlct->Fill(steta);
-                h_phi_me1_after_lct_okClctAlct->Fill(stphi);
+                eventFills_.fill(h_eta_me1_after_lct_okClctAlct, steta);
+                eventFills_.fill(h_phi_me1_after_lct_okClctAlct, stphi);
 		
             }
             if(okME11clctalct) {
-                h_eta_me11_after_lct_okClctAlct->Fill(steta);
+                eventFills_.fill(h_eta_me11_after_lct_okClctAlct, steta);
             }
             if (debugINHISTOS) std::cout<<" LCT check: histo filled "<<1<<std::endl;
 
@@ -2228,7 +2239,7 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
             //   {
             //     for(size_t c=0; c<ME1CLCTsOk.size(); c++)
             // 	for(size_t a=0; a<ME1ALCTsOk.size(); a++)
-            // 	  h_bx_me1_aclct_ok_lct_no__bx_alct_vs_dbx_ACLCT->Fill( ME1ALCTsOk[a].getBX(),
+            // 	  eventFills_.fill(h_bx_me1_aclct_ok_lct_no__bx_alct_vs_dbx_ACLCT,  ME1ALCTsOk[a].getBX(),
             // 								ME1ALCTsOk[a].getBX() - ME1CLCTsOk[c].getBX());
             //     if (debugINHISTOS) {
             // 	std::cout<<"Correct ALCT&CLCT but no good LCT"<<std::endl;
@@ -2260,9 +2271,9 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
                                 rLCTs[i].clct->deltaOk && rLCTs[i].alct->deltaOk) 
                         {
                             if (rLCTs[i].id.ring() == 1)
-                                h_strip_v_wireg_me1b->Fill(rLCTs[i].clct->trgdigi->getKeyStrip(),rLCTs[i].alct->trgdigi->getKeyWG());
+                                eventFills_.fill(h_strip_v_wireg_me1b, rLCTs[i].clct->trgdigi->getKeyStrip(),rLCTs[i].alct->trgdigi->getKeyWG());
                             if (rLCTs[i].id.ring() == 4)
-                                h_strip_v_wireg_me1a->Fill(rLCTs[i].clct->trgdigi->getKeyStrip(),rLCTs[i].alct->trgdigi->getKeyWG());
+                                eventFills_.fill(h_strip_v_wireg_me1a, rLCTs[i].clct->trgdigi->getKeyStrip(),rLCTs[i].alct->trgdigi->getKeyWG());
                         }
                     }
                 }
@@ -2294,42 +2305,42 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
             okNmplct = mpcStations.size();
 
             if (eta_ok) {
-                h_pt_after_mpc->Fill(stpt);
-                if (okNmplct>1) h_pt_after_mpc_ok_plus->Fill(stpt);
-                if (okNmplct>1 && okME1mplct) h_pt_me1_after_mpc_ok_plus->Fill(stpt);
+                eventFills_.fill(h_pt_after_mpc, stpt);
+                if (okNmplct>1) eventFills_.fill(h_pt_after_mpc_ok_plus, stpt);
+                if (okNmplct>1 && okME1mplct) eventFills_.fill(h_pt_me1_after_mpc_ok_plus, stpt);
             }
             if (eta_high) {
-                h_pth_after_mpc->Fill(stpt);
-                if (okNmplct>1) h_pth_after_mpc_ok_plus->Fill(stpt);
-                if (okNmplct>1 && okME1mplct) h_pth_me1_after_mpc_ok_plus->Fill(stpt);
+                eventFills_.fill(h_pth_after_mpc, stpt);
+                if (okNmplct>1) eventFills_.fill(h_pth_after_mpc_ok_plus, stpt);
+                if (okNmplct>1 && okME1mplct) eventFills_.fill(h_pth_me1_after_mpc_ok_plus, stpt);
             }
 
             if (pt_ok){
-                h_eta_after_mpc->Fill(steta);
-                if (okNmplct>0) h_eta_after_mpc_ok->Fill(steta);
-                if (okNmplct>1) h_eta_after_mpc_ok_plus->Fill(steta);
-                if (okNmplct>2) h_eta_after_mpc_ok_plus_3st->Fill(steta);
-                if (okNmplct>2 || (fabs(steta)<2.099 && okNmplct>1) ) h_eta_after_mpc_ok_plus_3st1a->Fill(steta);
+                eventFills_.fill(h_eta_after_mpc, steta);
+                if (okNmplct>0) eventFills_.fill(h_eta_after_mpc_ok, steta);
+                if (okNmplct>1) eventFills_.fill(h_eta_after_mpc_ok_plus, steta);
+                if (okNmplct>2) eventFills_.fill(h_eta_after_mpc_ok_plus_3st, steta);
+                if (okNmplct>2 || (fabs(steta)<2.099 && okNmplct>1) ) eventFills_.fill(h_eta_after_mpc_ok_plus_3st1a, steta);
             }
 
-            if (etapt_ok) h_phi_after_mpc->Fill(stphi);
-            if (pt_ok && nmplct_per_st[0]) h_eta_after_mpc_st1->Fill(steta);
-            if (pt_ok && nmplct_per_st_good[0]) h_eta_after_mpc_st1_good->Fill(steta);
+            if (etapt_ok) eventFills_.fill(h_phi_after_mpc, stphi);
+            if (pt_ok && nmplct_per_st[0]) eventFills_.fill(h_eta_after_mpc_st1, steta);
+            if (pt_ok && nmplct_per_st_good[0]) eventFills_.fill(h_eta_after_mpc_st1_good, steta);
 
             if(pt_ok){
                 if (okME1mplct) {
-                    h_eta_me1_after_mplct_okAlctClct->Fill(steta);
-                    h_phi_me1_after_mplct_okAlctClct->Fill(stphi);
-                    h_eta_me1_after_mplct_ok->Fill(steta);
-                    h_phi_me1_after_mplct_ok->Fill(stphi);
+                    eventFills_.fill(h_eta_me1_after_mplct_okAlctClct, steta);
+                    eventFills_.fill(h_phi_me1_after_mplct_okAlctClct, stphi);
+                    eventFills_.fill(h_eta_me1_after_mplct_ok, steta);
+                    eventFills_.fill(h_phi_me1_after_mplct_ok, stphi);
                     if (okNmplct>1) {
-                        h_eta_me1_after_mplct_okAlctClct_plus->Fill(steta);
-                        h_phi_me1_after_mplct_okAlctClct_plus->Fill(stphi);
+                        eventFills_.fill(h_eta_me1_after_mplct_okAlctClct_plus, steta);
+                        eventFills_.fill(h_phi_me1_after_mplct_okAlctClct_plus, stphi);
                     }
                 }
-                if (okME2mplct) h_eta_me2_after_mplct_ok->Fill(steta);
-                if (okME3mplct) h_eta_me3_after_mplct_ok->Fill(steta);
-                if (okME4mplct) h_eta_me4_after_mplct_ok->Fill(steta);
+                if (okME2mplct) eventFills_.fill(h_eta_me2_after_mplct_ok, steta);
+                if (okME3mplct) eventFills_.fill(h_eta_me3_after_mplct_ok, steta);
+                if (okME4mplct) eventFills_.fill(h_eta_me4_after_mplct_ok, steta);
             }
         }
 
@@ -2338,9 +2349,9 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
 
         if (match->TFTRACKs.size()) 
         {
-            if (eta_ok) h_pt_after_tftrack->Fill(stpt);
-            if (pt_ok) h_eta_after_tftrack->Fill(steta);
-            if (etapt_ok) h_phi_after_tftrack->Fill(stphi);
+            if (eta_ok) eventFills_.fill(h_pt_after_tftrack, stpt);
+            if (pt_ok) eventFills_.fill(h_eta_after_tftrack, steta);
+            if (etapt_ok) eventFills_.fill(h_phi_after_tftrack, stphi);
             for (unsigned t=0; t<match->TFTRACKs.size(); t++) if (match->TFTRACKs[t].debug) match->TFTRACKs[t].print("DEBUG");
         }
 
@@ -2361,11 +2372,11 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
             bool ok_2s13 = (ok_2s123 && (tf_mode != 0x6)); // excludes ME1-ME2 and ME1-ME4 stub tf tracks
 
             int qu = tfc->l1cand->quality_packed();
-            h_tfpt->Fill(tfc_pt);
-            h_tfphi->Fill(tfc->phi);
-            h_tfeta->Fill(tfc->eta);
-            h_tfbx->Fill(tfc->l1cand->bx());
-            h_tfdr->Fill(tfc->dr);
+            eventFills_.fill(h_tfpt, tfc_pt);
+            eventFills_.fill(h_tfphi, tfc->phi);
+            eventFills_.fill(h_tfeta, tfc->eta);
+            eventFills_.fill(h_tfbx, tfc->l1cand->bx());
+            eventFills_.fill(h_tfdr, tfc->dr);
 
             // count matched 
             std::set<int> tfStations;
@@ -2390,54 +2401,54 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
 
             if (eta_ok && pt_ok) 
             {
-                h_tfqu->Fill(qu);
-                h_tfpt_vs_qu->Fill(tfc_pt,qu);
+                eventFills_.fill(h_tfqu, qu);
+                eventFills_.fill(h_tfpt_vs_qu, tfc_pt,qu);
                 h_tf_mode->Fill(tf_mode);
             }
             if (eta_ok) 
             {
-                h_pt_after_tfcand->Fill(stpt);
+                eventFills_.fill(h_pt_after_tfcand, stpt);
 
-                if (tfc_pt>=10.)  h_pt_after_tfcand_pt10->Fill(stpt);
-                if (tfc_pt>=20.)  h_pt_after_tfcand_pt20->Fill(stpt);
-                if (tfc_pt>=40.)  h_pt_after_tfcand_pt40->Fill(stpt);
-                if (tfc_pt>=60.)  h_pt_after_tfcand_pt60->Fill(stpt);
+                if (tfc_pt>=10.)  eventFills_.fill(h_pt_after_tfcand_pt10, stpt);
+                if (tfc_pt>=20.)  eventFills_.fill(h_pt_after_tfcand_pt20, stpt);
+                if (tfc_pt>=40.)  eventFills_.fill(h_pt_after_tfcand_pt40, stpt);
+                if (tfc_pt>=60.)  eventFills_.fill(h_pt_after_tfcand_pt60, stpt);
 
-                h_pt_vs_qu->Fill(stpt,qu);
+                eventFills_.fill(h_pt_vs_qu, stpt,qu);
 
                 if (tffid_ok)
                 {
-                    h_pt_after_tfcand_ok->Fill(stpt);
-                    if (tfc_pt>=10.)  h_pt_after_tfcand_pt10_ok->Fill(stpt);
-                    if (tfc_pt>=20.)  h_pt_after_tfcand_pt20_ok->Fill(stpt);
-                    if (tfc_pt>=40.)  h_pt_after_tfcand_pt40_ok->Fill(stpt);
-                    if (tfc_pt>=60.)  h_pt_after_tfcand_pt60_ok->Fill(stpt);
-
-                    h_pt_over_tfpt_resol->Fill( stpt/tfc_pt - 1.);
-                    h_pt_over_tfpt_resol_vs_pt->Fill( stpt/tfc_pt - 1., stpt);
+                    eventFills_.fill(h_pt_after_tfcand_ok, stpt);
+                    if (tfc_pt>=10.)  eventFills_.fill(h_pt_after_tfcand_pt10_ok, stpt);
+                    if (tfc_pt>=20.)  eventFills_.fill(h_pt_after_tfcand_pt20_ok, stpt);
+                    if (tfc_pt>=40.)  eventFills_.fill(h_pt_after_tfcand_pt40_ok, stpt);
+                    if (tfc_pt>=60.)  eventFills_.fill(h_pt_after_tfcand_pt60_ok, stpt);
+
+                    eventFills_.fill(h_pt_over_tfpt_resol,  stpt/tfc_pt - 1.);
+                    eventFills_.fill(h_pt_over_tfpt_resol_vs_pt,  stpt/tfc_pt - 1., stpt);
                 }
 
                 if (nTFstubsOk>1 && okNmplct>1) {
-                    h_pt_after_tfcand_ok_plus->Fill(stpt);
-                    if (qu >=1) h_pt_after_tfcand_ok_plus_q[0]->Fill(stpt);
-                    if (qu >=2) h_pt_after_tfcand_ok_plus_q[1]->Fill(stpt);
-                    if (qu >=3) h_pt_after_tfcand_ok_plus_q[2]->Fill(stpt);
+                    eventFills_.fill(h_pt_after_tfcand_ok_plus, stpt);
+                    if (qu >=1) eventFills_.fill(h_pt_after_tfcand_ok_plus_q[0], stpt);
+                    if (qu >=2) eventFills_.fill(h_pt_after_tfcand_ok_plus_q[1], stpt);
+                    if (qu >=3) eventFills_.fill(h_pt_after_tfcand_ok_plus_q[2], stpt);
                     if (tfc_pt>=10.) {
-                        h_pt_after_tfcand_ok_plus_pt10->Fill(stpt);
-                        if (qu >=1) h_pt_after_tfcand_ok_plus_pt10_q[0]->Fill(stpt);
-                        if (qu >=2) h_pt_after_tfcand_ok_plus_pt10_q[1]->Fill(stpt);
-                        if (qu >=3) h_pt_after_tfcand_ok_plus_pt10_q[2]->Fill(stpt);
+                        eventFills_.fill(h_pt_after_tfcand_ok_plus_pt10, stpt);
+                        if (qu >=1) eventFills_.fill(h_pt_after_tfcand_ok_plus_pt10_q[0], stpt);
+                        if (qu >=2) eventFills_.fill(h_pt_after_tfcand_ok_plus_pt10_q[1], stpt);
+                        if (qu >=3) eventFills_.fill(h_pt_after_tfcand_ok_plus_pt10_q[2], stpt);
                     }
                     if (okME1tf && okME1mplct){
-                        h_pt_me1_after_tf_ok_plus->Fill(stpt);
-                        if (qu >=1) h_pt_me1_after_tf_ok_plus_q[0]->Fill(stpt);
-                        if (qu >=2) h_pt_me1_after_tf_ok_plus_q[1]->Fill(stpt);
-                        if (qu >=3) h_pt_me1_after_tf_ok_plus_q[2]->Fill(stpt);
+                        eventFills_.fill(h_pt_me1_after_tf_ok_plus, stpt);
+                        if (qu >=1) eventFills_.fill(h_pt_me1_after_tf_ok_plus_q[0], stpt);
+                        if (qu >=2) eventFills_.fill(h_pt_me1_after_tf_ok_plus_q[1], stpt);
+                        if (qu >=3) eventFills_.fill(h_pt_me1_after_tf_ok_plus_q[2], stpt);
                         if (tfc_pt>=10.) {
-                            h_pt_me1_after_tf_ok_plus_pt10->Fill(stpt);
-                            if (qu >=1) h_pt_me1_after_tf_ok_plus_pt10_q[0]->Fill(stpt);
-                            if (qu >=2) h_pt_me1_after_tf_ok_plus_pt10_q[1]->Fill(stpt);
-                            if (qu >=3) h_pt_me1_after_tf_ok_plus_pt10_q[2]->Fill(stpt);
+                            eventFills_.fill(h_pt_me1_after_tf_ok_plus_pt10, stpt);
+                            if (qu >=1) eventFills_.fill(h_pt_me1_after_tf_ok_plus_pt10_q[0], stpt);
+                            if (qu >=2) eventFills_.fill(h_pt_me1_after_tf_ok_plus_pt10_q[1], stpt);
+                            if (qu >=3) eventFills_.fill(h_pt_me1_after_tf_ok_plus_pt10_q[2], stpt);
                         }
                     }
                 }
@@ -2448,25 +2459,25 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
             {
                 const int Nthr = 7;
                 float tfc_pt_thr[Nthr] = {0., 10., 15., 20., 25., 30., 40.};
-                for (int i=0; i<Nthr; ++i) if (tfc_pt >= tfc_pt_thr[i])  h_pt_after_tfcand_eta1b_2s[i]->Fill(stpt);
+                for (int i=0; i<Nthr; ++i) if (tfc_pt >= tfc_pt_thr[i])  eventFills_.fill(h_pt_after_tfcand_eta1b_2s[i], stpt);
 
                 if (okME1tf)
                 {
                     for (int i=0; i<Nthr; ++i) 
                         if (tfc_pt >= tfc_pt_thr[i])
                         {
-                            h_pt_after_tfcand_eta1b_2s1b[i]->Fill(stpt);
-                            if (ok_2s123) h_pt_after_tfcand_eta1b_2s123[i]->Fill(stpt);
-                            if (ok_2s13) h_pt_after_tfcand_eta1b_2s13[i]->Fill(stpt);
+                            eventFills_.fill(h_pt_after_tfcand_eta1b_2s1b[i], stpt);
+                            if (ok_2s123) eventFills_.fill(h_pt_after_tfcand_eta1b_2s123[i], stpt);
+                            if (ok_2s13) eventFills_.fill(h_pt_after_tfcand_eta1b_2s13[i], stpt);
                         }
                 }
 
                 if ( nTFstubsOk >= 3 )
                 {
-                    for (int i=0; i<Nthr; ++i) if (tfc_pt >= tfc_pt_thr[i])  h_pt_after_tfcand_eta1b_3s[i]->Fill(stpt);
+                    for (int i=0; i<Nthr; ++i) if (tfc_pt >= tfc_pt_thr[i])  eventFills_.fill(h_pt_after_tfcand_eta1b_3s[i], stpt);
 
                     if (okME1tf) {
-                        for (int i=0; i<Nthr; ++i) if (tfc_pt >= tfc_pt_thr[i])  h_pt_after_tfcand_eta1b_3s1b[i]->Fill(stpt);
+                        for (int i=0; i<Nthr; ++i) if (tfc_pt >= tfc_pt_thr[i])  eventFills_.fill(h_pt_after_tfcand_eta1b_3s1b[i], stpt);
                     }
                 }
             }
@@ -2482,64 +2493,64 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
             //         {
             //           h_mode_tfcand_gem1b_2s1b_1b[i]->Fill(tf_mode);
 
-            //           h_pt_after_tfcand_gem1b_2s1b[i]->Fill(stpt);
-            //           if (ok_2s123) h_pt_after_tfcand_gem1b_2s123[i]->Fill(stpt);
-            //           if (ok_2s13) h_pt_after_tfcand_gem1b_2s13[i]->Fill(stpt);
+            //           eventFills_.fill(h_pt_after_tfcand_gem1b_2s1b[i], stpt);
+            //           if (ok_2s123) eventFills_.fill(h_pt_after_tfcand_gem1b_2s123[i], stpt);
+            //           if (ok_2s13) eventFills_.fill(h_pt_after_tfcand_gem1b_2s13[i], stpt);
 
-            //           if ( nTFstubsOk >= 3 )  h_pt_after_tfcand_gem1b_3s1b[i]->Fill(stpt);
+            //           if ( nTFstubsOk >= 3 )  eventFills_.fill(h_pt_after_tfcand_gem1b_3s1b[i], stpt);
 
             //           if (   (gem_dphi_odd < -99. && gem_dphi_even < 99.)  // both just dummy default values
             //                  || (gem_dphi_odd  > -9. && isGEMDPhiGood(gem_dphi_odd, tfc_pt_thr[i], 1) )  // good dphi odd
             //                  || (gem_dphi_even > -9. && isGEMDPhiGood(gem_dphi_even, tfc_pt_thr[i], 0) ) ) // good dphi even
             //             {
-            //               h_pt_after_tfcand_dphigem1b_2s1b[i]->Fill(stpt);
-            //               if (ok_2s123) h_pt_after_tfcand_dphigem1b_2s123[i]->Fill(stpt);
-            //               if (ok_2s13) h_pt_after_tfcand_dphigem1b_2s13[i]->Fill(stpt);
-            //               if ( nTFstubsOk >= 3 )  h_pt_after_tfcand_dphigem1b_3s1b[i]->Fill(stpt);
+            //               eventFills_.fill(h_pt_after_tfcand_dphigem1b_2s1b[i], stpt);
+            //               if (ok_2s123) eventFills_.fill(h_pt_after_tfcand_dphigem1b_2s123[i], stpt);
+            //               if (ok_2s13) eventFills_.fill(h_pt_after_tfcand_dphigem1b_2s13[i], stpt);
+            //               if ( nTFstubsOk >= 3 )  eventFills_.fill(h_pt_after_tfcand_dphigem1b_3s1b[i], stpt);
             //             }
             //         }
             //   }
             
             if (eta_high) 
             {
-                h_pth_after_tfcand->Fill(stpt);
+                eventFills_.fill(h_pth_after_tfcand, stpt);
 
-                if (tfc_pt>=10.)  h_pth_after_tfcand_pt10->Fill(stpt);
+                if (tfc_pt>=10.)  eventFills_.fill(h_pth_after_tfcand_pt10, stpt);
 
                 if (tffid_ok)
                 {
-                    h_pth_after_tfcand_ok->Fill(stpt);
-                    if (tfc_pt>=10.)  h_pth_after_tfcand_pt10_ok->Fill(stpt);
+                    eventFills_.fill(h_pth_after_tfcand_ok, stpt);
+                    if (tfc_pt>=10.)  eventFills_.fill(h_pth_after_tfcand_pt10_ok, stpt);
 
-                    h_pth_over_tfpt_resol->Fill( stpt/tfc_pt - 1.);
-                    h_pth_over_tfpt_resol_vs_pt->Fill( stpt/tfc_pt - 1., stpt);
+                    eventFills_.fill(h_pth_over_tfpt_resol,  stpt/tfc_pt - 1.);
+                    eventFills_.fill(h_pth_over_tfpt_resol_vs_pt,  stpt/tfc_pt - 1., stpt);
                 }
 
                 if (nTFstubsOk>1 && okNmplct>1) {
-                    h_pth_after_tfcand_ok_plus->Fill(stpt);
-                    if (high_eta_stubs) h_pth_after_tfcand_ok_plus_3st1a->Fill(stpt);
-                    if (qu >=1) h_pth_after_tfcand_ok_plus_q[0]->Fill(stpt);
-                    if (qu >=2) h_pth_after_tfcand_ok_plus_q[1]->Fill(stpt);
-                    if (qu >=3) h_pth_after_tfcand_ok_plus_q[2]->Fill(stpt);
+                    eventFills_.fill(h_pth_after_tfcand_ok_plus, stpt);
+                    if (high_eta_stubs) eventFills_.fill(h_pth_after_tfcand_ok_plus_3st1a, stpt);
+                    if (qu >=1) eventFills_.fill(h_pth_after_tfcand_ok_plus_q[0], stpt);
+                    if (qu >=2) eventFills_.fill(h_pth_after_tfcand_ok_plus_q[1], stpt);
+                    if (qu >=3) eventFills_.fill(h_pth_after_tfcand_ok_plus_q[2], stpt);
                     if (tfc_pt>=10.) {
-                        h_pth_after_tfcand_ok_plus_pt10->Fill(stpt);
-                        if (high_eta_stubs) h_pth_after_tfcand_ok_plus_pt10_3st1a->Fill(stpt);
-                        if (qu >=1) h_pth_after_tfcand_ok_plus_pt10_q[0]->Fill(stpt);
-                        if (qu >=2) h_pth_after_tfcand_ok_plus_pt10_q[1]->Fill(stpt);
-                        if (qu >=3) h_pth_after_tfcand_ok_plus_pt10_q[2]->Fill(stpt);
+                        eventFills_.fill(h_pth_after_tfcand_ok_plus_pt10, stpt);
+                        if (high_eta_stubs) eventFills_.fill(h_pth_after_tfcand_ok_plus_pt10_3st1a, stpt);
+                        if (qu >=1) eventFills_.fill(h_pth_after_tfcand_ok_plus_pt10_q[0], stpt);
+                        if (qu >=2) eventFills_.fill(h_pth_after_tfcand_ok_plus_pt10_q[1], stpt);
+                        if (qu >=3) eventFills_.fill(h_pth_after_tfcand_ok_plus_pt10_q[2], stpt);
                     }
                     if (okME1tf && okME1mplct){
-                        h_pth_me1_after_tf_ok_plus->Fill(stpt);
-                        if (high_eta_stubs) h_pth_me1_after_tf_ok_plus_3st1a->Fill(stpt);
-                        if (qu >=1) h_pth_me1_after_tf_ok_plus_q[0]->Fill(stpt);
-                        if (qu >=2) h_pth_me1_after_tf_ok_plus_q[1]->Fill(stpt);
-                        if (qu >=3) h_pth_me1_after_tf_ok_plus_q[2]->Fill(stpt);
+                        eventFills_.fill(h_pth_me1_after_tf_ok_plus, stpt);
+                        if (high_eta_stubs) eventFills_.fill(h_pth_me1_after_tf_ok_plus_3st1a, stpt);
+                        if (qu >=1) eventFills_.fill(h_pth_me1_after_tf_ok_plus_q[0], stpt);
+                        if (qu >=2) eventFills_.fill(h_pth_me1_after_tf_ok_plus_q[1], stpt);
+                        if (qu >=3) eventFills_.fill(h_pth_me1_after_tf_ok_plus_q[2], stpt);
                         if (tfc_pt>=10.) {
-                            h_pth_me1_after_tf_ok_plus_pt10->Fill(stpt);
-                            if (high_eta_stubs) h_pth_me1_after_tf_ok_plus_pt10_3st1a->Fill(stpt);
-                            if (qu >=1) h_pth_me1_after_tf_ok_plus_pt10_q[0]->Fill(stpt);
-                            if (qu >=2) h_pth_me1_after_tf_ok_plus_pt10_q[1]->Fill(stpt);
-                            if (qu >=3) h_pth_me1_after_tf_ok_plus_pt10_q[2]->Fill(stpt);
+                            eventFills_.fill(h_pth_me1_after_tf_ok_plus_pt10, stpt);
+                            if (high_eta_stubs) eventFills_.fill(h_pth_me1_after_tf_ok_plus_pt10_3st1a, stpt);
+                            if (qu >=1) eventFills_.fill(h_pth_me1_after_tf_ok_plus_pt10_q[0], stpt);
+                            if (qu >=2) eventFills_.fill(h_pth_me1_after_tf_ok_plus_pt10_q[1], stpt);
+                            if (qu >=3) eventFills_.fill(h_pth_me1_after_tf_ok_plus_pt10_q[2], stpt);
                         }
                     }
                 }
@@ -2551,12 +2562,12 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
             if (mugeo::isME42EtaRegion(steta)) {
                 //      	    double weight = rateWeight(stpt);
                 if (tfc->tftrack->nStubs()>=2) {
-                    h_tf_pt_h42_2st->Fill(tfc_pt);
-                    //      	      h_tf_pt_h42_2st_w->Fill(tfc_pt,weight);
+                    eventFills_.fill(h_tf_pt_h42_2st, tfc_pt);
+                    //      	      eventFills_.fill(h_tf_pt_h42_2st_w, tfc_pt,weight);
                 }
                 if (tfc->tftrack->nStubs()>=3) {
-                    h_tf_pt_h42_3st->Fill(tfc_pt);
-                    //      	      h_tf_pt_h42_3st_w->Fill(tfc_pt,weight);
+                    eventFills_.fill(h_tf_pt_h42_3st, tfc_pt);
+                    //      	      eventFills_.fill(h_tf_pt_h42_3st_w, tfc_pt,weight);
                 }
             }
 
@@ -2565,57 +2576,57 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
             //  if ( ((tfc->tftrack->mplcts)[i])->id.station() == 1 && ((tfc->tftrack->mplcts)[i])->lct->deltaOk) okME1tf = 1;
             if(pt_ok && okME1tf) 
             {
-                h_eta_me1_after_tf_ok->Fill(steta);
-                if (tfc_pt>=10.) h_eta_me1_after_tf_ok_pt10->Fill(steta);
+                eventFills_.fill(h_eta_me1_after_tf_ok, steta);
+                if (tfc_pt>=10.) eventFills_.fill(h_eta_me1_after_tf_ok_pt10, steta);
                 if (nTFstubsOk>1 && okNmplct>1 && okME1mplct){
-                    h_eta_me1_after_tf_ok_plus->Fill(steta);
-                    if (high_eta_stubs) h_eta_me1_after_tf_ok_plus_3st1a->Fill(steta);
-                    if (qu >=1) h_eta_me1_after_tf_ok_plus_q[0]->Fill(steta);
-                    if (qu >=2) h_eta_me1_after_tf_ok_plus_q[1]->Fill(steta);
-                    if (qu >=3) h_eta_me1_after_tf_ok_plus_q[2]->Fill(steta);
+                    eventFills_.fill(h_eta_me1_after_tf_ok_plus, steta);
+                    if (high_eta_stubs) eventFills_.fill(h_eta_me1_after_tf_ok_plus_3st1a, steta);
+                    if (qu >=1) eventFills_.fill(h_eta_me1_after_tf_ok_plus_q[0], steta);
+                    if (qu >=2) eventFills_.fill(h_eta_me1_after_tf_ok_plus_q[1], steta);
+                    if (qu >=3) eventFills_.fill(h_eta_me1_after_tf_ok_plus_q[2], steta);
                     if (tfc_pt>=10.) {
-                        h_eta_me1_after_tf_ok_plus_pt10->Fill(steta);
-                        if (high_eta_stubs) h_eta_me1_after_tf_ok_plus_pt10_3st1a->Fill(steta);
-                        if (qu >=1) h_eta_me1_after_tf_ok_plus_pt10_q[0]->Fill(steta);
-                        if (qu >=2) h_eta_me1_after_tf_ok_plus_pt10_q[1]->Fill(steta);
-                        if (qu >=3) h_eta_me1_after_tf_ok_plus_pt10_q[2]->Fill(steta);
+                        eventFills_.fill(h_eta_me1_after_tf_ok_plus_pt10, steta);
+                        if (high_eta_stubs) eventFills_.fill(h_eta_me1_after_tf_ok_plus_pt10_3st1a, steta);
+                        if (qu >=1) eventFills_.fill(h_eta_me1_after_tf_ok_plus_pt10_q[0], steta);
+                        if (qu >=2) eventFills_.fill(h_eta_me1_after_tf_ok_plus_pt10_q[1], steta);
+                        if (qu >=3) eventFills_.fill(h_eta_me1_after_tf_ok_plus_pt10_q[2], steta);
                     }
                 }
             }
 
             if (pt_ok) 
             {
-                h_eta_after_tfcand->Fill(steta);
-                if (qu >=1 ) h_eta_after_tfcand_q[0]->Fill(steta);
-                if (qu >=2 ) h_eta_after_tfcand_q[1]->Fill(steta);
-                if (qu >=3 ) h_eta_after_tfcand_q[2]->Fill(steta);
+                eventFills_.fill(h_eta_after_tfcand, steta);
+                if (qu >=1 ) eventFills_.fill(h_eta_after_tfcand_q[0], steta);
+                if (qu >=2 ) eventFills_.fill(h_eta_after_tfcand_q[1], steta);
+                if (qu >=3 ) eventFills_.fill(h_eta_after_tfcand_q[2], steta);
 
-                if (nTFstubsOk>0 && okNmplct>0) h_eta_after_tfcand_ok->Fill(steta);
+                if (nTFstubsOk>0 && okNmplct>0) eventFills_.fill(h_eta_after_tfcand_ok, steta);
                 if (nTFstubsOk>1 && okNmplct>1) {
-                    h_eta_after_tfcand_ok_plus->Fill(steta);
-                    if (high_eta_stubs) h_eta_after_tfcand_ok_plus_3st1a->Fill(steta);
-                    if (qu >=1) h_eta_after_tfcand_ok_plus_q[0]->Fill(steta);
-                    if (qu >=2) h_eta_after_tfcand_ok_plus_q[1]->Fill(steta);
-                    if (qu >=3) h_eta_after_tfcand_ok_plus_q[2]->Fill(steta);
+                    eventFills_.fill(h_eta_after_tfcand_ok_plus, steta);
+                    if (high_eta_stubs) eventFills_.fill(h_eta_after_tfcand_ok_plus_3st1a, steta);
+                    if (qu >=1) eventFills_.fill(h_eta_after_tfcand_ok_plus_q[0], steta);
+                    if (qu >=2) eventFills_.fill(h_eta_after_tfcand_ok_plus_q[1], steta);
+                    if (qu >=3) eventFills_.fill(h_eta_after_tfcand_ok_plus_q[2], steta);
                 }
 
                 if (tfc_pt>=10.) {
-                    h_eta_after_tfcand_pt10->Fill(steta);
-                    if (eta_ok) h_tfqu_pt10->Fill(qu);
-                    if (nTFstubsOk>0 && okNmplct>0) h_eta_after_tfcand_ok_pt10->Fill(steta);
+                    eventFills_.fill(h_eta_after_tfcand_pt10, steta);
+                    if (eta_ok) eventFills_.fill(h_tfqu_pt10, qu);
+                    if (nTFstubsOk>0 && okNmplct>0) eventFills_.fill(h_eta_after_tfcand_ok_pt10, steta);
                     if (nTFstubsOk>1 && okNmplct>1) {
-                        h_eta_after_tfcand_ok_plus_pt10->Fill(steta);
-                        if (high_eta_stubs) h_eta_after_tfcand_ok_plus_pt10_3st1a->Fill(steta);
-                        if (qu >=1) h_eta_after_tfcand_ok_plus_pt10_q[0]->Fill(steta);
-                        if (qu >=2) h_eta_after_tfcand_ok_plus_pt10_q[1]->Fill(steta);
-                        if (qu >=3) h_eta_after_tfcand_ok_plus_pt10_q[2]->Fill(steta);
+                        eventFills_.fill(h_eta_after_tfcand_ok_plus_pt10, steta);
+                        if (high_eta_stubs) eventFills_.fill(h_eta_after_tfcand_ok_plus_pt10_3st1a, steta);
+                        if (qu >=1) eventFills_.fill(h_eta_after_tfcand_ok_plus_pt10_q[0], steta);
+                        if (qu >=2) eventFills_.fill(h_eta_after_tfcand_ok_plus_pt10_q[1], steta);
+                        if (qu >=3) eventFills_.fill(h_eta_after_tfcand_ok_plus_pt10_q[2], steta);
                     }
                 }
-                else  if (eta_ok) h_tfqu_pt10_no->Fill(qu);
+                else  if (eta_ok) eventFills_.fill(h_tfqu_pt10_no, qu);
 
-                h_eta_vs_qu->Fill(steta,qu);
+                eventFills_.fill(h_eta_vs_qu, steta,qu);
 
-                h_eta_minus_tfeta_resol->Fill(steta - tfc->eta);
+                eventFills_.fill(h_eta_minus_tfeta_resol, steta - tfc->eta);
 
 
 
@@ -2623,23 +2634,23 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
                 {
                     MatchCSCMuL1::MPLCT *mp = (tfc->tftrack->mplcts)[i];
                     int csct = getCSCType( mp->id );
-                    h_tf_stub_bx->Fill( mp->getBX() - 6 );
-                    h_tf_stub_bx_cscdet[csct]->Fill( mp->getBX() - 6 );
-                    h_tf_stub_qu->Fill( mp->trgdigi->getQuality() );
-                    h_tf_stub_qu_cscdet[csct]->Fill( mp->trgdigi->getQuality() );
+                    eventFills_.fill(h_tf_stub_bx,  mp->getBX() - 6 );
+                    eventFills_.fill(h_tf_stub_bx_cscdet[csct],  mp->getBX() - 6 );
+                    eventFills_.fill(h_tf_stub_qu,  mp->trgdigi->getQuality() );
+                    eventFills_.fill(h_tf_stub_qu_cscdet[csct],  mp->trgdigi->getQuality() );
                     h_tf_stub_csctype->Fill(csct);
                 }
 
 
-                h_tf_n_stubs_vs_matchstubs->Fill( tfc->tftrack->trgdigis.size(), tfc->tftrack->mplcts.size());
-                h_tf_n_stubs->Fill( tfc->tftrack->trgdigis.size() );
-                h_tf_n_matchstubs->Fill( tfc->tftrack->mplcts.size() );
+                eventFills_.fill(h_tf_n_stubs_vs_matchstubs,  tfc->tftrack->trgdigis.size(), tfc->tftrack->mplcts.size());
+                eventFills_.fill(h_tf_n_stubs,  tfc->tftrack->trgdigis.size() );
+                eventFills_.fill(h_tf_n_matchstubs,  tfc->tftrack->mplcts.size() );
 
             }
             if (etapt_ok) 
             {
-                h_phi_after_tfcand->Fill(stphi);
-                h_phi_minus_tfphi_resol->Fill(stphi - tfc->phi);
+                eventFills_.fill(h_phi_after_tfcand, stphi);
+                eventFills_.fill(h_phi_minus_tfphi_resol, stphi - tfc->phi);
             }
         }
 
@@ -2693,24 +2704,24 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
         {
            // if (tfcAll==NULL) std::cout<<" ALARM: tfcAll==NULL !!!"<<std::endl;
 
-            if (eta_ok) h_pt_after_tfcand_all->Fill(stpt);
+            if (eta_ok) eventFills_.fill(h_pt_after_tfcand_all, stpt);
 
             if (tffidAll_ok) 
             {
-                h_pt_after_tfcand_all_ok->Fill(stpt);
-                if (tfcAll->pt>=10.)  h_pt_after_tfcand_all_pt10_ok->Fill(stpt);
-                if (tfcAll->pt>=20.)  h_pt_after_tfcand_all_pt20_ok->Fill(stpt);
-                if (tfcAll->pt>=40.)  h_pt_after_tfcand_all_pt40_ok->Fill(stpt);
-                if (tfcAll->pt>=60.)  h_pt_after_tfcand_all_pt60_ok->Fill(stpt);
+                eventFills_.fill(h_pt_after_tfcand_all_ok, stpt);
+                if (tfcAll->pt>=10.)  eventFills_.fill(h_pt_after_tfcand_all_pt10_ok, stpt);
+                if (tfcAll->pt>=20.)  eventFills_.fill(h_pt_after_tfcand_all_pt20_ok, stpt);
+                if (tfcAll->pt>=40.)  eventFills_.fill(h_pt_after_tfcand_all_pt40_ok, stpt);
+                if (tfcAll->pt>=60.)  eventFills_.fill(h_pt_after_tfcand_all_pt60_ok, stpt);
             }
             if (pt_ok) 
             {
-                h_eta_after_tfcand_all->Fill(steta);
-                if (tfcAll->pt>=10.) h_eta_after_tfcand_all_pt10->Fill(steta);
+                eventFills_.fill(h_eta_after_tfcand_all, steta);
+                if (tfcAll->pt>=10.) eventFills_.fill(h_eta_after_tfcand_all_pt10, steta);
             }
             if (etapt_ok) 
             {
-                h_phi_after_tfcand_all->Fill(stphi);
+                eventFills_.fill(h_phi_after_tfcand_all, stphi);
             }
 
         }
@@ -2722,30 +2733,30 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
         if (match->GMTREGCANDs.size()) 
         {
             if (gmtrc==NULL) std::cout<<" ALARM: gmtrc==NULL !!!"<<std::endl;
-            if (eta_ok)   h_pt_after_gmtreg->Fill(stpt);
-            if (eta_ok && gmtrc->pt>=10.)  h_pt_after_gmtreg_pt10->Fill(stpt);
-            if (pt_ok)    h_eta_after_gmtreg->Fill(steta);
-            if (pt_ok  && gmtrc->pt>=10.)  h_eta_after_gmtreg_pt10->Fill(steta);
-            if (etapt_ok) h_phi_after_gmtreg->Fill(stphi);
+            if (eta_ok)   eventFills_.fill(h_pt_after_gmtreg, stpt);
+            if (eta_ok && gmtrc->pt>=10.)  eventFills_.fill(h_pt_after_gmtreg_pt10, stpt);
+            if (pt_ok)    eventFills_.fill(h_eta_after_gmtreg, steta);
+            if (pt_ok  && gmtrc->pt>=10.)  eventFills_.fill(h_eta_after_gmtreg_pt10, steta);
+            if (etapt_ok) eventFills_.fill(h_phi_after_gmtreg, stphi);
         }
         MatchCSCMuL1::GMTREGCAND * gmtrca = 0;
         if (!lightRun) gmtrca = match->bestGMTREGCAND(match->GMTREGCANDsAll, bestPtMatch_);
         if (match->GMTREGCANDsAll.size()) 
         {
             if (gmtrca==NULL) std::cout<<" ALARM: gmtrca==NULL !!!"<<std::endl;
-            if (eta_ok)   h_pt_after_gmtreg_all->Fill(stpt);
-            if (eta_ok && gmtrca->pt>=10.)  h_pt_after_gmtreg_all_pt10->Fill(stpt);
-            if (pt_ok)    h_eta_after_gmtreg_all->Fill(steta);
-            if (pt_ok  && gmtrca->pt>=10.)  h_eta_after_gmtreg_all_pt10->Fill(steta);
-            if (etapt_ok) h_phi_after_gmtreg_all->Fill(stphi);
+            if (eta_ok)   eventFills_.fill(h_pt_after_gmtreg_all, stpt);
+            if (eta_ok && gmtrca->pt>=10.)  eventFills_.fill(h_pt_after_gmtreg_all_pt10, stpt);
+            if (pt_ok)    eventFills_.fill(h_eta_after_gmtreg_all, steta);
+            if (pt_ok  && gmtrca->pt>=10.)  eventFills_.fill(h_eta_after_gmtreg_all_pt10, steta);
+            if (etapt_ok) eventFills_.fill(h_phi_after_gmtreg_all, stphi);
         }
         if (match->GMTREGCANDBest.l1reg != NULL) 
         {
-            if (eta_ok)   h_pt_after_gmtreg_dr->Fill(stpt);
-            if (eta_ok && match->GMTREGCANDBest.pt>=10.)   h_pt_after_gmtreg_dr_pt10->Fill(stpt);
-            if (pt_ok)    h_eta_after_gmtreg_dr->Fill(steta);
-            if (pt_ok  && match->GMTREGCANDBest.pt>=10.)   h_eta_after_gmtreg_dr_pt10->Fill(steta);
-            if (etapt_ok) h_phi_after_gmtreg_dr->Fill(stphi);
+            if (eta_ok)   eventFills_.fill(h_pt_after_gmtreg_dr, stpt);
+            if (eta_ok && match->GMTREGCANDBest.pt>=10.)   eventFills_.fill(h_pt_after_gmtreg_dr_pt10, stpt);
+            if (pt_ok)    eventFills_.fill(h_eta_after_gmtreg_dr, steta);
+            if (pt_ok  && match->GMTREGCANDBest.pt>=10.)   eventFills_.fill(h_eta_after_gmtreg_dr_pt10, steta);
+            if (etapt_ok) eventFills_.fill(h_phi_after_gmtreg_dr, stphi);
         }
 
         //============ GMT CANDs ==================
@@ -2756,20 +2767,20 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
         {
             if (gmtc==NULL) std::cout<<" ALARM: gmtc==NULL !!!"<<std::endl;
 
-            h_gmtpt->Fill(gmtc->pt);
-            h_gmtphi->Fill(gmtc->phi);
-            h_gmteta->Fill(gmtc->eta);
-            h_gmtbx->Fill(gmtc->l1gmt->bx());
-            h_gmtrank->Fill(gmtc->l1gmt->rank());
-            h_gmtqu->Fill(gmtc->l1gmt->quality());
-            h_gmtisrpc->Fill(gmtc->l1gmt->isRPC());
-            h_gmtdr->Fill(gmtc->dr);
+            eventFills_.fill(h_gmtpt, gmtc->pt);
+            eventFills_.fill(h_gmtphi, gmtc->phi);
+            eventFills_.fill(h_gmteta, gmtc->eta);
+            eventFills_.fill(h_gmtbx, gmtc->l1gmt->bx());
+            eventFills_.fill(h_gmtrank, gmtc->l1gmt->rank());
+            eventFills_.fill(h_gmtqu, gmtc->l1gmt->quality());
+            eventFills_.fill(h_gmtisrpc, gmtc->l1gmt->isRPC());
+            eventFills_.fill(h_gmtdr, gmtc->dr);
 
-            if (eta_ok)   h_pt_after_gmt->Fill(stpt);
-            if (eta_ok && gmtc->pt>=10.)   h_pt_after_gmt_pt10->Fill(stpt);
-            if (pt_ok)    h_eta_after_gmt->Fill(steta);
-            if (pt_ok  && gmtc->pt>=10.)   h_eta_after_gmt_pt10->Fill(steta);
-            if (etapt_ok) h_phi_after_gmt->Fill(stphi);
+            if (eta_ok)   eventFills_.fill(h_pt_after_gmt, stpt);
+            if (eta_ok && gmtc->pt>=10.)   eventFills_.fill(h_pt_after_gmt_pt10, stpt);
+            if (pt_ok)    eventFills_.fill(h_eta_after_gmt, steta);
+            if (pt_ok  && gmtc->pt>=10.)   eventFills_.fill(h_eta_after_gmt_pt10, steta);
+            if (etapt_ok) eventFills_.fill(h_phi_after_gmt, stphi);
 
 
             // GMT ME1b
@@ -2780,17 +2791,17 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
                 for (int i=0; i<Nthr; ++i) 
                     if (gmtc->pt >= tfc_pt_thr[i]) 
                     {
-                        h_pt_after_gmt_eta1b_1mu[i]->Fill(stpt);
+                        eventFills_.fill(h_pt_after_gmt_eta1b_1mu[i], stpt);
 
                         // if (eta_gem_1b && match_has_gem && has_mplct_me1b) 
                         // {
-                        //     h_pt_after_gmt_gem1b_1mu[i]->Fill(stpt);
+                        //     eventFills_.fill(h_pt_after_gmt_gem1b_1mu[i], stpt);
 
                         //     if (   (gem_dphi_odd < -99. && gem_dphi_even < 99.)  // both just dummy default values
                         //             || (gem_dphi_odd  > -9. && isGEMDPhiGood(gem_dphi_odd, tfc_pt_thr[i], 1) )  // good dphi odd
                         //             || (gem_dphi_even > -9. && isGEMDPhiGood(gem_dphi_even, tfc_pt_thr[i], 0) ) ) // good dphi even
                         //     {
-                        //         h_pt_after_gmt_dphigem1b_1mu[i]->Fill(stpt);
+                        //         eventFills_.fill(h_pt_after_gmt_dphigem1b_1mu[i], stpt);
                         //     }
                         // }
                     }
@@ -2802,30 +2813,30 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
         if (match->GMTCANDsAll.size()) 
         {
             if (gmtca==NULL) std::cout<<" ALARM: gmtca==NULL !!!"<<std::endl;
-            if (eta_ok)   h_pt_after_gmt_all->Fill(stpt);
-            if (eta_ok && gmtca->pt>=10.)   h_pt_after_gmt_all_pt10->Fill(stpt);
-            if (pt_ok)    h_eta_after_gmt_all->Fill(steta);
-            if (pt_ok  && gmtca->pt>=10.)   h_eta_after_gmt_all_pt10->Fill(steta);
-            if (etapt_ok) h_phi_after_gmt_all->Fill(stphi);
+            if (eta_ok)   eventFills_.fill(h_pt_after_gmt_all, stpt);
+            if (eta_ok && gmtca->pt>=10.)   eventFills_.fill(h_pt_after_gmt_all_pt10, stpt);
+            if (pt_ok)    eventFills_.fill(h_eta_after_gmt_all, steta);
+            if (pt_ok  && gmtca->pt>=10.)   eventFills_.fill(h_eta_after_gmt_all_pt10, steta);
+            if (etapt_ok) eventFills_.fill(h_phi_after_gmt_all, stphi);
         }
 
         if (lightRun) match->GMTCANDBest.l1gmt = NULL;
         if (match->GMTCANDBest.l1gmt != NULL) 
         {
-            h_gmtxpt->Fill(match->GMTCANDBest.pt);
-            h_gmtxphi->Fill(match->GMTCANDBest.phi);
-            h_gmtxeta->Fill(match->GMTCANDBest.eta);
-            h_gmtxbx->Fill(match->GMTCANDBest.l1gmt->bx());
-            h_gmtxrank->Fill(match->GMTCANDBest.l1gmt->rank());
-            h_gmtxqu->Fill(match->GMTCANDBest.l1gmt->quality());
-            h_gmtxisrpc->Fill(match->GMTCANDBest.l1gmt->isRPC());
-            h_gmtxdr->Fill(match->GMTCANDBest.dr);
-
-            if (eta_ok)   h_pt_after_gmt_dr->Fill(stpt);
-            if (eta_ok && match->GMTCANDBest.pt>=10.)   h_pt_after_gmt_dr_pt10->Fill(stpt);
-            if (pt_ok)    h_eta_after_gmt_dr->Fill(steta);
-            if (pt_ok  && match->GMTCANDBest.pt>=10.)   h_eta_after_gmt_dr_pt10->Fill(steta);
-            if (etapt_ok) h_phi_after_gmt_dr->Fill(stphi);
+            eventFills_.fill(h_gmtxpt, match->GMTCANDBest.pt);
+            eventFills_.fill(h_gmtxphi, match->GMTCANDBest.phi);
+            eventFills_.fill(h_gmtxeta, match->GMTCANDBest.eta);
+            eventFills_.fill(h_gmtxbx, match->GMTCANDBest.l1gmt->bx());
+            eventFills_.fill(h_gmtxrank, match->GMTCANDBest.l1gmt->rank());
+            eventFills_.fill(h_gmtxqu, match->GMTCANDBest.l1gmt->quality());
+            eventFills_.fill(h_gmtxisrpc, match->GMTCANDBest.l1gmt->isRPC());
+            eventFills_.fill(h_gmtxdr, match->GMTCANDBest.dr);
+
+            if (eta_ok)   eventFills_.fill(h_pt_after_gmt_dr, stpt);
+            if (eta_ok && match->GMTCANDBest.pt>=10.)   eventFills_.fill(h_pt_after_gmt_dr_pt10, stpt);
+            if (pt_ok)    eventFills_.fill(h_eta_after_gmt_dr, steta);
+            if (pt_ok  && match->GMTCANDBest.pt>=10.)   eventFills_.fill(h_eta_after_gmt_dr_pt10, steta);
+            if (etapt_ok) eventFills_.fill(h_phi_after_gmt_dr, stphi);
 
         }
 
@@ -2834,35 +2845,35 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
         // Basically looking at RPC stubs
         if (match->GMTCANDBest.l1gmt != NULL && match->GMTCANDs.size()==0) 
         {
-            h_gmtxpt_nocsc->Fill(match->GMTCANDBest.pt);
-            h_gmtxphi_nocsc->Fill(match->GMTCANDBest.phi);
-            h_gmtxeta_nocsc->Fill(match->GMTCANDBest.eta);
-            h_gmtxbx_nocsc->Fill(match->GMTCANDBest.l1gmt->bx());
-            h_gmtxrank_nocsc->Fill(match->GMTCANDBest.l1gmt->rank());
-            h_gmtxqu_nocsc->Fill(match->GMTCANDBest.l1gmt->quality());
-            h_gmtxisrpc_nocsc->Fill(match->GMTCANDBest.l1gmt->isRPC());
-            h_gmtxdr_nocsc->Fill(match->GMTCANDBest.dr);
-
-            if (eta_ok)   h_pt_after_gmt_dr_nocsc->Fill(stpt);
-            if (eta_ok && match->GMTCANDBest.pt>=10.)   h_pt_after_gmt_dr_nocsc_pt10->Fill(stpt);
-            if (pt_ok)    h_eta_after_gmt_dr_nocsc->Fill(steta);
-            if (pt_ok  && match->GMTCANDBest.pt>=10.)   h_eta_after_gmt_dr_nocsc_pt10->Fill(steta);
-            if (etapt_ok) h_phi_after_gmt_dr_nocsc->Fill(stphi);
+            eventFills_.fill(h_gmtxpt_nocsc, match->GMTCANDBest.pt);
+            eventFills_.fill(h_gmtxphi_nocsc, match->GMTCANDBest.phi);
+            eventFills_.fill(h_gmtxeta_nocsc, match->GMTCANDBest.eta);
+            eventFills_.fill(h_gmtxbx_nocsc, match->GMTCANDBest.l1gmt->bx());
+            eventFills_.fill(h_gmtxrank_nocsc, match->GMTCANDBest.l1gmt->rank());
+            eventFills_.fill(h_gmtxqu_nocsc, match->GMTCANDBest.l1gmt->quality());
+            eventFills_.fill(h_gmtxisrpc_nocsc, match->GMTCANDBest.l1gmt->isRPC());
+            eventFills_.fill(h_gmtxdr_nocsc, match->GMTCANDBest.dr);
+
+            if (eta_ok)   eventFills_.fill(h_pt_after_gmt_dr_nocsc, stpt);
+            if (eta_ok && match->GMTCANDBest.pt>=10.)   eventFills_.fill(h_pt_after_gmt_dr_nocsc_pt10, stpt);
+            if (pt_ok)    eventFills_.fill(h_eta_after_gmt_dr_nocsc, steta);
+            if (pt_ok  && match->GMTCANDBest.pt>=10.)   eventFills_.fill(h_eta_after_gmt_dr_nocsc_pt10, steta);
+            if (etapt_ok) eventFills_.fill(h_phi_after_gmt_dr_nocsc, stphi);
         }
         if (match->GMTCANDBest.l1gmt != NULL && match->GMTCANDs.size()==0 && match->TFCANDs.size()>0) 
         {
-            h_gmtxqu_nogmtreg->Fill(match->GMTCANDBest.l1gmt->quality());
-            h_gmtxisrpc_nogmtreg->Fill(match->GMTCANDBest.l1gmt->isRPC());
+            eventFills_.fill(h_gmtxqu_nogmtreg, match->GMTCANDBest.l1gmt->quality());
+            eventFills_.fill(h_gmtxisrpc_nogmtreg, match->GMTCANDBest.l1gmt->isRPC());
         }
         if (match->GMTCANDBest.l1gmt != NULL && match->TFCANDs.size()==0 && rMPLCTs.size()>0) 
         {
-            h_gmtxqu_notfcand->Fill(match->GMTCANDBest.l1gmt->quality());
-            h_gmtxisrpc_notfcand->Fill(match->GMTCANDBest.l1gmt->isRPC());
+            eventFills_.fill(h_gmtxqu_notfcand, match->GMTCANDBest.l1gmt->quality());
+            eventFills_.fill(h_gmtxisrpc_notfcand, match->GMTCANDBest.l1gmt->isRPC());
         }
         if (match->GMTCANDBest.l1gmt != NULL && rMPLCTs.size()==0) 
         {
-            h_gmtxqu_nompc->Fill(match->GMTCANDBest.l1gmt->quality());
-            h_gmtxisrpc_nompc->Fill(match->GMTCANDBest.l1gmt->isRPC());
+            eventFills_.fill(h_gmtxqu_nompc, match->GMTCANDBest.l1gmt->quality());
+            eventFills_.fill(h_gmtxisrpc_nompc, match->GMTCANDBest.l1gmt->isRPC());
         }
 
 
@@ -2873,6 +2884,8 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
         matches.clear ();
 
         cleanUp();
+
+        hists_.flush(eventFills_);
     }
 
 
@@ -3035,8 +3048,8 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
                     bool me1a_all = (defaultME1a && id.station()==1 && id.ring()==1 && (*digiIt).getKeyWG() <= 15);
                     bool me1a_no_overlap = ( me1a_all && (*digiIt).getKeyWG() < 10 );
 
-                    std::vector<PSimHit> trackHitsInChamber = match->chamberHits(id.rawId());
-                    std::vector<PSimHit> trackHitsInChamber1a;
+                    MatchCSCMuL1::SimHitView trackHitsInChamber = match->chamberHits(id.rawId());
+                    MatchCSCMuL1::SimHitView trackHitsInChamber1a;
                     if (me1a_all) trackHitsInChamber1a = match->chamberHits(id1a.rawId());
 
                     if (trackHitsInChamber.size() + trackHitsInChamber1a.size() == 0 ) // no point to do any matching here
@@ -3249,7 +3262,7 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
                         cid = id1a;
                     }
 
-                    std::vector<PSimHit> trackHitsInChamber = match->chamberHits(cid.rawId());
+                    MatchCSCMuL1::SimHitView trackHitsInChamber = match->chamberHits(cid.rawId());
 
                     if (trackHitsInChamber.size()==0) // no point to do any matching here
                     {
@@ -4211,7 +4224,7 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
 
     // ================================================================================================
     bool 
-        GEMCSCTriggerEfficiency::compareSimHits(PSimHit &sh1, PSimHit &sh2)
+        GEMCSCTriggerEfficiency::compareSimHits(const PSimHit &sh1, const PSimHit &sh2)
         {
             int fdebug = 0;
 
@@ -4799,7 +4812,11 @@ GEMCSCTriggerEfficiency::analyze(const edm::Event& iEvent, const edm::EventSetup
 
     // ================================================================================================
     void 
-        GEMCSCTriggerEfficiency::endJob() {}
+        GEMCSCTriggerEfficiency::endJob()
+        {
+            edm::Service<TFileService> fs;
+            hists_.materialize(*fs);
+        }
 
 
     //define this as a plug-in
@@ -65,6 +65,8 @@
 //#include "SimMuon/MCTruth/interface/PSimHitMap.h"
 #include "GEMCode/SimMuL1/interface/PSimHitMap.h"
 #include "GEMCode/SimMuL1/interface/MuGeometryHelpers.h"
+#include "GEMCode/SimMuL1/interface/MuGeometryCache.h"
+#include "GEMCode/SimMuL1/interface/DenseHistograms.h"
 
 #include "GEMCode/SimMuL1/interface/MatchCSCMuL1.h"
 
@@ -118,7 +120,7 @@ public:
 
   int particleType(int simTrack);
     
-  bool compareSimHits(PSimHit &sh1, PSimHit &sh2);
+  bool compareSimHits(const PSimHit &sh1, const PSimHit &sh2);
 
   void propagateToCSCStations(MatchCSCMuL1 *match);
 
@@ -302,6 +304,7 @@ private:
   double minSimTrackDR_;
 
   mugeo::MuFiducial* mufiducial_;
+  mugeo::MuGeometryCache geometryCache_;
   
 // members
   std::vector<MatchCSCMuL1*> matches;
@@ -341,35 +344,40 @@ private:
 
   int nevt;
 
-  TH1D * h_N_mctr;
-  TH1D * h_N_simtr;
+  // the fixed-binning histograms are kept in hists_; the fills of an event are
+  // collected in eventFills_ and applied at its end, the TH1D/TH2D are written at endJob
+  DenseHistograms hists_;
+  DenseHistograms::Buffer eventFills_;
 
-  TH1D * h_pt_mctr;
-  TH1D * h_eta_mctr;
-  TH1D * h_phi_mctr;
+  DenseHistograms::H1 h_N_mctr;
+  DenseHistograms::H1 h_N_simtr;
 
-  TH1D * h_DR_mctr_simtr; 
-  TH1D * h_MinDR_mctr_simtr; 
+  DenseHistograms::H1 h_pt_mctr;
+  DenseHistograms::H1 h_eta_mctr;
+  DenseHistograms::H1 h_phi_mctr;
 
-  TH1D * h_DR_2SimTr;
+  DenseHistograms::H1 h_DR_mctr_simtr; 
+  DenseHistograms::H1 h_MinDR_mctr_simtr; 
+
+  DenseHistograms::H1 h_DR_2SimTr;
   TH1D * h_DR_2SimTr_looked;
   TH1D * h_DR_2SimTr_after_mpc_ok_plus;
   TH1D * h_DR_2SimTr_after_tfcand_ok_plus;
 
-  TH2D * h_csctype_vs_alct_occup;
-  TH2D * h_csctype_vs_clct_occup;
+  DenseHistograms::H2 h_csctype_vs_alct_occup;
+  DenseHistograms::H2 h_csctype_vs_clct_occup;
   
-  TH2D * h_eta_vs_ncscsh;
-  TH2D * h_eta_vs_nalct;
-  TH2D * h_eta_vs_nclct;
-  TH2D * h_eta_vs_nlct;
-  TH2D * h_eta_vs_nmplct;
+  DenseHistograms::H2 h_eta_vs_ncscsh;
+  DenseHistograms::H2 h_eta_vs_nalct;
+  DenseHistograms::H2 h_eta_vs_nclct;
+  DenseHistograms::H2 h_eta_vs_nlct;
+  DenseHistograms::H2 h_eta_vs_nmplct;
   
-  TH2D * h_pt_vs_ncscsh;
-  TH2D * h_pt_vs_nalct;
-  TH2D * h_pt_vs_nclct;
-  TH2D * h_pt_vs_nlct;
-  TH2D * h_pt_vs_nmplct;
+  DenseHistograms::H2 h_pt_vs_ncscsh;
+  DenseHistograms::H2 h_pt_vs_nalct;
+  DenseHistograms::H2 h_pt_vs_nclct;
+  DenseHistograms::H2 h_pt_vs_nlct;
+  DenseHistograms::H2 h_pt_vs_nmplct;
   
   TH2D * h_csctype_vs_nlct;
   TH2D * h_csctype_vs_nmplct;
@@ -417,50 +425,50 @@ private:
   TH1D * h_ov_delta__wire_cscdet[CSC_TYPES];
   TH1D * h_ov_delta__strip_cscdet[CSC_TYPES];
 
-  TH1D * h_bx__alct_cscdet[CSC_TYPES];
+  DenseHistograms::H1 h_bx__alct_cscdet[CSC_TYPES];
   TH1D * h_bx__clct_cscdet[CSC_TYPES];
   TH1D * h_bx__lct_cscdet[CSC_TYPES];
   TH1D * h_bx__mpc_cscdet[CSC_TYPES];
 
   TH2D * h_bx_lct__alct_vs_clct_cscdet[CSC_TYPES];
 
-  TH1D * h_bx_min__alct_cscdet[CSC_TYPES];
+  DenseHistograms::H1 h_bx_min__alct_cscdet[CSC_TYPES];
   TH1D * h_bx_min__clct_cscdet[CSC_TYPES];
   TH1D * h_bx_min__lct_cscdet[CSC_TYPES];
   TH1D * h_bx_min__mpc_cscdet[CSC_TYPES];
 
-  TH1D * h_bx__alctOk_cscdet[CSC_TYPES];
+  DenseHistograms::H1 h_bx__alctOk_cscdet[CSC_TYPES];
   TH1D * h_bx__clctOk_cscdet[CSC_TYPES];
   
-  TH1D * h_bx__alctOkBest_cscdet[CSC_TYPES];
-  TH1D * h_bx__clctOkBest_cscdet[CSC_TYPES];
+  DenseHistograms::H1 h_bx__alctOkBest_cscdet[CSC_TYPES];
+  DenseHistograms::H1 h_bx__clctOkBest_cscdet[CSC_TYPES];
 
-  TH2D * h_wg_vs_bx__alctOkBest_cscdet[CSC_TYPES];
+  DenseHistograms::H2 h_wg_vs_bx__alctOkBest_cscdet[CSC_TYPES];
 
-  TH1D * h_bxf__alct_cscdet[CSC_TYPES];
+  DenseHistograms::H1 h_bxf__alct_cscdet[CSC_TYPES];
   TH1D * h_bxf__clct_cscdet[CSC_TYPES];
-  TH1D * h_bxf__alctOk_cscdet[CSC_TYPES];
+  DenseHistograms::H1 h_bxf__alctOk_cscdet[CSC_TYPES];
   TH1D * h_bxf__clctOk_cscdet[CSC_TYPES];
 
-  TH1D * h_dbxbxf__alct_cscdet[CSC_TYPES];
+  DenseHistograms::H1 h_dbxbxf__alct_cscdet[CSC_TYPES];
   TH1D * h_dbxbxf__clct_cscdet[CSC_TYPES];
 
   TH2D * h_bx_me11nomatchclct_alct_vs_clct;
   TH2D * h_bx_me11nomatchalct_alct_vs_clct;
 
-  TH2D * h_bx_me1_aclct_ok_lct_no__bx_alct_vs_dbx_ACLCT;
+  DenseHistograms::H2 h_bx_me1_aclct_ok_lct_no__bx_alct_vs_dbx_ACLCT;
 
-  TH2D * h_nMplct_vs_nDigiMplct;
-  TH2D * h_qu_vs_nDigiMplct;
+  DenseHistograms::H2 h_nMplct_vs_nDigiMplct;
+  DenseHistograms::H2 h_qu_vs_nDigiMplct;
 
-  TH2D * h_ntftrackall_vs_ntftrack;
-  TH2D * h_ntfcandall_vs_ntfcand;
+  DenseHistograms::H2 h_ntftrackall_vs_ntftrack;
+  DenseHistograms::H2 h_ntfcandall_vs_ntfcand;
 
-  TH2D * h_eta_vs_ntfcand;
-  TH2D * h_pt_vs_ntfcand;
+  DenseHistograms::H2 h_eta_vs_ntfcand;
+  DenseHistograms::H2 h_pt_vs_ntfcand;
 
-  TH2D * h_pt_vs_qu;
-  TH2D * h_eta_vs_qu;
+  DenseHistograms::H2 h_pt_vs_qu;
+  DenseHistograms::H2 h_eta_vs_qu;
   
   TH1D * h_cscdet_of_chamber;
   TH1D * h_cscdet_of_chamber_w_alct;
@@ -469,38 +477,38 @@ private:
 
 
 
-  TH1D * h_pt_initial0;
-  TH1D * h_pt_initial;
-  TH1D * h_pt_initial_1b;
-  TH1D * h_pt_initial_gem_1b;
+  DenseHistograms::H1 h_pt_initial0;
+  DenseHistograms::H1 h_pt_initial;
+  DenseHistograms::H1 h_pt_initial_1b;
+  DenseHistograms::H1 h_pt_initial_gem_1b;
   
-  TH1D * h_pt_me1_initial;
-  TH1D * h_pt_me2_initial;
-  TH1D * h_pt_me3_initial;
-  TH1D * h_pt_me4_initial;
+  DenseHistograms::H1 h_pt_me1_initial;
+  DenseHistograms::H1 h_pt_me2_initial;
+  DenseHistograms::H1 h_pt_me3_initial;
+  DenseHistograms::H1 h_pt_me4_initial;
 
-  TH1D * h_pt_initial_1st;
-  TH1D * h_pt_initial_2st;
-  TH1D * h_pt_initial_3st;
+  DenseHistograms::H1 h_pt_initial_1st;
+  DenseHistograms::H1 h_pt_initial_2st;
+  DenseHistograms::H1 h_pt_initial_3st;
 
-  TH1D * h_pt_me1_initial_2st;
-  TH1D * h_pt_me1_initial_3st;
+  DenseHistograms::H1 h_pt_me1_initial_2st;
+  DenseHistograms::H1 h_pt_me1_initial_3st;
 
 
-  TH1D * h_pt_gem_1b;
-  TH1D * h_pt_lctgem_1b;
+  DenseHistograms::H1 h_pt_gem_1b;
+  DenseHistograms::H1 h_pt_lctgem_1b;
 
-  TH1D * h_pt_me1_mpc;
-  TH1D * h_pt_me2_mpc;
-  TH1D * h_pt_me3_mpc;
-  TH1D * h_pt_me4_mpc;
+  DenseHistograms::H1 h_pt_me1_mpc;
+  DenseHistograms::H1 h_pt_me2_mpc;
+  DenseHistograms::H1 h_pt_me3_mpc;
+  DenseHistograms::H1 h_pt_me4_mpc;
 
-  TH1D * h_pt_mpc_1st;
-  TH1D * h_pt_mpc_2st;
-  TH1D * h_pt_mpc_3st;
+  DenseHistograms::H1 h_pt_mpc_1st;
+  DenseHistograms::H1 h_pt_mpc_2st;
+  DenseHistograms::H1 h_pt_mpc_3st;
 
-  TH1D * h_pt_me1_mpc_2st;
-  TH1D * h_pt_me1_mpc_3st;
+  DenseHistograms::H1 h_pt_me1_mpc_2st;
+  DenseHistograms::H1 h_pt_me1_mpc_3st;
 
   TH1D * h_pt_tf_initial0_tfpt[N_PT_THRESHOLDS];
   TH1D * h_pt_tf_initial_tfpt[N_PT_THRESHOLDS];
@@ -509,82 +517,82 @@ private:
   TH1D * h_pt_tf_stubs233_tfpt[N_PT_THRESHOLDS];
 
 
-  TH1D * h_pt_after_alct;
-  TH1D * h_pt_after_clct;
-
-  TH1D * h_pt_me1_after_alct;
-  TH1D * h_pt_me1_after_clct;
-
-  TH1D * h_pt_me1_after_alct_okAlct;
-  TH1D * h_pt_me1_after_clct_okClct;
-
-  TH1D * h_pt_after_lct;
-  TH1D * h_pt_me1_after_lct_okAlctClct;
-
-  TH1D * h_pt_after_mpc;
-  TH1D * h_pt_after_mpc_ok_plus;
-  TH1D * h_pt_after_tftrack;
-  TH1D * h_pt_after_tfcand;
-  TH1D * h_pt_after_tfcand_pt10;
-  TH1D * h_pt_after_tfcand_pt20;
-  TH1D * h_pt_after_tfcand_pt40;
-  TH1D * h_pt_after_tfcand_pt60;
-
-  TH1D * h_pt_after_tfcand_ok;
-  TH1D * h_pt_after_tfcand_pt10_ok;
-  TH1D * h_pt_after_tfcand_pt20_ok;
-  TH1D * h_pt_after_tfcand_pt40_ok;
-  TH1D * h_pt_after_tfcand_pt60_ok;
-
-  TH1D * h_pt_after_tfcand_ok_plus;
-  TH1D * h_pt_after_tfcand_ok_plus_pt10;
-  TH1D * h_pt_after_tfcand_ok_plus_q[3];
-  TH1D * h_pt_after_tfcand_ok_plus_pt10_q[3];
-
-  TH1D * h_pt_after_tfcand_all;
-  TH1D * h_pt_after_tfcand_all_ok;
-  TH1D * h_pt_after_tfcand_all_pt10_ok;
-  TH1D * h_pt_after_tfcand_all_pt20_ok;
-  TH1D * h_pt_after_tfcand_all_pt40_ok;
-  TH1D * h_pt_after_tfcand_all_pt60_ok;
-
-
-  TH1D * h_pt_after_tfcand_eta1b_2s[7];
-  TH1D * h_pt_after_tfcand_eta1b_2s1b[7];
-  TH1D * h_pt_after_tfcand_eta1b_2s123[7];
-  TH1D * h_pt_after_tfcand_eta1b_2s13[7];
-  TH1D * h_pt_after_tfcand_eta1b_3s[7];
-  TH1D * h_pt_after_tfcand_eta1b_3s1b[7];
-  TH1D * h_pt_after_tfcand_gem1b_2s1b[7];
-  TH1D * h_pt_after_tfcand_gem1b_2s123[7];
-  TH1D * h_pt_after_tfcand_gem1b_2s13[7];
-  TH1D * h_pt_after_tfcand_gem1b_3s1b[7];
-  TH1D * h_pt_after_tfcand_dphigem1b_2s1b[7];
-  TH1D * h_pt_after_tfcand_dphigem1b_2s123[7];
-  TH1D * h_pt_after_tfcand_dphigem1b_2s13[7];
-  TH1D * h_pt_after_tfcand_dphigem1b_3s1b[7];
+  DenseHistograms::H1 h_pt_after_alct;
+  DenseHistograms::H1 h_pt_after_clct;
+
+  DenseHistograms::H1 h_pt_me1_after_alct;
+  DenseHistograms::H1 h_pt_me1_after_clct;
+
+  DenseHistograms::H1 h_pt_me1_after_alct_okAlct;
+  DenseHistograms::H1 h_pt_me1_after_clct_okClct;
+
+  DenseHistograms::H1 h_pt_after_lct;
+  DenseHistograms::H1 h_pt_me1_after_lct_okAlctClct;
+
+  DenseHistograms::H1 h_pt_after_mpc;
+  DenseHistograms::H1 h_pt_after_mpc_ok_plus;
+  DenseHistograms::H1 h_pt_after_tftrack;
+  DenseHistograms::H1 h_pt_after_tfcand;
+  DenseHistograms::H1 h_pt_after_tfcand_pt10;
+  DenseHistograms::H1 h_pt_after_tfcand_pt20;
+  DenseHistograms::H1 h_pt_after_tfcand_pt40;
+  DenseHistograms::H1 h_pt_after_tfcand_pt60;
+
+  DenseHistograms::H1 h_pt_after_tfcand_ok;
+  DenseHistograms::H1 h_pt_after_tfcand_pt10_ok;
+  DenseHistograms::H1 h_pt_after_tfcand_pt20_ok;
+  DenseHistograms::H1 h_pt_after_tfcand_pt40_ok;
+  DenseHistograms::H1 h_pt_after_tfcand_pt60_ok;
+
+  DenseHistograms::H1 h_pt_after_tfcand_ok_plus;
+  DenseHistograms::H1 h_pt_after_tfcand_ok_plus_pt10;
+  DenseHistograms::H1 h_pt_after_tfcand_ok_plus_q[3];
+  DenseHistograms::H1 h_pt_after_tfcand_ok_plus_pt10_q[3];
+
+  DenseHistograms::H1 h_pt_after_tfcand_all;
+  DenseHistograms::H1 h_pt_after_tfcand_all_ok;
+  DenseHistograms::H1 h_pt_after_tfcand_all_pt10_ok;
+  DenseHistograms::H1 h_pt_after_tfcand_all_pt20_ok;
+  DenseHistograms::H1 h_pt_after_tfcand_all_pt40_ok;
+  DenseHistograms::H1 h_pt_after_tfcand_all_pt60_ok;
+
+
+  DenseHistograms::H1 h_pt_after_tfcand_eta1b_2s[7];
+  DenseHistograms::H1 h_pt_after_tfcand_eta1b_2s1b[7];
+  DenseHistograms::H1 h_pt_after_tfcand_eta1b_2s123[7];
+  DenseHistograms::H1 h_pt_after_tfcand_eta1b_2s13[7];
+  DenseHistograms::H1 h_pt_after_tfcand_eta1b_3s[7];
+  DenseHistograms::H1 h_pt_after_tfcand_eta1b_3s1b[7];
+  DenseHistograms::H1 h_pt_after_tfcand_gem1b_2s1b[7];
+  DenseHistograms::H1 h_pt_after_tfcand_gem1b_2s123[7];
+  DenseHistograms::H1 h_pt_after_tfcand_gem1b_2s13[7];
+  DenseHistograms::H1 h_pt_after_tfcand_gem1b_3s1b[7];
+  DenseHistograms::H1 h_pt_after_tfcand_dphigem1b_2s1b[7];
+  DenseHistograms::H1 h_pt_after_tfcand_dphigem1b_2s123[7];
+  DenseHistograms::H1 h_pt_after_tfcand_dphigem1b_2s13[7];
+  DenseHistograms::H1 h_pt_after_tfcand_dphigem1b_3s1b[7];
 
   TH1D * h_mode_tfcand_gem1b_2s1b_1b[7];
 
 
-  TH1D * h_pt_after_gmtreg;
-  TH1D * h_pt_after_gmtreg_all;
-  TH1D * h_pt_after_gmtreg_dr;
-  TH1D * h_pt_after_gmt;
-  TH1D * h_pt_after_gmt_all;
-  TH1D * h_pt_after_gmt_dr;
-  TH1D * h_pt_after_gmt_dr_nocsc;
-  TH1D * h_pt_after_gmtreg_pt10;
-  TH1D * h_pt_after_gmtreg_all_pt10;
-  TH1D * h_pt_after_gmtreg_dr_pt10;
-  TH1D * h_pt_after_gmt_pt10;
-  TH1D * h_pt_after_gmt_all_pt10;
-  TH1D * h_pt_after_gmt_dr_pt10;
-  TH1D * h_pt_after_gmt_dr_nocsc_pt10;
-
-  TH1D * h_pt_after_gmt_eta1b_1mu[7];
-  TH1D * h_pt_after_gmt_gem1b_1mu[7];
-  TH1D * h_pt_after_gmt_dphigem1b_1mu[7];
+  DenseHistograms::H1 h_pt_after_gmtreg;
+  DenseHistograms::H1 h_pt_after_gmtreg_all;
+  DenseHistograms::H1 h_pt_after_gmtreg_dr;
+  DenseHistograms::H1 h_pt_after_gmt;
+  DenseHistograms::H1 h_pt_after_gmt_all;
+  DenseHistograms::H1 h_pt_after_gmt_dr;
+  DenseHistograms::H1 h_pt_after_gmt_dr_nocsc;
+  DenseHistograms::H1 h_pt_after_gmtreg_pt10;
+  DenseHistograms::H1 h_pt_after_gmtreg_all_pt10;
+  DenseHistograms::H1 h_pt_after_gmtreg_dr_pt10;
+  DenseHistograms::H1 h_pt_after_gmt_pt10;
+  DenseHistograms::H1 h_pt_after_gmt_all_pt10;
+  DenseHistograms::H1 h_pt_after_gmt_dr_pt10;
+  DenseHistograms::H1 h_pt_after_gmt_dr_nocsc_pt10;
+
+  DenseHistograms::H1 h_pt_after_gmt_eta1b_1mu[7];
+  DenseHistograms::H1 h_pt_after_gmt_gem1b_1mu[7];
+  DenseHistograms::H1 h_pt_after_gmt_dphigem1b_1mu[7];
 
   TH1D * h_pt_after_xtra;
   TH1D * h_pt_after_xtra_all;
@@ -593,123 +601,123 @@ private:
   TH1D * h_pt_after_xtra_all_pt10;
   TH1D * h_pt_after_xtra_dr_pt10;
 
-  TH1D * h_pt_me1_after_mpc_ok_plus;
-  TH1D * h_pt_me1_after_tf_ok_plus;
-  TH1D * h_pt_me1_after_tf_ok_plus_pt10;
-  TH1D * h_pt_me1_after_tf_ok_plus_q[3];
-  TH1D * h_pt_me1_after_tf_ok_plus_pt10_q[3];
+  DenseHistograms::H1 h_pt_me1_after_mpc_ok_plus;
+  DenseHistograms::H1 h_pt_me1_after_tf_ok_plus;
+  DenseHistograms::H1 h_pt_me1_after_tf_ok_plus_pt10;
+  DenseHistograms::H1 h_pt_me1_after_tf_ok_plus_q[3];
+  DenseHistograms::H1 h_pt_me1_after_tf_ok_plus_pt10_q[3];
 
 
   // high eta pt distros
-  TH1D * h_pth_initial;
-  TH1D * h_pth_after_mpc;
-  TH1D * h_pth_after_mpc_ok_plus;
+  DenseHistograms::H1 h_pth_initial;
+  DenseHistograms::H1 h_pth_after_mpc;
+  DenseHistograms::H1 h_pth_after_mpc_ok_plus;
  
-  TH1D * h_pth_after_tfcand;
-  TH1D * h_pth_after_tfcand_pt10;
+  DenseHistograms::H1 h_pth_after_tfcand;
+  DenseHistograms::H1 h_pth_after_tfcand_pt10;
 
-  TH1D * h_pth_after_tfcand_ok;
-  TH1D * h_pth_after_tfcand_pt10_ok;
+  DenseHistograms::H1 h_pth_after_tfcand_ok;
+  DenseHistograms::H1 h_pth_after_tfcand_pt10_ok;
 
-  TH1D * h_pth_after_tfcand_ok_plus;
-  TH1D * h_pth_after_tfcand_ok_plus_pt10;
-  TH1D * h_pth_after_tfcand_ok_plus_q[3];
-  TH1D * h_pth_after_tfcand_ok_plus_pt10_q[3];
+  DenseHistograms::H1 h_pth_after_tfcand_ok_plus;
+  DenseHistograms::H1 h_pth_after_tfcand_ok_plus_pt10;
+  DenseHistograms::H1 h_pth_after_tfcand_ok_plus_q[3];
+  DenseHistograms::H1 h_pth_after_tfcand_ok_plus_pt10_q[3];
 
-  TH1D * h_pth_me1_after_mpc_ok_plus;
-  TH1D * h_pth_me1_after_tf_ok_plus;
-  TH1D * h_pth_me1_after_tf_ok_plus_pt10;
-  TH1D * h_pth_me1_after_tf_ok_plus_q[3];
-  TH1D * h_pth_me1_after_tf_ok_plus_pt10_q[3];
+  DenseHistograms::H1 h_pth_me1_after_mpc_ok_plus;
+  DenseHistograms::H1 h_pth_me1_after_tf_ok_plus;
+  DenseHistograms::H1 h_pth_me1_after_tf_ok_plus_pt10;
+  DenseHistograms::H1 h_pth_me1_after_tf_ok_plus_q[3];
+  DenseHistograms::H1 h_pth_me1_after_tf_ok_plus_pt10_q[3];
 
-  TH1D * h_pth_over_tfpt_resol;
-  TH2D * h_pth_over_tfpt_resol_vs_pt;
+  DenseHistograms::H1 h_pth_over_tfpt_resol;
+  DenseHistograms::H2 h_pth_over_tfpt_resol_vs_pt;
 
 
-  TH1D * h_pth_after_tfcand_ok_plus_3st1a;
-  TH1D * h_pth_after_tfcand_ok_plus_pt10_3st1a;
-  TH1D * h_pth_me1_after_tf_ok_plus_3st1a;
-  TH1D * h_pth_me1_after_tf_ok_plus_pt10_3st1a;
+  DenseHistograms::H1 h_pth_after_tfcand_ok_plus_3st1a;
+  DenseHistograms::H1 h_pth_after_tfcand_ok_plus_pt10_3st1a;
+  DenseHistograms::H1 h_pth_me1_after_tf_ok_plus_3st1a;
+  DenseHistograms::H1 h_pth_me1_after_tf_ok_plus_pt10_3st1a;
 
 
   // 
-  TH1D * h_eta_initial0;
-  TH1D * h_eta_initial;
+  DenseHistograms::H1 h_eta_initial0;
+  DenseHistograms::H1 h_eta_initial;
   
-  TH1D * h_eta_me11_initial;
-  TH1D * h_eta_me1_initial;
-  TH1D * h_eta_me2_initial;
-  TH1D * h_eta_me3_initial;
-  TH1D * h_eta_me4_initial;
-
-  TH1D * h_eta_initial_1st;
-  TH1D * h_eta_initial_2st;
-  TH1D * h_eta_initial_3st;
-
-  TH1D * h_eta_me1_initial_2st;
-  TH1D * h_eta_me1_initial_3st;
-
-  TH1D * h_eta_me1_mpc;
-  TH1D * h_eta_me2_mpc;
-  TH1D * h_eta_me3_mpc;
-  TH1D * h_eta_me4_mpc;
-
-  TH1D * h_eta_mpc_1st;
-  TH1D * h_eta_mpc_2st;
-  TH1D * h_eta_mpc_3st;
-
-  TH1D * h_eta_me1_mpc_2st;
-  TH1D * h_eta_me1_mpc_3st;
-
-
-  TH1D * h_eta_tf_initial0_tfpt[N_PT_THRESHOLDS];
-  TH1D * h_eta_tf_initial_tfpt[N_PT_THRESHOLDS];
-  TH1D * h_eta_tf_stubs222_tfpt[N_PT_THRESHOLDS];
-  TH1D * h_eta_tf_stubs223_tfpt[N_PT_THRESHOLDS];
-  TH1D * h_eta_tf_stubs233_tfpt[N_PT_THRESHOLDS];
-
-
-  TH1D * h_eta_after_alct;
-  TH1D * h_eta_after_clct;
-  TH1D * h_eta_after_lct;
-  TH1D * h_eta_after_mpc;
-  TH1D * h_eta_after_mpc_ok;
-  TH1D * h_eta_after_mpc_ok_plus;
-  TH1D * h_eta_after_mpc_ok_plus_3st;
-  TH1D * h_eta_after_mpc_st1;
-  TH1D * h_eta_after_mpc_st1_good;
-  TH1D * h_eta_after_tftrack;
-  TH1D * h_eta_after_tftrack_q[3];
-  TH1D * h_eta_after_tfcand;
-  TH1D * h_eta_after_tfcand_q[3];
-  TH1D * h_eta_after_tfcand_ok;
-  TH1D * h_eta_after_tfcand_ok_plus;
-  TH1D * h_eta_after_tfcand_ok_pt10;
-  TH1D * h_eta_after_tfcand_ok_plus_pt10;
-  TH1D * h_eta_after_tfcand_ok_plus_q[3];
-  TH1D * h_eta_after_tfcand_ok_plus_pt10_q[3];
-  TH1D * h_eta_after_tfcand_pt10;
-  TH1D * h_eta_after_tfcand_all;
-  TH1D * h_eta_after_tfcand_all_pt10;
-  TH1D * h_eta_after_tfcand_my_st1;
-  TH1D * h_eta_after_tfcand_org_st1;
-  TH1D * h_eta_after_tfcand_comm_st1;
-  TH1D * h_eta_after_tfcand_my_st1_pt10;
+  DenseHistograms::H1 h_eta_me11_initial;
+  DenseHistograms::H1 h_eta_me1_initial;
+  DenseHistograms::H1 h_eta_me2_initial;
+  DenseHistograms::H1 h_eta_me3_initial;
+  DenseHistograms::H1 h_eta_me4_initial;
+
+  DenseHistograms::H1 h_eta_initial_1st;
+  DenseHistograms::H1 h_eta_initial_2st;
+  DenseHistograms::H1 h_eta_initial_3st;
+
+  DenseHistograms::H1 h_eta_me1_initial_2st;
+  DenseHistograms::H1 h_eta_me1_initial_3st;
+
+  DenseHistograms::H1 h_eta_me1_mpc;
+  DenseHistograms::H1 h_eta_me2_mpc;
+  DenseHistograms::H1 h_eta_me3_mpc;
+  DenseHistograms::H1 h_eta_me4_mpc;
+
+  DenseHistograms::H1 h_eta_mpc_1st;
+  DenseHistograms::H1 h_eta_mpc_2st;
+  DenseHistograms::H1 h_eta_mpc_3st;
+
+  DenseHistograms::H1 h_eta_me1_mpc_2st;
+  DenseHistograms::H1 h_eta_me1_mpc_3st;
+
+
+  DenseHistograms::H1 h_eta_tf_initial0_tfpt[N_PT_THRESHOLDS];
+  DenseHistograms::H1 h_eta_tf_initial_tfpt[N_PT_THRESHOLDS];
+  DenseHistograms::H1 h_eta_tf_stubs222_tfpt[N_PT_THRESHOLDS];
+  DenseHistograms::H1 h_eta_tf_stubs223_tfpt[N_PT_THRESHOLDS];
+  DenseHistograms::H1 h_eta_tf_stubs233_tfpt[N_PT_THRESHOLDS];
+
+
+  DenseHistograms::H1 h_eta_after_alct;
+  DenseHistograms::H1 h_eta_after_clct;
+  DenseHistograms::H1 h_eta_after_lct;
+  DenseHistograms::H1 h_eta_after_mpc;
+  DenseHistograms::H1 h_eta_after_mpc_ok;
+  DenseHistograms::H1 h_eta_after_mpc_ok_plus;
+  DenseHistograms::H1 h_eta_after_mpc_ok_plus_3st;
+  DenseHistograms::H1 h_eta_after_mpc_st1;
+  DenseHistograms::H1 h_eta_after_mpc_st1_good;
+  DenseHistograms::H1 h_eta_after_tftrack;
+  DenseHistograms::H1 h_eta_after_tftrack_q[3];
+  DenseHistograms::H1 h_eta_after_tfcand;
+  DenseHistograms::H1 h_eta_after_tfcand_q[3];
+  DenseHistograms::H1 h_eta_after_tfcand_ok;
+  DenseHistograms::H1 h_eta_after_tfcand_ok_plus;
+  DenseHistograms::H1 h_eta_after_tfcand_ok_pt10;
+  DenseHistograms::H1 h_eta_after_tfcand_ok_plus_pt10;
+  DenseHistograms::H1 h_eta_after_tfcand_ok_plus_q[3];
+  DenseHistograms::H1 h_eta_after_tfcand_ok_plus_pt10_q[3];
+  DenseHistograms::H1 h_eta_after_tfcand_pt10;
+  DenseHistograms::H1 h_eta_after_tfcand_all;
+  DenseHistograms::H1 h_eta_after_tfcand_all_pt10;
+  DenseHistograms::H1 h_eta_after_tfcand_my_st1;
+  DenseHistograms::H1 h_eta_after_tfcand_org_st1;
+  DenseHistograms::H1 h_eta_after_tfcand_comm_st1;
+  DenseHistograms::H1 h_eta_after_tfcand_my_st1_pt10;
   
-  TH1D * h_eta_after_gmtreg;
-  TH1D * h_eta_after_gmtreg_all;
-  TH1D * h_eta_after_gmtreg_dr;
-  TH1D * h_eta_after_gmt;
-  TH1D * h_eta_after_gmt_all;
-  TH1D * h_eta_after_gmt_dr;
-  TH1D * h_eta_after_gmt_dr_nocsc;
-  TH1D * h_eta_after_gmtreg_pt10;
-  TH1D * h_eta_after_gmtreg_all_pt10;
-  TH1D * h_eta_after_gmtreg_dr_pt10;
-  TH1D * h_eta_after_gmt_pt10;
-  TH1D * h_eta_after_gmt_all_pt10;
-  TH1D * h_eta_after_gmt_dr_pt10;
-  TH1D * h_eta_after_gmt_dr_nocsc_pt10;
+  DenseHistograms::H1 h_eta_after_gmtreg;
+  DenseHistograms::H1 h_eta_after_gmtreg_all;
+  DenseHistograms::H1 h_eta_after_gmtreg_dr;
+  DenseHistograms::H1 h_eta_after_gmt;
+  DenseHistograms::H1 h_eta_after_gmt_all;
+  DenseHistograms::H1 h_eta_after_gmt_dr;
+  DenseHistograms::H1 h_eta_after_gmt_dr_nocsc;
+  DenseHistograms::H1 h_eta_after_gmtreg_pt10;
+  DenseHistograms::H1 h_eta_after_gmtreg_all_pt10;
+  DenseHistograms::H1 h_eta_after_gmtreg_dr_pt10;
+  DenseHistograms::H1 h_eta_after_gmt_pt10;
+  DenseHistograms::H1 h_eta_after_gmt_all_pt10;
+  DenseHistograms::H1 h_eta_after_gmt_dr_pt10;
+  DenseHistograms::H1 h_eta_after_gmt_dr_nocsc_pt10;
 
   TH1D * h_eta_after_xtra;
   TH1D * h_eta_after_xtra_all;
@@ -718,129 +726,129 @@ private:
   TH1D * h_eta_after_xtra_all_pt10;
   TH1D * h_eta_after_xtra_dr_pt10;
 
-  TH2D * h_eta_vs_bx_after_alct;
+  DenseHistograms::H2 h_eta_vs_bx_after_alct;
   TH2D * h_eta_vs_bx_after_clct;
   TH2D * h_eta_vs_bx_after_lct;
-  TH2D * h_eta_vs_bx_after_mpc;
-
-  TH1D * h_eta_me1_after_alct;
-  TH1D * h_eta_me1_after_alct_okAlct;
-  TH1D * h_eta_me1_after_clct;
-  TH1D * h_eta_me1_after_clct_okClct;
-  TH1D * h_eta_me1_after_alctclct;
-  TH1D * h_eta_me1_after_alctclct_okAlct;
-  TH1D * h_eta_me1_after_alctclct_okClct;
-  TH1D * h_eta_me1_after_alctclct_okAlctClct;
-
-  TH1D * h_eta_me1_after_lct;
-  TH1D * h_eta_me1_after_lct_okAlct;
-  TH1D * h_eta_me1_after_lct_okAlctClct;
-  TH1D * h_eta_me1_after_lct_okClct;
-  TH1D * h_eta_me1_after_lct_okClctAlct;
-  TH1D * h_eta_me1_after_mplct_okAlctClct;
-  TH1D * h_eta_me1_after_mplct_okAlctClct_plus;
-  TH1D * h_eta_me1_after_tf_ok;
-  TH1D * h_eta_me1_after_tf_ok_pt10;
-  TH1D * h_eta_me1_after_tf_ok_plus;
-  TH1D * h_eta_me1_after_tf_ok_plus_pt10;
-  TH1D * h_eta_me1_after_tf_ok_plus_q[3];
-  TH1D * h_eta_me1_after_tf_ok_plus_pt10_q[3];
+  DenseHistograms::H2 h_eta_vs_bx_after_mpc;
+
+  DenseHistograms::H1 h_eta_me1_after_alct;
+  DenseHistograms::H1 h_eta_me1_after_alct_okAlct;
+  DenseHistograms::H1 h_eta_me1_after_clct;
+  DenseHistograms::H1 h_eta_me1_after_clct_okClct;
+  DenseHistograms::H1 h_eta_me1_after_alctclct;
+  DenseHistograms::H1 h_eta_me1_after_alctclct_okAlct;
+  DenseHistograms::H1 h_eta_me1_after_alctclct_okClct;
+  DenseHistograms::H1 h_eta_me1_after_alctclct_okAlctClct;
+
+  DenseHistograms::H1 h_eta_me1_after_lct;
+  DenseHistograms::H1 h_eta_me1_after_lct_okAlct;
+  DenseHistograms::H1 h_eta_me1_after_lct_okAlctClct;
+  DenseHistograms::H1 h_eta_me1_after_lct_okClct;
+  DenseHistograms::H1 h_eta_me1_after_lct_okClctAlct;
+  DenseHistograms::H1 h_eta_me1_after_mplct_okAlctClct;
+  DenseHistograms::H1 h_eta_me1_after_mplct_okAlctClct_plus;
+  DenseHistograms::H1 h_eta_me1_after_tf_ok;
+  DenseHistograms::H1 h_eta_me1_after_tf_ok_pt10;
+  DenseHistograms::H1 h_eta_me1_after_tf_ok_plus;
+  DenseHistograms::H1 h_eta_me1_after_tf_ok_plus_pt10;
+  DenseHistograms::H1 h_eta_me1_after_tf_ok_plus_q[3];
+  DenseHistograms::H1 h_eta_me1_after_tf_ok_plus_pt10_q[3];
   //TH1D * h_eta_me1_after_tf_all;
   //TH1D * h_eta_me1_after_tf_all_pt10;
 
-  TH1D * h_eta_me11_after_alct;
-  TH1D * h_eta_me11_after_alct_okAlct;
-  TH1D * h_eta_me11_after_clct;
-  TH1D * h_eta_me11_after_clct_okClct;
-  TH1D * h_eta_me11_after_alctclct;
-  TH1D * h_eta_me11_after_alctclct_okAlct;
-  TH1D * h_eta_me11_after_alctclct_okClct;
-  TH1D * h_eta_me11_after_alctclct_okAlctClct;
-
-  TH1D * h_eta_me11_after_lct;
-  TH1D * h_eta_me11_after_lct_okAlct;
-  TH1D * h_eta_me11_after_lct_okAlctClct;
-  TH1D * h_eta_me11_after_lct_okClct;
-  TH1D * h_eta_me11_after_lct_okClctAlct;
-  TH1D * h_eta_me11_after_mplct_okAlctClct;
-  TH1D * h_eta_me11_after_mplct_okAlctClct_plus;
-
-  TH1D * h_eta_me1_after_mplct_ok;
-  TH1D * h_eta_me2_after_mplct_ok;
-  TH1D * h_eta_me3_after_mplct_ok;
-  TH1D * h_eta_me4_after_mplct_ok;
-
-
-
-  TH1D * h_eta_after_mpc_ok_plus_3st1a;
-  TH1D * h_eta_after_tfcand_ok_plus_3st1a;
-  TH1D * h_eta_after_tfcand_ok_plus_pt10_3st1a;
-  TH1D * h_eta_me1_after_tf_ok_plus_3st1a;
-  TH1D * h_eta_me1_after_tf_ok_plus_pt10_3st1a;
-
-
-  TH1D * h_wg_me11_initial;
-  TH1D * h_wg_me11_after_alct_okAlct;
-  TH1D * h_wg_me11_after_alctclct_okAlctClct;
-  TH1D * h_wg_me11_after_lct_okAlctClct;
-
-  TH1D * h_strip_me1a_initial;
-  TH1D * h_strip_me1b_initial;
-  TH1D * h_strip_me1a_after_clct;
-  TH1D * h_strip_me1b_after_clct;
-  TH1D * h_strip_me1a_after_clct_okClct;
-  TH1D * h_strip_me1b_after_clct_okClct;
-
-  TH1D * h_bx_after_alct;
+  DenseHistograms::H1 h_eta_me11_after_alct;
+  DenseHistograms::H1 h_eta_me11_after_alct_okAlct;
+  DenseHistograms::H1 h_eta_me11_after_clct;
+  DenseHistograms::H1 h_eta_me11_after_clct_okClct;
+  DenseHistograms::H1 h_eta_me11_after_alctclct;
+  DenseHistograms::H1 h_eta_me11_after_alctclct_okAlct;
+  DenseHistograms::H1 h_eta_me11_after_alctclct_okClct;
+  DenseHistograms::H1 h_eta_me11_after_alctclct_okAlctClct;
+
+  DenseHistograms::H1 h_eta_me11_after_lct;
+  DenseHistograms::H1 h_eta_me11_after_lct_okAlct;
+  DenseHistograms::H1 h_eta_me11_after_lct_okAlctClct;
+  DenseHistograms::H1 h_eta_me11_after_lct_okClct;
+  DenseHistograms::H1 h_eta_me11_after_lct_okClctAlct;
+  DenseHistograms::H1 h_eta_me11_after_mplct_okAlctClct;
+  DenseHistograms::H1 h_eta_me11_after_mplct_okAlctClct_plus;
+
+  DenseHistograms::H1 h_eta_me1_after_mplct_ok;
+  DenseHistograms::H1 h_eta_me2_after_mplct_ok;
+  DenseHistograms::H1 h_eta_me3_after_mplct_ok;
+  DenseHistograms::H1 h_eta_me4_after_mplct_ok;
+
+
+
+  DenseHistograms::H1 h_eta_after_mpc_ok_plus_3st1a;
+  DenseHistograms::H1 h_eta_after_tfcand_ok_plus_3st1a;
+  DenseHistograms::H1 h_eta_after_tfcand_ok_plus_pt10_3st1a;
+  DenseHistograms::H1 h_eta_me1_after_tf_ok_plus_3st1a;
+  DenseHistograms::H1 h_eta_me1_after_tf_ok_plus_pt10_3st1a;
+
+
+  DenseHistograms::H1 h_wg_me11_initial;
+  DenseHistograms::H1 h_wg_me11_after_alct_okAlct;
+  DenseHistograms::H1 h_wg_me11_after_alctclct_okAlctClct;
+  DenseHistograms::H1 h_wg_me11_after_lct_okAlctClct;
+
+  DenseHistograms::H1 h_strip_me1a_initial;
+  DenseHistograms::H1 h_strip_me1b_initial;
+  DenseHistograms::H1 h_strip_me1a_after_clct;
+  DenseHistograms::H1 h_strip_me1b_after_clct;
+  DenseHistograms::H1 h_strip_me1a_after_clct_okClct;
+  DenseHistograms::H1 h_strip_me1b_after_clct_okClct;
+
+  DenseHistograms::H1 h_bx_after_alct;
   TH1D * h_bx_after_clct;
   TH1D * h_bx_after_lct;
-  TH1D * h_bx_after_mpc;
+  DenseHistograms::H1 h_bx_after_mpc;
   
-  TH1D * h_phi_initial;
-  TH1D * h_phi_after_alct;
-  TH1D * h_phi_after_clct;
-  TH1D * h_phi_after_lct;
-  TH1D * h_phi_after_mpc;
-  TH1D * h_phi_after_tftrack;
-  TH1D * h_phi_after_tfcand;
-  TH1D * h_phi_after_tfcand_all;
-  TH1D * h_phi_after_gmtreg;
-  TH1D * h_phi_after_gmtreg_all;
-  TH1D * h_phi_after_gmtreg_dr;
-  TH1D * h_phi_after_gmt;
-  TH1D * h_phi_after_gmt_all;
-  TH1D * h_phi_after_gmt_dr;
-  TH1D * h_phi_after_gmt_dr_nocsc;
+  DenseHistograms::H1 h_phi_initial;
+  DenseHistograms::H1 h_phi_after_alct;
+  DenseHistograms::H1 h_phi_after_clct;
+  DenseHistograms::H1 h_phi_after_lct;
+  DenseHistograms::H1 h_phi_after_mpc;
+  DenseHistograms::H1 h_phi_after_tftrack;
+  DenseHistograms::H1 h_phi_after_tfcand;
+  DenseHistograms::H1 h_phi_after_tfcand_all;
+  DenseHistograms::H1 h_phi_after_gmtreg;
+  DenseHistograms::H1 h_phi_after_gmtreg_all;
+  DenseHistograms::H1 h_phi_after_gmtreg_dr;
+  DenseHistograms::H1 h_phi_after_gmt;
+  DenseHistograms::H1 h_phi_after_gmt_all;
+  DenseHistograms::H1 h_phi_after_gmt_dr;
+  DenseHistograms::H1 h_phi_after_gmt_dr_nocsc;
   TH1D * h_phi_after_xtra;
   TH1D * h_phi_after_xtra_all;
   TH1D * h_phi_after_xtra_dr;
 
-  TH1D * h_phi_me1_after_alct;
-  TH1D * h_phi_me1_after_alct_okAlct;
-  TH1D * h_phi_me1_after_clct;
-  TH1D * h_phi_me1_after_clct_okClct;
-  TH1D * h_phi_me1_after_alctclct;
-  TH1D * h_phi_me1_after_alctclct_okAlct;
-  TH1D * h_phi_me1_after_alctclct_okClct;
-  TH1D * h_phi_me1_after_alctclct_okAlctClct;
-  TH1D * h_phi_me1_after_lct;
-  TH1D * h_phi_me1_after_lct_okAlct;
-  TH1D * h_phi_me1_after_lct_okAlctClct;
-  TH1D * h_phi_me1_after_lct_okClct;
-  TH1D * h_phi_me1_after_lct_okClctAlct;
-  TH1D * h_phi_me1_after_mplct_ok;
-  TH1D * h_phi_me1_after_mplct_okAlctClct;
-  TH1D * h_phi_me1_after_mplct_okAlctClct_plus;
-  TH1D * h_phi_me1_after_tf_ok;
-
-  TH1D * h_qu_alct;
+  DenseHistograms::H1 h_phi_me1_after_alct;
+  DenseHistograms::H1 h_phi_me1_after_alct_okAlct;
+  DenseHistograms::H1 h_phi_me1_after_clct;
+  DenseHistograms::H1 h_phi_me1_after_clct_okClct;
+  DenseHistograms::H1 h_phi_me1_after_alctclct;
+  DenseHistograms::H1 h_phi_me1_after_alctclct_okAlct;
+  DenseHistograms::H1 h_phi_me1_after_alctclct_okClct;
+  DenseHistograms::H1 h_phi_me1_after_alctclct_okAlctClct;
+  DenseHistograms::H1 h_phi_me1_after_lct;
+  DenseHistograms::H1 h_phi_me1_after_lct_okAlct;
+  DenseHistograms::H1 h_phi_me1_after_lct_okAlctClct;
+  DenseHistograms::H1 h_phi_me1_after_lct_okClct;
+  DenseHistograms::H1 h_phi_me1_after_lct_okClctAlct;
+  DenseHistograms::H1 h_phi_me1_after_mplct_ok;
+  DenseHistograms::H1 h_phi_me1_after_mplct_okAlctClct;
+  DenseHistograms::H1 h_phi_me1_after_mplct_okAlctClct_plus;
+  DenseHistograms::H1 h_phi_me1_after_tf_ok;
+
+  DenseHistograms::H1 h_qu_alct;
   TH1D * h_qu_clct;
   TH1D * h_qu_lct;
-  TH1D * h_qu_mplct;
-  TH2D * h_qu_vs_bx__alct;
+  DenseHistograms::H1 h_qu_mplct;
+  DenseHistograms::H2 h_qu_vs_bx__alct;
   TH2D * h_qu_vs_bx__clct;
   TH2D * h_qu_vs_bx__lct;
-  TH2D * h_qu_vs_bx__mplct;
+  DenseHistograms::H2 h_qu_vs_bx__mplct;
 
   TH2D * h_qu_vs_bxclct__lct;
 
@@ -864,11 +872,11 @@ private:
   TH2D * h_bx_lct_a1_a2;
   TH2D * h_bx_lct_a1_a2_cscdet[CSC_TYPES];
 
-  TH1D * h_tf_stub_bx;
-  TH1D * h_tf_stub_bx_cscdet[CSC_TYPES];
-  TH1D * h_tf_stub_qu;
-  TH1D * h_tf_stub_qu_cscdet[CSC_TYPES];
-  TH2D * h_tf_stub_qu_vs_bx;
+  DenseHistograms::H1 h_tf_stub_bx;
+  DenseHistograms::H1 h_tf_stub_bx_cscdet[CSC_TYPES];
+  DenseHistograms::H1 h_tf_stub_qu;
+  DenseHistograms::H1 h_tf_stub_qu_cscdet[CSC_TYPES];
+  DenseHistograms::H2 h_tf_stub_qu_vs_bx;
   TH2D * h_tf_stub_qu_vs_bx_cscdet[CSC_TYPES];
   TH1D * h_tf_stub_csctype;
   TH1D * h_tf_stub_csctype_org;
@@ -881,23 +889,23 @@ private:
   TH1D * h_tf_stub_pattern_cscdet[CSC_TYPES];
   
   TH1D * h_tf_n_uncommon_stubs;
-  TH1D * h_tf_n_stubs;
-  TH1D * h_tf_n_matchstubs;
-  TH2D * h_tf_n_stubs_vs_matchstubs;
-
-  TH1D * h_tfpt;
-  TH2D * h_tfpt_vs_qu;
-  TH1D * h_tfeta;
-  TH1D * h_tfphi;
-  TH1D * h_tfbx;
-  TH1D * h_tfqu;
-  TH1D * h_tfdr;
+  DenseHistograms::H1 h_tf_n_stubs;
+  DenseHistograms::H1 h_tf_n_matchstubs;
+  DenseHistograms::H2 h_tf_n_stubs_vs_matchstubs;
+
+  DenseHistograms::H1 h_tfpt;
+  DenseHistograms::H2 h_tfpt_vs_qu;
+  DenseHistograms::H1 h_tfeta;
+  DenseHistograms::H1 h_tfphi;
+  DenseHistograms::H1 h_tfbx;
+  DenseHistograms::H1 h_tfqu;
+  DenseHistograms::H1 h_tfdr;
   TH1D * h_tf_mode;
 
-  TH1D * h_tf_pt_h42_2st;
-  TH1D * h_tf_pt_h42_3st;
-  TH1D * h_tf_pt_h42_2st_w;
-  TH1D * h_tf_pt_h42_3st_w;
+  DenseHistograms::H1 h_tf_pt_h42_2st;
+  DenseHistograms::H1 h_tf_pt_h42_3st;
+  DenseHistograms::H1 h_tf_pt_h42_2st_w;
+  DenseHistograms::H1 h_tf_pt_h42_3st_w;
 
   TH1D * h_tf_check_mode;
   TH1D * h_tf_check_bx;
@@ -914,39 +922,39 @@ private:
   //TH2D * h_tf_check_st1_scaledDPhi23_vs_ptbin;
   //TH2D * h_tf_check_st1_scaledDPhi23_vs_ptbin_ok;
 
-  TH1D * h_gmtpt;
-  TH1D * h_gmteta;
-  TH1D * h_gmtphi;
-  TH1D * h_gmtbx;
-  TH1D * h_gmtrank;
-  TH1D * h_gmtqu;
-  TH1D * h_gmtisrpc;
-  TH1D * h_gmtdr;
-
-  TH1D * h_gmtxpt;
-  TH1D * h_gmtxeta;
-  TH1D * h_gmtxphi;
-  TH1D * h_gmtxbx;
-  TH1D * h_gmtxrank;
-  TH1D * h_gmtxqu;
-  TH1D * h_gmtxisrpc;
-  TH1D * h_gmtxdr;
-
-  TH1D * h_gmtxpt_nocsc;
-  TH1D * h_gmtxeta_nocsc;
-  TH1D * h_gmtxphi_nocsc;
-  TH1D * h_gmtxbx_nocsc;
-  TH1D * h_gmtxrank_nocsc;
-  TH1D * h_gmtxqu_nocsc;
-  TH1D * h_gmtxisrpc_nocsc;
-  TH1D * h_gmtxdr_nocsc;
-
-  TH1D * h_gmtxqu_nogmtreg;
-  TH1D * h_gmtxisrpc_nogmtreg;
-  TH1D * h_gmtxqu_notfcand;
-  TH1D * h_gmtxisrpc_notfcand;
-  TH1D * h_gmtxqu_nompc;
-  TH1D * h_gmtxisrpc_nompc;
+  DenseHistograms::H1 h_gmtpt;
+  DenseHistograms::H1 h_gmteta;
+  DenseHistograms::H1 h_gmtphi;
+  DenseHistograms::H1 h_gmtbx;
+  DenseHistograms::H1 h_gmtrank;
+  DenseHistograms::H1 h_gmtqu;
+  DenseHistograms::H1 h_gmtisrpc;
+  DenseHistograms::H1 h_gmtdr;
+
+  DenseHistograms::H1 h_gmtxpt;
+  DenseHistograms::H1 h_gmtxeta;
+  DenseHistograms::H1 h_gmtxphi;
+  DenseHistograms::H1 h_gmtxbx;
+  DenseHistograms::H1 h_gmtxrank;
+  DenseHistograms::H1 h_gmtxqu;
+  DenseHistograms::H1 h_gmtxisrpc;
+  DenseHistograms::H1 h_gmtxdr;
+
+  DenseHistograms::H1 h_gmtxpt_nocsc;
+  DenseHistograms::H1 h_gmtxeta_nocsc;
+  DenseHistograms::H1 h_gmtxphi_nocsc;
+  DenseHistograms::H1 h_gmtxbx_nocsc;
+  DenseHistograms::H1 h_gmtxrank_nocsc;
+  DenseHistograms::H1 h_gmtxqu_nocsc;
+  DenseHistograms::H1 h_gmtxisrpc_nocsc;
+  DenseHistograms::H1 h_gmtxdr_nocsc;
+
+  DenseHistograms::H1 h_gmtxqu_nogmtreg;
+  DenseHistograms::H1 h_gmtxisrpc_nogmtreg;
+  DenseHistograms::H1 h_gmtxqu_notfcand;
+  DenseHistograms::H1 h_gmtxisrpc_notfcand;
+  DenseHistograms::H1 h_gmtxqu_nompc;
+  DenseHistograms::H1 h_gmtxisrpc_nompc;
 
   TH1D * h_xtrapt;
   TH1D * h_xtraeta;
@@ -954,26 +962,26 @@ private:
   TH1D * h_xtrabx;
   TH1D * h_xtradr;
 
-  TH1D * h_n_simHits;
-  TH1D * h_n_alct;
-  TH1D * h_n_clct;
-  TH1D * h_n_lct;
-  TH1D * h_n_mplct;
-  TH1D * h_n_tftrack;
-  TH1D * h_n_tftrack_all;
-  TH1D * h_n_tfcand;
-  TH1D * h_n_tfcand_all;
-  TH1D * h_n_gmtregcand;
-  TH1D * h_n_gmtregcand_all;
-  TH1D * h_n_gmtcand;
-  TH1D * h_n_gmtcand_all;
+  DenseHistograms::H1 h_n_simHits;
+  DenseHistograms::H1 h_n_alct;
+  DenseHistograms::H1 h_n_clct;
+  DenseHistograms::H1 h_n_lct;
+  DenseHistograms::H1 h_n_mplct;
+  DenseHistograms::H1 h_n_tftrack;
+  DenseHistograms::H1 h_n_tftrack_all;
+  DenseHistograms::H1 h_n_tfcand;
+  DenseHistograms::H1 h_n_tfcand_all;
+  DenseHistograms::H1 h_n_gmtregcand;
+  DenseHistograms::H1 h_n_gmtregcand_all;
+  DenseHistograms::H1 h_n_gmtcand;
+  DenseHistograms::H1 h_n_gmtcand_all;
   TH1D * h_n_xtra;
   TH1D * h_n_xtra_all;
 
-  TH1D * h_n_ch_w_alct;
-  TH1D * h_n_ch_w_clct;
-  TH1D * h_n_ch_w_lct;
-  TH1D * h_n_ch_w_mplct;
+  DenseHistograms::H1 h_n_ch_w_alct;
+  DenseHistograms::H1 h_n_ch_w_clct;
+  DenseHistograms::H1 h_n_ch_w_lct;
+  DenseHistograms::H1 h_n_ch_w_mplct;
 
   TH1D * h_n_bx_per_ch_alct;
   TH1D * h_n_bx_per_ch_clct;
@@ -1009,8 +1017,8 @@ private:
   TH1D * h_station_tforg_pu_no;
   TH1D * h_station_tforg_pu_ok_once;
   TH1D * h_station_tforg_pu_no_once;
-  TH1D * h_tfqu_pt10;
-  TH1D * h_tfqu_pt10_no;
+  DenseHistograms::H1 h_tfqu_pt10;
+  DenseHistograms::H1 h_tfqu_pt10_no;
   
   TH1D * h_dBx_LctAlct;
   TH1D * h_dBx_LctClct;
@@ -1023,17 +1031,17 @@ private:
   TH1D * h_dBx_2inCh_LctClct_cscdet[CSC_TYPES];
   TH2D * h_dBx_2inCh_LctClct2_cscdet[CSC_TYPES];
 
-  TH1D * h_pt_over_tfpt_resol;
-  TH2D * h_pt_over_tfpt_resol_vs_pt;
+  DenseHistograms::H1 h_pt_over_tfpt_resol;
+  DenseHistograms::H2 h_pt_over_tfpt_resol_vs_pt;
 
-  TH1D * h_eta_minus_tfeta_resol;
-  TH1D * h_phi_minus_tfphi_resol;
+  DenseHistograms::H1 h_eta_minus_tfeta_resol;
+  DenseHistograms::H1 h_phi_minus_tfphi_resol;
 
-  TH2D * h_strip_v_wireg_me1a;
-  TH2D * h_strip_v_wireg_me1b;
+  DenseHistograms::H2 h_strip_v_wireg_me1a;
+  DenseHistograms::H2 h_strip_v_wireg_me1b;
 
-  TH1D * h_gmt_mindr; 
-  TH1D * h_gmt_dr_maxrank; 
+  DenseHistograms::H1 h_gmt_mindr; 
+  DenseHistograms::H1 h_gmt_dr_maxrank; 
   bool fill_debug_tree_;
   TTree* dbg_tree;
   void bookDbgTTree();
@@ -8,7 +8,11 @@ GEMCSCTriggerRateTree::GEMCSCTriggerRateTree(const edm::ParameterSet& iConfig):
   ptLUTset(CSCTFSPset.getParameter<edm::ParameterSet>("PTLUT")),
   ptLUT(0),
   centralBxOnlyGMT_(iConfig.getUntrackedParameter< bool >("centralBxOnlyGMT",false)),
-  doSelectEtaForGMTRates_(iConfig.getUntrackedParameter< bool >("doSelectEtaForGMTRates",false))
+  doSelectEtaForGMTRates_(iConfig.getUntrackedParameter< bool >("doSelectEtaForGMTRates",false)),
+  parallelFill_(iConfig.getUntrackedParameter< bool >("parallelFill",false)),
+  fillQueueCapacity_(iConfig.getUntrackedParameter< unsigned int >("fillQueueCapacity",4096)),
+  pendingJobs_(0),
+  stopWorkers_(false)
 {
   // stubs
   auto cscALCT = simTrackMatching.getParameter<edm::ParameterSet>("cscALCT");
@@ -119,12 +123,25 @@ GEMCSCTriggerRateTree::GEMCSCTriggerRateTree(const edm::ParameterSet& iConfig):
   if (runCSCTFTrack_ and runCSCTFCand_ and runGMTRegCand_) bookGMTRegCandTree();
   if (runCSCTFTrack_ and runCSCTFCand_ and runGMTRegCand_ and runGMTCand_) bookGMTCandTree();
 
+  if (parallelFill_) {
+    alctQueue_.enableQueue(fillQueueCapacity_);
+    clctQueue_.enableQueue(fillQueueCapacity_);
+    lctQueue_.enableQueue(fillQueueCapacity_);
+    mplctQueue_.enableQueue(fillQueueCapacity_);
+    tftrackQueue_.enableQueue(fillQueueCapacity_);
+    tfcandQueue_.enableQueue(fillQueueCapacity_);
+    gmtregcandQueue_.enableQueue(fillQueueCapacity_);
+    gmtcandQueue_.enableQueue(fillQueueCapacity_);
+  }
+
   n_events = 0;
 }
 
 // ================================================================================================
 GEMCSCTriggerRateTree::~GEMCSCTriggerRateTree()
 {
+  stopWorkers();
+
   if(ptLUT) delete ptLUT;
   ptLUT = nullptr;
 
@@ -177,14 +194,81 @@ GEMCSCTriggerRateTree::beginJob()
   edm::Service<TFileService> fs;
 
   h_events = fs->make<TH1D>("h_events","h_events",1,0,1);
+
+  // one worker per stub loop
+  if (parallelFill_) startWorkers(3);
 }
 
 void 
 GEMCSCTriggerRateTree::endJob()
 {
+  stopWorkers();
   h_events->SetBinContent(1,n_events);
 }
 
+// ================================================================================================
+void
+GEMCSCTriggerRateTree::startWorkers(unsigned int n)
+{
+  stopWorkers_ = false;
+  for (unsigned int i = 0; i < n; ++i) workers_.emplace_back(&GEMCSCTriggerRateTree::workerLoop, this);
+}
+
+// ================================================================================================
+void
+GEMCSCTriggerRateTree::stopWorkers()
+{
+  if (workers_.empty()) return;
+  {
+    std::lock_guard<std::mutex> lock(jobsMutex_);
+    stopWorkers_ = true;
+  }
+  jobsReady_.notify_all();
+  for (auto& w: workers_) w.join();
+  workers_.clear();
+}
+
+// ================================================================================================
+void
+GEMCSCTriggerRateTree::workerLoop()
+{
+  std::unique_lock<std::mutex> lock(jobsMutex_);
+  while (true) {
+    jobsReady_.wait(lock, [this]() { return stopWorkers_ or !jobs_.empty(); });
+    if (jobs_.empty()) return;
+    std::function<void()> job(std::move(jobs_.back()));
+    jobs_.pop_back();
+    lock.unlock();
+    std::exception_ptr error;
+    try { job(); }
+    catch (...) { error = std::current_exception(); }
+    lock.lock();
+    if (error and !jobError_) jobError_ = error;
+    if (--pendingJobs_ == 0) jobsDone_.notify_one();
+  }
+}
+
+// ================================================================================================
+void
+GEMCSCTriggerRateTree::runJobs(std::vector<std::function<void()> >& jobs)
+{
+  {
+    std::lock_guard<std::mutex> lock(jobsMutex_);
+    pendingJobs_ += jobs.size();
+    for (auto& j: jobs) jobs_.push_back(std::move(j));
+  }
+  jobs.clear();
+  jobsReady_.notify_all();
+}
+
+// ================================================================================================
+unsigned int
+GEMCSCTriggerRateTree::drainQueues()
+{
+  return alctQueue_.drain() + clctQueue_.drain() + lctQueue_.drain() + mplctQueue_.drain() +
+    tftrackQueue_.drain() + tfcandQueue_.drain() + gmtregcandQueue_.drain() + gmtcandQueue_.drain();
+}
+
 void 
 GEMCSCTriggerRateTree::intializeTree()
 {
@@ -434,14 +518,47 @@ GEMCSCTriggerRateTree::analyze(const edm::Event& iEvent, const edm::EventSetup&
     }
   }
 
-  analyzeALCTRate(iEvent);
-  analyzeCLCTRate(iEvent);
-  analyzeLCTRate(iEvent);
-  analyzeMPCLCTRate(iEvent);
+  // stub collections are retrieved here, the event is not read from other threads
+  edm::Handle< CSCALCTDigiCollection > halcts;
+  iEvent.getByLabel(inputALCT_, halcts);
+  edm::Handle< CSCCLCTDigiCollection > hclcts;
+  iEvent.getByLabel(inputCLCT_, hclcts);
+  edm::Handle< CSCCorrelatedLCTDigiCollection > hlcts;
+  iEvent.getByLabel(inputLCT_, hlcts);
+  edm::Handle< CSCCorrelatedLCTDigiCollection > hmplcts;
+  iEvent.getByLabel(inputMPLCT_, hmplcts);
+
+  // every analyzeXRate function only touches its own row and queue; the MPLCT and
+  // TF/GMT chain share the sector receiver LUTs and stay on this thread
+  if (parallelFill_) {
+    std::vector<std::function<void()> > jobs;
+    jobs.push_back([&]() { analyzeALCTRate(iEvent, halcts.product()); });
+    jobs.push_back([&]() { analyzeCLCTRate(iEvent, hclcts.product()); });
+    jobs.push_back([&]() { analyzeLCTRate(iEvent, hlcts.product()); });
+    runJobs(jobs);
+  }
+  else {
+    analyzeALCTRate(iEvent, halcts.product());
+    analyzeCLCTRate(iEvent, hclcts.product());
+    analyzeLCTRate(iEvent, hlcts.product());
+  }
+  analyzeMPCLCTRate(iEvent, hmplcts.product());
   if (runCSCTFTrack_) analyzeTFTrackRate(iEvent);
   if (runCSCTFTrack_ and runCSCTFCand_) analyzeTFCandRate(iEvent);
   if (runCSCTFTrack_ and runCSCTFCand_ and runGMTRegCand_) analyzeGMTRegCandRate(iEvent);
   if (runCSCTFTrack_ and runCSCTFCand_ and runGMTRegCand_ and runGMTCand_) analyzeGMTCandRate(iEvent);
+
+  if (parallelFill_) {
+    // wait for the stub loops, then write the rows of this event from the module thread
+    std::exception_ptr error;
+    {
+      std::unique_lock<std::mutex> lock(jobsMutex_);
+      jobsDone_.wait(lock, [this]() { return pendingJobs_ == 0; });
+      std::swap(error, jobError_);
+    }
+    drainQueues();
+    if (error) std::rethrow_exception(error);
+  }
 }
 
 // ================================================================================================
@@ -456,6 +573,7 @@ GEMCSCTriggerRateTree::bookALCTTree()
   alct_tree_->Branch("station",&alct_.station);
   alct_tree_->Branch("ring",&alct_.ring);
   alct_tree_->Branch("chamber",&alct_.chamber);
+  alctQueue_.setTree(alct_tree_, &alct_);
 }
 
 // ================================================================================================
@@ -470,6 +588,7 @@ GEMCSCTriggerRateTree::bookCLCTTree()
   clct_tree_->Branch("station",&clct_.station);
   clct_tree_->Branch("ring",&clct_.ring);
   clct_tree_->Branch("chamber",&clct_.chamber);
+  clctQueue_.setTree(clct_tree_, &clct_);
 }
 
 // ================================================================================================
@@ -484,6 +603,7 @@ GEMCSCTriggerRateTree::bookLCTTree()
   lct_tree_->Branch("station",&lct_.station);
   lct_tree_->Branch("ring",&lct_.ring);
   lct_tree_->Branch("chamber",&lct_.chamber);
+  lctQueue_.setTree(lct_tree_, &lct_);
 }
 
 // ================================================================================================
@@ -500,6 +620,7 @@ GEMCSCTriggerRateTree::bookMPCLCTTree()
   mplct_tree_->Branch("chamber",&mplct_.chamber);
   mplct_tree_->Branch("etalut",&mplct_.etalut);
   mplct_tree_->Branch("philut",&mplct_.philut);
+  mplctQueue_.setTree(mplct_tree_, &mplct_);
 }
 
 // ================================================================================================
@@ -537,6 +658,7 @@ GEMCSCTriggerRateTree::bookTFTrackTree()
   tftrack_tree_->Branch("hasGE21S",&tftrack_.hasGE21S);
   tftrack_tree_->Branch("hasGE21L",&tftrack_.hasGE21L);
   tftrack_tree_->Branch("hasME0",&tftrack_.hasME0);
+  tftrackQueue_.setTree(tftrack_tree_, &tftrack_);
 }
 
 // ================================================================================================
@@ -576,6 +698,7 @@ GEMCSCTriggerRateTree::bookTFCandTree()
   tfcand_tree_->Branch("hasGE21S",&tfcand_.hasGE21S);
   tfcand_tree_->Branch("hasGE21L",&tfcand_.hasGE21L);
   tfcand_tree_->Branch("hasME0",&tfcand_.hasME0);
+  tfcandQueue_.setTree(tfcand_tree_, &tfcand_);
 }
 
 // ================================================================================================
@@ -620,6 +743,7 @@ GEMCSCTriggerRateTree::bookGMTRegCandTree()
   gmtregcand_tree_->Branch("isDT",&gmtregcand_.isDT);
   gmtregcand_tree_->Branch("isRPCb",&gmtregcand_.isRPCb);
   gmtregcand_tree_->Branch("isRPCf",&gmtregcand_.isRPCf);
+  gmtregcandQueue_.setTree(gmtregcand_tree_, &gmtregcand_);
 }
 
 // ================================================================================================
@@ -660,16 +784,13 @@ GEMCSCTriggerRateTree::bookGMTCandTree()
   gmtcand_tree_->Branch("hasGE21S",&gmtcand_.hasGE21S);
   gmtcand_tree_->Branch("hasGE21L",&gmtcand_.hasGE21L);
   gmtcand_tree_->Branch("hasME0",&gmtcand_.hasME0);
+  gmtcandQueue_.setTree(gmtcand_tree_, &gmtcand_);
 }
 
 // ================================================================================================
 void  
-GEMCSCTriggerRateTree::analyzeALCTRate(const edm::Event& iEvent)
+GEMCSCTriggerRateTree::analyzeALCTRate(const edm::Event& iEvent, const CSCALCTDigiCollection* alcts)
 {
-  edm::Handle< CSCALCTDigiCollection > halcts;
-  iEvent.getByLabel(inputALCT_,  halcts);
-  const CSCALCTDigiCollection* alcts = halcts.product();
-  
   for (CSCALCTDigiCollection::DigiRangeIterator  adetUnitIt = alcts->begin(); adetUnitIt != alcts->end(); ++adetUnitIt)
   {
     CSCDetId detId((*adetUnitIt).first);
@@ -685,7 +806,7 @@ GEMCSCTriggerRateTree::analyzeALCTRate(const edm::Event& iEvent)
       alct_.ring = detId.ring();
       alct_.chamber = detId.chamber();
       alct_.bx = bx - 6;
-      alct_tree_->Fill();
+      alctQueue_.fill();
 
       // debug
       if (verboseALCT_){
@@ -700,12 +821,8 @@ GEMCSCTriggerRateTree::analyzeALCTRate(const edm::Event& iEvent)
 
 // ================================================================================================
 void  
-GEMCSCTriggerRateTree::analyzeCLCTRate(const edm::Event& iEvent)
+GEMCSCTriggerRateTree::analyzeCLCTRate(const edm::Event& iEvent, const CSCCLCTDigiCollection* clcts)
 {
-  edm::Handle< CSCCLCTDigiCollection > hclcts;
-  iEvent.getByLabel(inputCLCT_,  hclcts);
-  const CSCCLCTDigiCollection* clcts = hclcts.product();
-
   for (CSCCLCTDigiCollection::DigiRangeIterator  adetUnitIt = clcts->begin(); adetUnitIt != clcts->end(); ++adetUnitIt)
   {
     CSCDetId detId((*adetUnitIt).first);
@@ -721,7 +838,7 @@ GEMCSCTriggerRateTree::analyzeCLCTRate(const edm::Event& iEvent)
       clct_.ring = detId.ring();
       clct_.chamber = detId.chamber();
       clct_.bx = bx - 6;
-      clct_tree_->Fill();
+      clctQueue_.fill();
 
       // debug
       if (verboseCLCT_){
@@ -737,12 +854,8 @@ GEMCSCTriggerRateTree::analyzeCLCTRate(const edm::Event& iEvent)
 
 // ================================================================================================
 void  
-GEMCSCTriggerRateTree::analyzeLCTRate(const edm::Event& iEvent)
+GEMCSCTriggerRateTree::analyzeLCTRate(const edm::Event& iEvent, const CSCCorrelatedLCTDigiCollection* lcts)
 {
-  edm::Handle< CSCCorrelatedLCTDigiCollection > lcts_tmb;
-  iEvent.getByLabel(inputLCT_,  lcts_tmb);
-  const CSCCorrelatedLCTDigiCollection* lcts = lcts_tmb.product();
-
   for (CSCCorrelatedLCTDigiCollection::DigiRangeIterator detUnitIt = lcts->begin(); detUnitIt != lcts->end(); detUnitIt++) 
   {
     const CSCDetId& detId = (*detUnitIt).first;
@@ -758,7 +871,7 @@ GEMCSCTriggerRateTree::analyzeLCTRate(const edm::Event& iEvent)
       lct_.ring = detId.ring();
       lct_.chamber = detId.chamber();
       lct_.bx = bx - 6;
-      lct_tree_->Fill();
+      lctQueue_.fill();
 
       // debug
       if (verboseLCT_){
@@ -773,12 +886,8 @@ GEMCSCTriggerRateTree::analyzeLCTRate(const edm::Event& iEvent)
 
 // ================================================================================================
 void  
-GEMCSCTriggerRateTree::analyzeMPCLCTRate(const edm::Event& iEvent)
+GEMCSCTriggerRateTree::analyzeMPCLCTRate(const edm::Event& iEvent, const CSCCorrelatedLCTDigiCollection* mplcts)
 {
-  edm::Handle< CSCCorrelatedLCTDigiCollection > lcts_mpc;
-  iEvent.getByLabel(inputMPLCT_,  lcts_mpc);
-  const CSCCorrelatedLCTDigiCollection* mplcts = lcts_mpc.product();
-
   for (auto detUnitIt = mplcts->begin(); detUnitIt != mplcts->end(); detUnitIt++) 
   {
     const CSCDetId& detId = (*detUnitIt).first;
@@ -797,7 +906,7 @@ GEMCSCTriggerRateTree::analyzeMPCLCTRate(const edm::Event& iEvent)
       const csctf::TrackStub stub(buildTrackStub((*digiIt), detId));
       mplct_.etalut = stub.etaValue();
       mplct_.philut = stub.phiValue();
-      mplct_tree_->Fill();
+      mplctQueue_.fill();
 
       // debug
       if (verboseMPLCT_){
@@ -902,7 +1011,7 @@ GEMCSCTriggerRateTree::analyzeTFTrackRate(const edm::Event& iEvent)
     // add the TFTrack to the list
     rtTFTracks_.push_back(myTFTrk);
 
-    tftrack_tree_->Fill();
+    tftrackQueue_.fill();
   }
 }
 
@@ -975,7 +1084,7 @@ GEMCSCTriggerRateTree::analyzeTFCandRate(const edm::Event& iEvent)
     
     rtTFCands_.push_back(myTFCand);
 
-    tfcand_tree_->Fill();
+    tfcandQueue_.fill();
   }
 }
 
@@ -1104,7 +1213,7 @@ GEMCSCTriggerRateTree::analyzeGMTRegCandRate(const edm::Event& iEvent, enum gmtR
                 << "\tRE42 " << gmtregcand_.hasRE42 << "\tRE43 " << gmtregcand_.hasRE43 << endl;
     }
     
-    gmtregcand_tree_->Fill();
+    gmtregcandQueue_.fill();
   }
 }
 
@@ -1294,7 +1403,7 @@ GEMCSCTriggerRateTree::analyzeGMTCandRate(const edm::Event& iEvent)
        }      
       
       rtGmtCands_.push_back(myGMTCand);
-      gmtcand_tree_->Fill();
+      gmtcandQueue_.fill();
     }
   }
 }
@@ -2,8 +2,13 @@
 #define SimMuL1_GEMCSCTriggerRateTree_h
 
 // system include files
+#include <condition_variable>
+#include <exception>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <cmath>
+#include <thread>
 
 // user include files
 #include "FWCore/Framework/interface/Frameworkfwd.h"
@@ -49,6 +54,7 @@
 
 #include "GEMCode/SimMuL1/interface/MuGeometryHelpers.h"
 #include "GEMCode/SimMuL1/interface/MatchCSCMuL1.h"
+#include "GEMCode/SimMuL1/plugins/RateTreeQueue.h"
 
 // ROOT
 #include "TH1.h"
@@ -200,10 +206,10 @@ class GEMCSCTriggerRateTree : public edm::EDAnalyzer
 
   void intializeTree();
 
-  void analyzeALCTRate(const edm::Event&);
-  void analyzeCLCTRate(const edm::Event&);
-  void analyzeLCTRate(const edm::Event&);
-  void analyzeMPCLCTRate(const edm::Event&);
+  void analyzeALCTRate(const edm::Event&, const CSCALCTDigiCollection*);
+  void analyzeCLCTRate(const edm::Event&, const CSCCLCTDigiCollection*);
+  void analyzeLCTRate(const edm::Event&, const CSCCorrelatedLCTDigiCollection*);
+  void analyzeMPCLCTRate(const edm::Event&, const CSCCorrelatedLCTDigiCollection*);
 
   void analyzeTFTrackRate(const edm::Event&);
   void analyzeTFTrackRate(const edm::Event&, enum tfTrack type);
@@ -216,6 +222,13 @@ class GEMCSCTriggerRateTree : public edm::EDAnalyzer
 
   void analyzeGMTCandRate(const edm::Event&);
 
+  // worker threads for parallelFill mode
+  void startWorkers(unsigned int n);
+  void stopWorkers();
+  void workerLoop();
+  void runJobs(std::vector<std::function<void()> >& jobs);
+  unsigned int drainQueues();
+
   // parameters
   edm::ParameterSet simTrackMatching;
   edm::ParameterSet CSCTFSPset;
@@ -294,6 +307,11 @@ class GEMCSCTriggerRateTree : public edm::EDAnalyzer
   bool centralBxOnlyGMT_;
   bool doSelectEtaForGMTRates_;
 
+  // run the ALCT, CLCT and LCT loops on worker threads next to the MPLCT/TF/GMT chain;
+  // their rows are buffered and written to the trees on the module thread
+  bool parallelFill_;
+  unsigned int fillQueueCapacity_;
+
   const CSCGeometry* cscGeometry;
 
   TTree* alct_tree_;
@@ -314,6 +332,25 @@ class GEMCSCTriggerRateTree : public edm::EDAnalyzer
   MyGMTRegCand gmtregcand_;
   MyGMT gmtcand_;
 
+  RateTreeQueue<MyALCT> alctQueue_;
+  RateTreeQueue<MyCLCT> clctQueue_;
+  RateTreeQueue<MyLCT> lctQueue_;
+  RateTreeQueue<MyMPLCT> mplctQueue_;
+  RateTreeQueue<MyTFTrack> tftrackQueue_;
+  RateTreeQueue<MyTFCand> tfcandQueue_;
+  RateTreeQueue<MyGMTRegCand> gmtregcandQueue_;
+  RateTreeQueue<MyGMT> gmtcandQueue_;
+
+  // started once in beginJob, handed the stub loops of every event
+  std::vector<std::thread> workers_;
+  std::mutex jobsMutex_;
+  std::condition_variable jobsReady_;
+  std::condition_variable jobsDone_;
+  std::vector<std::function<void()> > jobs_;
+  unsigned int pendingJobs_;
+  std::exception_ptr jobError_;
+  bool stopWorkers_;
+
   std::vector<MatchCSCMuL1::TFTRACK> rtTFTracks_;
   std::vector<MatchCSCMuL1::TFCAND> rtTFCands_;
   std::vector<MatchCSCMuL1::GMTREGCAND> rtGmtRegCscCands_;
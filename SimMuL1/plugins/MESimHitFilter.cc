@@ -29,12 +29,14 @@
 #include "FWCore/Framework/interface/MakerMacros.h"
 
 #include "FWCore/ParameterSet/interface/ParameterSet.h"
+#include "FWCore/Utilities/interface/InputTag.h"
 
 #include "DataFormats/MuonDetId/interface/CSCDetId.h"
-#include "GEMCode/SimMuL1/interface/PSimHitMapCSC.h"
+#include "SimDataFormats/TrackingHit/interface/PSimHitContainer.h"
 
+#include <algorithm>
+#include <cstring>
 #include <vector>
-#include <set>
 
 //
 // class declaration
@@ -53,9 +55,21 @@ private:
   virtual bool filter(edm::Event&, const edm::EventSetup&);
   virtual void endJob() ;
 
-  SimHitAnalysis::PSimHitMapCSC simhit_map_csc_;
+  // dense chamber index over endcap, station, ring, chamber
+  enum {N_CHAMBER_INDEX = 2*4*4*36};
+  static int chamberIndex(const CSCDetId& id)
+  {
+    return (((id.endcap()-1)*4 + id.station()-1)*4 + id.ring()-1)*36 + id.chamber()-1;
+  }
+
+  edm::InputTag input_;
+
+  // selected chamber types, indexed by CSCDetId::iChamberType() (1..10)
+  bool me_types_[11];
+  unsigned int min_n_layers_;
 
-  std::set<int> me_types_;
+  // bit (layer-1) is set for every layer with a simhit
+  unsigned char layer_mask_[N_CHAMBER_INDEX];
 };
 
 
@@ -64,11 +78,13 @@ MESimHitFilter::MESimHitFilter(const edm::ParameterSet& cfg)
 {
   const std::vector<int> def_types {1,4,5}; // ME1/a ME1/b ME2/1
   std::vector<int> types_cfg = cfg.getUntrackedParameter<std::vector<int> >("me_types", def_types);
-  std::copy(types_cfg.begin(), types_cfg.end(), inserter(me_types_, me_types_.begin()));
-  
-  edm::InputTag def_input("g4SimHits","MuonCSCHits");
-  simhit_map_csc_.setInputTag(def_input);
+  std::fill(me_types_, me_types_ + 11, false);
+  for (auto t: types_cfg) if (t >= 1 and t <= 10) me_types_[t] = true;
+
+  min_n_layers_ = cfg.getUntrackedParameter<unsigned int>("min_n_layers", 4);
 
+  edm::InputTag def_input("g4SimHits","MuonCSCHits");
+  input_ = cfg.getUntrackedParameter<edm::InputTag>("simInputLabel", def_input);
 }
 
 
@@ -79,25 +95,22 @@ MESimHitFilter::~MESimHitFilter()
 
 bool MESimHitFilter::filter(edm::Event& iEvent, const edm::EventSetup& iSetup)
 {
-  using namespace edm;
-  using namespace std;
-  
-  simhit_map_csc_.fill(iEvent);
-
-  vector<int> ch_ids = simhit_map_csc_.chambersWithHits();
-  if (ch_ids.empty()) return false;
+  edm::Handle<edm::PSimHitContainer> hSimHits;
+  iEvent.getByLabel(input_, hSimHits);
 
-  for(auto d: ch_ids)
+  // one pass over the simhits: collect the layer mask per chamber and stop
+  // as soon as a chamber of interest has enough layers
+  std::memset(layer_mask_, 0, sizeof(layer_mask_));
+  for (auto& hit: *hSimHits)
   {
-    CSCDetId ch_id(d);
+    const CSCDetId id(hit.detUnitId());
 
     // is it a chamber type of interest?
-    if (me_types_.count(ch_id.iChamberType()) == 0) continue;
+    if (!me_types_[id.iChamberType()]) continue;
 
-    // count number of layers with hits
-    vector<int> layer_ids = simhit_map_csc_.chamberLayersWithHits(d);
-    //cout<<ch_id<<" #L "<<layer_ids.size()<<endl;
-    if (layer_ids.size() >= 4) return true;
+    unsigned char& mask = layer_mask_[chamberIndex(id)];
+    mask |= 1 << (id.layer() - 1);
+    if (unsigned(__builtin_popcount(mask)) >= min_n_layers_) return true;
   }
 
   return false;
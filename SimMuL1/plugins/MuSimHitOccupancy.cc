@@ -45,7 +45,9 @@
 
 #include "GEMCode/SimMuL1/interface/PSimHitMapCSC.h"
 #include "GEMCode/SimMuL1/interface/MuGeometryHelpers.h"
+#include "GEMCode/SimMuL1/interface/MuGeometryCache.h"
 #include "GEMCode/SimMuL1/interface/MuNtupleClasses.h"
+#include "GEMCode/SimMuL1/interface/MuOccupancyNormalization.h"
 
 #include <iomanip>
 
@@ -63,15 +65,6 @@ const std::string pdg_ids_names_[N_PDGIDS] = {"", "e", "mu", "pi", "K", "p", "nu
 const int pdg_colors[N_PDGIDS] = {0, kBlack, kBlue, kGreen+1, kOrange-3, kMagenta, kRed};
 const int pdg_markers[N_PDGIDS] = {0, 1, 24, 3, 5, 26, 2};
 
-template<class H>
-void scaleOneBin(H *h, int bin, double scale)
-{
-  double rt = scale * h->GetBinContent(bin);
-  double er = scale * h->GetBinError(bin);
-  h->SetBinContent(bin, rt);
-  h->SetBinError(bin, er);
-}
-
 } // local namespace
 
 
@@ -93,10 +86,6 @@ public:
   void analyzeDT();
   void analyzeRPC();
 
-  std::vector<std::vector<MyCSCSimHit> > clusterCSCHitsInLayer(std::vector<MyCSCSimHit> &hits);
-  std::vector<std::vector<MyGEMSimHit> > clusterGEMHitsInPart(std::vector<MyGEMSimHit> &hits);
-  std::vector<std::vector<MyRPCSimHit> > clusterRPCHitsInRoll(std::vector<MyRPCSimHit> &hits);
-  std::vector<std::vector<MyDTSimHit> > clusterDTHitsInLayer(std::vector<MyDTSimHit> &hits);
 
 private:
 
@@ -119,6 +108,9 @@ private:
   bool fill_rpc_sh_tree_;
   bool fill_dt_sh_tree_;
 
+  // false: keep raw counts, to be merged and normalized with mergeMuSimHitOccupancy
+  bool normalize_in_job_;
+
   // misc. utilities
 
   const CSCGeometry* csc_geometry;
@@ -133,8 +125,9 @@ private:
   SimHitAnalysis::PSimHitMap simhit_map_rpc;
   SimHitAnalysis::PSimHitMap simhit_map_dt;
 
-  // sensitive areas
-  mugeo::MuGeometryAreas areas_;
+  // sensitive areas, shared with the other modules of the job through the geometry cache
+  mugeo::MuGeometryCache geometry_cache_;
+  std::shared_ptr<const mugeo::MuGeometryAreas> areas_;
 
   // some counters:
 
@@ -218,12 +211,7 @@ private:
   TH2D * h_mu_rz_sh_heatmap;
   TH2D * h_mu_xy_sh_heatmap;
 
-
-  TGraphErrors *gr_csc_hit_flux_me1, *gr_csc_hit_flux_me2, *gr_csc_hit_flux_me3, *gr_csc_hit_flux_me4;
-  TGraphErrors *gr_dt_hit_flux_mb1, *gr_dt_hit_flux_mb2, *gr_dt_hit_flux_mb3, *gr_dt_hit_flux_mb4;
-
-  TGraphErrors *gr_gem_hit_flux_ge1;
-  TGraphErrors *gr_gem_hit_padflux_ge1;
+  // the flux graphs are made from the normalized histograms by MuOccupancyNormalizer
 
   // some ntuples:
 
@@ -325,6 +313,15 @@ MuSimHitOccupancy::MuSimHitOccupancy(const edm::ParameterSet& iConfig)
   fill_dt_sh_tree_  = do_dt_ && iConfig.getUntrackedParameter< bool >("fillDTSimHitsTree",true);
   if (fill_dt_sh_tree_) bookDTSimHitsTrees();
 
+  normalize_in_job_ = iConfig.getUntrackedParameter< bool >("normalizeInJob", true);
+
+  geometry_cache_ = mugeo::MuGeometryCache(iConfig.getUntrackedParameter<std::string>("geometryCacheDir", ""),
+                                           iConfig.getUntrackedParameter<std::string>("geometryVersion", ""));
+  csc_geometry = 0;
+  gem_geometry = 0;
+  dt_geometry = 0;
+  rpc_geometry = 0;
+
 
   evtn = 0;
   nevt_with_cscsh = nevt_with_cscsh_in_rpc = n_cscsh = n_cscsh_in_rpc = 0;
@@ -552,39 +549,6 @@ MuSimHitOccupancy::MuSimHitOccupancy(const edm::ParameterSet& iConfig)
 
   h_mu_rz_sh_heatmap = fs->make<TH2D>("h_mu_rz_sh_heatmap", (n_simhits+" #rho-z;z, cm;#rho, cm").c_str(),572,0,1120,160,0,800);
 
-
-  gr_csc_hit_flux_me1 = fs->make<TGraphErrors>(4);
-  gr_csc_hit_flux_me1->SetName("gr_csc_hit_flux_me1");
-  gr_csc_hit_flux_me1->SetTitle("SimHit Flux in ME1;r, cm;Hz/cm^{2}");
-  gr_csc_hit_flux_me2 = fs->make<TGraphErrors>(2);
-  gr_csc_hit_flux_me2->SetName("gr_csc_hit_flux_me2");
-  gr_csc_hit_flux_me2->SetTitle("SimHit Flux in ME2;r, cm;Hz/cm^{2}");
-  gr_csc_hit_flux_me3 = fs->make<TGraphErrors>(2);
-  gr_csc_hit_flux_me3->SetName("gr_csc_hit_flux_me3");
-  gr_csc_hit_flux_me3->SetTitle("SimHit Flux in ME3;r, cm;Hz/cm^{2}");
-  gr_csc_hit_flux_me4 = fs->make<TGraphErrors>(2);
-  gr_csc_hit_flux_me4->SetName("gr_csc_hit_flux_me4");
-  gr_csc_hit_flux_me4->SetTitle("SimHit Flux in ME3;r, cm;Hz/cm^{2}");
-
-  gr_dt_hit_flux_mb1 = fs->make<TGraphErrors>(3);
-  gr_dt_hit_flux_mb1->SetName("gr_dt_hit_flux_mb1");
-  gr_dt_hit_flux_mb1->SetTitle("SimHit Flux in MB1;z, cm;Hz/cm^{2}");
-  gr_dt_hit_flux_mb2 = fs->make<TGraphErrors>(3);
-  gr_dt_hit_flux_mb2->SetName("gr_dt_hit_flux_mb2");
-  gr_dt_hit_flux_mb2->SetTitle("SimHit Flux in MB2;z, cm;Hz/cm^{2}");
-  gr_dt_hit_flux_mb3 = fs->make<TGraphErrors>(3);
-  gr_dt_hit_flux_mb3->SetName("gr_dt_hit_flux_mb3");
-  gr_dt_hit_flux_mb3->SetTitle("SimHit Flux in MB3;z, cm;Hz/cm^{2}");
-  gr_dt_hit_flux_mb4 = fs->make<TGraphErrors>(3);
-  gr_dt_hit_flux_mb4->SetName("gr_dt_hit_flux_mb4");
-  gr_dt_hit_flux_mb4->SetTitle("SimHit Flux in MB4;z, cm;Hz/cm^{2}");
-
-  gr_gem_hit_flux_ge1 = fs->make<TGraphErrors>(10);
-  gr_gem_hit_flux_ge1->SetName("gr_gem_hit_flux_ge1");
-  gr_gem_hit_flux_ge1->SetTitle("SimHit Flux in GE1;r, cm;Hz/pad");
-  gr_gem_hit_padflux_ge1 = fs->make<TGraphErrors>(10);
-  gr_gem_hit_padflux_ge1->SetName("gr_gem_hit_padflux_ge1");
-  gr_gem_hit_padflux_ge1->SetTitle("SimHit Flux in GE1;r, cm;Hz/pad");
 }
 
 // ================================================================================================
@@ -726,8 +690,6 @@ MuSimHitOccupancy::analyze(const edm::Event& iEvent, const edm::EventSetup& iSet
     iSetup.get< MuonGeometryRecord >().get(csc_geom);
     csc_geometry = &*csc_geom;
 
-    if (evtn==1) areas_.calculateCSCDetectorAreas(csc_geometry);
-
     // get SimHits
     simhit_map_csc.fill(iEvent);
    
@@ -740,8 +702,6 @@ MuSimHitOccupancy::analyze(const edm::Event& iEvent, const edm::EventSetup& iSet
     iSetup.get< MuonGeometryRecord >().get(gem_geom);
     gem_geometry = &*gem_geom;
 
-    if (evtn==1) areas_.calculateGEMDetectorAreas(gem_geometry);
-
     // get SimHits
     simhit_map_gem.fill(iEvent);
    
@@ -754,8 +714,6 @@ MuSimHitOccupancy::analyze(const edm::Event& iEvent, const edm::EventSetup& iSet
     iSetup.get< MuonGeometryRecord >().get(rpc_geom);
     rpc_geometry = &*rpc_geom;
 
-    if (evtn==1) areas_.calculateRPCDetectorAreas(rpc_geometry);
-
     // get SimHits
     simhit_map_rpc.fill(iEvent);
 
@@ -768,14 +726,13 @@ MuSimHitOccupancy::analyze(const edm::Event& iEvent, const edm::EventSetup& iSet
     iSetup.get< MuonGeometryRecord >().get(dt_geom);
     dt_geometry = &*dt_geom;
 
-    if (evtn==1) areas_.calculateDTDetectorAreas(dt_geometry);
-
     // get SimHits
     simhit_map_dt.fill(iEvent);
 
     analyzeDT();
   }
 
+  if (evtn==1) areas_ = geometry_cache_.areas(iSetup.get< MuonGeometryRecord >(), csc_geometry, gem_geometry, rpc_geometry, dt_geometry);
 }
 
 // ================================================================================================
@@ -847,7 +804,7 @@ MuSimHitOccupancy::analyzeCSC()
       }
 
       cout<<" calling recursive clustering:"<<endl;
-      vector<vector<MyCSCSimHit> > clusters = clusterCSCHitsInLayer(layer_mysimhits);
+      vector<vector<MyCSCSimHit> > clusters = clusterCSCSimHits(layer_mysimhits, true);
       //cout<<"      "<< layer_ids[la]<<" "<<layerId<<"   # hits = "<<hits.size()<<"  # clusters = "<<clusters.size()<<endl;
 
       vector<MyCSCCluster> layer_myclusters;
@@ -962,7 +919,7 @@ MuSimHitOccupancy::analyzeGEM()
     }
 
     cout<<" calling GEM recursive clustering:"<<endl;
-    vector<vector<MyGEMSimHit> > clusters = clusterGEMHitsInPart(part_mysimhits);
+    vector<vector<MyGEMSimHit> > clusters = clusterGEMSimHits(part_mysimhits, true);
 
     vector<MyGEMCluster> part_myclusters;
     for (unsigned cl = 0; cl < clusters.size(); cl++)
@@ -1095,7 +1052,7 @@ MuSimHitOccupancy::analyzeRPC()
     }
 
     cout<<" calling recursive clustering:"<<endl;
-    vector<vector<MyRPCSimHit> > clusters = clusterRPCHitsInRoll(roll_mysimhits);
+    vector<vector<MyRPCSimHit> > clusters = clusterRPCSimHits(roll_mysimhits, true);
 
     vector<MyRPCCluster> roll_myclusters;
     for (unsigned cl = 0; cl < clusters.size(); cl++)
@@ -1229,361 +1186,67 @@ void MuSimHitOccupancy::beginJob() {}
 // ================================================================================================
 void MuSimHitOccupancy::endJob()
 {
-  using namespace std;
-  cout<<"******************* COUNTERS *******************"<<endl;
-  cout<<"* #events: "<< evtn <<endl;
-  cout<<"* #events with SimHits in:"<<endl;
-  cout<<"*   CSC:                     "<<nevt_with_cscsh<<" ("<<(double)nevt_with_cscsh/evtn*100<<"%)"<<endl;
-  cout<<"*   CSC (|eta|<1.6, st 1-3): "<<nevt_with_cscsh_in_rpc<<" ("<<(double)nevt_with_cscsh_in_rpc/evtn*100<<"%)"<<endl;
-  cout<<"*   GEM:                     "<<nevt_with_gemsh<<" ("<<(double)nevt_with_gemsh/evtn*100<<"%)"<<endl;
-  cout<<"*   RPC:                     "<<nevt_with_rpcsh<<" ("<<(double)nevt_with_rpcsh/evtn*100<<"%)"<<endl;
-  cout<<"*   RPC endcaps:             "<<nevt_with_rpcsh_e<<" ("<<(double)nevt_with_rpcsh_e/evtn*100<<"%)"<<endl;
-  cout<<"*   RPC barrel:              "<<nevt_with_rpcsh_b<<" ("<<(double)nevt_with_rpcsh_b/evtn*100<<"%)"<<endl;
-  cout<<"*   DT:                      "<<nevt_with_dtsh<<" ("<<(double)nevt_with_dtsh/evtn*100<<"%)"<<endl;
-  cout<<"* total SimHit numbers in: "<<endl;
-  cout<<"*   CSC:                     "<<n_cscsh<<" (~"<<(double)n_cscsh/nevt_with_cscsh<<" sh/evt with hits)"<<endl;
-  cout<<"*   CSC (|eta|<1.6, st 1-3): "<<n_cscsh_in_rpc<<" (~"<<(double)n_cscsh_in_rpc/nevt_with_cscsh_in_rpc<<" sh/evt with hits)"<<endl;
-  cout<<"*   GEM:                     "<<n_gemsh<<" (~"<<(double)n_gemsh/nevt_with_gemsh<<" sh/evt with hits)"<<endl;
-  cout<<"*   RPC:                     "<<n_rpcsh<<" (~"<<(double)n_rpcsh/nevt_with_rpcsh<<" sh/evt with hits)"<<endl;
-  cout<<"*   RPC endcaps:             "<<n_rpcsh_e<<" (~"<<(double)n_rpcsh_e/nevt_with_rpcsh_e<<" sh/evt with hits)"<<endl;
-  cout<<"*   RPC barrel:              "<<n_rpcsh_b<<" (~"<< ( (nevt_with_rpcsh_b>0) ? (double)n_rpcsh_b/nevt_with_rpcsh_b : 0 )<<" sh/evt with hits)"<<endl;
-  cout<<"*   DT:                      "<<n_dtsh<<" (~"<<(double)n_dtsh/nevt_with_dtsh<<" sh/evt with hits)"<<endl;
-  cout<<"************************************************"<<endl;
-
-  edm::Service<TFileService> fs;
-
-  // convert to fraction:
-  h_csc_nevt_fraction_with_sh->Sumw2();
-  h_csc_nevt_fraction_with_sh->Scale(1./evtn);
-  h_gem_nevt_fraction_with_sh->Sumw2();
-  h_gem_nevt_fraction_with_sh->Scale(1./evtn);
-  h_rpcf_nevt_fraction_with_sh->Sumw2();
-  h_rpcf_nevt_fraction_with_sh->Scale(1./evtn);
-  h_rpcb_nevt_fraction_with_sh->Sumw2();
-  h_rpcb_nevt_fraction_with_sh->Scale(1./evtn);
-  h_dt_nevt_fraction_with_sh->Sumw2();
-  h_dt_nevt_fraction_with_sh->Scale(1./evtn);
-
-  // ---- calculate fluxes per cm2 and rates per chamber at L=10^34 ----
-
-  // pileup at nominal lumi
-  double n_pu = 25.;
-  // fraction of full BXs : 2808 filled bickets out of 3564
-  double f_full_bx = 0.7879;
-  if (!input_is_neutrons_) f_full_bx = 1.;
-  // bx rate 40 MHz
-  double bxrate = 40000000.;
-  double scale;
-
-  if (do_csc_) for (int t=0; t <= CSC_TYPES; t++)
-  {
-    h_csc_total_area->SetBinContent(t, areas_.csc_total_areas_cm2[t]);
-  }
-  h_csc_total_area->SetBinContent(CSC_TYPES+1, evtn); // store it in overflow
-  h_csc_total_area->SetEntries(CSC_TYPES+2);
-
-  h_csc_hit_flux_per_layer->Sumw2();
-  h_csc_hit_rate_per_ch->Sumw2();
-  h_csc_clu_flux_per_layer->Sumw2();
-  h_csc_clu_rate_per_ch->Sumw2();
-  if (do_csc_) for (int t=1; t <= CSC_TYPES; t++)
-  {
-    // 2 endcaps , 6 layers
-    scale = bxrate * n_pu * f_full_bx /areas_.csc_total_areas_cm2[t]/evtn;
-    scaleOneBin(h_csc_hit_flux_per_layer, t, scale);
-    scaleOneBin(h_csc_clu_flux_per_layer, t, scale);
-
-    scale = bxrate * n_pu * f_full_bx /csc_radial_segm[t]/2./evtn/1000.;
-    scaleOneBin(h_csc_hit_rate_per_ch, t, scale);
-    scaleOneBin(h_csc_clu_rate_per_ch, t, scale);
-  }
-  if (do_csc_) for (int i=0; i<4; i++)
-  {
-    gr_csc_hit_flux_me1->SetPoint(i, areas_.csc_ch_radius[i+1], h_csc_hit_flux_per_layer->GetBinContent(i+1) );
-    gr_csc_hit_flux_me1->SetPointError(i, areas_.csc_ch_halfheight[i+1], h_csc_hit_flux_per_layer->GetBinError(i+1) );
-    if (i>1) continue;
-    gr_csc_hit_flux_me2->SetPoint(i, areas_.csc_ch_radius[i+5], h_csc_hit_flux_per_layer->GetBinContent(i+5) );
-    gr_csc_hit_flux_me3->SetPoint(i, areas_.csc_ch_radius[i+7], h_csc_hit_flux_per_layer->GetBinContent(i+7) );
-    gr_csc_hit_flux_me4->SetPoint(i, areas_.csc_ch_radius[i+9], h_csc_hit_flux_per_layer->GetBinContent(i+9) );
-    gr_csc_hit_flux_me2->SetPointError(i, areas_.csc_ch_halfheight[i+5], h_csc_hit_flux_per_layer->GetBinError(i+5) );
-    gr_csc_hit_flux_me3->SetPointError(i, areas_.csc_ch_halfheight[i+7], h_csc_hit_flux_per_layer->GetBinError(i+7) );
-    gr_csc_hit_flux_me4->SetPointError(i, areas_.csc_ch_halfheight[i+9], h_csc_hit_flux_per_layer->GetBinError(i+9) );
-  }
-
-
-  if (do_gem_) for (int t=0; t <= GEM_TYPES; t++) // underflow is total area
-  {
-    h_gem_total_area->SetBinContent(t,areas_.gem_total_areas_cm2[t]);
-  }
-  h_gem_total_area->SetBinContent(GEM_TYPES+1, evtn); // store it in overflow
-  h_gem_total_area->SetEntries(GEM_TYPES+2);
-
-  h_gem_hit_flux_per_layer->Sumw2();
-  h_gem_hit_rate_per_ch->Sumw2();
-  if (do_gem_) for (int t=1; t<=GEM_TYPES; t++)
-  {
-    scale = bxrate * n_pu * f_full_bx /areas_.gem_total_areas_cm2[t]/evtn;
-    scaleOneBin(h_gem_hit_flux_per_layer, t, scale);
-    scaleOneBin(h_gem_clu_flux_per_layer, t, scale);
-
-    scale = bxrate * n_pu * f_full_bx /gem_radial_segm[t]/2/evtn/1000;
-    scaleOneBin(h_gem_hit_rate_per_ch, t, scale);
-    scaleOneBin(h_gem_clu_rate_per_ch, t, scale);
-
-    scale = 1. /evtn /gem_radial_segm[t]/2./2.; // gem
-    scaleOneBin(h_gem_nhit_avg_per_ch, t, scale);
-  }
-
-  h_gem_hit_flux_per_partlayer_ge11->Sumw2();
-  h_gem_hit_avg_per_part_ge11->Sumw2();
-  if (do_gem_)  for (int i=1; i<=10; i++)
-  {
-    if (areas_.gem_total_part_areas_cm2[1][i] == 0.) continue;
-    scale = bxrate * n_pu * f_full_bx /evtn /areas_.gem_total_part_areas_cm2[1][i];
-    scaleOneBin(h_gem_hit_flux_per_partlayer_ge11, i, scale);
-  }
-  if (do_gem_)
-  {
-    scale = 1. /evtn /gem_radial_segm[1]/2./2.; // gem
-    h_gem_hit_avg_per_part_ge11->Scale(scale);
-  }
-  if (do_gem_) for (int i=0; i<=10; i++)
-  {
-    gr_gem_hit_flux_ge1->SetPoint(i, areas_.gem_part_radius[1][i+1], h_gem_hit_flux_per_partlayer_ge11->GetBinContent(i+1) );
-    gr_gem_hit_flux_ge1->SetPointError(i, areas_.gem_part_halfheight[1][i+1], h_gem_hit_flux_per_partlayer_ge11->GetBinError(i+1) );
-  }
-  
-
-  if (do_rpc_) for (int t=0; t <= RPCF_TYPES; t++)
-  {
-    h_rpcf_total_area->SetBinContent(t, areas_.rpcf_total_areas_cm2[t]);
-  }
-  h_rpcf_total_area->SetBinContent(RPCF_TYPES+1, evtn); // store it in overflow
-  h_rpcf_total_area->SetEntries(RPCF_TYPES+2);
-
-  h_rpcf_hit_flux_per_layer->Sumw2();
-  h_rpcf_hit_rate_per_ch->Sumw2();
-  if (do_rpc_) for (int t=1; t<=RPCF_TYPES; t++)
-  {
-    scale = bxrate * n_pu * f_full_bx /areas_.rpcf_total_areas_cm2[t]/evtn;
-    scaleOneBin(h_rpcf_hit_flux_per_layer, t, scale);
-    scaleOneBin(h_rpcf_clu_flux_per_layer, t, scale);
-
-    scale = bxrate * n_pu * f_full_bx /rpcf_radial_segm[t]/2/evtn/1000;
-    scaleOneBin(h_rpcf_hit_rate_per_ch, t, scale);
-    scaleOneBin(h_rpcf_clu_rate_per_ch, t, scale);
-  }
-
-  
-  if (do_rpc_) for (int t=0; t <= RPCB_TYPES; t++)
-  {
-    h_rpcb_total_area->SetBinContent(t, areas_.rpcb_total_areas_cm2[t]);
-  }
-  h_rpcb_total_area->SetBinContent(RPCB_TYPES+1, evtn); // store it in overflow
-  h_rpcb_total_area->SetEntries(RPCB_TYPES+2);
-
-  h_rpcb_hit_flux_per_layer->Sumw2();
-  if (do_rpc_) for (int t=1; t<=RPCB_TYPES; t++)
-  {
-    scale = bxrate * n_pu * f_full_bx /areas_.rpcb_total_areas_cm2[t]/evtn;
-    scaleOneBin(h_rpcb_hit_flux_per_layer, t, scale);
-    scaleOneBin(h_rpcb_clu_flux_per_layer, t, scale);
-
-    scale = bxrate * n_pu * f_full_bx /rpcb_radial_segm[t]/evtn/1000;
-    scaleOneBin(h_rpcb_hit_rate_per_ch, t, scale);
-    scaleOneBin(h_rpcb_clu_rate_per_ch, t, scale);
-  }
-
-
-  if (do_dt_) for (int t=0; t <= DT_TYPES; t++)
-  {
-    h_dt_total_area->SetBinContent(t, areas_.dt_total_areas_cm2[t]);
-  }
-  h_dt_total_area->SetBinContent(DT_TYPES+1, evtn); // store it in overflow
-  h_dt_total_area->SetEntries(DT_TYPES+2);
-
-  h_dt_hit_flux_per_layer->Sumw2();
-  h_dt_hit_rate_per_ch->Sumw2();
-  if (do_dt_) for (int t=1; t<=DT_TYPES; t++)
-  {
-    // 2 endcaps , 6 layers
-    scale = bxrate * n_pu * f_full_bx /areas_.dt_total_areas_cm2[t] /evtn;
-    scaleOneBin(h_dt_hit_flux_per_layer, t, scale);
-
-    scale = bxrate * n_pu * f_full_bx /dt_radial_segm[t]/evtn/1000.;
-    scaleOneBin(h_dt_hit_rate_per_ch, t, scale);
-  }
-  if (do_dt_) for (int i=0; i<3; i++)
-  {
-    gr_dt_hit_flux_mb1->SetPoint(i, areas_.dt_ch_z[i+1], h_dt_hit_flux_per_layer->GetBinContent(i+1) );
-    gr_dt_hit_flux_mb2->SetPoint(i, areas_.dt_ch_z[i+4], h_dt_hit_flux_per_layer->GetBinContent(i+4) );
-    gr_dt_hit_flux_mb3->SetPoint(i, areas_.dt_ch_z[i+7], h_dt_hit_flux_per_layer->GetBinContent(i+7) );
-    gr_dt_hit_flux_mb4->SetPoint(i, areas_.dt_ch_z[i+10], h_dt_hit_flux_per_layer->GetBinContent(i+10) );
-    gr_dt_hit_flux_mb1->SetPointError(i, areas_.dt_ch_halfspanz[i+1], h_dt_hit_flux_per_layer->GetBinError(i+1) );
-    gr_dt_hit_flux_mb2->SetPointError(i, areas_.dt_ch_halfspanz[i+4], h_dt_hit_flux_per_layer->GetBinError(i+4) );
-    gr_dt_hit_flux_mb3->SetPointError(i, areas_.dt_ch_halfspanz[i+7], h_dt_hit_flux_per_layer->GetBinError(i+7) );
-    gr_dt_hit_flux_mb4->SetPointError(i, areas_.dt_ch_halfspanz[i+10], h_dt_hit_flux_per_layer->GetBinError(i+10) );
-  }
-
-}
-
-
-// ================================================================================================
-std::vector<std::vector<MyCSCSimHit> > MuSimHitOccupancy::clusterCSCHitsInLayer(std::vector<MyCSCSimHit> &hits)
-{
-  /* Does recursive clustering:
-      - sort by WG,Strip,TOF
-      - take first hit
-      - cluster the other hits around it by requiring dWG<2 && dS<4 && dTOF<2ns
-      - recursively call itself over the hits that didn't get into the cluster
-  */
-  using namespace std;
-
-  vector< vector<MyCSCSimHit> > result;
-  vector<MyCSCSimHit> cluster;
-  size_t N = hits.size();
-  cout<<" clusterCSC: #hits="<<N<<endl;
-  if (N==0) {cout<<"  DONE 0???"<<endl;  return result;}
-
-  sort(hits.begin(), hits.end());
-  MyCSCSimHit sh1 = hits[0];
-  cout<<"    hit  1: t="<<sh1.t<<" w="<<sh1.w<<" s="<<sh1.s<<endl;
-  cluster.push_back(sh1);
-  if (N==1)
+  MuOccupancyExposure exposure;
+  exposure.njobs = 1;
+  exposure.evtn = evtn;
+  exposure.nevt_with_cscsh = nevt_with_cscsh;
+  exposure.nevt_with_cscsh_in_rpc = nevt_with_cscsh_in_rpc;
+  exposure.n_cscsh = n_cscsh;
+  exposure.n_cscsh_in_rpc = n_cscsh_in_rpc;
+  exposure.nevt_with_gemsh = nevt_with_gemsh;
+  exposure.n_gemsh = n_gemsh;
+  exposure.nevt_with_rpcsh = nevt_with_rpcsh;
+  exposure.nevt_with_rpcsh_e = nevt_with_rpcsh_e;
+  exposure.nevt_with_rpcsh_b = nevt_with_rpcsh_b;
+  exposure.n_rpcsh = n_rpcsh;
+  exposure.n_rpcsh_e = n_rpcsh_e;
+  exposure.n_rpcsh_b = n_rpcsh_b;
+  exposure.nevt_with_dtsh = nevt_with_dtsh;
+  exposure.n_dtsh = n_dtsh;
+
+  exposure.input_is_neutrons = input_is_neutrons_;
+  exposure.do_csc = do_csc_;
+  exposure.do_gem = do_gem_;
+  exposure.do_rpc = do_rpc_;
+  exposure.do_dt = do_dt_;
+  exposure.normalized = normalize_in_job_;
+
+  if (areas_)
   {
-    result.push_back(cluster);
-    cout<<"  DONE"<<endl;
-    return result;
-  }
-
-  vector<MyCSCSimHit> not_clustered;
-  for (size_t i=1; i<N; i++)
-  {
-    MyCSCSimHit shi = hits[i];
-    cout<<"    hit  "<<i<<": t="<<shi.t<<" w="<<shi.w<<" s="<<shi.s<<"   ";
-    if ( fabs(sh1.t - shi.t) > 2 || abs(sh1.w - shi.w) > 1 || abs(sh1.s - shi.s) > 3 ) {
-      not_clustered.push_back(shi);
-      cout<<"NO"<<endl;
-    }
-    else {cluster.push_back(shi); cout<<"ok"<<endl;}
-  }
-  result.push_back(cluster);
-  cout<<"     made cluster of size "<<cluster.size()<<endl;
-
-  if (not_clustered.size())
-  {
-    cout<<"   recursing..."<<endl;
-    vector< vector<MyCSCSimHit> > result_recursive = clusterCSCHitsInLayer(not_clustered);
-    result.insert(result.end(), result_recursive.begin(), result_recursive.end());
-  }
-  cout<<"   returning "<<result.size()<<" clusters"<<endl;
-  return result;
-}
-
-
-
-// ================================================================================================
-std::vector<std::vector<MyGEMSimHit> > MuSimHitOccupancy::clusterGEMHitsInPart(std::vector<MyGEMSimHit> &hits)
-{
-  /* Does recursive clustering:
-      - sort by Strip,TOF
-      - take first hit
-      - cluster the other hits around it by requiring dS<4 && dTOF<4ns
-      - recursively call itself over the hits that didn't get into the cluster
-  */
-  using namespace std;
-
-  vector< vector<MyGEMSimHit> > result;
-  vector<MyGEMSimHit> cluster;
-  size_t N = hits.size();
-  cout<<" clusterGEM: #hits="<<N<<endl;
-  if (N==0) {cout<<"  DONE 0???"<<endl;  return result;}
-
-  sort(hits.begin(), hits.end());
-  MyGEMSimHit sh1 = hits[0];
-  cout<<"    hit  1: t="<<sh1.t<<" s="<<sh1.s<<endl;
-  cluster.push_back(sh1);
-  if (N==1)
-  {
-    result.push_back(cluster);
-    cout<<"  DONE"<<endl;
-    return result;
-  }
-
-  vector<MyGEMSimHit> not_clustered;
-  for (size_t i=1; i<N; i++)
-  {
-    MyGEMSimHit &shi = hits[i];
-    cout<<"    hit  "<<i<<": t="<<shi.t<<" s="<<shi.s<<"   ";
-    if ( fabs(sh1.t - shi.t) > 4. || abs(sh1.s - shi.s) > 3 ) {
-      not_clustered.push_back(shi);
-      cout<<"NO"<<endl;
+    if (do_csc_) for (int t=0; t <= CSC_TYPES; t++) exposure.csc_total_areas_cm2[t] = areas_->csc_total_areas_cm2[t];
+    if (do_gem_) for (int t=0; t <= GEM_TYPES; t++) exposure.gem_total_areas_cm2[t] = areas_->gem_total_areas_cm2[t];
+    if (do_rpc_) for (int t=0; t <= RPCF_TYPES; t++) exposure.rpcf_total_areas_cm2[t] = areas_->rpcf_total_areas_cm2[t];
+    if (do_rpc_) for (int t=0; t <= RPCB_TYPES; t++) exposure.rpcb_total_areas_cm2[t] = areas_->rpcb_total_areas_cm2[t];
+    if (do_dt_)  for (int t=0; t <= DT_TYPES; t++) exposure.dt_total_areas_cm2[t] = areas_->dt_total_areas_cm2[t];
+    if (do_gem_) for (size_t i=0; i < areas_->gem_total_part_areas_cm2[1].size() && i < GEM_PART_SLOTS; i++)
+    {
+      exposure.ge11_part_areas_cm2[i] = areas_->gem_total_part_areas_cm2[1][i];
+      exposure.ge11_part_radius[i] = areas_->gem_part_radius[1][i];
+      exposure.ge11_part_halfheight[i] = areas_->gem_part_halfheight[1][i];
     }
-    else {cluster.push_back(shi); cout<<"ok"<<endl;}
   }
-  result.push_back(cluster);
-  cout<<"     made cluster of size "<<cluster.size()<<endl;
-
-  if (not_clustered.size())
+  for (int t=0; t <= CSC_TYPES; t++)
   {
-    cout<<"   recursing..."<<endl;
-    vector< vector<MyGEMSimHit> > result_recursive = clusterGEMHitsInPart(not_clustered);
-    result.insert(result.end(), result_recursive.begin(), result_recursive.end());
+    exposure.csc_ch_radius[t] = MuGeometryAreas::csc_ch_radius[t];
+    exposure.csc_ch_halfheight[t] = MuGeometryAreas::csc_ch_halfheight[t];
   }
-  cout<<"   returning "<<result.size()<<" clusters"<<endl;
-  return result;
-}
-
-// ================================================================================================
-std::vector<std::vector<MyRPCSimHit> > MuSimHitOccupancy::clusterRPCHitsInRoll(std::vector<MyRPCSimHit> &hits)
-{
-  /* Does recursive clustering:
-      - sort by Strip,TOF
-      - take first hit
-      - cluster the other hits around it by requiring dS<3 && dTOF<2ns
-      - recursively call itself over the hits that didn't get into the cluster
-  */
-  using namespace std;
-
-  vector< vector<MyRPCSimHit> > result;
-  vector<MyRPCSimHit> cluster;
-  size_t N = hits.size();
-  cout<<" clusterRPC: #hits="<<N<<endl;
-  if (N==0) {cout<<"  DONE 0???"<<endl;  return result;}
-
-  sort(hits.begin(), hits.end());
-  MyRPCSimHit sh1 = hits[0];
-  cout<<"    hit  1: t="<<sh1.t<<" s="<<sh1.s<<endl;
-  cluster.push_back(sh1);
-  if (N==1)
+  for (int t=0; t <= DT_TYPES; t++)
   {
-    result.push_back(cluster);
-    cout<<"  DONE"<<endl;
-    return result;
+    exposure.dt_ch_z[t] = MuGeometryAreas::dt_ch_z[t];
+    exposure.dt_ch_halfspanz[t] = MuGeometryAreas::dt_ch_halfspanz[t];
   }
 
-  vector<MyRPCSimHit> not_clustered;
-  for (size_t i=1; i<N; i++)
-  {
-    MyRPCSimHit shi = hits[i];
-    cout<<"    hit  "<<i<<": t="<<shi.t<<" s="<<shi.s<<"   ";
-    if ( fabs(sh1.t - shi.t) > 2 || abs(sh1.s - shi.s) > 2 ) {
-      not_clustered.push_back(shi);
-      cout<<"NO"<<endl;
-    }
-    else {cluster.push_back(shi); cout<<"ok"<<endl;}
-  }
-  result.push_back(cluster);
-  cout<<"     made cluster of size "<<cluster.size()<<endl;
+  exposure.print();
 
-  if (not_clustered.size())
-  {
-    cout<<"   recursing..."<<endl;
-    vector< vector<MyRPCSimHit> > result_recursive = clusterRPCHitsInRoll(not_clustered);
-    result.insert(result.end(), result_recursive.begin(), result_recursive.end());
-  }
-  cout<<"   returning "<<result.size()<<" clusters"<<endl;
-  return result;
+  edm::Service<TFileService> fs;
+  TTree* exposure_tree = fs->make<TTree>("MuOccupancyExposure", "MuOccupancyExposure");
+  exposure.book(exposure_tree);
+  exposure_tree->Fill();
+
+  // ---- calculate fractions, fluxes per cm2 and rates per chamber at L=10^34 ----
+  // or keep the raw counts (with their Sumw2) to be merged with the other jobs first
+  if (normalize_in_job_) MuOccupancyNormalizer::normalize(fs->getBareDirectory(), exposure, MuOccupancyScale(input_is_neutrons_));
+  else MuOccupancyNormalizer::sumw2(fs->getBareDirectory());
 }
 
 
@@ -4,6 +4,12 @@
 #include "TChain.h" 
 #include "TBranch.h" 
 
+#include "FWCore/Utilities/interface/Exception.h"
+
+#include <deque>
+#include <string>
+#include <vector>
+
 typedef std::vector<std::vector<Float_t> > vvfloat;
 typedef std::vector<std::vector<Int_t> > vvint;
 typedef std::vector<Float_t> vfloat;
@@ -12,9 +18,18 @@ typedef std::vector<Int_t> vint;
 struct MyNtuple
 {
   void init(); // initialize to default values
-  TTree* book(TTree *t, const std::string & name = "trk_eff");
+  // flat = true books the nested collections in the flat layout (see flatten)
+  TTree* book(TTree *t, const std::string & name = "trk_eff", bool flat = false);
   void initialize();
 
+  // In the flat layout every vvint/vvfloat member <group>_<field> is written
+  // as one array with the values of all tracks, and each group of
+  // collections filled together (gem_sh, csc_alct, ...) gets one
+  // <group>_offsets array: the values of track i are [offsets[i], offsets[i+1]).
+  // No nested STL collections are streamed; FlatNtupleReader reads it back.
+  // Call flatten() before every TTree::Fill; it does nothing in the nested layout.
+  void flatten();
+
   // event
   Float_t eventNumber;
 
@@ -166,10 +181,40 @@ struct MyNtuple
   // number of TF 
   
   // CSC 
+
+  // flat layout
+  template <class T>
+  struct FlatColumn
+  {
+    std::vector<std::vector<T> >* nested;
+    std::vector<T> values;
+    unsigned group;
+  };
+  struct FlatGroup
+  {
+    std::string name;
+    vint offsets;
+    bool filled;
+  };
+
+  template <class T>
+  void bookNested(TTree *t, const std::string & name, std::vector<std::vector<T> > & nested,
+                  std::deque<FlatColumn<T> > & columns);
+  void bookNested(TTree *t, const std::string & name, vvint & nested) {bookNested(t, name, nested, flatInts_);}
+  void bookNested(TTree *t, const std::string & name, vvfloat & nested) {bookNested(t, name, nested, flatFloats_);}
+  template <class T>
+  void flatten(std::deque<FlatColumn<T> > & columns);
+
+  bool flat_;
+  // deques, so that the branch addresses stay valid while booking
+  std::deque<FlatGroup> flatGroups_;
+  std::deque<FlatColumn<Int_t> > flatInts_;
+  std::deque<FlatColumn<Float_t> > flatFloats_;
 };
 
-TTree* MyNtuple::book(TTree *t, const std::string & name)
+TTree* MyNtuple::book(TTree *t, const std::string & name, bool flat)
 {
+  flat_ = flat;
   edm::Service< TFileService > fs;
   t = fs->make<TTree>(name.c_str(), name.c_str());
 
@@ -208,105 +253,173 @@ TTree* MyNtuple::book(TTree *t, const std::string & name)
   t->Branch("st_n_l1ExtraAll",&st_n_l1ExtraAll);
   t->Branch("st_n_l1ExtraBest",&st_n_l1ExtraBest);
   
-  t->Branch("gem_sh_detUnitId", &gem_sh_detUnitId);
-  t->Branch("gem_sh_particleType",&gem_sh_particleType);
-  t->Branch("gem_sh_lx",&gem_sh_lx);
-  t->Branch("gem_sh_ly",&gem_sh_ly);
-  t->Branch("gem_sh_energyLoss",&gem_sh_energyLoss);
-  t->Branch("gem_sh_pabs",&gem_sh_pabs);
-  t->Branch("gem_sh_timeOfFlight",&gem_sh_timeOfFlight);
-  t->Branch("gem_sh_detId",&gem_sh_detId);
-  t->Branch("gem_sh_gx",&gem_sh_gx);
-  t->Branch("gem_sh_gz",&gem_sh_gz);
-  t->Branch("gem_sh_gr",&gem_sh_gr);
-  t->Branch("gem_sh_geta",&gem_sh_geta);
-  t->Branch("gem_sh_gphi",&gem_sh_gphi);
-  t->Branch("gem_sh_strip",&gem_sh_strip);
-
-  t->Branch("gem_dg_detId",&gem_dg_detId);
-  t->Branch("gem_dg_strip",&gem_dg_strip);
-  t->Branch("gem_dg_bx",&gem_dg_bx);
-  t->Branch("gem_dg_lx",&gem_dg_lx);
-  t->Branch("gem_dg_ly",&gem_dg_ly);
-  t->Branch("gem_dg_gr",&gem_dg_gr);
-  t->Branch("gem_dg_geta",&gem_dg_geta);
-  t->Branch("gem_dg_gphi",&gem_dg_gphi);
-  t->Branch("gem_dg_gx",&gem_dg_gx);
-  t->Branch("gem_dg_gy",&gem_dg_gy);
-  t->Branch("gem_dg_gz",&gem_dg_gz);
-
-  t->Branch("gem_pad_detId",&gem_pad_detId);
-  t->Branch("gem_pad_strip",&gem_pad_strip);
-  t->Branch("gem_pad_bx",&gem_pad_bx);
-  t->Branch("gem_pad_lx",&gem_pad_lx);
-  t->Branch("gem_pad_ly",&gem_pad_ly);
-  t->Branch("gem_pad_gr",&gem_pad_gr);
-  t->Branch("gem_pad_geta",&gem_pad_geta);
-  t->Branch("gem_pad_gphi",&gem_pad_gphi);
-  t->Branch("gem_pad_gx",&gem_pad_gx);
-  t->Branch("gem_pad_gy",&gem_pad_gy);
-  t->Branch("gem_pad_gz",&gem_pad_gz);
-  t->Branch("gem_pad_is_l1",&gem_pad_is_l1);
-  t->Branch("gem_pad_is_copad",&gem_pad_is_copad);
-
-  t->Branch("csc_sh_detUnitId",&csc_sh_detUnitId);
-  t->Branch("csc_sh_particleType",&csc_sh_particleType);
-  t->Branch("csc_sh_lx",&csc_sh_lx);
-  t->Branch("csc_sh_ly",&csc_sh_ly);
-  t->Branch("csc_sh_energyLoss",&csc_sh_energyLoss);
-  t->Branch("csc_sh_pabs",&csc_sh_pabs);
-  t->Branch("csc_sh_timeOfFlight",&csc_sh_timeOfFlight);
-  t->Branch("csc_sh_gx",&csc_sh_gx);
-  t->Branch("csc_sh_gy",&csc_sh_gy);
-  t->Branch("csc_sh_gz",&csc_sh_gz);
-  t->Branch("csc_sh_gr",&csc_sh_gr);
-  t->Branch("csc_sh_geta",&csc_sh_geta);
-  t->Branch("csc_sh_gphi",&csc_sh_gphi);
-  t->Branch("csc_sh_strip",&csc_sh_strip);
-  t->Branch("csc_sh_wire",&csc_sh_wire);
-
-  t->Branch("csc_alct_valid",&csc_alct_valid);
-  t->Branch("csc_alct_quality",&csc_alct_quality);
-  t->Branch("csc_alct_accel",&csc_alct_accel);
-  t->Branch("csc_alct_keywire",&csc_alct_keywire);
-  t->Branch("csc_alct_bx",&csc_alct_bx);
-  t->Branch("csc_alct_trknmb",&csc_alct_trknmb);
-  t->Branch("csc_alct_fullbx",&csc_alct_fullbx);
-  t->Branch("csc_alct_detId",&csc_alct_detId);
-  t->Branch("csc_alct_isGood",&csc_alct_isGood);
-  t->Branch("csc_alct_deltaOk",&csc_alct_deltaOk);
-
-  t->Branch("csc_clct_valid",&csc_clct_valid);
-  t->Branch("csc_clct_quality",&csc_clct_quality);
-  t->Branch("csc_clct_pattern",&csc_clct_pattern);
-  t->Branch("csc_clct_bend",&csc_clct_bend);
-  t->Branch("csc_clct_strip",&csc_clct_strip);
-  t->Branch("csc_clct_bx",&csc_clct_bx);
-  t->Branch("csc_clct_trknmb",&csc_clct_trknmb);
-  t->Branch("csc_clct_fullbx",&csc_clct_fullbx);
-  t->Branch("csc_clct_isGood",&csc_clct_isGood);
-  t->Branch("csc_clct_detId",&csc_clct_detId);
-  t->Branch("csc_clct_deltaOk",&csc_clct_deltaOk);
-
-  t->Branch("csc_tmblct_trknmb",&csc_tmblct_trknmb);
-  t->Branch("csc_tmblct_valid",&csc_tmblct_valid);
-  t->Branch("csc_tmblct_quality",&csc_tmblct_quality);
-  t->Branch("csc_tmblct_keywire",&csc_tmblct_keywire);
-  t->Branch("csc_tmblct_strip",&csc_tmblct_strip);
-  t->Branch("csc_tmblct_pattern",&csc_tmblct_pattern);
-  t->Branch("csc_tmblct_bend",&csc_tmblct_bend);
-  t->Branch("csc_tmblct_bx",&csc_tmblct_bx);
-  t->Branch("csc_tmblct_mpclink",&csc_tmblct_mpclink);
-  t->Branch("csc_tmblct_gemDPhi",&csc_tmblct_gemDPhi);
-  t->Branch("csc_tmblct_isAlctGood",&csc_tmblct_isAlctGood);
-  t->Branch("csc_tmblct_isClctGood",&csc_tmblct_isClctGood);
-  t->Branch("csc_tmblct_detId",&csc_tmblct_detId);
-  t->Branch("csc_tmblct_gemDPhi",&csc_tmblct_gemDPhi);
-  t->Branch("csc_tmblct_hasGEM",&csc_tmblct_hasGEM);
+  bookNested(t, "gem_sh_detUnitId", gem_sh_detUnitId);
+  bookNested(t, "gem_sh_particleType", gem_sh_particleType);
+  bookNested(t, "gem_sh_lx", gem_sh_lx);
+  bookNested(t, "gem_sh_ly", gem_sh_ly);
+  bookNested(t, "gem_sh_energyLoss", gem_sh_energyLoss);
+  bookNested(t, "gem_sh_pabs", gem_sh_pabs);
+  bookNested(t, "gem_sh_timeOfFlight", gem_sh_timeOfFlight);
+  bookNested(t, "gem_sh_detId", gem_sh_detId);
+  bookNested(t, "gem_sh_gx", gem_sh_gx);
+  bookNested(t, "gem_sh_gz", gem_sh_gz);
+  bookNested(t, "gem_sh_gr", gem_sh_gr);
+  bookNested(t, "gem_sh_geta", gem_sh_geta);
+  bookNested(t, "gem_sh_gphi", gem_sh_gphi);
+  bookNested(t, "gem_sh_strip", gem_sh_strip);
+
+  bookNested(t, "gem_dg_detId", gem_dg_detId);
+  bookNested(t, "gem_dg_strip", gem_dg_strip);
+  bookNested(t, "gem_dg_bx", gem_dg_bx);
+  bookNested(t, "gem_dg_lx", gem_dg_lx);
+  bookNested(t, "gem_dg_ly", gem_dg_ly);
+  bookNested(t, "gem_dg_gr", gem_dg_gr);
+  bookNested(t, "gem_dg_geta", gem_dg_geta);
+  bookNested(t, "gem_dg_gphi", gem_dg_gphi);
+  bookNested(t, "gem_dg_gx", gem_dg_gx);
+  bookNested(t, "gem_dg_gy", gem_dg_gy);
+  bookNested(t, "gem_dg_gz", gem_dg_gz);
+
+  bookNested(t, "gem_pad_detId", gem_pad_detId);
+  bookNested(t, "gem_pad_strip", gem_pad_strip);
+  bookNested(t, "gem_pad_bx", gem_pad_bx);
+  bookNested(t, "gem_pad_lx", gem_pad_lx);
+  bookNested(t, "gem_pad_ly", gem_pad_ly);
+  bookNested(t, "gem_pad_gr", gem_pad_gr);
+  bookNested(t, "gem_pad_geta", gem_pad_geta);
+  bookNested(t, "gem_pad_gphi", gem_pad_gphi);
+  bookNested(t, "gem_pad_gx", gem_pad_gx);
+  bookNested(t, "gem_pad_gy", gem_pad_gy);
+  bookNested(t, "gem_pad_gz", gem_pad_gz);
+  bookNested(t, "gem_pad_is_l1", gem_pad_is_l1);
+  bookNested(t, "gem_pad_is_copad", gem_pad_is_copad);
+
+  bookNested(t, "csc_sh_detUnitId", csc_sh_detUnitId);
+  bookNested(t, "csc_sh_particleType", csc_sh_particleType);
+  bookNested(t, "csc_sh_lx", csc_sh_lx);
+  bookNested(t, "csc_sh_ly", csc_sh_ly);
+  bookNested(t, "csc_sh_energyLoss", csc_sh_energyLoss);
+  bookNested(t, "csc_sh_pabs", csc_sh_pabs);
+  bookNested(t, "csc_sh_timeOfFlight", csc_sh_timeOfFlight);
+  bookNested(t, "csc_sh_gx", csc_sh_gx);
+  bookNested(t, "csc_sh_gy", csc_sh_gy);
+  bookNested(t, "csc_sh_gz", csc_sh_gz);
+  bookNested(t, "csc_sh_gr", csc_sh_gr);
+  bookNested(t, "csc_sh_geta", csc_sh_geta);
+  bookNested(t, "csc_sh_gphi", csc_sh_gphi);
+  bookNested(t, "csc_sh_strip", csc_sh_strip);
+  bookNested(t, "csc_sh_wire", csc_sh_wire);
+
+  bookNested(t, "csc_alct_valid", csc_alct_valid);
+  bookNested(t, "csc_alct_quality", csc_alct_quality);
+  bookNested(t, "csc_alct_accel", csc_alct_accel);
+  bookNested(t, "csc_alct_keywire", csc_alct_keywire);
+  bookNested(t, "csc_alct_bx", csc_alct_bx);
+  bookNested(t, "csc_alct_trknmb", csc_alct_trknmb);
+  bookNested(t, "csc_alct_fullbx", csc_alct_fullbx);
+  bookNested(t, "csc_alct_detId", csc_alct_detId);
+  bookNested(t, "csc_alct_isGood", csc_alct_isGood);
+  bookNested(t, "csc_alct_deltaOk", csc_alct_deltaOk);
+
+  bookNested(t, "csc_clct_valid", csc_clct_valid);
+  bookNested(t, "csc_clct_quality", csc_clct_quality);
+  bookNested(t, "csc_clct_pattern", csc_clct_pattern);
+  bookNested(t, "csc_clct_bend", csc_clct_bend);
+  bookNested(t, "csc_clct_strip", csc_clct_strip);
+  bookNested(t, "csc_clct_bx", csc_clct_bx);
+  bookNested(t, "csc_clct_trknmb", csc_clct_trknmb);
+  bookNested(t, "csc_clct_fullbx", csc_clct_fullbx);
+  bookNested(t, "csc_clct_isGood", csc_clct_isGood);
+  bookNested(t, "csc_clct_detId", csc_clct_detId);
+  bookNested(t, "csc_clct_deltaOk", csc_clct_deltaOk);
+
+  bookNested(t, "csc_tmblct_trknmb", csc_tmblct_trknmb);
+  bookNested(t, "csc_tmblct_valid", csc_tmblct_valid);
+  bookNested(t, "csc_tmblct_quality", csc_tmblct_quality);
+  bookNested(t, "csc_tmblct_keywire", csc_tmblct_keywire);
+  bookNested(t, "csc_tmblct_strip", csc_tmblct_strip);
+  bookNested(t, "csc_tmblct_pattern", csc_tmblct_pattern);
+  bookNested(t, "csc_tmblct_bend", csc_tmblct_bend);
+  bookNested(t, "csc_tmblct_bx", csc_tmblct_bx);
+  bookNested(t, "csc_tmblct_mpclink", csc_tmblct_mpclink);
+  bookNested(t, "csc_tmblct_gemDPhi", csc_tmblct_gemDPhi);
+  bookNested(t, "csc_tmblct_isAlctGood", csc_tmblct_isAlctGood);
+  bookNested(t, "csc_tmblct_isClctGood", csc_tmblct_isClctGood);
+  bookNested(t, "csc_tmblct_detId", csc_tmblct_detId);
+  bookNested(t, "csc_tmblct_gemDPhi", csc_tmblct_gemDPhi);
+  bookNested(t, "csc_tmblct_hasGEM", csc_tmblct_hasGEM);
 
   return t;
 }
 
+template <class T>
+void MyNtuple::bookNested(TTree *t, const std::string & name, std::vector<std::vector<T> > & nested,
+                          std::deque<FlatColumn<T> > & columns)
+{
+  if (!flat_) {
+    t->Branch(name.c_str(), &nested);
+    return;
+  }
+  // the group is the name up to the second underscore, e.g. csc_sh for csc_sh_lx
+  const std::string group(name.substr(0, name.find('_', name.find('_') + 1)));
+  unsigned g = 0;
+  while (g < flatGroups_.size() && flatGroups_[g].name != group) ++g;
+  if (g == flatGroups_.size()) {
+    FlatGroup newGroup;
+    newGroup.name = group;
+    newGroup.filled = false;
+    flatGroups_.push_back(newGroup);
+    t->Branch((group + "_offsets").c_str(), &flatGroups_.back().offsets);
+  }
+  // the same branch booked twice points to the same column
+  for (unsigned c = 0; c < columns.size(); ++c) if (columns[c].nested == &nested) return;
+  FlatColumn<T> column;
+  column.nested = &nested;
+  column.group = g;
+  columns.push_back(column);
+  t->Branch(name.c_str(), &columns.back().values);
+}
+
+void MyNtuple::flatten()
+{
+  if (!flat_) return;
+  for (unsigned g = 0; g < flatGroups_.size(); ++g) {
+    flatGroups_[g].offsets.assign(1, 0);
+    flatGroups_[g].filled = false;
+  }
+  flatten(flatInts_);
+  flatten(flatFloats_);
+}
+
+template <class T>
+void MyNtuple::flatten(std::deque<FlatColumn<T> > & columns)
+{
+  for (unsigned c = 0; c < columns.size(); ++c) {
+    FlatColumn<T> & column(columns[c]);
+    FlatGroup & group(flatGroups_[column.group]);
+    const std::vector<std::vector<T> > & nested(*column.nested);
+    column.values.clear();
+    // collections that are not filled at all are written empty
+    if (nested.empty()) continue;
+
+    // the first filled collection of a group defines the offsets
+    if (!group.filled) {
+      for (unsigned i = 0; i < nested.size(); ++i) group.offsets.push_back(group.offsets.back() + nested[i].size());
+      group.filled = true;
+    }
+    if (nested.size() + 1 != group.offsets.size())
+      throw cms::Exception("MyNtuple") << "flatten: " << group.name << " collections filled for "
+                                       << group.offsets.size() - 1 << " and " << nested.size() << " tracks";
+    column.values.reserve(group.offsets.back());
+    for (unsigned i = 0; i < nested.size(); ++i) {
+      if (Int_t(nested[i].size()) != group.offsets[i+1] - group.offsets[i])
+        throw cms::Exception("MyNtuple") << "flatten: " << group.name << " collections of track " << i
+                                         << " have different sizes";
+      column.values.insert(column.values.end(), nested[i].begin(), nested[i].end());
+    }
+  }
+}
+
 void MyNtuple::initialize()
 {
   eventNumber = 0;
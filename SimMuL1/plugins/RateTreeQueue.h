@@ -0,0 +1,92 @@
+#ifndef SimMuL1_RateTreeQueue_h
+#define SimMuL1_RateTreeQueue_h
+
+/**\class RateTreeQueue
+
+ Description: per-event buffer between the producers of rate tree rows and
+ the TTree they belong to
+
+ Every tree of GEMCSCTriggerRateTree has one producer, the analyzeXRate
+ function that owns its row struct. In parallelFill mode some producers run
+ on the worker threads of the module, which must not touch the trees of the
+ TFileService file, so fill() only stores a copy of the row. The module thread
+ writes the stored rows with drain() once all producers of the event are done.
+
+ In direct mode fill() is simply TTree::Fill(). In queued mode the branches are
+ rebound to a private row that drain() copies the stored rows into, so the
+ producer row can keep changing while rows are stored.
+
+*/
+
+#include "TTree.h"
+#include "TBranch.h"
+#include "TObjArray.h"
+
+#include <vector>
+
+template <class Row>
+class RateTreeQueue
+{
+ public:
+
+  RateTreeQueue() : tree_(nullptr), row_(nullptr), queued_(false) {}
+
+  RateTreeQueue(const RateTreeQueue&) = delete;
+  RateTreeQueue& operator=(const RateTreeQueue&) = delete;
+
+  /// tree whose branches point to the members of row
+  void setTree(TTree* tree, Row* row)
+  {
+    tree_ = tree;
+    row_ = row;
+  }
+
+  /// switch to queued mode, reserving room for capacity rows per event;
+  /// must be called before the first fill()
+  void enableQueue(unsigned int capacity)
+  {
+    if (tree_ == nullptr) return;
+    rows_.reserve(capacity);
+
+    // same layout, so every branch moves by the same offset
+    char* from = reinterpret_cast<char*>(row_);
+    char* to = reinterpret_cast<char*>(&out_);
+    TObjArray* branches = tree_->GetListOfBranches();
+    for (int i = 0; i < branches->GetEntriesFast(); ++i) {
+      TBranch* b = static_cast<TBranch*>(branches->UncheckedAt(i));
+      b->SetAddress(to + (b->GetAddress() - from));
+    }
+    queued_ = true;
+  }
+
+  /// producer side: write the current content of the row
+  void fill()
+  {
+    if (!queued_) tree_->Fill();
+    else rows_.push_back(*row_);
+  }
+
+  /// module thread: write all rows stored so far, returns the number of rows written
+  unsigned int drain()
+  {
+    const unsigned int n = rows_.size();
+    for (const auto& row: rows_) {
+      out_ = row;
+      tree_->Fill();
+    }
+    rows_.clear();
+    return n;
+  }
+
+  bool empty() const { return rows_.empty(); }
+
+ private:
+
+  TTree* tree_;
+  Row* row_;
+  Row out_;
+  bool queued_;
+  std::vector<Row> rows_;
+};
+
+#endif
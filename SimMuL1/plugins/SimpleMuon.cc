@@ -98,7 +98,8 @@ private:
                            const CSCALCTDigiCollection*, const CSCWireDigiCollection*);
   unsigned matchCSCAnodeHits(const std::vector<CSCAnodeLayerInfo>& , 
                              std::vector<PSimHit> &); 
-  bool compareSimHits(PSimHit &, PSimHit &);
+  bool compareSimHits(const PSimHit &, const PSimHit &);
+  int countSharedHits(MatchCSCMuL1 *, const CSCDetId &, const std::vector<PSimHit> &);
   void matchSimTrack2CLCTs( MatchCSCMuL1 *, 
                             const edm::PSimHitContainer* , 
                             const CSCCLCTDigiCollection *, 
@@ -202,6 +203,8 @@ private:
   std::vector<const CSCCorrelatedLCTDigi*> ghostLCTs;
 
   TTree *tree_eff_;
+  // write the nested collections as flat values + offsets arrays
+  bool flatNtuple_;
   MyNtuple etrk_;
 };
 
@@ -280,7 +283,9 @@ SimpleMuon::SimpleMuon(const edm::ParameterSet& iConfig)
   gangedME1a = iConfig.getUntrackedParameter<bool>("gangedME1a", false);
   addGhostLCTs_ = iConfig.getUntrackedParameter< bool >("addGhostLCTs",true);
 
-  tree_eff_ = etrk_.book(tree_eff_,"efficiency");
+  flatNtuple_ = iConfig.getUntrackedParameter<bool>("flatNtuple", false);
+
+  tree_eff_ = etrk_.book(tree_eff_,"efficiency",flatNtuple_);
   etrk_.initialize();
 }
 
@@ -751,7 +756,7 @@ SimpleMuon::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
       //------------------------------------------------------------------------------------------------
       //                               CSC SimHits
       //------------------------------------------------------------------------------------------------
-      std::vector<PSimHit> cscSimHits(match->allSimHits());
+      const MatchCSCMuL1::SimHitView cscSimHits(match->allSimHits());
       if (cscSimHits.size()==0) {
         std::cout << "WARNING: CSC SimHit collection is empty" << std::endl;
         continue;
@@ -790,7 +795,7 @@ SimpleMuon::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
       trk_csc_sh_wire.clear();
       
       for (unsigned i=0; i<cscSimHits.size();i++) {
-        auto mySimHit(cscSimHits.at(i));
+        const PSimHit& mySimHit(cscSimHits[i]);
 
         trk_csc_sh_detUnitId.push_back(mySimHit.detUnitId());
         trk_csc_sh_particleType.push_back(mySimHit.particleType());
@@ -1022,6 +1027,7 @@ SimpleMuon::analyze(const edm::Event& iEvent, const edm::EventSetup& iSetup)
       etrk_.csc_tmblct_mpclink.push_back(trk_csc_tmblct_mpclink);
     }
 
+  etrk_.flatten();
   tree_eff_->Fill();
   
 }
@@ -1330,6 +1336,11 @@ SimpleMuon::matchSimTrack2ALCTs(MatchCSCMuL1 *match,
       //if (id.station()==1&&id.ring()==2) debugALCT=1;
       // ME1/a has ring number 4???
       CSCDetId id1a(id.endcap(),id.station(),4,id.chamber(),0);
+
+      // track hits are the same for all the ALCTs of the chamber
+      const MatchCSCMuL1::SimHitView hitsInChamber(match->chamberHits(id.rawId()));
+      MatchCSCMuL1::SimHitView hitsInChamber1a;
+      if (defaultME1a && id.station()==1 && id.ring()==1) hitsInChamber1a = match->chamberHits(id1a.rawId());
     
       for (CSCALCTDigiCollection::const_iterator digiIt = range.first; digiIt != range.second; digiIt++) 
         {
@@ -1343,9 +1354,9 @@ SimpleMuon::matchSimTrack2ALCTs(MatchCSCMuL1 *match,
           const bool me1a_all(defaultME1a && id.station()==1 && id.ring()==1 && (*digiIt).getKeyWG() <= 15);
           const bool me1a_no_overlap(me1a_all && (*digiIt).getKeyWG() < 10);
      
-          std::vector<PSimHit> trackHitsInChamber = match->chamberHits(id.rawId());
-          std::vector<PSimHit> trackHitsInChamber1a;
-          if (me1a_all) trackHitsInChamber1a = match->chamberHits(id1a.rawId());
+          const MatchCSCMuL1::SimHitView& trackHitsInChamber(hitsInChamber);
+          MatchCSCMuL1::SimHitView trackHitsInChamber1a;
+          if (me1a_all) trackHitsInChamber1a = hitsInChamber1a;
      
           // no point to do any matching here
           if (trackHitsInChamber.size() + trackHitsInChamber1a.size() == 0 )
@@ -1382,7 +1393,9 @@ SimpleMuon::matchSimTrack2ALCTs(MatchCSCMuL1 *match,
           MatchCSCMuL1::ALCT malct1a(match);
           if (me1a_all) {
             //alctInfo1a = alct_analyzer.getSimInfo(*digiIt, id1a, wiredc, allCSCSimHits);
-            nmhits1a = matchCSCAnodeHits(alctInfo, matchedHits1a);
+            // same layer info as for ME1/b, no need to match it again
+            matchedHits1a = matchedHits;
+            nmhits1a = nmhits;
        
             malct1a.trgdigi = &*digiIt;
             malct1a.layerInfo = alctInfo1a;
@@ -1402,35 +1415,8 @@ SimpleMuon::matchSimTrack2ALCTs(MatchCSCMuL1 *match,
             {
               //if (debugALCT) std::cout<<"  --- matched to ALCT hits: "<<std::endl;
        
-              int nHitsMatch = 0;
-              for (unsigned i=0; i<nmhits;i++)
-                {
-                  //if (debugALCT) std::cout<<"   "<<matchedHits[i]<<" "<<matchedHits[i].exitPoint()<<"  "
-                  //                   <<matchedHits[i].momentumAtEntry()<<" "<<matchedHits[i].energyLoss()<<" "
-                  //                   <<matchedHits[i].particleType()<<" "<<matchedHits[i].trackId();
-                  //bool wasmatch = 0;
-                  for (unsigned j=0; j<trackHitsInChamber.size(); j++)
-                    if ( compareSimHits ( matchedHits[i], trackHitsInChamber[j] ) )
-                      {
-                        nHitsMatch++;
-                        //wasmatch = 1;
-                      }
-                  //if (debugALCT)  {if (wasmatch) std::cout<<" --> match!"<<std::endl;  else std::cout<<std::endl;}
-                }
-              malct.nHitsShared = nHitsMatch;
-              if( me1a_all ) {
-                nHitsMatch = 0;
-                for (unsigned i=0; i<nmhits1a;i++) {
-                  //bool wasmatch = 0;
-                  for (unsigned j=0; j<trackHitsInChamber1a.size(); j++)
-                    if ( compareSimHits ( matchedHits1a[i], trackHitsInChamber1a[j] ) )
-                      {
-                        nHitsMatch++;
-                        //wasmatch = 1;
-                      }
-                }
-                malct1a.nHitsShared = nHitsMatch;
-              }
+              malct.nHitsShared = countSharedHits(match, id, matchedHits);
+              if( me1a_all ) malct1a.nHitsShared = countSharedHits(match, id1a, matchedHits1a);
             }
           else if (debugALCT) std::cout<< "  +++ ALCT warning: no simhits for its digi found!\n";
      
@@ -1557,9 +1543,11 @@ SimpleMuon::matchCSCAnodeHits(const std::vector<CSCAnodeLayerInfo>& allLayerInfo
       if (pli->getId().layer() == CSCConstants::KEY_ALCT_LAYER)  continue;
     
       // if there is any occurrence of simHit size greater that zero, use this.
-      if ((pli->getRecDigis()).size() > 0 && (pli->getSimHits()).size() > 0) 
+      // (the layer info returns copies, so take the simhits only once)
+      if ((pli->getRecDigis()).size() == 0) continue;
+      const std::vector<PSimHit> thisLayerHits(pli->getSimHits());
+      if (thisLayerHits.size() > 0) 
         {
-          std::vector<PSimHit> thisLayerHits = pli->getSimHits();
           // There can be several RecDigis and several SimHits in a nonkey layer.
           //if (thisLayerHits.size() != 1) 
           //{
@@ -1581,7 +1569,7 @@ SimpleMuon::matchCSCAnodeHits(const std::vector<CSCAnodeLayerInfo>& allLayerInfo
 
 // ================================================================================================
 bool 
-SimpleMuon::compareSimHits(PSimHit &sh1, PSimHit &sh2)
+SimpleMuon::compareSimHits(const PSimHit &sh1, const PSimHit &sh2)
 {
   int fdebug = 0;
 
@@ -1625,6 +1613,25 @@ SimpleMuon::compareSimHits(PSimHit &sh1, PSimHit &sh2)
 }
 
 
+// ================================================================================================
+int
+SimpleMuon::countSharedHits(MatchCSCMuL1 *match, const CSCDetId &id, const std::vector<PSimHit> &matchedHits)
+{
+  // identical hits are in the same layer, so each matched hit is only compared
+  // to the track hits of its own layer in the chamber
+  int nHitsMatch = 0;
+  for (unsigned i=0; i<matchedHits.size(); i++)
+    {
+      const CSCDetId layerId(matchedHits[i].detUnitId());
+      if (layerId.chamberId() != id.chamberId()) continue;
+      const MatchCSCMuL1::SimHitView trackHitsInLayer(match->layerHits(layerId.rawId()));
+      for (unsigned j=0; j<trackHitsInLayer.size(); j++)
+        if ( compareSimHits ( matchedHits[i], trackHitsInLayer[j] ) ) nHitsMatch++;
+    }
+  return nHitsMatch;
+}
+
+
 // ================================================================================================
 int 
 SimpleMuon::calculate2DStubsDeltas(MatchCSCMuL1 *match, MatchCSCMuL1::ALCT &alct)
@@ -1724,7 +1731,7 @@ SimpleMuon::matchSimTrack2CLCTs(MatchCSCMuL1 *match,
             cid = id1a;
           }
 
-          std::vector<PSimHit> trackHitsInChamber = match->chamberHits(cid.rawId());
+          const MatchCSCMuL1::SimHitView trackHitsInChamber(match->chamberHits(cid.rawId()));
 
           if (trackHitsInChamber.size()==0) // no point to do any matching here
             {
@@ -1763,22 +1770,7 @@ SimpleMuon::matchSimTrack2CLCTs(MatchCSCMuL1 *match,
             {
               //if (debugCLCT) std::cout<<"  --- matched to CLCT hits: "<<std::endl;
 
-              int nHitsMatch = 0;
-              for (unsigned i=0; i<nmhits;i++)
-                {
-                  //if (debugCLCT) std::cout<<"   "<<matchedHits[i]<<" "<<matchedHits[i].exitPoint()<<"  "
-                  //                   <<matchedHits[i].momentumAtEntry()<<" "<<matchedHits[i].energyLoss()<<" "
-                  //                   <<matchedHits[i].particleType()<<" "<<matchedHits[i].trackId();
-                  //bool wasmatch = 0;
-                  for (unsigned j=0; j<trackHitsInChamber.size(); j++)
-                    if ( compareSimHits ( matchedHits[i], trackHitsInChamber[j] ) )
-                      {
-                        nHitsMatch++;
-                        //wasmatch = 1;
-                      }
-                  //if (debugCLCT)  {if (wasmatch) std::cout<<" --> match!"<<std::endl;  else std::cout<<std::endl;}
-                }
-              mclct.nHitsShared = nHitsMatch;
+              mclct.nHitsShared = countSharedHits(match, cid, matchedHits);
             }
           else if (debugCLCT) std::cout<< "  +++ CLCT warning: no simhits for its digi found!\n";
 
@@ -1892,9 +1884,11 @@ SimpleMuon::matchCSCCathodeHits(const std::vector<CSCCathodeLayerInfo>& allLayer
       if (pli->getId().layer() == key_layer)  continue;
     
       // if there is any occurrence of simHit size greater that zero, use this.
-      if ((pli->getRecDigis()).size() > 0 && (pli->getSimHits()).size() > 0) 
+      // (the layer info returns copies, so take the simhits only once)
+      if ((pli->getRecDigis()).size() == 0) continue;
+      const std::vector<PSimHit> thisLayerHits(pli->getSimHits());
+      if (thisLayerHits.size() > 0) 
         {
-          std::vector<PSimHit> thisLayerHits = pli->getSimHits();
           // There can be several RecDigis and several SimHits in a nonkey layer.
           //if (thisLayerHits.size() != 1) 
           //{
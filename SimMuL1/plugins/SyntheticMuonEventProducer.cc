@@ -0,0 +1,131 @@
+/**\class SyntheticMuonEventProducer
+
+ Description:
+
+ Puts the collections of a synthetic muon system event (see SyntheticMuonEventGenerator)
+ into the event, in place of the GEN-SIM-DIGI-L1 inputs of the matchers and of the
+ trigger rate code. Every instance regenerates the event from the same seed and puts
+ the products selected in "products", so that one instance per module label of the
+ full simulation reproduces its InputTags:
+
+   g4SimHits                    SimHits    SimTracks, SimVertices, MuonCSCHits, MuonGEMHits, MuonRPCHits
+   simMuonGEMDigis              GEMDigis   GEMDigiCollection
+   simMuonGEMCSCPadDigis        GEMPads    GEMCSCPadDigiCollection, "Coincidence" co-pads
+   simMuonRPCDigis              RPCDigis   RPCDigiCollection
+   simMuonCSCDigis              CSCDigis   MuonCSCWireDigi, MuonCSCComparatorDigi
+   simCscTriggerPrimitiveDigis  CSCStubs   ALCTs, CLCTs, LCTs and MPCSORTED LCTs
+
+ See GEMCode/SimMuL1/python/SyntheticMuonEvents_cff.py.
+*/
+
+#include "FWCore/Framework/interface/Frameworkfwd.h"
+#include "FWCore/Framework/interface/EDProducer.h"
+#include "FWCore/Framework/interface/MakerMacros.h"
+#include "FWCore/Framework/interface/Event.h"
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
+#include "FWCore/Utilities/interface/Exception.h"
+
+#include "GEMCode/SimMuL1/interface/SyntheticMuonEvent.h"
+
+#include <memory>
+#include <set>
+#include <string>
+
+using namespace std;
+
+
+class SyntheticMuonEventProducer : public edm::EDProducer
+{
+public:
+
+  explicit SyntheticMuonEventProducer(const edm::ParameterSet&);
+
+  ~SyntheticMuonEventProducer() {}
+
+private:
+
+  virtual void produce(edm::Event&, const edm::EventSetup&);
+
+  bool has(const string& product) const { return products_.count(product) > 0; }
+
+  template <typename T>
+  void put(edm::Event& ev, std::unique_ptr<T>& product, const string& instance = "")
+  {
+    std::auto_ptr<T> p(product.release());
+    ev.put(p, instance);
+  }
+
+  mugeo::SyntheticMuonEventGenerator generator_;
+  set<string> products_;
+};
+
+
+SyntheticMuonEventProducer::SyntheticMuonEventProducer(const edm::ParameterSet& ps)
+: generator_(ps)
+{
+  const set<string> known{"SimHits", "GEMDigis", "GEMPads", "RPCDigis", "CSCDigis", "CSCStubs"};
+  for (auto& p: ps.getParameter<vector<string> >("products")) {
+    if (known.count(p) == 0)
+      throw cms::Exception("Configuration") << "SyntheticMuonEventProducer: unknown product group " << p;
+    products_.insert(p);
+  }
+
+  if (has("SimHits")) {
+    produces<edm::SimTrackContainer>();
+    produces<edm::SimVertexContainer>();
+    produces<edm::PSimHitContainer>("MuonCSCHits");
+    produces<edm::PSimHitContainer>("MuonGEMHits");
+    produces<edm::PSimHitContainer>("MuonRPCHits");
+  }
+  if (has("GEMDigis")) produces<GEMDigiCollection>();
+  if (has("GEMPads")) {
+    produces<GEMCSCPadDigiCollection>();
+    produces<GEMCSCPadDigiCollection>("Coincidence");
+  }
+  if (has("RPCDigis")) produces<RPCDigiCollection>();
+  if (has("CSCDigis")) {
+    produces<CSCWireDigiCollection>("MuonCSCWireDigi");
+    produces<CSCComparatorDigiCollection>("MuonCSCComparatorDigi");
+  }
+  if (has("CSCStubs")) {
+    produces<CSCALCTDigiCollection>();
+    produces<CSCCLCTDigiCollection>();
+    produces<CSCCorrelatedLCTDigiCollection>();
+    produces<CSCCorrelatedLCTDigiCollection>("MPCSORTED");
+  }
+}
+
+
+void SyntheticMuonEventProducer::produce(edm::Event& ev, const edm::EventSetup& es)
+{
+  mugeo::SyntheticMuonEvent sev;
+  generator_.generate(generator_.eventSeed(ev.id().run(), ev.id().event()), sev);
+
+  if (has("SimHits")) {
+    put(ev, sev.simTracks);
+    put(ev, sev.simVertices);
+    put(ev, sev.cscSimHits, "MuonCSCHits");
+    put(ev, sev.gemSimHits, "MuonGEMHits");
+    put(ev, sev.rpcSimHits, "MuonRPCHits");
+  }
+  if (has("GEMDigis")) put(ev, sev.gemDigis);
+  if (has("GEMPads")) {
+    put(ev, sev.gemPads);
+    put(ev, sev.gemCoPads, "Coincidence");
+  }
+  if (has("RPCDigis")) put(ev, sev.rpcDigis);
+  if (has("CSCDigis")) {
+    put(ev, sev.cscWireDigis, "MuonCSCWireDigi");
+    put(ev, sev.cscComparatorDigis, "MuonCSCComparatorDigi");
+  }
+  if (has("CSCStubs")) {
+    put(ev, sev.alcts);
+    put(ev, sev.clcts);
+    put(ev, sev.lcts);
+    put(ev, sev.mplcts, "MPCSORTED");
+  }
+}
+
+
+//define this as a plug-in
+DEFINE_FWK_MODULE(SyntheticMuonEventProducer);
@@ -6,6 +6,11 @@ GEMCSCTriggerEfficiency = cms.EDAnalyzer("GEMCSCTriggerEfficiency",
     doME1a = cms.untracked.bool(True),
     defaultME1a = cms.untracked.bool(False),
     gangedME1a = cms.untracked.bool(False),
+    ## directory of the MuGeometryCache files; empty: the tables are only shared within the job
+    geometryCacheDir = cms.untracked.string(""),
+    ## geometry the tables are kept for in geometryCacheDir (e.g. the name of the geometry cff);
+    ## empty: they are not kept
+    geometryVersion = cms.untracked.string(""),
     ## BX windows - about central BX=6                                     
     minBxALCT = cms.untracked.int32(5),
     maxBxALCT = cms.untracked.int32(7),
@@ -13,5 +13,8 @@ SimpleMuon = cms.EDAnalyzer('SimpleMuon',
     debugTFCAND   = cms.untracked.int32(0),
     debugGMTCAND  = cms.untracked.int32(0),
     debugL1EXTRA  = cms.untracked.int32(0),
+    # write the nested (per-track) collections as flat values + offsets arrays,
+    # see SimMuL1/interface/FlatNtupleReader.h
+    flatNtuple = cms.untracked.bool(False),
     strips = cms.PSet()                 
 )    
@@ -0,0 +1,35 @@
+import FWCore.ParameterSet.Config as cms
+
+SyntheticMuonEventProducer = cms.EDProducer("SyntheticMuonEventProducer",
+    verbose = cms.untracked.int32(0),
+    ## product groups put by this instance:
+    ## SimHits, GEMDigis, GEMPads, RPCDigis, CSCDigis, CSCStubs
+    products = cms.vstring(),
+    ## all the instances of a job need the same settings below to see the same event
+    seed = cms.uint32(1234567),
+    ## muon gun: flat in pt, |eta| and phi, both endcaps; charge 0 is random
+    nMuons = cms.int32(2),
+    minPt = cms.double(2.),
+    maxPt = cms.double(50.),
+    minEta = cms.double(1.55),
+    maxEta = cms.double(2.45),
+    charge = cms.int32(0),
+    ## uniform field (T), no bending beyond fieldEndZ (cm)
+    magneticField = cms.double(3.8),
+    fieldEndZ = cms.double(650.),
+    ## background multiplicities scale with the pileup; 0 turns off the background
+    pileup = cms.double(0.),
+    ## mean background hits per chamber layer at pileup 1, per CSC chamber type (index 0 unused):
+    ##                                    ME1/a  ME1/b  ME1/2  ME1/3  ME2/1  ME2/2  ME3/1  ME3/2  ME4/1  ME4/2
+    cscBackgroundHitsPerLayer = cms.vdouble(0., 0.004, 0.004, 0.002, 0.001, 0.003, 0.001, 0.002, 0.001, 0.002, 0.001),
+    gemBackgroundHitsPerLayer = cms.double(0.01),
+    rpcBackgroundHitsPerLayer = cms.double(0.003),
+    ## mean random background stubs per chamber at pileup 1
+    cscBackgroundStubsPerChamber = cms.vdouble(0., 0.0005, 0.0005, 0.0002, 0.0001, 0.0003, 0.0001, 0.0002, 0.0001, 0.0002, 0.0001),
+    ## BX range of the background, relative to the muons
+    backgroundMinBX = cms.int32(-2),
+    backgroundMaxBX = cms.int32(2),
+    ## hit to digi efficiency, and the number of CSC layers needed for a stub
+    digiEfficiency = cms.double(0.97),
+    minLayersForStub = cms.int32(4),
+)
@@ -0,0 +1,32 @@
+import FWCore.ParameterSet.Config as cms
+
+## Synthetic muon system events under the module labels of the full simulation,
+## for running the matchers and the trigger rate code without GEN-SIM-DIGI files.
+## Each module regenerates the same event and puts its own products.
+
+from GEMCode.SimMuL1.SyntheticMuonEventProducer_cfi import SyntheticMuonEventProducer
+
+g4SimHits = SyntheticMuonEventProducer.clone(products = cms.vstring("SimHits"))
+simMuonGEMDigis = SyntheticMuonEventProducer.clone(products = cms.vstring("GEMDigis"))
+simMuonGEMCSCPadDigis = SyntheticMuonEventProducer.clone(products = cms.vstring("GEMPads"))
+simMuonRPCDigis = SyntheticMuonEventProducer.clone(products = cms.vstring("RPCDigis"))
+simMuonCSCDigis = SyntheticMuonEventProducer.clone(products = cms.vstring("CSCDigis"))
+simCscTriggerPrimitiveDigis = SyntheticMuonEventProducer.clone(products = cms.vstring("CSCStubs"))
+
+syntheticMuonEvents = cms.Sequence(
+    g4SimHits +
+    simMuonGEMDigis +
+    simMuonGEMCSCPadDigis +
+    simMuonRPCDigis +
+    simMuonCSCDigis +
+    simCscTriggerPrimitiveDigis
+)
+
+syntheticMuonEventModules = ['g4SimHits', 'simMuonGEMDigis', 'simMuonGEMCSCPadDigis',
+                             'simMuonRPCDigis', 'simMuonCSCDigis', 'simCscTriggerPrimitiveDigis']
+
+def setSyntheticMuonEventParameter(process, name, value):
+    """same setting for all the synthetic event modules of a process"""
+    for m in syntheticMuonEventModules:
+        setattr(getattr(process, m), name, value)
+    return process
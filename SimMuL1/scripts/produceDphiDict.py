@@ -5,7 +5,7 @@
 from cuts import *
 
 ## run quiet mode
-import sys
+import sys, os
 sys.argv.append( '-b' )
 
 from ROOT import *
@@ -173,6 +173,35 @@ def produceDphiDict(filesDir, outFileName):
     outfile.close()
 
 
+def produceDphiDictCompiled(filesDir, outFileName, headerFileName):
+    """Get the libary of dPhi values with exact quantiles, one pass per tree (see produceDphiDict.C)"""
+
+    gROOT.ProcessLine(".L %s+"%(os.path.join(os.path.dirname(os.path.abspath(__file__)), "produceDphiDict.C")))
+
+    stationStrings = {'ME1b' : 'GE11-9-10', 'ME21' : 'GE21L', 'ME31' : 'RE31', 'ME41' : 'RE41' }
+    parities = {'odd' : 0, 'even' : 1}
+
+    builder = DphiDictBuilder()
+    for station in stations:
+        builder.addStation(station, (station is 'ME1b') or (station is 'ME21'))
+        partitions = eta_partitions[stationStrings[station]]
+        for m in sorted(partitions.keys()):
+            for parity in parities:
+                builder.addPartition(station, m, parities[parity],
+                                     partitions[m][parity]['min'], partitions[m][parity]['max'])
+    for n in range(len(pt)):
+        builder.addPtSample(pt[n], "%sgem-csc_stub_ana_%s.root"%(filesDir,pt[n]))
+    for f in fr:
+        builder.addFraction(f)
+
+    if not builder.run():
+        sys.exit('Failed to read the input trees.')
+    builder.writePython(outFileName)
+    builder.writeHeader(headerFileName)
+
+    print "dPhi library written to:", outFileName, "and", headerFileName
+
+
 if __name__ == "__main__":
     
     stations = ['ME1b', 'ME21', 'ME31', 'ME41']
@@ -180,5 +209,7 @@ if __name__ == "__main__":
     pt = ["Pt3","Pt5","Pt7","Pt10","Pt15","Pt20","Pt30","Pt40"]
     fr = [95,98,99]
     
-    produceDphiDict("/uscms/home/dildick/nobackup/work/cscTriggerUpgradeGEMRPC/CMSSW_6_2_0_SLHC12/src/", "GEMCSCdPhiDict.py")
+    ## histogram-based version, kept for comparison
+    ## produceDphiDict("/uscms/home/dildick/nobackup/work/cscTriggerUpgradeGEMRPC/CMSSW_6_2_0_SLHC12/src/", "GEMCSCdPhiDict.py")
+    produceDphiDictCompiled("/uscms/home/dildick/nobackup/work/cscTriggerUpgradeGEMRPC/CMSSW_6_2_0_SLHC12/src/", "GEMCSCdPhiDict.py", "GEMCSCdPhiLUT.h")
     
@@ -0,0 +1,79 @@
+#include "GEMCode/SimMuL1/interface/DenseHistograms.h"
+
+#include "CommonTools/UtilAlgos/interface/TFileDirectory.h"
+
+#include "TH1D.h"
+#include "TH2D.h"
+
+#include <algorithm>
+
+
+// ================================================================================================
+DenseHistograms::H1
+DenseHistograms::book1D(const std::string& name, const std::string& title, int nx, double xmin, double xmax)
+{
+  return H1(book(name, title, Axis(nx, xmin, xmax), Axis(), false));
+}
+
+
+DenseHistograms::H2
+DenseHistograms::book2D(const std::string& name, const std::string& title, int nx, double xmin, double xmax,
+                        int ny, double ymin, double ymax)
+{
+  return H2(book(name, title, Axis(nx, xmin, xmax), Axis(ny, ymin, ymax), true));
+}
+
+
+unsigned int
+DenseHistograms::book(const std::string& name, const std::string& title, const Axis& x, const Axis& y, bool is2D)
+{
+  Spec s;
+  s.name = name;
+  s.title = title;
+  s.x = x;
+  s.y = y;
+  s.is2D = is2D;
+  s.offset = arena_.size();
+  s.ncells = (x.n + 2)*(is2D ? y.n + 2 : 1);
+  s.entries = 0.;
+  for (double& st: s.stats) st = 0.;
+  s.weighted = false;
+
+  arena_.resize(arena_.size() + 2*s.ncells, 0.);
+  specs_.push_back(s);
+  return specs_.size() - 1;
+}
+
+
+// ================================================================================================
+void DenseHistograms::flush(Buffer& buffer)
+{
+  for (const Buffer::Entry& e: buffer.entries_) fillCell(e.index, e.x, e.y, e.w);
+  buffer.clear();
+}
+
+
+// ================================================================================================
+void DenseHistograms::materialize(TFileDirectory& dir) const
+{
+  for (const Spec& s: specs_)
+  {
+    TH1* h;
+    if (s.is2D) h = dir.make<TH2D>(s.name.c_str(), s.title.c_str(), s.x.n, s.x.min, s.x.max, s.y.n, s.y.min, s.y.max);
+    else        h = dir.make<TH1D>(s.name.c_str(), s.title.c_str(), s.x.n, s.x.min, s.x.max);
+
+    // the errors are sqrt(content) unless some fill had a weight
+    const bool sumw2 = s.weighted or TH1::GetDefaultSumw2();
+    if (sumw2 and h->GetSumw2N() == 0) h->Sumw2();
+
+    for (size_t cell = 0; cell < s.ncells; ++cell)
+    {
+      h->SetBinContent(cell, arena_[s.offset + cell]);
+      if (sumw2) h->GetSumw2()->AddAt(arena_[s.offset + s.ncells + cell], cell);
+    }
+    double stats[7];
+    std::copy(s.stats, s.stats + 7, stats);
+    h->PutStats(stats);
+    h->SetEntries(s.entries);
+  }
+}
@@ -47,10 +47,17 @@ MatchCSCMuL1::MatchCSCMuL1(const SimTrack  *s, const SimVertex *v, const CSCGeom
     void 
 MatchCSCMuL1::addSimHit(PSimHit & h)
 {
+    const unsigned i = simHits.size();
+    const int chamberId = CSCDetId( h.detUnitId() ).chamberId().rawId();
     simHits.push_back(h);
-    hitsMapLayer[h.detUnitId()].push_back(h);
-    CSCDetId layerId( h.detUnitId() );
-    hitsMapChamber[layerId.chamberId().rawId()].push_back(h);
+    allHits.push_back(i);
+    hitsMapLayer[h.detUnitId()].push_back(i);
+    hitsMapChamber[chamberId].push_back(i);
+    if (abs(h.particleType())==13) {
+        muHits.push_back(i);
+        muHitsMapLayer[h.detUnitId()].push_back(i);
+        muHitsMapChamber[chamberId].push_back(i);
+    }
 }
 
 
@@ -124,10 +131,7 @@ MatchCSCMuL1::deltaRSmart(double to_eta, double to_phi)
     int 
 MatchCSCMuL1::nSimHits()
 {
-    if (!muOnly) return simHits.size();
-    int n=0;
-    for (unsigned j=0; j<simHits.size(); j++) if (abs(simHits[j].particleType())==13 ) n++;
-    return n;
+    return muOnly ? muHits.size() : simHits.size();
 }
 
 
@@ -140,9 +144,9 @@ MatchCSCMuL1::nSimHits()
 MatchCSCMuL1::detsWithHits()
 {
     std::set<int> dets;
-    std::map<int, std::vector<PSimHit> >::const_iterator mapItr = hitsMapLayer.begin();
+    std::map<int, std::vector<unsigned> >::const_iterator mapItr = hitsMapLayer.begin();
     for( ; mapItr != hitsMapLayer.end(); ++mapItr) 
-        if ( !muOnly || abs((mapItr->second)[0].particleType())==13 ) 
+        if ( !muOnly || abs(simHits[(mapItr->second)[0]].particleType())==13 ) 
             dets.insert(mapItr->first);
     return std::vector<int>(dets.begin(), dets.end()); 
 }
@@ -226,15 +230,15 @@ MatchCSCMuL1::chambersWithHits(int station, int ring, unsigned minNHits)
     std::set<int> chambers;
     std::set<int> layersWithHits;
 
-    std::map<int, std::vector<PSimHit> >::const_iterator mapItr = hitsMapChamber.begin();
+    std::map<int, std::vector<unsigned> >::const_iterator mapItr = hitsMapChamber.begin();
     for( ; mapItr != hitsMapChamber.end(); ++mapItr){
         CSCDetId cid(mapItr->first);
         if (station && cid.station() != station) continue;
         if (ring && cid.ring() != ring) continue;
         layersWithHits.clear();
         for (unsigned i=0; i<(mapItr->second).size(); i++)
-            if ( !muOnly || abs((mapItr->second)[i].particleType())==13 ) {
-                CSCDetId hid((mapItr->second)[i].detUnitId());
+            if ( !muOnly || abs(simHits[(mapItr->second)[i]].particleType())==13 ) {
+                CSCDetId hid(simHits[(mapItr->second)[i]].detUnitId());
                 layersWithHits.insert(hid.layer());
             }
         if (layersWithHits.size()>=minNHits) chambers.insert( mapItr->first );
@@ -256,16 +260,13 @@ MatchCSCMuL1::chambersWithHits(int station, int ring, unsigned minNHits)
  * Return the simhits for a particular detId
  * INFO: this function is in use
  */
-    std::vector<PSimHit>
+    MatchCSCMuL1::SimHitView
 MatchCSCMuL1::layerHits(int detId)
 {
-    std::vector<PSimHit> result;
-    std::map<int, std::vector<PSimHit> >::const_iterator mapItr = hitsMapLayer.find(detId);
-    if (mapItr == hitsMapLayer.end()) return result;
-    for (unsigned i=0; i<(mapItr->second).size(); i++)
-        if ( !muOnly || abs((mapItr->second)[i].particleType())==13 ) 
-            result.push_back((mapItr->second)[i]);
-    return result;
+    const std::map<int, std::vector<unsigned> >& hitsMap = muOnly ? muHitsMapLayer : hitsMapLayer;
+    std::map<int, std::vector<unsigned> >::const_iterator mapItr = hitsMap.find(detId);
+    if (mapItr == hitsMap.end()) return SimHitView();
+    return SimHitView(&simHits, &(mapItr->second));
 }
 
 
@@ -273,21 +274,17 @@ MatchCSCMuL1::layerHits(int detId)
 /*
  * Return the simhits for a particular detId
  */
-    std::vector<PSimHit>
+    MatchCSCMuL1::SimHitView
 MatchCSCMuL1::chamberHits(int detId)
 {
     // foolproof chamber id
     CSCDetId dId(detId);
     CSCDetId chamberId = dId.chamberId();
 
-    std::vector<PSimHit> result;
-    std::map<int, std::vector<PSimHit> >::const_iterator mapItr = hitsMapChamber.find(chamberId);
-    if (mapItr == hitsMapChamber.end()) return result;
-    for (unsigned i=0; i<(mapItr->second).size(); i++)
-        if ( !muOnly || abs((mapItr->second)[i].particleType())==13 ) 
-            result.push_back((mapItr->second)[i]);
-
-    return result;
+    const std::map<int, std::vector<unsigned> >& hitsMap = muOnly ? muHitsMapChamber : hitsMapChamber;
+    std::map<int, std::vector<unsigned> >::const_iterator mapItr = hitsMap.find(chamberId);
+    if (mapItr == hitsMap.end()) return SimHitView();
+    return SimHitView(&simHits, &(mapItr->second));
 }
 
 
@@ -296,15 +293,10 @@ MatchCSCMuL1::chamberHits(int detId)
  * Return all simhits in the event
  * Option to return only muon simhits
  */
-    std::vector<PSimHit> 
+    MatchCSCMuL1::SimHitView
 MatchCSCMuL1::allSimHits()
 {
-    if (!muOnly) return simHits;
-    std::vector<PSimHit> result;
-    for (unsigned j=0; j<simHits.size(); j++) 
-        if (abs(simHits[j].particleType())==13 ) 
-            result.push_back(simHits[j]);
-    return result;
+    return SimHitView(&simHits, muOnly ? &muHits : &allHits);
 }
 
 
@@ -322,7 +314,7 @@ MatchCSCMuL1::numberOfLayersWithHitsInChamber(int detId)
 {
     std::set<int> layersWithHits;
 
-    std::vector<PSimHit> chHits = chamberHits(detId);
+    SimHitView chHits = chamberHits(detId);
     for (unsigned i = 0; i < chHits.size(); i++) 
     {
         CSCDetId hid(chHits[i].detUnitId());
@@ -339,7 +331,7 @@ MatchCSCMuL1::wireGroupAndStripInChamber( int detId )
 {
     std::pair<int,int> err_pair(-99,-99);
 
-    std::vector<PSimHit> hits = chamberHits( detId );
+    SimHitView hits = chamberHits( detId );
     unsigned n = hits.size();
     if ( n == 0 ) return err_pair;
 
@@ -872,11 +864,11 @@ MatchCSCMuL1::print (const char msg[300], bool psimtr, bool psimh,
 
         //self check 
         unsigned ntot=0;
-        std::map<int, std::vector<PSimHit> >::const_iterator mapItr = hitsMapChamber.begin();
+        std::map<int, std::vector<unsigned> >::const_iterator mapItr = hitsMapChamber.begin();
         for (; mapItr != hitsMapChamber.end(); mapItr++) 
         {
             unsigned nltot=0;
-            std::map<int, std::vector<PSimHit> >::const_iterator lmapItr = hitsMapLayer.begin();
+            std::map<int, std::vector<unsigned> >::const_iterator lmapItr = hitsMapLayer.begin();
             for (; lmapItr != hitsMapLayer.end(); lmapItr++) 
             {
                 CSCDetId lId(lmapItr->first);
@@ -895,7 +887,7 @@ MatchCSCMuL1::print (const char msg[300], bool psimtr, bool psimh,
             CSCDetId chid(chIds[ch]);
             std::pair<int,int> ws = wireGroupAndStripInChamber(chIds[ch]);
             std::cout<<"  chamber "<<chIds[ch]<<"   "<<chid<<"    #layers with hits = "<<numberOfLayersWithHitsInChamber(chIds[ch])<<"  w="<<ws.first<<"  s="<<ws.second<<std::endl;
-            std::vector<PSimHit> chHits;
+            SimHitView chHits;
             if(DETAILED_HIT_LAYERS) chHits = chamberHits(chIds[ch]);
             for (unsigned i = 0; i < chHits.size(); i++) 
             {
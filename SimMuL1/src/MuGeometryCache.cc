@@ -0,0 +1,330 @@
+#include "GEMCode/SimMuL1/interface/MuGeometryCache.h"
+
+#include "Geometry/CSCGeometry/interface/CSCGeometry.h"
+#include "Geometry/GEMGeometry/interface/GEMGeometry.h"
+#include "Geometry/RPCGeometry/interface/RPCGeometry.h"
+#include "Geometry/DTGeometry/interface/DTGeometry.h"
+#include "Geometry/Records/interface/MuonGeometryRecord.h"
+#include "FWCore/Framework/interface/IOVSyncValue.h"
+#include "FWCore/Framework/interface/ValidityInterval.h"
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace mugeo;
+
+namespace {
+
+// bump when the content or the layout of the tables changes
+const uint32_t CACHE_VERSION = 2;
+const char CACHE_MAGIC[8] = {'M','U','G','E','O','C','H','E'};
+
+// values per LUT entry: rawId + Rmin, Rmax, PhiMin, PhiMax, Zmin, Zmax
+const unsigned int LUT_ENTRY_SIZE = 7;
+
+struct CacheHeader
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t valueSize;
+  uint64_t key;
+  uint64_t n;
+};
+
+// FNV-1a
+struct Hasher
+{
+  uint64_t h = 14695981039346656037ULL;
+
+  void add(uint64_t v)
+  {
+    for (int i = 0; i < 8; ++i) {
+      h ^= (v >> (8*i)) & 0xff;
+      h *= 1099511628211ULL;
+    }
+  }
+  void add(const std::string& s)
+  {
+    add(static_cast<uint64_t>(s.size()));
+    for (unsigned char c: s) {
+      h ^= c;
+      h *= 1099511628211ULL;
+    }
+  }
+};
+
+// flat layout of the areas: the fixed size arrays, then every GEM partition vector preceded by its size
+void areasToBlob(const MuGeometryAreas& a, std::vector<float>& blob)
+{
+  blob.insert(blob.end(), a.csc_total_areas_cm2, a.csc_total_areas_cm2 + CSC_TYPES+1);
+  blob.insert(blob.end(), a.gem_total_areas_cm2, a.gem_total_areas_cm2 + GEM_TYPES+1);
+  blob.insert(blob.end(), a.dt_total_areas_cm2, a.dt_total_areas_cm2 + DT_TYPES+1);
+  blob.insert(blob.end(), a.rpcb_total_areas_cm2, a.rpcb_total_areas_cm2 + RPCB_TYPES+1);
+  blob.insert(blob.end(), a.rpcf_total_areas_cm2, a.rpcf_total_areas_cm2 + RPCF_TYPES+1);
+  const std::vector<float>* parts[3] = {a.gem_total_part_areas_cm2, a.gem_part_radius, a.gem_part_halfheight};
+  for (auto p: parts) {
+    for (int t = 0; t <= GEM_TYPES; ++t) {
+      blob.push_back(p[t].size());
+      blob.insert(blob.end(), p[t].begin(), p[t].end());
+    }
+  }
+}
+
+bool blobToAreas(const std::vector<float>& blob, MuGeometryAreas& a)
+{
+  const unsigned int nfixed = CSC_TYPES + GEM_TYPES + DT_TYPES + RPCB_TYPES + RPCF_TYPES + 5;
+  if (blob.size() < nfixed) return false;
+  auto b = blob.begin();
+  std::copy(b, b + CSC_TYPES+1, a.csc_total_areas_cm2); b += CSC_TYPES+1;
+  std::copy(b, b + GEM_TYPES+1, a.gem_total_areas_cm2); b += GEM_TYPES+1;
+  std::copy(b, b + DT_TYPES+1, a.dt_total_areas_cm2); b += DT_TYPES+1;
+  std::copy(b, b + RPCB_TYPES+1, a.rpcb_total_areas_cm2); b += RPCB_TYPES+1;
+  std::copy(b, b + RPCF_TYPES+1, a.rpcf_total_areas_cm2); b += RPCF_TYPES+1;
+  std::vector<float>* parts[3] = {a.gem_total_part_areas_cm2, a.gem_part_radius, a.gem_part_halfheight};
+  for (auto p: parts) {
+    for (int t = 0; t <= GEM_TYPES; ++t) {
+      if (b == blob.end()) return false;
+      const unsigned int n = *b++;
+      if (static_cast<unsigned int>(blob.end() - b) < n) return false;
+      p[t].assign(b, b + n);
+      b += n;
+    }
+  }
+  return b == blob.end();
+}
+
+void lutToBlob(const fidLUT& lut, std::vector<double>& blob)
+{
+  blob.reserve(lut.size()*LUT_ENTRY_SIZE);
+  for (auto& e: lut) {
+    blob.push_back(e.first);
+    blob.insert(blob.end(), e.second.begin(), e.second.end());
+    blob.resize(blob.size() + LUT_ENTRY_SIZE - 1 - e.second.size(), 0.);
+  }
+}
+
+bool blobToLUT(const std::vector<double>& blob, fidLUT& lut)
+{
+  if (blob.size() % LUT_ENTRY_SIZE) return false;
+  for (auto b = blob.begin(); b != blob.end(); b += LUT_ENTRY_SIZE)
+    lut[static_cast<uint32_t>(*b)].assign(b + 1, b + LUT_ENTRY_SIZE);
+  return true;
+}
+
+// tables already built in this job, shared by all the modules
+std::mutex registryMutex;
+std::map<std::string, std::shared_ptr<const MuGeometryAreas> > areasRegistry;
+std::map<std::string, std::shared_ptr<const fidLUT> > lutRegistry;
+
+std::string registryKey(const std::string& table, uint64_t key)
+{
+  std::ostringstream s;
+  s << table << "_" << std::hex << key;
+  return s.str();
+}
+
+} // local namespace
+
+
+// ================================================================================================
+uint64_t MuGeometryCache::key(const MuonGeometryRecord& record) const
+{
+  if (record.cacheIdentifier() == cacheId_) return key_;
+  cacheId_ = record.cacheIdentifier();
+
+  Hasher hs;
+  hs.add(static_cast<uint64_t>(CACHE_VERSION));
+  if (geometryVersion_.empty()) {
+    // the record only identifies the geometry within the job
+    hs.add(std::string("job"));
+    hs.add(static_cast<uint64_t>(cacheId_));
+  }
+  else {
+    hs.add(geometryVersion_);
+    hs.add(static_cast<uint64_t>(record.validityInterval().first().eventID().run()));
+  }
+  key_ = hs.h;
+  return key_;
+}
+
+
+// ================================================================================================
+std::shared_ptr<const MuGeometryAreas>
+MuGeometryCache::areas(const MuonGeometryRecord& record,
+                       const CSCGeometry* csc, const GEMGeometry* gem, const RPCGeometry* rpc, const DTGeometry* dt) const
+{
+  // the areas of the skipped detectors are zero, so they are part of the key
+  Hasher hs;
+  hs.add(this->key(record));
+  hs.add(static_cast<uint64_t>((csc != 0) | (gem != 0) << 1 | (rpc != 0) << 2 | (dt != 0) << 3));
+  const uint64_t key = hs.h;
+  const std::string rkey(registryKey("areas", key));
+
+  std::lock_guard<std::mutex> lock(registryMutex);
+  auto it = areasRegistry.find(rkey);
+  if (it != areasRegistry.end()) return it->second;
+
+  // value-initialized, so the areas of the skipped detectors are zero
+  std::shared_ptr<MuGeometryAreas> a(new MuGeometryAreas());
+  std::vector<float> blob;
+  if (read("areas", key, blob) and blobToAreas(blob, *a)) {
+    edm::LogInfo("MuGeometryCache") << "areas read from " << path("areas", key);
+  }
+  else {
+    a.reset(new MuGeometryAreas());
+    if (csc) a->calculateCSCDetectorAreas(csc);
+    if (gem) a->calculateGEMDetectorAreas(gem);
+    if (rpc) a->calculateRPCDetectorAreas(rpc);
+    if (dt) a->calculateDTDetectorAreas(dt);
+    blob.clear();
+    areasToBlob(*a, blob);
+    write("areas", key, blob);
+  }
+  areasRegistry[rkey] = a;
+  return a;
+}
+
+
+// ================================================================================================
+std::shared_ptr<const fidLUT> MuGeometryCache::gemLUT(const MuonGeometryRecord& record, const GEMGeometry* g) const
+{
+  if (g == 0) return std::shared_ptr<const fidLUT>();
+  const uint64_t key = this->key(record);
+  const std::string rkey(registryKey("gemLUT", key));
+
+  std::lock_guard<std::mutex> lock(registryMutex);
+  auto it = lutRegistry.find(rkey);
+  if (it != lutRegistry.end()) return it->second;
+
+  std::shared_ptr<const fidLUT> lut;
+  std::vector<double> blob;
+  std::shared_ptr<fidLUT> fromFile(new fidLUT());
+  if (read("gemLUT", key, blob) and blobToLUT(blob, *fromFile)) {
+    edm::LogInfo("MuGeometryCache") << "gemLUT read from " << path("gemLUT", key);
+    lut = fromFile;
+  }
+  else {
+    MuFiducial fid;
+    fid.setGEMGeometry(g);
+    fid.buildGEMLUT();
+    lut = fid.getGEMLUT();
+    blob.clear();
+    lutToBlob(*lut, blob);
+    write("gemLUT", key, blob);
+  }
+  lutRegistry[rkey] = lut;
+  return lut;
+}
+
+
+std::shared_ptr<const fidLUT> MuGeometryCache::cscLUT(const MuonGeometryRecord& record, const CSCGeometry* g) const
+{
+  if (g == 0) return std::shared_ptr<const fidLUT>();
+  const uint64_t key = this->key(record);
+  const std::string rkey(registryKey("cscLUT", key));
+
+  std::lock_guard<std::mutex> lock(registryMutex);
+  auto it = lutRegistry.find(rkey);
+  if (it != lutRegistry.end()) return it->second;
+
+  std::shared_ptr<const fidLUT> lut;
+  std::vector<double> blob;
+  std::shared_ptr<fidLUT> fromFile(new fidLUT());
+  if (read("cscLUT", key, blob) and blobToLUT(blob, *fromFile)) {
+    edm::LogInfo("MuGeometryCache") << "cscLUT read from " << path("cscLUT", key);
+    lut = fromFile;
+  }
+  else {
+    MuFiducial fid;
+    fid.setCSCGeometry(g);
+    fid.buildCSCLUT();
+    lut = fid.getCSCLUT();
+    blob.clear();
+    lutToBlob(*lut, blob);
+    write("cscLUT", key, blob);
+  }
+  lutRegistry[rkey] = lut;
+  return lut;
+}
+
+
+// ================================================================================================
+std::string MuGeometryCache::path(const std::string& table, uint64_t key) const
+{
+  std::ostringstream s;
+  s << dir_ << "/mugeo_" << table << "_" << std::hex << key << ".bin";
+  return s.str();
+}
+
+
+template <class T>
+bool MuGeometryCache::read(const std::string& table, uint64_t key, std::vector<T>& values) const
+{
+  if (!persistent()) return false;
+  const std::string file(path(table, key));
+  const int fd = ::open(file.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+
+  bool ok = false;
+  struct stat st;
+  if (::fstat(fd, &st) == 0 and static_cast<size_t>(st.st_size) >= sizeof(CacheHeader)) {
+    void* m = ::mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (m != MAP_FAILED) {
+      const CacheHeader* h = static_cast<const CacheHeader*>(m);
+      ok = std::memcmp(h->magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) == 0 and
+        h->version == CACHE_VERSION and h->valueSize == sizeof(T) and h->key == key and
+        static_cast<uint64_t>(st.st_size) == sizeof(CacheHeader) + h->n*sizeof(T);
+      if (ok) {
+        const T* begin = reinterpret_cast<const T*>(static_cast<const char*>(m) + sizeof(CacheHeader));
+        values.assign(begin, begin + h->n);
+      }
+      ::munmap(m, st.st_size);
+    }
+  }
+  ::close(fd);
+  if (!ok) edm::LogInfo("MuGeometryCache") << "ignoring invalid cache file " << file;
+  return ok;
+}
+
+
+template <class T>
+void MuGeometryCache::write(const std::string& table, uint64_t key, const std::vector<T>& values) const
+{
+  if (!persistent()) return;
+  ::mkdir(dir_.c_str(), 0755);
+
+  const std::string file(path(table, key));
+  std::ostringstream tmp;
+  tmp << file << ".tmp" << ::getpid();
+
+  CacheHeader h;
+  std::memcpy(h.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+  h.version = CACHE_VERSION;
+  h.valueSize = sizeof(T);
+  h.key = key;
+  h.n = values.size();
+
+  FILE* f = std::fopen(tmp.str().c_str(), "wb");
+  bool ok = f != 0;
+  if (ok) {
+    ok = std::fwrite(&h, sizeof(h), 1, f) == 1;
+    if (ok and !values.empty()) ok = std::fwrite(&values[0], sizeof(T), values.size(), f) == values.size();
+    ok = (std::fclose(f) == 0) and ok;
+  }
+  if (ok) ok = std::rename(tmp.str().c_str(), file.c_str()) == 0;
+  if (!ok) {
+    std::remove(tmp.str().c_str());
+    edm::LogInfo("MuGeometryCache") << "cannot write " << file << ", the tables are only shared within the job";
+  }
+  else edm::LogInfo("MuGeometryCache") << table << " written to " << file;
+}
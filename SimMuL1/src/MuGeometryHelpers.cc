@@ -206,6 +206,7 @@ void mugeo::MuGeometryAreas::calculateRPCDetectorAreas(const RPCGeometry* g)
 // ================================================================================================
 void mugeo::MuFiducial::buildGEMLUT()
 {
+  std::shared_ptr<fidLUT> lut(new fidLUT());
   auto etaPartitions = gemGeometry->etaPartitions();
   for(auto roll: etaPartitions)
   {
@@ -276,13 +277,15 @@ void mugeo::MuFiducial::buildGEMLUT()
     values.push_back(0.);
     values.push_back(0.);
     
-    gemLUT_[rId.rawId()] = values;
+    (*lut)[rId.rawId()] = values;
   }
+  gemLUT_ = lut;
 }
 
 // ================================================================================================
 void mugeo::MuFiducial::buildCSCLUT()
 {
+  std::shared_ptr<fidLUT> lut(new fidLUT());
   auto chambers = cscGeometry->chambers();
   for(auto ch: chambers)
   {    
@@ -333,19 +336,21 @@ void mugeo::MuFiducial::buildCSCLUT()
     values.push_back(0.);
     values.push_back(0.);
     
-    cscLUT_[rId.rawId()] = values;
+    (*lut)[rId.rawId()] = values;
   }
+  cscLUT_ = lut;
 }
 
 std::set<uint32_t> mugeo::MuFiducial::gemDetIds(math::XYZVectorD p)
 {
   std::set<uint32_t> result;
+  if (!gemLUT_) return result;
   const double r(p.Rho());
   double phi(p.Phi()*180./TMath::Pi()); //.degrees()
   if (phi < 0) phi += 360.;
   //  std::cout << "r " << r << " phi " << phi << " z " << p.z() << std::endl;
   
-  for (auto it=gemLUT_.begin(); it!=gemLUT_.end(); ++it){
+  for (auto it=gemLUT_->begin(); it!=gemLUT_->end(); ++it){
     // check if R and phi are withing limits
     // z match
     if (p.z()*(GEMDetId(it->first).region())<0) continue;
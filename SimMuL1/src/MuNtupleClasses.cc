@@ -6,6 +6,10 @@
 #include "Geometry/RPCGeometry/interface/RPCGeometry.h"
 #include "Geometry/DTGeometry/interface/DTGeometry.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
 using std::cout;
 using std::endl;
 using namespace mugeo;
@@ -598,3 +602,162 @@ MyDTSimHit::init(PSimHit &sh, const DTGeometry* dt_g, const ParticleDataTable *
   //w = csclayer->geometry()->wireGroup(csclayer->geometry()->nearestWire(hitLP));
   //s = csclayer->geometry()->nearestStrip(hitLP);
 }
+
+
+// ================================================================================================
+std::vector<std::vector<MyCSCSimHit> > clusterCSCSimHits(std::vector<MyCSCSimHit> &hits, bool verbose)
+{
+  /* Does recursive clustering:
+      - sort by WG,Strip,TOF
+      - take first hit
+      - cluster the other hits around it by requiring dWG<2 && dS<4 && dTOF<2ns
+      - recursively call itself over the hits that didn't get into the cluster
+  */
+  using namespace std;
+
+  vector< vector<MyCSCSimHit> > result;
+  vector<MyCSCSimHit> cluster;
+  size_t N = hits.size();
+  if (verbose) cout<<" clusterCSC: #hits="<<N<<endl;
+  if (N==0) {if (verbose) cout<<"  DONE 0???"<<endl;  return result;}
+
+  sort(hits.begin(), hits.end());
+  MyCSCSimHit sh1 = hits[0];
+  if (verbose) cout<<"    hit  1: t="<<sh1.t<<" w="<<sh1.w<<" s="<<sh1.s<<endl;
+  cluster.push_back(sh1);
+  if (N==1)
+  {
+    result.push_back(cluster);
+    if (verbose) cout<<"  DONE"<<endl;
+    return result;
+  }
+
+  vector<MyCSCSimHit> not_clustered;
+  for (size_t i=1; i<N; i++)
+  {
+    MyCSCSimHit shi = hits[i];
+    if (verbose) cout<<"    hit  "<<i<<": t="<<shi.t<<" w="<<shi.w<<" s="<<shi.s<<"   ";
+    if ( fabs(sh1.t - shi.t) > 2 || abs(sh1.w - shi.w) > 1 || abs(sh1.s - shi.s) > 3 ) {
+      not_clustered.push_back(shi);
+      if (verbose) cout<<"NO"<<endl;
+    }
+    else {cluster.push_back(shi); if (verbose) cout<<"ok"<<endl;}
+  }
+  result.push_back(cluster);
+  if (verbose) cout<<"     made cluster of size "<<cluster.size()<<endl;
+
+  if (not_clustered.size())
+  {
+    if (verbose) cout<<"   recursing..."<<endl;
+    vector< vector<MyCSCSimHit> > result_recursive = clusterCSCSimHits(not_clustered, verbose);
+    result.insert(result.end(), result_recursive.begin(), result_recursive.end());
+  }
+  if (verbose) cout<<"   returning "<<result.size()<<" clusters"<<endl;
+  return result;
+}
+
+
+
+// ================================================================================================
+std::vector<std::vector<MyGEMSimHit> > clusterGEMSimHits(std::vector<MyGEMSimHit> &hits, bool verbose)
+{
+  /* Does recursive clustering:
+      - sort by Strip,TOF
+      - take first hit
+      - cluster the other hits around it by requiring dS<4 && dTOF<4ns
+      - recursively call itself over the hits that didn't get into the cluster
+  */
+  using namespace std;
+
+  vector< vector<MyGEMSimHit> > result;
+  vector<MyGEMSimHit> cluster;
+  size_t N = hits.size();
+  if (verbose) cout<<" clusterGEM: #hits="<<N<<endl;
+  if (N==0) {if (verbose) cout<<"  DONE 0???"<<endl;  return result;}
+
+  sort(hits.begin(), hits.end());
+  MyGEMSimHit sh1 = hits[0];
+  if (verbose) cout<<"    hit  1: t="<<sh1.t<<" s="<<sh1.s<<endl;
+  cluster.push_back(sh1);
+  if (N==1)
+  {
+    result.push_back(cluster);
+    if (verbose) cout<<"  DONE"<<endl;
+    return result;
+  }
+
+  vector<MyGEMSimHit> not_clustered;
+  for (size_t i=1; i<N; i++)
+  {
+    MyGEMSimHit &shi = hits[i];
+    if (verbose) cout<<"    hit  "<<i<<": t="<<shi.t<<" s="<<shi.s<<"   ";
+    if ( fabs(sh1.t - shi.t) > 4. || abs(sh1.s - shi.s) > 3 ) {
+      not_clustered.push_back(shi);
+      if (verbose) cout<<"NO"<<endl;
+    }
+    else {cluster.push_back(shi); if (verbose) cout<<"ok"<<endl;}
+  }
+  result.push_back(cluster);
+  if (verbose) cout<<"     made cluster of size "<<cluster.size()<<endl;
+
+  if (not_clustered.size())
+  {
+    if (verbose) cout<<"   recursing..."<<endl;
+    vector< vector<MyGEMSimHit> > result_recursive = clusterGEMSimHits(not_clustered, verbose);
+    result.insert(result.end(), result_recursive.begin(), result_recursive.end());
+  }
+  if (verbose) cout<<"   returning "<<result.size()<<" clusters"<<endl;
+  return result;
+}
+
+// ================================================================================================
+std::vector<std::vector<MyRPCSimHit> > clusterRPCSimHits(std::vector<MyRPCSimHit> &hits, bool verbose)
+{
+  /* Does recursive clustering:
+      - sort by Strip,TOF
+      - take first hit
+      - cluster the other hits around it by requiring dS<3 && dTOF<2ns
+      - recursively call itself over the hits that didn't get into the cluster
+  */
+  using namespace std;
+
+  vector< vector<MyRPCSimHit> > result;
+  vector<MyRPCSimHit> cluster;
+  size_t N = hits.size();
+  if (verbose) cout<<" clusterRPC: #hits="<<N<<endl;
+  if (N==0) {if (verbose) cout<<"  DONE 0???"<<endl;  return result;}
+
+  sort(hits.begin(), hits.end());
+  MyRPCSimHit sh1 = hits[0];
+  if (verbose) cout<<"    hit  1: t="<<sh1.t<<" s="<<sh1.s<<endl;
+  cluster.push_back(sh1);
+  if (N==1)
+  {
+    result.push_back(cluster);
+    if (verbose) cout<<"  DONE"<<endl;
+    return result;
+  }
+
+  vector<MyRPCSimHit> not_clustered;
+  for (size_t i=1; i<N; i++)
+  {
+    MyRPCSimHit shi = hits[i];
+    if (verbose) cout<<"    hit  "<<i<<": t="<<shi.t<<" s="<<shi.s<<"   ";
+    if ( fabs(sh1.t - shi.t) > 2 || abs(sh1.s - shi.s) > 2 ) {
+      not_clustered.push_back(shi);
+      if (verbose) cout<<"NO"<<endl;
+    }
+    else {cluster.push_back(shi); if (verbose) cout<<"ok"<<endl;}
+  }
+  result.push_back(cluster);
+  if (verbose) cout<<"     made cluster of size "<<cluster.size()<<endl;
+
+  if (not_clustered.size())
+  {
+    if (verbose) cout<<"   recursing..."<<endl;
+    vector< vector<MyRPCSimHit> > result_recursive = clusterRPCSimHits(not_clustered, verbose);
+    result.insert(result.end(), result_recursive.begin(), result_recursive.end());
+  }
+  if (verbose) cout<<"   returning "<<result.size()<<" clusters"<<endl;
+  return result;
+}
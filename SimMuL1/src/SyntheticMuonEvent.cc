@@ -0,0 +1,587 @@
+#include "GEMCode/SimMuL1/interface/SyntheticMuonEvent.h"
+#include "GEMCode/SimMuL1/interface/MuGeometryHelpers.h"
+
+#include "FWCore/Utilities/interface/Exception.h"
+#include "DataFormats/Math/interface/normalizedPhi.h"
+#include "DataFormats/MuonDetId/interface/CSCTriggerNumbering.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <set>
+#include <tuple>
+
+using namespace std;
+using namespace mugeo;
+
+namespace {
+
+// CSC chamber types: station, ring (ME1/a is ring 4 in the simhits and digis)
+const int csc_station[CSC_TYPES+1] = {0, 1, 1, 1, 1, 2, 2, 3, 3, 4, 4};
+const int csc_ring[CSC_TYPES+1]    = {0, 4, 1, 2, 3, 1, 2, 1, 2, 1, 2};
+// approximate |z| of the middle of the CSC chambers, cm
+const float csc_z[CSC_TYPES+1] = {0., 603., 603., 697., 697., 830., 830., 935., 935., 1025., 1025.};
+const float csc_layer_dz = 2.54;
+const float csc_gap = 0.95;
+// strips and wiregroups of the CSC chamber types; the 48 ME1/a strips are ganged in 16 channels
+const int csc_strips[CSC_TYPES+1] = {0, 48, 64, 80, 64, 80, 80, 80, 80, 80, 80};
+const int csc_wgs[CSC_TYPES+1]    = {0, 48, 48, 64, 32, 112, 64, 96, 64, 96, 64};
+const int me1a_type = 1;
+const int me1a_channels = 16;
+const int me1a_first_hs = 128;
+// time bin of an in-time hit in the CSC digis, and BX of an in-time CSC stub
+const int csc_tbin = 6;
+const int csc_stub_bx = 6;
+
+// GE1/1 chambers: centre and half-height in r, |z| of the first layer
+const float gem_radius = 195.;
+const float gem_halfheight = 65.;
+const float gem_z = 567.;
+const float gem_layer_dz = 2.1;
+const float gem_gap = 0.3;
+const int gem_rolls = 8;
+const int gem_strips = 384;
+const int gem_strips_per_pad = 2;
+
+// endcap RPC rings 2 and 3 of the four stations; |z| of the stations
+const float rpc_z[MAX_RPCF_STATIONS+1] = {0., 715., 800., 965., 1050.};
+const float rpc_gap = 0.2;
+const int rpc_chambers = 36;
+const int rpc_rolls = 3;
+const int rpc_strips = 32;
+
+// background hits get track ids above the ones of the muons
+const unsigned int background_track_id = 100000;
+// speed of light, cm/ns
+const float c_light = 29.98;
+const double muon_mass = 0.10566;
+
+
+// centre and half-height in r of an endcap RPC ring: RE1/2 and RE1/3 sit on
+// ME1/2 and ME1/3, rings 2 and 3 of the other stations share the outer CSC ring
+void rpcRing(int station, int ring, float& radius, float& halfheight)
+{
+  // CSC chamber type: ME1/2, ME1/3 for station 1, else the outer ring ME2/2, ME3/2, ME4/2
+  const int t(station == 1 ? ring + 1 : 2*station + 2);
+  if (station < 1 or station > 4 or t < 1 or t > CSC_TYPES)
+    throw cms::Exception("LogicError") << "SyntheticMuonEventGenerator: no CSC ring for RPC station "
+                                       << station << " ring " << ring;
+  if (station == 1) {
+    radius = MuGeometryAreas::csc_ch_radius[t];
+    halfheight = MuGeometryAreas::csc_ch_halfheight[t];
+    return;
+  }
+  halfheight = 0.5*MuGeometryAreas::csc_ch_halfheight[t];
+  radius = MuGeometryAreas::csc_ch_radius[t] + (ring == 2 ? -halfheight : halfheight);
+}
+
+
+// Chamber of a ring of nChambers chambers hit at (r, phi); chamber 1 is centred
+// at phi=0. Returns the fractional position across (u) and along (v) the chamber
+// and the local position. False when the point is outside the ring.
+bool locate(float r, float phi, float radius, float halfheight, int nChambers,
+            int& chamber, float& u, float& v, float& x, float& y)
+{
+  const float dphi(2.*M_PI/nChambers);
+  const float phi0(phi < 0. ? phi + 2.*M_PI : phi);
+  const int c(int(std::floor(phi0/dphi + 0.5)) % nChambers);
+  const float lphi(normalizedPhi(phi0 - c*dphi));
+  x = r*std::sin(lphi);
+  y = r*std::cos(lphi) - radius;
+  if (std::abs(y) >= halfheight) return false;
+  chamber = c + 1;
+  u = std::min(std::max(lphi/dphi + 0.5f, 0.f), 0.9999f);
+  v = std::min(std::max(0.5f*y/halfheight + 0.5f, 0.f), 0.9999f);
+  return true;
+}
+
+
+// local position of a point at fractional position (u, v) of a chamber
+void place(float u, float v, float radius, float halfheight, int nChambers, float& x, float& y)
+{
+  y = (2.*v - 1.)*halfheight;
+  x = (radius + y)*std::tan(2.*M_PI/nChambers*(u - 0.5));
+}
+
+
+// roll of a fractional position along the chamber, and local y in the roll;
+// GEM rolls are numbered from the top of the chamber, RPC rolls from the bottom
+int roll(float v, int nRolls, float halfheight, bool fromTop, float& y)
+{
+  const int i(std::min(int(v*nRolls), nRolls - 1));
+  y = (v*nRolls - i - 0.5)*2.*halfheight/nRolls;
+  return fromTop ? nRolls - i : i + 1;
+}
+
+
+// CSC chamber the stubs of a layer go to: ME1/a stubs are in the ME1/1 chamber
+CSCDetId stubChamber(const CSCDetId& id)
+{
+  return CSCDetId(id.endcap(), id.station(), id.ring() == 4 ? 1 : id.ring(), id.chamber(), 0);
+}
+
+
+// key half-strip of a stub, from the half-strip in the layer
+int stubHalfStrip(int type, int hs)
+{
+  if (type == me1a_type) return me1a_first_hs + hs % (2*me1a_channels);
+  return hs;
+}
+
+
+struct Stub
+{
+  int keyWG, keyHS, pattern, bend, quality, alctQuality, clctQuality, bx;
+};
+
+}
+
+
+mugeo::SyntheticMuonEvent::SyntheticMuonEvent()
+: simTracks(new edm::SimTrackContainer)
+, simVertices(new edm::SimVertexContainer)
+, cscSimHits(new edm::PSimHitContainer)
+, gemSimHits(new edm::PSimHitContainer)
+, rpcSimHits(new edm::PSimHitContainer)
+, gemDigis(new GEMDigiCollection)
+, gemPads(new GEMCSCPadDigiCollection)
+, gemCoPads(new GEMCSCPadDigiCollection)
+, rpcDigis(new RPCDigiCollection)
+, cscWireDigis(new CSCWireDigiCollection)
+, cscComparatorDigis(new CSCComparatorDigiCollection)
+, alcts(new CSCALCTDigiCollection)
+, clcts(new CSCCLCTDigiCollection)
+, lcts(new CSCCorrelatedLCTDigiCollection)
+, mplcts(new CSCCorrelatedLCTDigiCollection)
+{}
+
+
+mugeo::SyntheticMuonEventGenerator::SyntheticMuonEventGenerator(const edm::ParameterSet& ps)
+: seed_(ps.getParameter<unsigned int>("seed"))
+, nMuons_(ps.getParameter<int>("nMuons"))
+, minPt_(ps.getParameter<double>("minPt"))
+, maxPt_(ps.getParameter<double>("maxPt"))
+, minEta_(ps.getParameter<double>("minEta"))
+, maxEta_(ps.getParameter<double>("maxEta"))
+, charge_(ps.getParameter<int>("charge"))
+, magneticField_(ps.getParameter<double>("magneticField"))
+, fieldEndZ_(ps.getParameter<double>("fieldEndZ"))
+, pileup_(ps.getParameter<double>("pileup"))
+, cscBackgroundHitsPerLayer_(ps.getParameter<std::vector<double> >("cscBackgroundHitsPerLayer"))
+, gemBackgroundHitsPerLayer_(ps.getParameter<double>("gemBackgroundHitsPerLayer"))
+, rpcBackgroundHitsPerLayer_(ps.getParameter<double>("rpcBackgroundHitsPerLayer"))
+, cscBackgroundStubsPerChamber_(ps.getParameter<std::vector<double> >("cscBackgroundStubsPerChamber"))
+, backgroundMinBX_(ps.getParameter<int>("backgroundMinBX"))
+, backgroundMaxBX_(ps.getParameter<int>("backgroundMaxBX"))
+, digiEfficiency_(ps.getParameter<double>("digiEfficiency"))
+, minLayersForStub_(ps.getParameter<int>("minLayersForStub"))
+, verbose_(ps.getUntrackedParameter<int>("verbose", 0))
+{
+  if (cscBackgroundHitsPerLayer_.size() != CSC_TYPES + 1 or cscBackgroundStubsPerChamber_.size() != CSC_TYPES + 1)
+    throw cms::Exception("Configuration")
+      << "SyntheticMuonEventGenerator: cscBackgroundHitsPerLayer and cscBackgroundStubsPerChamber need "
+      << CSC_TYPES + 1 << " entries, one per CSC chamber type (the first one is not used)";
+  if (minPt_ <= 0. or maxPt_ < minPt_ or minEta_ < 0. or maxEta_ < minEta_)
+    throw cms::Exception("Configuration") << "SyntheticMuonEventGenerator: bad muon pt or eta range";
+  if (backgroundMaxBX_ < backgroundMinBX_)
+    throw cms::Exception("Configuration") << "SyntheticMuonEventGenerator: backgroundMaxBX < backgroundMinBX";
+}
+
+
+uint64_t
+mugeo::SyntheticMuonEventGenerator::eventSeed(unsigned int run, unsigned long long event) const
+{
+  // splitmix64 of the configured seed, run and event
+  uint64_t z(seed_ + 0x9e3779b97f4a7c15ULL*(1 + (uint64_t(run) << 40 ^ uint64_t(event))));
+  z = (z ^ (z >> 30))*0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27))*0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+
+bool
+mugeo::SyntheticMuonEventGenerator::propagate(const Muon& mu, float absz, float& r, float& phi) const
+{
+  // straight line in r-z; circle in r-phi up to fieldEndZ, no bending after
+  const float tanTheta(1./std::sinh(std::abs(mu.eta)));
+  r = absz*tanTheta;
+  const float rField(std::min(absz, float(fieldEndZ_))*tanTheta);
+  // sine of half the turning angle, r/2R with R = pt/(0.3 B) in m
+  const float s(0.003*magneticField_*rField/(2.*mu.pt));
+  if (s >= 1.) return false;
+  phi = normalizedPhi(mu.phi - mu.charge*std::asin(s));
+  return true;
+}
+
+
+void
+mugeo::SyntheticMuonEventGenerator::generate(uint64_t seed, SyntheticMuonEvent& ev) const
+{
+  Engine engine(seed);
+  std::vector<LayerHit> csc, gem, rpc;
+
+  ev.simVertices->push_back(SimVertex(math::XYZVectorD(0., 0., 0.), 0.));
+  for (int i = 0; i < nMuons_; ++i) generateMuon(engine, i + 1, ev, csc, gem, rpc);
+  generateBackground(engine, csc, gem, rpc);
+
+  fillSimHits(csc, csc_gap, *ev.cscSimHits);
+  fillSimHits(gem, gem_gap, *ev.gemSimHits);
+  fillSimHits(rpc, rpc_gap, *ev.rpcSimHits);
+
+  // the same hits fire the digis and the stubs
+  std::bernoulli_distribution efficient(digiEfficiency_);
+  auto fired = [&](std::vector<LayerHit>& hits)
+  {
+    hits.erase(std::remove_if(hits.begin(), hits.end(), [&](const LayerHit&) { return !efficient(engine); }), hits.end());
+  };
+  fired(csc);
+  fired(gem);
+  fired(rpc);
+
+  digitizeGEM(gem, ev);
+  digitizeRPC(rpc, ev);
+  digitizeCSC(csc, ev);
+  buildStubs(engine, csc, ev);
+
+  if (verbose_) {
+    cout << "SyntheticMuonEventGenerator: seed " << seed << " pileup " << pileup_ << " muons " << nMuons_
+         << " CSC/GEM/RPC simhits " << ev.cscSimHits->size() << "/" << ev.gemSimHits->size()
+         << "/" << ev.rpcSimHits->size() << endl;
+  }
+}
+
+
+void
+mugeo::SyntheticMuonEventGenerator::generateMuon(Engine& engine, unsigned int trackId, SyntheticMuonEvent& ev,
+                                                 std::vector<LayerHit>& csc, std::vector<LayerHit>& gem,
+                                                 std::vector<LayerHit>& rpc) const
+{
+  std::uniform_real_distribution<double> flat(0., 1.);
+  const int zSign(flat(engine) < 0.5 ? 1 : -1);
+  Muon mu;
+  mu.pt = minPt_ + (maxPt_ - minPt_)*flat(engine);
+  mu.eta = zSign*(minEta_ + (maxEta_ - minEta_)*flat(engine));
+  mu.phi = normalizedPhi(2.*M_PI*flat(engine));
+  mu.charge = charge_ != 0 ? (charge_ > 0 ? 1 : -1) : (flat(engine) < 0.5 ? 1 : -1);
+
+  const double p(mu.pt*std::cosh(mu.eta));
+  const math::XYZTLorentzVectorD p4(mu.pt*std::cos(mu.phi), mu.pt*std::sin(mu.phi), mu.pt*std::sinh(mu.eta),
+                                    std::sqrt(p*p + muon_mass*muon_mass));
+  SimTrack trk(-13*mu.charge, p4, 0, trackId - 1);
+  trk.setTrackId(trackId);
+  ev.simTracks->push_back(trk);
+
+  LayerHit h;
+  h.bx = 0;
+  h.trackId = trackId;
+  h.particleType = -13*mu.charge;
+  h.p = p;
+  h.theta = p4.theta();
+  h.phi = mu.phi;
+
+  float r, phi;
+  int chamber;
+
+  for (int t = 1; t <= CSC_TYPES; ++t) {
+    for (int layer = 1; layer <= 6; ++layer) {
+      const float z(csc_z[t] + (layer - 3.5)*csc_layer_dz);
+      if (!propagate(mu, z, r, phi)) continue;
+      h.tof = z/c_light;
+      if (!locate(r, phi, MuGeometryAreas::csc_ch_radius[t], MuGeometryAreas::csc_ch_halfheight[t],
+                  int(csc_radial_segm[t]), chamber, h.u, h.v, h.x, h.y)) continue;
+      h.detId = CSCDetId(zSign > 0 ? 1 : 2, csc_station[t], csc_ring[t], chamber, layer).rawId();
+      h.type = t;
+      csc.push_back(h);
+    }
+  }
+
+  for (int layer = 1; layer <= 2; ++layer) {
+    const float z(gem_z + (layer - 1)*gem_layer_dz);
+    if (!propagate(mu, z, r, phi)) continue;
+    h.tof = z/c_light;
+    if (!locate(r, phi, gem_radius, gem_halfheight, int(gem_radial_segm[1]), chamber, h.u, h.v, h.x, h.y)) continue;
+    const int rl(roll(h.v, gem_rolls, gem_halfheight, true, h.y));
+    h.detId = GEMDetId(zSign, 1, 1, layer, chamber, rl).rawId();
+    h.type = 1;
+    gem.push_back(h);
+  }
+
+  for (int station = 1; station <= MAX_RPCF_STATIONS; ++station) {
+    if (!propagate(mu, rpc_z[station], r, phi)) continue;
+    h.tof = rpc_z[station]/c_light;
+    for (int ring = 2; ring <= 3; ++ring) {
+      float radius, halfheight;
+      rpcRing(station, ring, radius, halfheight);
+      if (!locate(r, phi, radius, halfheight, rpc_chambers, chamber, h.u, h.v, h.x, h.y)) continue;
+      const int rl(roll(h.v, rpc_rolls, halfheight, false, h.y));
+      h.detId = RPCDetId(zSign, ring, station, (chamber - 1)/6 + 1, 1, (chamber - 1)%6 + 1, rl).rawId();
+      h.type = 3*station + ring - 3;
+      rpc.push_back(h);
+    }
+  }
+}
+
+
+void
+mugeo::SyntheticMuonEventGenerator::generateBackground(Engine& engine, std::vector<LayerHit>& csc,
+                                                       std::vector<LayerHit>& gem, std::vector<LayerHit>& rpc) const
+{
+  if (pileup_ <= 0.) return;
+  std::uniform_real_distribution<float> flat(0., 0.9999);
+  std::uniform_int_distribution<int> bx(backgroundMinBX_, backgroundMaxBX_);
+
+  // neutron-induced hits: low energy electrons, uniform in strips and wires
+  LayerHit h;
+  h.trackId = background_track_id;
+  h.particleType = 11;
+  h.p = 0.001;
+  h.theta = 0.;
+  h.phi = 0.;
+  auto next = [&](float z)
+  {
+    h.u = flat(engine);
+    h.v = flat(engine);
+    h.bx = bx(engine);
+    h.tof = z/c_light + 25.*h.bx;
+    ++h.trackId;
+  };
+
+  for (int endcap = 1; endcap <= 2; ++endcap) {
+    for (int t = 1; t <= CSC_TYPES; ++t) {
+      const double mean(pileup_*cscBackgroundHitsPerLayer_[t]);
+      if (mean <= 0.) continue;
+      std::poisson_distribution<int> hits(mean);
+      const int nChambers(csc_radial_segm[t]);
+      for (int chamber = 1; chamber <= nChambers; ++chamber) {
+        for (int layer = 1; layer <= 6; ++layer) {
+          for (int n = hits(engine); n > 0; --n) {
+            next(csc_z[t]);
+            place(h.u, h.v, MuGeometryAreas::csc_ch_radius[t], MuGeometryAreas::csc_ch_halfheight[t], nChambers, h.x, h.y);
+            h.detId = CSCDetId(endcap, csc_station[t], csc_ring[t], chamber, layer).rawId();
+            h.type = t;
+            csc.push_back(h);
+          }
+        }
+      }
+    }
+
+    const int region(endcap == 1 ? 1 : -1);
+    if (gemBackgroundHitsPerLayer_ > 0.) {
+      std::poisson_distribution<int> hits(pileup_*gemBackgroundHitsPerLayer_);
+      const int nChambers(gem_radial_segm[1]);
+      for (int chamber = 1; chamber <= nChambers; ++chamber) {
+        for (int layer = 1; layer <= 2; ++layer) {
+          for (int n = hits(engine); n > 0; --n) {
+            next(gem_z);
+            place(h.u, h.v, gem_radius, gem_halfheight, nChambers, h.x, h.y);
+            const int rl(roll(h.v, gem_rolls, gem_halfheight, true, h.y));
+            h.detId = GEMDetId(region, 1, 1, layer, chamber, rl).rawId();
+            h.type = 1;
+            gem.push_back(h);
+          }
+        }
+      }
+    }
+
+    if (rpcBackgroundHitsPerLayer_ > 0.) {
+      std::poisson_distribution<int> hits(pileup_*rpcBackgroundHitsPerLayer_);
+      for (int station = 1; station <= MAX_RPCF_STATIONS; ++station) {
+        for (int ring = 2; ring <= 3; ++ring) {
+          float radius, halfheight;
+          rpcRing(station, ring, radius, halfheight);
+          for (int chamber = 1; chamber <= rpc_chambers; ++chamber) {
+            for (int n = hits(engine); n > 0; --n) {
+              next(rpc_z[station]);
+              place(h.u, h.v, radius, halfheight, rpc_chambers, h.x, h.y);
+              const int rl(roll(h.v, rpc_rolls, halfheight, false, h.y));
+              h.detId = RPCDetId(region, ring, station, (chamber - 1)/6 + 1, 1, (chamber - 1)%6 + 1, rl).rawId();
+              h.type = 3*station + ring - 3;
+              rpc.push_back(h);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+
+void
+mugeo::SyntheticMuonEventGenerator::fillSimHits(const std::vector<LayerHit>& hits, float thickness,
+                                                edm::PSimHitContainer& out) const
+{
+  out.reserve(hits.size());
+  for (auto& h: hits) {
+    out.push_back(PSimHit(Local3DPoint(h.x, h.y, -0.5*thickness), Local3DPoint(h.x, h.y, 0.5*thickness),
+                          h.p, h.tof, 1.e-6, h.particleType, h.detId, h.trackId, h.theta, h.phi));
+  }
+}
+
+
+void
+mugeo::SyntheticMuonEventGenerator::digitizeGEM(const std::vector<LayerHit>& hits, SyntheticMuonEvent& ev) const
+{
+  // (eta partition, strip or pad, bx), sorted and without duplicates
+  std::set<std::tuple<unsigned int, int, int> > strips, pads, layer2Pads;
+  for (auto& h: hits) {
+    const int strip(int(h.u*gem_strips) + 1);
+    strips.insert(std::make_tuple(h.detId, strip, h.bx));
+    pads.insert(std::make_tuple(h.detId, (strip - 1)/gem_strips_per_pad + 1, h.bx));
+  }
+  for (auto& s: strips) ev.gemDigis->insertDigi(GEMDetId(std::get<0>(s)), GEMDigi(std::get<1>(s), std::get<2>(s)));
+  for (auto& p: pads) {
+    const GEMDetId id(std::get<0>(p));
+    ev.gemPads->insertDigi(id, GEMCSCPadDigi(std::get<1>(p), std::get<2>(p)));
+    if (id.layer() == 2) {
+      const GEMDetId id1(id.region(), id.ring(), id.station(), 1, id.chamber(), id.roll());
+      layer2Pads.insert(std::make_tuple(id1.rawId(), std::get<1>(p), std::get<2>(p)));
+    }
+  }
+
+  // co-pads: a layer 1 pad with a layer 2 pad within one pad, in the same BX; kept in the layer 1 partition
+  for (auto& p: pads) {
+    const GEMDetId id(std::get<0>(p));
+    if (id.layer() != 1) continue;
+    const int pad(std::get<1>(p));
+    for (int dp = -1; dp <= 1; ++dp) {
+      if (layer2Pads.count(std::make_tuple(id.rawId(), pad + dp, std::get<2>(p))) == 0) continue;
+      ev.gemCoPads->insertDigi(id, GEMCSCPadDigi(pad, std::get<2>(p)));
+      break;
+    }
+  }
+}
+
+
+void
+mugeo::SyntheticMuonEventGenerator::digitizeRPC(const std::vector<LayerHit>& hits, SyntheticMuonEvent& ev) const
+{
+  std::set<std::tuple<unsigned int, int, int> > strips;
+  for (auto& h: hits) strips.insert(std::make_tuple(h.detId, int(h.u*rpc_strips) + 1, h.bx));
+  for (auto& s: strips) ev.rpcDigis->insertDigi(RPCDetId(std::get<0>(s)), RPCDigi(std::get<1>(s), std::get<2>(s)));
+}
+
+
+void
+mugeo::SyntheticMuonEventGenerator::digitizeCSC(const std::vector<LayerHit>& hits, SyntheticMuonEvent& ev) const
+{
+  // (layer, wiregroup or strip, time bin) and comparator of the strips
+  std::set<std::tuple<unsigned int, int, int> > wires;
+  std::map<std::tuple<unsigned int, int, int>, int> strips;
+  for (auto& h: hits) {
+    const int tbin(csc_tbin + h.bx);
+    if (tbin < 0 or tbin > 15) continue;
+    wires.insert(std::make_tuple(h.detId, int(h.v*csc_wgs[h.type]) + 1, tbin));
+    const int hs(int(h.u*2*csc_strips[h.type]));
+    int strip(hs/2 + 1);
+    if (h.type == me1a_type) strip = (strip - 1)%me1a_channels + 1;
+    strips.insert(std::make_pair(std::make_tuple(h.detId, strip, tbin), hs%2));
+  }
+  for (auto& w: wires)
+    ev.cscWireDigis->insertDigi(CSCDetId(std::get<0>(w)), CSCWireDigi(std::get<1>(w), 1u << std::get<2>(w)));
+  for (auto& s: strips)
+    ev.cscComparatorDigis->insertDigi(CSCDetId(std::get<0>(s.first)),
+                                      CSCComparatorDigi(std::get<1>(s.first), s.second, 1u << std::get<2>(s.first)));
+}
+
+
+void
+mugeo::SyntheticMuonEventGenerator::buildStubs(Engine& engine, const std::vector<LayerHit>& hits,
+                                               SyntheticMuonEvent& ev) const
+{
+  // muon hits per (stub chamber, track): wiregroup and half-strip in every layer
+  std::map<std::pair<unsigned int, unsigned int>, std::map<int, std::pair<int, int> > > tracks;
+  std::map<std::pair<unsigned int, unsigned int>, int> types;
+  for (auto& h: hits) {
+    if (h.trackId >= background_track_id) continue;
+    const CSCDetId id(h.detId);
+    const auto key(std::make_pair(stubChamber(id).rawId(), h.trackId));
+    tracks[key][id.layer()] = std::make_pair(int(h.v*csc_wgs[h.type]), int(h.u*2*csc_strips[h.type]));
+    types[key] = h.type;
+  }
+
+  std::map<unsigned int, std::vector<Stub> > stubs;
+  for (auto& t: tracks) {
+    const auto& layers(t.second);
+    const int nLayers(layers.size());
+    if (nLayers < minLayersForStub_) continue;
+    double wg(0.), hs(0.);
+    for (auto& l: layers) {
+      wg += l.second.first;
+      hs += l.second.second;
+    }
+    // half-strips per layer between the first and last layers
+    const double slope(layers.size() > 1 ?
+                       double(layers.rbegin()->second.second - layers.begin()->second.second)/
+                       (layers.rbegin()->first - layers.begin()->first) : 0.);
+    Stub s;
+    s.keyWG = int(wg/nLayers + 0.5);
+    s.keyHS = stubHalfStrip(types[t.first], int(hs/nLayers + 0.5));
+    s.bend = slope < 0. ? 0 : 1;
+    const double aslope(std::abs(slope));
+    s.pattern = (aslope < 0.25 ? 10 : aslope < 0.5 ? 8 : aslope < 1. ? 6 : aslope < 1.5 ? 4 : 2) + (aslope < 0.25 ? 0 : s.bend);
+    s.alctQuality = std::min(nLayers - 3, 3);
+    s.clctQuality = nLayers;
+    s.quality = std::min(11 + 2*(nLayers - 4), 15);
+    s.bx = csc_stub_bx;
+    stubs[t.first.first].push_back(s);
+  }
+
+  // random stubs of the background, uniform in key wiregroup and half-strip
+  if (pileup_ > 0.) {
+    std::uniform_real_distribution<float> flat(0., 0.9999);
+    std::uniform_int_distribution<int> bx(csc_stub_bx + backgroundMinBX_, csc_stub_bx + backgroundMaxBX_);
+    for (int endcap = 1; endcap <= 2; ++endcap) {
+      for (int t = 1; t <= CSC_TYPES; ++t) {
+        const double mean(pileup_*cscBackgroundStubsPerChamber_[t]);
+        if (mean <= 0.) continue;
+        std::poisson_distribution<int> nStubs(mean);
+        for (int chamber = 1; chamber <= int(csc_radial_segm[t]); ++chamber) {
+          const CSCDetId id(stubChamber(CSCDetId(endcap, csc_station[t], csc_ring[t], chamber, 0)));
+          for (int n = nStubs(engine); n > 0; --n) {
+            Stub s;
+            s.keyWG = int(flat(engine)*csc_wgs[t]);
+            s.keyHS = stubHalfStrip(t, int(flat(engine)*2*csc_strips[t]));
+            s.bend = flat(engine) < 0.5 ? 0 : 1;
+            s.pattern = 2 + 2*int(flat(engine)*4) + s.bend;
+            s.alctQuality = 1;
+            s.clctQuality = 4;
+            s.quality = 11;
+            s.bx = bx(engine);
+            stubs[id.rawId()].push_back(s);
+          }
+        }
+      }
+    }
+  }
+
+  // two best stubs per chamber; the MPC keeps the three best of a trigger sector and station
+  std::map<std::tuple<int, int, int>, std::vector<std::pair<CSCDetId, CSCCorrelatedLCTDigi> > > sectors;
+  for (auto& c: stubs) {
+    const CSCDetId id(c.first);
+    auto& chamberStubs(c.second);
+    std::stable_sort(chamberStubs.begin(), chamberStubs.end(), [](const Stub& a, const Stub& b)
+                     { return a.quality > b.quality; });
+    if (chamberStubs.size() > 2) chamberStubs.resize(2);
+    for (unsigned int i = 0; i < chamberStubs.size(); ++i) {
+      const Stub& s(chamberStubs[i]);
+      ev.alcts->insertDigi(id, CSCALCTDigi(1, s.alctQuality, 0, 1, s.keyWG, s.bx, i + 1));
+      ev.clcts->insertDigi(id, CSCCLCTDigi(1, s.clctQuality, s.pattern, 1, s.bend, s.keyHS%32, s.keyHS/32, s.bx, i + 1));
+      const CSCCorrelatedLCTDigi lct(i + 1, 1, s.quality, s.keyWG, s.keyHS, s.pattern, s.bend, s.bx);
+      ev.lcts->insertDigi(id, lct);
+      sectors[std::make_tuple(id.endcap(), id.station(), CSCTriggerNumbering::triggerSectorFromLabels(id))]
+        .push_back(std::make_pair(id, lct));
+    }
+  }
+  for (auto& sector: sectors) {
+    auto& sectorStubs(sector.second);
+    std::stable_sort(sectorStubs.begin(), sectorStubs.end(),
+                     [](const std::pair<CSCDetId, CSCCorrelatedLCTDigi>& a, const std::pair<CSCDetId, CSCCorrelatedLCTDigi>& b)
+                     { return a.second.getQuality() > b.second.getQuality(); });
+    if (sectorStubs.size() > 3) sectorStubs.erase(sectorStubs.begin() + 3, sectorStubs.end());
+    for (unsigned int i = 0; i < sectorStubs.size(); ++i) {
+      sectorStubs[i].second.setMPCLink(i + 1);
+      ev.mplcts->insertDigi(sectorStubs[i].first, sectorStubs[i].second);
+    }
+  }
+}
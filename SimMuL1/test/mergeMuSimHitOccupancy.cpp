@@ -0,0 +1,182 @@
+// Merges the outputs of MuSimHitOccupancy jobs run with normalizeInJob = False
+// and converts the summed counts into fluxes and rates once, with the summed
+// number of events. The input files are read in parallel; the SimHit trees
+// are not copied, only the histograms and the MuOccupancyExposure tree.
+//
+//   mergeMuSimHitOccupancy [-o merged.root] [-d directory] [-j nThreads] [--npu 25] [--no-normalize] job_1.root job_2.root ...
+//
+// With --no-normalize the output keeps the raw counts and can be merged again.
+
+#include "GEMCode/SimMuL1/interface/MuOccupancyNormalization.h"
+
+#include "TFile.h"
+#include "TH1.h"
+#include "TKey.h"
+#include "TROOT.h"
+#include "TThread.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace mugeo;
+
+namespace {
+
+// sums of the files read by one thread
+struct PartialSum
+{
+  MuOccupancyExposure exposure;
+  std::vector<std::string> order;
+  std::map<std::string, TH1*> histos;
+  bool ok = true;
+
+  void add(TH1* h)
+  {
+    auto it = histos.find(h->GetName());
+    if (it == histos.end()) {
+      order.push_back(h->GetName());
+      histos[h->GetName()] = h;
+    }
+    else {
+      it->second->Add(h);
+      delete h;
+    }
+  }
+};
+
+// first directory of the file with a MuOccupancyExposure tree
+std::string findDirectory(TFile* f)
+{
+  TIter next(f->GetListOfKeys());
+  while (TKey* key = static_cast<TKey*>(next())) {
+    if (!key->IsFolder()) continue;
+    TDirectory* dir = dynamic_cast<TDirectory*>(key->ReadObj());
+    if (dir and dir->Get("MuOccupancyExposure")) return key->GetName();
+  }
+  return "";
+}
+
+void readFiles(const std::vector<std::string>& files, unsigned int first, unsigned int step,
+               std::string dirName, PartialSum& sum)
+{
+  for (unsigned int i = first; i < files.size(); i += step) {
+    std::unique_ptr<TFile> f(TFile::Open(files[i].c_str()));
+    if (!f or f->IsZombie()) {
+      std::cerr << "cannot open " << files[i] << std::endl;
+      sum.ok = false;
+      return;
+    }
+    if (dirName.empty()) dirName = findDirectory(f.get());
+    TDirectory* dir = f->GetDirectory(dirName.c_str());
+    TTree* tree = dir ? dynamic_cast<TTree*>(dir->Get("MuOccupancyExposure")) : nullptr;
+    if (!tree) {
+      std::cerr << files[i] << ": no MuOccupancyExposure tree in directory '" << dirName << "'" << std::endl;
+      sum.ok = false;
+      return;
+    }
+
+    MuOccupancyExposure row;
+    row.setBranchAddresses(tree);
+    for (Long64_t r = 0; r < tree->GetEntries(); ++r) {
+      tree->GetEntry(r);
+      if (!sum.exposure.add(row)) {
+        std::cerr << files[i] << ": was normalized in the job, or has a different setup or geometry" << std::endl;
+        sum.ok = false;
+        return;
+      }
+    }
+
+    TIter next(dir->GetListOfKeys());
+    while (TKey* key = static_cast<TKey*>(next())) {
+      TClass* cl = TClass::GetClass(key->GetClassName());
+      if (!cl or !cl->InheritsFrom(TH1::Class())) continue;
+      TH1* h = static_cast<TH1*>(key->ReadObj());
+      h->SetDirectory(nullptr);
+      sum.add(h);
+    }
+  }
+}
+
+} // local namespace
+
+
+int main(int argc, char** argv)
+{
+  std::string output = "merged.root";
+  std::string dirName;
+  unsigned int nThreads = std::thread::hardware_concurrency();
+  double npu = -1.;
+  bool normalize = true;
+  std::vector<std::string> files;
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg(argv[i]);
+    if (arg == "-o" and i+1 < argc) output = argv[++i];
+    else if (arg == "-d" and i+1 < argc) dirName = argv[++i];
+    else if (arg == "-j" and i+1 < argc) nThreads = std::atoi(argv[++i]);
+    else if (arg == "--npu" and i+1 < argc) npu = std::atof(argv[++i]);
+    else if (arg == "--no-normalize") normalize = false;
+    else files.push_back(arg);
+  }
+  if (files.empty()) {
+    std::cerr << "usage: " << argv[0]
+              << " [-o merged.root] [-d directory] [-j nThreads] [--npu 25] [--no-normalize] job_1.root ..." << std::endl;
+    return 1;
+  }
+  if (nThreads == 0) nThreads = 1;
+  if (nThreads > files.size()) nThreads = files.size();
+
+  TThread::Initialize();
+  TH1::AddDirectory(kFALSE);
+
+  std::vector<PartialSum> sums(nThreads);
+  std::vector<std::thread> threads;
+  for (unsigned int t = 0; t < nThreads; ++t)
+    threads.emplace_back(readFiles, std::cref(files), t, nThreads, dirName, std::ref(sums[t]));
+  for (auto& t: threads) t.join();
+
+  PartialSum& total = sums[0];
+  for (unsigned int t = 1; t < nThreads; ++t) {
+    total.ok = total.ok and sums[t].ok and total.exposure.add(sums[t].exposure);
+    for (const auto& name: sums[t].order) total.add(sums[t].histos[name]);
+  }
+  if (!total.ok) {
+    std::cerr << "merging failed" << std::endl;
+    return 1;
+  }
+
+  if (dirName.empty()) {
+    std::unique_ptr<TFile> f(TFile::Open(files[0].c_str()));
+    dirName = findDirectory(f.get());
+  }
+
+  std::cout << "merged " << total.exposure.njobs << " jobs from " << files.size() << " files" << std::endl;
+  total.exposure.print();
+
+  TFile out(output.c_str(), "RECREATE");
+  TDirectory* dir = out.mkdir(dirName.c_str());
+  dir->cd();
+  for (const auto& name: total.order) total.histos[name]->SetDirectory(dir);
+
+  if (normalize) {
+    MuOccupancyScale scale(total.exposure.input_is_neutrons);
+    if (npu > 0) scale.n_pu = npu;
+    MuOccupancyNormalizer::normalize(dir, total.exposure, scale);
+    total.exposure.normalized = true;
+  }
+  else MuOccupancyNormalizer::sumw2(dir);
+
+  TTree* tree = new TTree("MuOccupancyExposure", "MuOccupancyExposure");
+  total.exposure.book(tree);
+  tree->Fill();
+
+  out.Write();
+  out.Close();
+  std::cout << "written " << output << std::endl;
+  return 0;
+}
@@ -83,6 +83,9 @@ from L1Trigger.CSCTrackFinder.csctfTrackDigisUngangedME1a_cfi import csctfTrackD
 process.GEMCSCTriggerRateTree = cms.EDAnalyzer("GEMCSCTriggerRateTree",
     simTrackMatching = SimTrackMatching,
     sectorProcessor = csctfTrackDigisUngangedME1a.SectorProcessor,
+    ## run the stub loops on worker threads; the trees are still filled from the module thread
+    parallelFill = cms.untracked.bool(False),
+    fillQueueCapacity = cms.untracked.uint32(4096),
 )
 
 ## output
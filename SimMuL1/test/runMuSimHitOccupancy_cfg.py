@@ -97,6 +97,14 @@ process.TFileService = cms.Service("TFileService",
 
 process.neutronAna = cms.EDAnalyzer("MuSimHitOccupancy",
     inputIsNeutrons = cms.untracked.bool(not isMB),
+    ## set to False for split production: the raw counts are then merged and
+    ## normalized with mergeMuSimHitOccupancy
+    normalizeInJob = cms.untracked.bool(True),
+    ## directory of the MuGeometryCache files; empty: the areas are only shared within the job
+    geometryCacheDir = cms.untracked.string(""),
+    ## geometry the areas are kept for in geometryCacheDir (e.g. the name of the geometry cff);
+    ## empty: they are not kept
+    geometryVersion = cms.untracked.string(""),
     inputTagCSC = cms.untracked.InputTag("g4SimHits","MuonCSCHits"),
     inputTagGEM = cms.untracked.InputTag("g4SimHits","MuonGEMHits"),
     inputTagRPC = cms.untracked.InputTag("g4SimHits","MuonRPCHits"),
@@ -0,0 +1,43 @@
+import FWCore.ParameterSet.Config as cms
+
+## Synthetic muon system events into an EDM file, e.g. for scaling tests
+## with pileup from 1 to 200; no input files nor GlobalTag are needed
+
+## steering
+events = 1000
+pileup = 140.
+nMuons = 2
+seed = 1234567
+outputFile = 'out_synthetic_muon_events_PU%d.root' % pileup
+
+process = cms.Process("SYNTHMU")
+
+process.load("FWCore.MessageService.MessageLogger_cfi")
+process.MessageLogger.cerr.FwkReport.reportEvery = 100
+
+process.maxEvents = cms.untracked.PSet( input = cms.untracked.int32(events) )
+process.options = cms.untracked.PSet( wantSummary = cms.untracked.bool(True) )
+
+process.source = cms.Source("EmptySource")
+
+process.load('GEMCode.SimMuL1.SyntheticMuonEvents_cff')
+from GEMCode.SimMuL1.SyntheticMuonEvents_cff import setSyntheticMuonEventParameter
+setSyntheticMuonEventParameter(process, 'pileup', pileup)
+setSyntheticMuonEventParameter(process, 'nMuons', nMuons)
+setSyntheticMuonEventParameter(process, 'seed', seed)
+#setSyntheticMuonEventParameter(process, 'minPt', 20.)
+#setSyntheticMuonEventParameter(process, 'maxPt', 20.)
+
+process.output = cms.OutputModule("PoolOutputModule",
+    fileName = cms.untracked.string(outputFile),
+    outputCommands = cms.untracked.vstring('drop *', 'keep *_*_*_SYNTHMU')
+)
+
+process.p = cms.Path(process.syntheticMuonEvents)
+process.out_step = cms.EndPath(process.output)
+
+## the events can also be analyzed in the same job, without the output file
+## (the matchers still need the muon geometry in the EventSetup):
+#process.load('GEMCode.GEMValidation.GEMCSCAnalyzer_cfi')
+#process.TFileService = cms.Service("TFileService", fileName = cms.string("gem_csc_synthetic.root"))
+#process.p = cms.Path(process.syntheticMuonEvents + process.GEMCSCAnalyzer)